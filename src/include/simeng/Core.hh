@@ -47,6 +47,19 @@ class Core {
   /** Retrieve a map of statistics to report. */
   virtual std::map<std::string, std::string> getStats() const = 0;
 
+  /** Check whether the core is blocked until an outstanding data memory
+   * request completes. While this holds, ticking the core will not issue any
+   * further data memory requests, so a driver may defer ticking it until the
+   * memory system responds. Cores which cannot determine this never report
+   * being blocked. */
+  virtual bool isWaitingOnMemory() const { return false; }
+
+  /** Set the ID by which the kernel identifies this core. */
+  void setCoreId(uint16_t coreId) { coreId_ = coreId; }
+
+  /** Retrieve the ID by which the kernel identifies this core. */
+  uint16_t getCoreId() const { return coreId_; }
+
   /** Retrieve the simulated nanoseconds elapsed since the core started. */
   uint64_t getSystemTimer() const {
     // TODO: This will need to be changed if we start supporting DVFS.
@@ -115,6 +128,9 @@ class Core {
 
   /** Clock frequency of core in GHz */
   float clockFrequency_ = 0.0f;
+
+  /** The ID by which the kernel identifies this core. */
+  uint16_t coreId_ = 0;
 };
 
 }  // namespace simeng
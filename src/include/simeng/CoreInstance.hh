@@ -36,6 +36,12 @@ class CoreInstance {
   CoreInstance(uint8_t* assembledSource, size_t sourceSize,
                ryml::ConstNodeRef config = config::SimInfo::getConfig());
 
+  /** CoreInstance for an additional core sharing the process, kernel, and
+   * process memory of `primary`. The core registered with the kernel as
+   * `coreId` must have been given a thread to run via
+   * `kernel::Linux::resumeThread()`, from whose state execution begins. */
+  CoreInstance(const CoreInstance& primary, uint16_t coreId);
+
   ~CoreInstance();
 
   /** Set the SimEng L1 instruction cache memory. */
@@ -67,6 +73,9 @@ class CoreInstance {
   /* Getter for heap start. */
   uint64_t getHeapStart() const;
 
+  /** Getter for the kernel shared by all cores running the process. */
+  std::shared_ptr<simeng::kernel::Linux> getKernel() const;
+
  private:
   /** Generate the appropriate simulation objects as parameterised by the
    * configuration.*/
@@ -82,6 +91,10 @@ class CoreInstance {
   /** Construct the process memory from the generated process_ object. */
   void createProcessMemory();
 
+  /** Construct the memory interfaces as parameterised by the configuration,
+   * and the core if neither is externally constructed. */
+  void createMemoryInterfaces();
+
   /** Construct the SimEng L1 instruction cache memory. */
   void createL1InstructionMemory(const memory::MemInterfaceType type);
 
@@ -94,8 +107,12 @@ class CoreInstance {
   /** The config file describing the modelled core to be created. */
   ryml::ConstNodeRef config_;
 
-  /** The SimEng Linux kernel object. */
-  simeng::kernel::Linux kernel_;
+  /** The SimEng Linux kernel object, shared with any additional cores
+   * running the same process. */
+  std::shared_ptr<simeng::kernel::Linux> kernel_;
+
+  /** The ID of the core with the kernel. */
+  uint16_t coreId_ = 0;
 
   /** Reference to source assembled by LLVM. */
   uint8_t* source_ = nullptr;
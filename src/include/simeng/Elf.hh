@@ -46,15 +46,28 @@ struct Elf64_Phdr {
   uint64_t p_memsz;
 };
 
-/** A processed Executable and Linkable Format (ELF) file. */
+/** A processed Executable and Linkable Format (ELF) file. The file is
+ * memory-mapped rather than read, such that its headers are parsed in place
+ * and its loadable segments can be mapped directly into a process image. */
 class Elf {
  public:
-  Elf(std::string path, char** imagePointer);
+  Elf(std::string path);
   ~Elf();
 
+  Elf(const Elf&) = delete;
+  Elf& operator=(const Elf&) = delete;
+
   /** Returns the process image size */
   uint64_t getProcessImageSize() const;
 
+  /** Load the loadable segments into `image`, a zero-filled process image of
+   * at least `getProcessImageSize()` bytes which starts on a host page
+   * boundary. The whole pages of each segment are mapped copy-on-write from
+   * the file, such that they are only read from disk once accessed and are
+   * shared between all processes created from this file until written to;
+   * the remainder of each segment is copied. */
+  void loadSegments(char* image) const;
+
   /** Returns if this ELF is valid */
   bool isValid() const;
 
@@ -72,18 +85,32 @@ class Elf {
   uint64_t getNumPhdr() const;
 
  private:
+  /** Read a `T` from `offset` bytes into the file. Returns false if the file
+   * is too small to hold it. */
+  template <typename T>
+  bool read(uint64_t offset, T& value) const;
+
+  /** The file descriptor of the ELF file, or -1 if it couldn't be opened */
+  int fd_ = -1;
+
+  /** The read-only mapping of the ELF file */
+  const char* file_ = nullptr;
+
+  /** The size of the ELF file in bytes */
+  uint64_t fileSize_ = 0;
+
   /** The entry point of the program */
-  uint64_t entryPoint_;
+  uint64_t entryPoint_ = 0;
 
   /** A vector holding each of the program headers extracted from the ELF */
   std::vector<Elf64_Phdr> pheaders_;
 
   /** The program header entry size stored in the ELF header */
-  uint16_t e_phentsize_;
+  uint16_t e_phentsize_ = 0;
 
   /** The number of entries in the program header table stored in the ELF header
    */
-  uint16_t e_phnum_;
+  uint16_t e_phnum_ = 0;
 
   /** Virtual address of the program header table */
   uint64_t phdrTableAddress_ = 0;
@@ -92,7 +119,7 @@ class Elf {
   bool isValid_ = false;
 
   /** The size of the process image */
-  uint64_t processImageSize_;
+  uint64_t processImageSize_ = 0;
 };
 
 }  // namespace simeng
@@ -1,11 +1,15 @@
 #pragma once
 
+#include <memory>
+#include <string>
 #include <vector>
 
 #include "capstone/capstone.h"
 #include "simeng/BranchPredictor.hh"
+#include "simeng/PortMask.hh"
 #include "simeng/Register.hh"
 #include "simeng/RegisterValue.hh"
+#include "simeng/SmallVector.hh"
 #include "simeng/memory/MemoryInterface.hh"
 #include "simeng/span.hh"
 
@@ -13,6 +17,20 @@ using InstructionException = short;
 
 namespace simeng {
 
+/** The number of memory accesses an instruction holds the addresses and data
+ * of without a heap allocation. Covers scalar, pair, and multi-structure
+ * accesses, as well as gathers and scatters of 64-bit elements at a 512-bit
+ * vector length; wider accesses spill to the heap. */
+constexpr size_t INLINE_MEMORY_ACCESSES = 8;
+
+/** A list of the memory accesses made by an instruction. */
+using MemoryAccessTargets =
+    SmallVector<memory::MemoryAccessTarget, INLINE_MEMORY_ACCESSES>;
+
+/** A list of the data loaded or stored by an instruction, with one entry per
+ * memory access. */
+using MemoryAccessData = SmallVector<RegisterValue, INLINE_MEMORY_ACCESSES>;
+
 /** A struct holding user-defined execution information for an instruction. */
 struct ExecutionInfo {
   /** The latency for the instruction. */
@@ -22,7 +40,7 @@ struct ExecutionInfo {
   uint16_t stallCycles = 1;
 
   /** The ports that support the instruction. */
-  std::vector<uint16_t> ports = {};
+  PortMask ports = 0;
 };
 
 /** An abstract instruction definition.
@@ -102,6 +120,12 @@ class Instruction {
   /** Retrieve the instruction group this instruction belongs to. */
   virtual uint16_t getGroup() const = 0;
 
+  /** Retrieve the ISA-defined opcode of this instruction. */
+  virtual uint32_t getOpcode() const = 0;
+
+  /** Retrieve the assembly text of this instruction, for use in traces. */
+  virtual std::string getDisassembly() const = 0;
+
   /** Check whether all operand values have been supplied, and the instruction
    * is ready to execute. */
   virtual bool canExecute() const = 0;
@@ -110,12 +134,17 @@ class Instruction {
   virtual void execute() = 0;
 
   /** Get this instruction's supported set of ports. */
-  virtual const std::vector<uint16_t>& getSupportedPorts() = 0;
+  virtual PortMask getSupportedPorts() = 0;
 
   /** Set this instruction's execution information including it's execution
    * latency and throughput, and the set of ports which support it. */
   virtual void setExecutionInfo(const ExecutionInfo& info) = 0;
 
+  /** Create a new instance of this instruction, copying its current state. Used
+   * to replay an instruction held in its predecoded state without decoding it
+   * again. */
+  virtual std::shared_ptr<Instruction> clone() const = 0;
+
   /** Set this instruction's sequence ID. */
   void setSequenceId(uint64_t seqId) { sequenceId_ = seqId; }
 
@@ -210,11 +239,45 @@ class Instruction {
   /** Get arbitrary micro-operation index. */
   int getMicroOpIndex() const { return microOpIndex_; }
 
+  /** Record the cycle in which this instruction was fetched. */
+  void setFetchCycle(uint64_t cycle) { fetchCycle_ = cycle; }
+
+  /** Retrieve the cycle in which this instruction was fetched, or 0 if not
+   * recorded. */
+  uint64_t getFetchCycle() const { return fetchCycle_; }
+
+  /** Record the cycle in which this instruction was decoded. */
+  void setDecodeCycle(uint64_t cycle) { decodeCycle_ = cycle; }
+
+  /** Retrieve the cycle in which this instruction was decoded, or 0 if not
+   * recorded. */
+  uint64_t getDecodeCycle() const { return decodeCycle_; }
+
+  /** Record the cycle in which this instruction was renamed. */
+  void setRenameCycle(uint64_t cycle) { renameCycle_ = cycle; }
+
+  /** Retrieve the cycle in which this instruction was renamed, or 0 if not
+   * recorded. */
+  uint64_t getRenameCycle() const { return renameCycle_; }
+
+  /** Record the cycle in which this instruction was issued. */
+  void setIssueCycle(uint64_t cycle) { issueCycle_ = cycle; }
+
+  /** Retrieve the cycle in which this instruction was issued, or 0 if not
+   * recorded. */
+  uint64_t getIssueCycle() const { return issueCycle_; }
+
+  /** Record the cycle in which this instruction completed execution. */
+  void setCompleteCycle(uint64_t cycle) { completeCycle_ = cycle; }
+
+  /** Retrieve the cycle in which this instruction completed execution, or 0
+   * if not recorded. */
+  uint64_t getCompleteCycle() const { return completeCycle_; }
+
  protected:
   /** Set the accessed memory addresses, and create a corresponding memory data
    * vector. */
-  void setMemoryAddresses(
-      const std::vector<memory::MemoryAccessTarget>& addresses) {
+  void setMemoryAddresses(const MemoryAccessTargets& addresses) {
     memoryData_.resize(addresses.size());
     memoryAddresses_ = addresses;
     dataPending_ = addresses.size();
@@ -222,7 +285,7 @@ class Instruction {
 
   /** Set the accessed memory addresses, and create a corresponding memory data
    * vector. */
-  void setMemoryAddresses(std::vector<memory::MemoryAccessTarget>&& addresses) {
+  void setMemoryAddresses(MemoryAccessTargets&& addresses) {
     dataPending_ = addresses.size();
     memoryData_.resize(addresses.size());
     memoryAddresses_ = std::move(addresses);
@@ -264,20 +327,20 @@ class Instruction {
   uint16_t stallCycles_ = 1;
 
   /** The execution ports that this instruction can be issued to. */
-  std::vector<uint16_t> supportedPorts_ = {};
+  PortMask supportedPorts_ = 0;
 
   /** Whether or not this instruction is ready to commit. */
   bool canCommit_ = false;
 
   // Memory
-  /** The memory addresses this instruction accesses, as a vector of {offset,
+  /** The memory addresses this instruction accesses, as a list of {offset,
    * width} pairs. */
-  std::vector<memory::MemoryAccessTarget> memoryAddresses_;
+  MemoryAccessTargets memoryAddresses_;
 
   /** A vector of memory values, that were either loaded memory, or are prepared
    * for sending to memory (according to instruction type). Each entry
    * corresponds to a `memoryAddresses` entry. */
-  std::vector<RegisterValue> memoryData_;
+  MemoryAccessData memoryData_;
 
   /** The number of data items that still need to be supplied. */
   uint8_t dataPending_ = 0;
@@ -321,6 +384,15 @@ class Instruction {
   /** An arbitrary index value for the micro-operation. Its use is based on the
    * implementation of specific micro-operations. */
   int microOpIndex_ = 0;
+
+  // Tracing
+  /** The cycles in which this instruction passed each pipeline stage. Only
+   * recorded whilst a commit trace is being written; 0 if not recorded. */
+  uint64_t fetchCycle_ = 0;
+  uint64_t decodeCycle_ = 0;
+  uint64_t renameCycle_ = 0;
+  uint64_t issueCycle_ = 0;
+  uint64_t completeCycle_ = 0;
 };
 
 }  // namespace simeng
\ No newline at end of file
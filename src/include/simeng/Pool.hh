@@ -156,4 +156,68 @@ class Pool {
   fixedPool_<256, 1024> pool256;
 };
 
+/** A memory pool for blocks which hold a fixed-size header ahead of their
+ * data, such as the reference-counted data of wide register values. Requests
+ * are served from a collection of pools, one per power-of-two data size
+ * between 32 and 512 bytes, whose chunks are sized to fit the header as well
+ * as the data. Unlike `Pool`, the header therefore never pushes a block into
+ * the next size class.
+ *
+ * Allocation requests for data larger than 512 bytes are served from the free
+ * store directly.
+ *
+ * Like `Pool`, a HeaderedPool isn't thread-safe: its free lists are updated
+ * without synchronisation, so a pool must only be used by one thread at a
+ * time. */
+template <size_t header_size>
+class HeaderedPool {
+  static_assert(header_size % alignof(std::max_align_t) == 0 &&
+                "header_size doesn't preserve the alignment of the data");
+
+ public:
+  /** Allocates a block holding the header and `bytes` of data, with alignment
+   * `alignof(std::max_align_t)`. The data starts `header_size` bytes into the
+   * returned block. */
+  void* allocate(uint32_t bytes) {
+    allocations++;
+    if (bytes <= 32) return pool32.allocate();
+    if (bytes <= 64) return pool64.allocate();
+    if (bytes <= 128) return pool128.allocate();
+    if (bytes <= 256) return pool256.allocate();
+    if (bytes <= 512) return pool512.allocate();
+    return ::operator new(header_size + bytes);
+  }
+
+  /** Returns the block at `ptr`, holding `bytes` of data, to the memory pool.
+   * If `ptr` is a nullptr, it is a nop. */
+  void deallocate(void* ptr, uint32_t bytes) noexcept {
+    if (bytes <= 32) {
+      pool32.deallocate(ptr);
+    } else if (bytes <= 64) {
+      pool64.deallocate(ptr);
+    } else if (bytes <= 128) {
+      pool128.deallocate(ptr);
+    } else if (bytes <= 256) {
+      pool256.deallocate(ptr);
+    } else if (bytes <= 512) {
+      pool512.deallocate(ptr);
+    } else {
+      ::operator delete(ptr);
+    }
+  }
+
+  /** Retrieve the number of blocks allocated over the pool's lifetime. */
+  uint64_t getAllocationCount() const { return allocations; }
+
+ private:
+  // No. of blocks allocated, including those since returned.
+  uint64_t allocations = 0;
+
+  fixedPool_<header_size + 32> pool32;
+  fixedPool_<header_size + 128> pool128;
+  fixedPool_<header_size + 512> pool512;
+  fixedPool_<header_size + 64, 1024> pool64;
+  fixedPool_<header_size + 256, 1024> pool256;
+};
+
 }  // namespace simeng
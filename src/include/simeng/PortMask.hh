@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace simeng {
+
+/** A set of execution ports, held as a bitmask in which bit `n` is set if
+ * port `n` is a member. Used in place of a list of port indices so that
+ * port sets may be copied, compared, and intersected in a single operation. */
+using PortMask = uint64_t;
+
+/** The maximum number of ports a core may define; one per bit of `PortMask`.
+ */
+constexpr size_t MAX_PORTS = sizeof(PortMask) * 8;
+
+/** Retrieve the mask containing only `port`. */
+constexpr PortMask portBit(uint16_t port) { return PortMask(1) << port; }
+
+/** Construct a mask from a list of port indices. */
+inline PortMask toPortMask(const std::vector<uint16_t>& ports) {
+  PortMask mask = 0;
+  for (uint16_t port : ports) {
+    assert(port < MAX_PORTS && "Port index exceeds the capacity of PortMask");
+    mask |= portBit(port);
+  }
+  return mask;
+}
+
+/** Retrieve the lowest-indexed port in the non-empty `mask`. */
+inline uint16_t lowestPort(PortMask mask) {
+  assert(mask != 0 && "Attempted to retrieve a port from an empty mask");
+  return static_cast<uint16_t>(__builtin_ctzll(mask));
+}
+
+/** Retrieve the number of ports in `mask`. */
+inline uint16_t portCount(PortMask mask) {
+  return static_cast<uint16_t>(__builtin_popcountll(mask));
+}
+
+/** Call `fn` with the index of each port in `mask`, in ascending order. */
+template <typename F>
+void forEachPort(PortMask mask, F fn) {
+  for (; mask != 0; mask &= mask - 1) fn(lowestPort(mask));
+}
+
+}  // namespace simeng
@@ -10,17 +10,59 @@
 
 namespace simeng {
 
-/** Global memory pool used by RegisterValue class. */
-extern Pool pool;
+/** The number of bytes held ahead of the data of each heap-held RegisterValue,
+ * containing its reference count. */
+constexpr size_t REGISTER_VALUE_HEADER_BYTES = alignof(std::max_align_t);
+
+/** Global memory pool used by RegisterValue class. It isn't thread-safe. */
+extern HeaderedPool<REGISTER_VALUE_HEADER_BYTES> pool;
 
 /** A class that holds an arbitrary region of immutable data, providing casting
  * and data accessor functions. For values smaller than or equal to
  * `MAX_LOCAL_BYTES`, this data is held in a local value, otherwise memory is
- * allocated and the data is stored there. */
+ * allocated and the data is stored there.
+ *
+ * Allocated data is shared between copies of a RegisterValue, and freed once
+ * the last copy is destroyed. The data is preceded in the same pool block by
+ * an intrusive reference count, such that a copy never allocates.
+ *
+ * Neither the reference count nor the global pool is synchronised: the count
+ * isn't atomic, and the pool isn't thread-safe. RegisterValues holding more
+ * than `MAX_LOCAL_BYTES` must therefore only be created, copied and destroyed
+ * by one thread at a time. The SST integration therefore requires a single
+ * SST thread whenever several cores simulate one process. */
 class RegisterValue {
  public:
   RegisterValue();
 
+  RegisterValue(const RegisterValue& other) : bytes(other.bytes) {
+    copyFrom(other);
+  }
+
+  RegisterValue(RegisterValue&& other) noexcept : bytes(other.bytes) {
+    moveFrom(other);
+  }
+
+  RegisterValue& operator=(const RegisterValue& other) {
+    if (this != &other) {
+      release();
+      bytes = other.bytes;
+      copyFrom(other);
+    }
+    return *this;
+  }
+
+  RegisterValue& operator=(RegisterValue&& other) noexcept {
+    if (this != &other) {
+      release();
+      bytes = other.bytes;
+      moveFrom(other);
+    }
+    return *this;
+  }
+
+  ~RegisterValue() { release(); }
+
   /** Create a new RegisterValue from a value of arbitrary type (except
    * pointers), zero-extending the allocated memory space to the specified
    * number of bytes (defaulting to the size of the template type). */
@@ -37,15 +79,11 @@ class RegisterValue {
                                    0);
       }
     } else {
-      void* data = pool.allocate(bytes);
+      char* data = allocate();
       std::memset(data, 0, bytes);
 
       T* view = reinterpret_cast<T*>(data);
       view[0] = value;
-
-      this->ptr = std::shared_ptr<char>(
-          static_cast<char*>(data),
-          [bytes](void* ptr) { pool.deallocate(ptr, bytes); });
     }
   }
 
@@ -59,10 +97,8 @@ class RegisterValue {
     if (isLocal()) {
       dest = this->value;
     } else {
-      dest = static_cast<char*>(pool.allocate(capacity));
+      dest = allocate();
       std::memset(dest, 0, capacity);
-      this->ptr = std::shared_ptr<char>(
-          dest, [capacity](void* ptr) { pool.deallocate(ptr, capacity); });
     }
     assert(dest && "Attempted to dereference a NULL pointer");
     std::memcpy(dest, ptr, bytes);
@@ -98,7 +134,7 @@ class RegisterValue {
     if (isLocal()) {
       return reinterpret_cast<const T*>(value);
     } else {
-      return reinterpret_cast<const T*>(ptr.get());
+      return reinterpret_cast<const T*>(ptr);
     }
   }
 
@@ -117,18 +153,64 @@ class RegisterValue {
   /** Check whether the value is held locally or behind a pointer. */
   constexpr bool isLocal() const { return bytes <= MAX_LOCAL_BYTES; }
 
+  /** Retrieve the reference count held ahead of the allocated data. */
+  uint32_t& refCount() const {
+    return *reinterpret_cast<uint32_t*>(ptr - REGISTER_VALUE_HEADER_BYTES);
+  }
+
+  /** Allocate a pool block for `bytes` of data, with a reference count of 1,
+   * and return a pointer to its data. */
+  char* allocate() {
+    char* block = static_cast<char*>(pool.allocate(bytes));
+    ptr = block + REGISTER_VALUE_HEADER_BYTES;
+    refCount() = 1;
+    return ptr;
+  }
+
+  /** Take a reference to the data held by `other`, which holds the same number
+   * of bytes. */
+  void copyFrom(const RegisterValue& other) {
+    if (isLocal()) {
+      std::memcpy(value, other.value, MAX_LOCAL_BYTES);
+    } else {
+      ptr = other.ptr;
+      refCount()++;
+    }
+  }
+
+  /** Take over the data held by `other`, which holds the same number of bytes,
+   * leaving `other` empty. */
+  void moveFrom(RegisterValue& other) {
+    if (isLocal()) {
+      std::memcpy(value, other.value, MAX_LOCAL_BYTES);
+    } else {
+      ptr = other.ptr;
+      other.bytes = 0;
+    }
+  }
+
+  /** Drop this instance's reference to any allocated data, returning it to the
+   * pool once no references remain. */
+  void release() {
+    if (!isLocal() && --refCount() == 0) {
+      pool.deallocate(ptr - REGISTER_VALUE_HEADER_BYTES, bytes);
+    }
+  }
+
   /** The maximum number of bytes that can be held locally. */
   static constexpr uint16_t MAX_LOCAL_BYTES = 16;
 
   /** The number of bytes held. */
   uint16_t bytes = 0;
 
-  /** The underlying pointer each instance references. */
-  std::shared_ptr<char> ptr;
+  union {
+    /** The underlying pointer to allocated data each instance references. */
+    char* ptr;
 
-  /** The underlying local member value. Aligned to 8 bytes to prevent
-   * potential alignment issue when casting. */
-  alignas(8) char value[MAX_LOCAL_BYTES];
+    /** The underlying local member value. Aligned to 8 bytes to prevent
+     * potential alignment issue when casting. */
+    alignas(8) char value[MAX_LOCAL_BYTES];
+  };
 };
 
 inline bool operator==(const RegisterValue& lhs, const RegisterValue& rhs) {
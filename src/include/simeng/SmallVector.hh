@@ -0,0 +1,215 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace simeng {
+
+/** A vector-like container which holds up to `inline_capacity` elements of
+ * type T within the object itself, only moving its elements to a heap
+ * allocation once that capacity is exceeded. Used where a container is
+ * created or refilled at a high rate but is usually small, such that the
+ * common case never touches the heap.
+ *
+ * Only the subset of the `std::vector` interface used within SimEng is
+ * provided. As with `std::vector`, growing the container invalidates any
+ * pointers to its elements. */
+template <typename T, size_t inline_capacity>
+class SmallVector {
+  static_assert(inline_capacity > 0, "inline_capacity must be non-zero");
+
+ public:
+  using value_type = T;
+  using size_type = size_t;
+  using reference = T&;
+  using const_reference = const T&;
+  using pointer = T*;
+  using const_pointer = const T*;
+  using iterator = T*;
+  using const_iterator = const T*;
+
+  SmallVector() = default;
+
+  SmallVector(std::initializer_list<T> values) {
+    reserve(values.size());
+    for (const auto& value : values) new (data_ + size_++) T(value);
+  }
+
+  SmallVector(const SmallVector& other) {
+    reserve(other.size_);
+    for (const auto& value : other) new (data_ + size_++) T(value);
+  }
+
+  SmallVector(SmallVector&& other) noexcept { moveFrom(other); }
+
+  SmallVector& operator=(const SmallVector& other) {
+    if (this != &other) {
+      clear();
+      reserve(other.size_);
+      for (const auto& value : other) new (data_ + size_++) T(value);
+    }
+    return *this;
+  }
+
+  SmallVector& operator=(SmallVector&& other) noexcept {
+    if (this != &other) {
+      clear();
+      releaseHeap();
+      moveFrom(other);
+    }
+    return *this;
+  }
+
+  SmallVector& operator=(std::initializer_list<T> values) {
+    clear();
+    reserve(values.size());
+    for (const auto& value : values) new (data_ + size_++) T(value);
+    return *this;
+  }
+
+  ~SmallVector() {
+    clear();
+    releaseHeap();
+  }
+
+  /** Append a copy of `value`. */
+  void push_back(const T& value) { emplace_back(value); }
+
+  /** Append `value`. */
+  void push_back(T&& value) { emplace_back(std::move(value)); }
+
+  /** Construct a new element at the end of the container from `args`. */
+  template <typename... Args>
+  T& emplace_back(Args&&... args) {
+    if (size_ == capacity_) {
+      // Construct the element before growing, in case `args` refers to an
+      // existing element
+      T value(std::forward<Args>(args)...);
+      grow(capacity_ * 2);
+      return *new (data_ + size_++) T(std::move(value));
+    }
+    return *new (data_ + size_++) T(std::forward<Args>(args)...);
+  }
+
+  /** Remove the last element. */
+  void pop_back() {
+    assert(size_ > 0 && "pop_back called on an empty SmallVector");
+    data_[--size_].~T();
+  }
+
+  /** Ensure space for at least `capacity` elements without further
+   * reallocation. */
+  void reserve(size_t capacity) {
+    if (capacity > capacity_) grow(capacity);
+  }
+
+  /** Resize the container to hold `size` elements, value-initialising any
+   * elements added. */
+  void resize(size_t size) {
+    reserve(size);
+    while (size_ < size) new (data_ + size_++) T();
+    while (size_ > size) data_[--size_].~T();
+  }
+
+  /** Destroy all elements. Any heap allocation is retained for reuse. */
+  void clear() {
+    while (size_ > 0) data_[--size_].~T();
+  }
+
+  size_t size() const { return size_; }
+  size_t capacity() const { return capacity_; }
+  bool empty() const { return size_ == 0; }
+
+  /** Whether the elements are currently held within the object itself. */
+  bool isInline() const { return data_ == inlineData(); }
+
+  T* data() { return data_; }
+  const T* data() const { return data_; }
+
+  T& operator[](size_t index) {
+    assert(index < size_ && "SmallVector index out of range");
+    return data_[index];
+  }
+  const T& operator[](size_t index) const {
+    assert(index < size_ && "SmallVector index out of range");
+    return data_[index];
+  }
+
+  T& front() { return (*this)[0]; }
+  const T& front() const { return (*this)[0]; }
+  T& back() { return (*this)[size_ - 1]; }
+  const T& back() const { return (*this)[size_ - 1]; }
+
+  iterator begin() { return data_; }
+  const_iterator begin() const { return data_; }
+  iterator end() { return data_ + size_; }
+  const_iterator end() const { return data_ + size_; }
+
+ private:
+  T* inlineData() {
+    return std::launder(reinterpret_cast<T*>(inlineStorage_));
+  }
+  const T* inlineData() const {
+    return std::launder(reinterpret_cast<const T*>(inlineStorage_));
+  }
+
+  /** Move the elements to a heap allocation able to hold `capacity`
+   * elements. */
+  void grow(size_t capacity) {
+    capacity = std::max(capacity, capacity_ * 2);
+    T* newData = static_cast<T*>(::operator new(capacity * sizeof(T)));
+    for (size_t i = 0; i < size_; i++) {
+      new (newData + i) T(std::move(data_[i]));
+      data_[i].~T();
+    }
+    releaseHeap();
+    data_ = newData;
+    capacity_ = capacity;
+  }
+
+  /** Free any heap allocation, returning to the inline storage. Elements must
+   * already have been destroyed. */
+  void releaseHeap() {
+    if (!isInline()) ::operator delete(data_);
+    data_ = inlineData();
+    capacity_ = inline_capacity;
+  }
+
+  /** Take the elements of `other`, which is left empty. A heap allocation is
+   * taken over as-is; inline elements are moved individually. Requires this
+   * container to be empty and inline. */
+  void moveFrom(SmallVector& other) {
+    if (other.isInline()) {
+      for (auto& value : other) new (data_ + size_++) T(std::move(value));
+      other.clear();
+    } else {
+      data_ = other.data_;
+      size_ = other.size_;
+      capacity_ = other.capacity_;
+      other.data_ = other.inlineData();
+      other.size_ = 0;
+      other.capacity_ = inline_capacity;
+    }
+  }
+
+  /** Storage for the first `inline_capacity` elements. */
+  alignas(T) unsigned char inlineStorage_[inline_capacity * sizeof(T)];
+
+  /** The storage currently holding the elements; either `inlineStorage_` or a
+   * heap allocation. */
+  T* data_ = inlineData();
+
+  /** The number of elements held. */
+  size_t size_ = 0;
+
+  /** The number of elements `data_` can hold. */
+  size_t capacity_ = inline_capacity;
+};
+
+}  // namespace simeng
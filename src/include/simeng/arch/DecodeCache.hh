@@ -0,0 +1,98 @@
+#pragma once
+
+#include <capstone/capstone.h>
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace simeng {
+namespace arch {
+
+/** A persistent cache of Capstone disassembly results, keyed by instruction
+ * encoding. The cache is held in a file shared between simulations; it's
+ * memory-mapped when opened and rewritten, including any newly disassembled
+ * encodings, when the cache is destroyed. A cache file is only used if it was
+ * written for the same ISA variant by the same version of SimEng and
+ * Capstone, and is otherwise replaced. */
+class DecodeCache {
+ public:
+  /** Open the cache held in the file at `path`, for the ISA variant described
+   * by `isaKey`. An empty `path` disables the cache. */
+  DecodeCache(const std::string& path, const std::string& isaKey);
+
+  ~DecodeCache();
+
+  /** Check whether the cache is in use. */
+  bool isEnabled() const;
+
+  /** Look up the disassembly of `encoding`. If present, it's written into
+   * `insn` and `detail`, with `insn.detail` pointing at `detail`, `success`
+   * is set to whether Capstone succeeded in disassembling it, and true is
+   * returned. */
+  bool lookup(uint32_t encoding, cs_insn& insn, cs_detail& detail,
+              bool& success) const;
+
+  /** Add the disassembly of `encoding` to the cache. */
+  void insert(uint32_t encoding, const cs_insn& insn, const cs_detail& detail,
+              bool success);
+
+  /** Write the cache, including all inserted encodings, to its file. The file
+   * is replaced atomically, such that simulations sharing it never observe a
+   * partially written cache. */
+  void save() const;
+
+ private:
+  /** The layout of the start of a cache file. */
+  struct header {
+    /** Identifies the file as a decode cache. */
+    char magic[8];
+    /** The version of the file format, SimEng and Capstone, and the ISA
+     * variant, which the cache was written for. */
+    char key[56];
+    /** The size of each entry, in bytes. */
+    uint64_t entrySize;
+    /** The number of entries following the header. */
+    uint64_t entryCount;
+  };
+
+  /** The layout of a single cached disassembly. */
+  struct entry {
+    /** The instruction encoding. */
+    uint32_t encoding;
+    /** Whether Capstone succeeded in disassembling the encoding. */
+    uint32_t success;
+    /** The disassembled instruction. Its `detail` pointer isn't valid. */
+    cs_insn insn;
+    /** The disassembled instruction's details. */
+    cs_detail detail;
+  };
+
+  /** Map the cache file, if it exists and matches `key_`, and index its
+   * entries. */
+  void load();
+
+  /** The path to the cache file. */
+  std::string path_;
+
+  /** The key identifying the cache file contents which may be used. */
+  char key_[sizeof(header::key)] = {};
+
+  /** The memory-mapped cache file, or nullptr if not mapped. */
+  void* mapping_ = nullptr;
+
+  /** The size of the memory-mapped cache file. */
+  size_t mappingSize_ = 0;
+
+  /** A map from each cached encoding to its entry, within either the mapped
+   * file or `inserted_`. */
+  std::unordered_map<uint32_t, const entry*> index_;
+
+  /** The entries inserted since the cache was opened. Entries are allocated
+   * individually, such that pointers held in `index_` remain valid. */
+  std::vector<std::unique_ptr<entry>> inserted_;
+};
+
+}  // namespace arch
+}  // namespace simeng
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace simeng {
+namespace arch {
+
+/** A thread-safe cache of decoding results of type `T`, keyed by instruction
+ * encoding, which may be shared by every architecture instance in a process
+ * such that each unique encoding is only decoded once.
+ *
+ * The cache is read-mostly: once simulations have warmed up, nearly every
+ * access is a hit. Encodings are therefore spread across `shard_count`
+ * independently locked shards, each guarded by a reader-writer lock which
+ * lookups only take in shared mode. Cached values are never removed or moved,
+ * so references to them remain valid for the lifetime of the cache and may
+ * be used without holding any lock. */
+template <typename T, size_t shard_count = 16>
+class SharedDecodeCache {
+ public:
+  /** Find the cached value for `encoding`, or nullptr if it hasn't been
+   * decoded. */
+  const T* find(uint32_t encoding) const {
+    const shard& target = getShard(encoding);
+    std::shared_lock<std::shared_mutex> lock(target.mutex);
+    auto iter = target.values.find(encoding);
+    if (iter == target.values.end()) return nullptr;
+    return iter->second.get();
+  }
+
+  /** Cache `value` as the decoding of `encoding`, and return the cached
+   * value. If another thread cached a value for `encoding` first, `value` is
+   * discarded and the existing value returned instead. */
+  const T& insert(uint32_t encoding, T&& value) {
+    auto newValue = std::make_unique<T>(std::move(value));
+    shard& target = getShard(encoding);
+    std::unique_lock<std::shared_mutex> lock(target.mutex);
+    return *target.values.try_emplace(encoding, std::move(newValue))
+                .first->second;
+  }
+
+  /** Get the number of encodings cached. */
+  size_t size() const {
+    size_t total = 0;
+    for (const auto& target : shards_) {
+      std::shared_lock<std::shared_mutex> lock(target.mutex);
+      total += target.values.size();
+    }
+    return total;
+  }
+
+ private:
+  /** A subset of the cached encodings, and the lock guarding them. */
+  struct shard {
+    /** The lock guarding `values`. */
+    mutable std::shared_mutex mutex;
+    /** The cached values, individually allocated such that their addresses
+     * are stable. */
+    std::unordered_map<uint32_t, std::unique_ptr<T>> values;
+  };
+
+  /** Get the shard holding `encoding`. The encoding is hashed first, as the
+   * low-order bits of instruction encodings are often register fields. */
+  shard& getShard(uint32_t encoding) {
+    return shards_[((encoding * 0x9E3779B1u) >> 16) % shard_count];
+  }
+  const shard& getShard(uint32_t encoding) const {
+    return shards_[((encoding * 0x9E3779B1u) >> 16) % shard_count];
+  }
+
+  /** The shards of the cache. */
+  std::array<shard, shard_count> shards_;
+};
+
+}  // namespace arch
+}  // namespace simeng
@@ -5,6 +5,8 @@
 #include <unordered_map>
 
 #include "simeng/arch/Architecture.hh"
+#include "simeng/arch/DecodeCache.hh"
+#include "simeng/arch/SharedDecodeCache.hh"
 #include "simeng/arch/aarch64/ExceptionHandler.hh"
 #include "simeng/arch/aarch64/MicroDecoder.hh"
 
@@ -80,10 +82,26 @@ class Architecture : public arch::Architecture {
   mutable std::unordered_map<uint32_t, Instruction> decodeCache_;
 
   /** A decoding metadata cache, mapping an instruction word to a previously
-   * decoded instruction metadata bundle. Metadata is added to the cache as it's
-   * decoded, to reduce the overhead of future decoding. */
+   * decoded instruction metadata bundle. Shared by every AArch64 architecture
+   * in the process, such that concurrent simulations only decode each unique
+   * instruction word once. Instructions remain cached per-architecture in
+   * `decodeCache_`, as they hold architecture-specific execution
+   * information. */
+  static SharedDecodeCache<InstructionMetadata> sharedMetadataCache_;
+
+  /** A cache of the metadata created for misaligned instruction addresses,
+   * which isn't keyed by instruction word. */
   mutable std::forward_list<InstructionMetadata> metadataCache_;
 
+  /** A persistent cache of Capstone disassembly results, shared between
+   * simulations. Consulted before invoking Capstone for any encoding not found
+   * in `decodeCache_`. */
+  mutable DecodeCache persistentDecodeCache_;
+
+  /** Whether encodings are looked up in the `TableDecoder` decode table before
+   * falling back to Capstone. */
+  bool useTableDecoder_;
+
   /** A reference to a micro decoder object to split macro operations. */
   std::unique_ptr<MicroDecoder> microDecoder_;
 
@@ -68,6 +68,32 @@ class ExceptionHandler : public simeng::arch::ExceptionHandler {
    * exception results. */
   bool concludeSyscall(ProcessStateChange& stateChange);
 
+  /** Conclude a syscall which suspends the calling thread, saving its register
+   * context and resuming the next runnable thread. Only the memory updates in
+   * `stateChange` are applied; the suspended thread instead receives the
+   * result supplied by the kernel once it's resumed. */
+  bool concludeSyscallAndSwitch(ProcessStateChange& stateChange);
+
+  /** Conclude handling by resuming the thread `next`, applying the memory
+   * updates in `stateChange`. The register context of `next` is restored if
+   * `restoreContext` is set, or if it differs from the calling thread. */
+  bool resumeThread(const kernel::LinuxThreadState& next,
+                    ProcessStateChange& stateChange, bool restoreContext);
+
+  /** Wait for a thread to become runnable while the core is idle, resuming it
+   * once one does. Halts once every thread has exited, or if every remaining
+   * thread is blocked indefinitely. */
+  bool awaitThread();
+
+  /** Retrieve the value of every architectural register, in order of register
+   * type and tag. */
+  std::vector<RegisterValue> getRegisterContext() const;
+
+  /** Get the index of register `reg` within a register context taken using
+   * `getRegisterContext()`. */
+  static size_t getContextIndex(
+      Register reg, const std::vector<RegisterFileStructure>& regFileStruct);
+
   /** Sets a generic fatal result and returns true. */
   bool fatal();
 
@@ -96,6 +122,7 @@ class ExceptionHandler : public simeng::arch::ExceptionHandler {
   static constexpr Register R3 = {RegisterType::GENERAL, 3};
   static constexpr Register R4 = {RegisterType::GENERAL, 4};
   static constexpr Register R5 = {RegisterType::GENERAL, 5};
+  static constexpr Register SP = {RegisterType::GENERAL, 31};
 
   /** Let the following ExceptionHandlerTest derived classes be a friend of this
    * class to allow proper testing of `readStringThen()`, `readBufferThen()` and
@@ -22,8 +22,6 @@ class MicroDecoder {
   /** Construct a micro decoder for splitting relevant instructions. */
   MicroDecoder(ryml::ConstNodeRef config = config::SimInfo::getConfig());
 
-  ~MicroDecoder();
-
   /** From a macro-op, split into one or more micro-ops and populate passed
    * vector. Return the number of micro-ops generated. */
   uint8_t decode(const Architecture& architecture, uint32_t word,
@@ -74,13 +72,13 @@ class MicroDecoder {
   /** A micro-decoding cache, mapping an instruction word to a previously split
    * instruction. Instructions are added to the cache as they're split into
    * their respective micro-operations, to reduce the overhead of future
-   * splitting. */
-  static std::unordered_map<uint32_t, std::vector<Instruction>>
-      microDecodeCache_;
+   * splitting. Held per micro decoder, as the cached micro-operations are
+   * bound to the architecture which split them. */
+  std::unordered_map<uint32_t, std::vector<Instruction>> microDecodeCache_;
 
   /** A cache for newly created instruction metadata. Ensures metadata values
    * persist for a micro-operations' life cycle. */
-  static std::forward_list<InstructionMetadata> microMetadataCache_;
+  std::forward_list<InstructionMetadata> microMetadataCache_;
 
   // Default objects
   /** Default capstone instruction structure. */
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <capstone/capstone.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace simeng {
+namespace arch {
+namespace aarch64 {
+
+/** A decoder for the most frequently executed AArch64 instructions, driven by
+ * a table of encoding patterns fixed at compile time. Produces the same
+ * Capstone representation of an instruction which `InstructionMetadata` is
+ * constructed from, without the cost of invoking Capstone; any encoding not
+ * covered by the table must be disassembled by Capstone instead.
+ *
+ * Aliases are never produced. An encoding is always decoded to its canonical
+ * instruction (e.g. `subs xzr, x0, #1` rather than `cmp x0, #1`), matching the
+ * metadata produced once Capstone's aliases have been reverted. */
+class TableDecoder {
+ public:
+  /** An encoding pattern of the decode table. Any encoding which matches
+   * `value` in the bits selected by `mask` is covered by the table. */
+  struct Pattern {
+    uint32_t mask;
+    uint32_t value;
+  };
+
+  /** Decode the instruction `encoding` into `insn` and `detail`, with
+   * `insn.detail` pointing at `detail`. Returns false, leaving both
+   * unmodified, if the encoding isn't covered by the decode table. */
+  static bool decode(uint32_t encoding, cs_insn& insn, cs_detail& detail);
+
+  /** Retrieve the encoding pattern of each entry of the decode table, in the
+   * order they're searched. */
+  static std::vector<Pattern> getPatterns();
+};
+
+}  // namespace aarch64
+}  // namespace arch
+}  // namespace simeng
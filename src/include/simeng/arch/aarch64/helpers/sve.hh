@@ -4,6 +4,7 @@
 #include <cstdint>
 
 #include "auxiliaryFunctions.hh"
+#include "simeng/Instruction.hh"
 
 namespace simeng {
 namespace arch {
@@ -1727,11 +1728,11 @@ RegisterValue sveZip_vecs(srcValContainer& sourceValues, const uint16_t VL_bits,
  * consecutive active elements into blocks to be written.
  * T represents the size of the vector elements (e.g. for zn.d, T = uint64_t).
  * C represents the size of the memory elements (e.g. for st1w, C = uint32_t).
- * Return a vector of RegisterValues.  */
+ * Return a list of RegisterValues.  */
 template <typename T, typename C = T>
-std::vector<RegisterValue> sve_merge_store_data(const T* d, const uint64_t* p,
-                                                uint16_t vl_bits) {
-  std::vector<RegisterValue> outputData;
+MemoryAccessData sve_merge_store_data(const T* d, const uint64_t* p,
+                                      uint16_t vl_bits) {
+  MemoryAccessData outputData;
 
   uint16_t numVecElems = (vl_bits / (8 * sizeof(T)));
   // Determine how many predicate elements are present per uint64_t.
@@ -4,6 +4,7 @@
 #include <unordered_map>
 
 #include "simeng/arch/Architecture.hh"
+#include "simeng/arch/DecodeCache.hh"
 #include "simeng/arch/riscv/ExceptionHandler.hh"
 #include "simeng/arch/riscv/Instruction.hh"
 
@@ -69,6 +70,11 @@ class Architecture : public arch::Architecture {
    * decoded, to reduce the overhead of future decoding. */
   mutable std::forward_list<InstructionMetadata> metadataCache_;
 
+  /** A persistent cache of Capstone disassembly results, shared between
+   * simulations. Consulted before invoking Capstone for any encoding not found
+   * in `decodeCache_`. */
+  mutable DecodeCache persistentDecodeCache_;
+
   /** System Register of Processor Cycle Counter. */
   simeng::Register cycleSystemReg_;
 
@@ -4,6 +4,7 @@
 #include <cfenv>
 #include <functional>
 #include <unordered_map>
+#include <utility>
 
 #include "simeng/BranchPredictor.hh"
 #include "simeng/Instruction.hh"
@@ -161,6 +162,13 @@ class Instruction : public simeng::Instruction {
   /** Retrieve the instruction group this instruction belongs to. */
   uint16_t getGroup() const override;
 
+  /** Retrieve the Capstone opcode of this instruction. */
+  uint32_t getOpcode() const override;
+
+  /** Retrieve the assembly text of this instruction, as disassembled by
+   * Capstone. */
+  std::string getDisassembly() const override;
+
   /** Check whether all operand values have been supplied, and the instruction
    * is ready to execute. */
   bool canExecute() const override;
@@ -169,12 +177,15 @@ class Instruction : public simeng::Instruction {
   void execute() override;
 
   /** Get this instruction's supported set of ports. */
-  const std::vector<uint16_t>& getSupportedPorts() override;
+  PortMask getSupportedPorts() override;
 
   /** Set this instruction's execution information including it's execution
    * latency and throughput, and the set of ports which support it. */
   void setExecutionInfo(const ExecutionInfo& info) override;
 
+  /** Create a new instance of this instruction, copying its current state. */
+  std::shared_ptr<simeng::Instruction> clone() const override;
+
   /** Retrieve the instruction's metadata. */
   const InstructionMetadata& getMetadata() const;
 
@@ -211,6 +222,25 @@ class Instruction : public simeng::Instruction {
   /** Generate an ExecutionNotYetImplemented exception. */
   void executionNYI();
 
+  /** A pointer to a member function implementing the execution behaviour of
+   * an opcode. */
+  using ExecuteHandler = void (Instruction::*)();
+
+  /** Execute the behaviour of `opcode`. Specialised in Instruction_execute.cc
+   * for each implemented opcode; the primary template raises an
+   * ExecutionNotYetImplemented exception. */
+  template <unsigned int opcode>
+  void executeOpcode();
+
+  /** Get the handler implementing the execution behaviour of `opcode`. */
+  static ExecuteHandler getExecuteHandler(unsigned int opcode);
+
+  /** Build a table of the handler for each opcode in `opcodes`, indexed by
+   * opcode. */
+  template <size_t... opcodes>
+  static std::array<ExecuteHandler, sizeof...(opcodes)> makeExecuteHandlers(
+      std::index_sequence<opcodes...>);
+
   /** A reference to the ISA instance this instruction belongs to. */
   const Architecture& architecture_;
 
@@ -244,6 +274,11 @@ class Instruction : public simeng::Instruction {
   /** The current exception state of this instruction. */
   InstructionException exception_ = InstructionException::None;
 
+  /** The handler implementing this instruction's execution behaviour, resolved
+   * from its opcode once at decode such that executing an instruction is a
+   * single indirect call. */
+  ExecuteHandler executeHandler_ = &Instruction::executionNYI;
+
   /** The number of source operands that have not yet had values supplied. Used
    * to determine execution readiness. */
   uint16_t sourceOperandsPending_ = 0;
@@ -173,6 +173,10 @@ class ExpectationNode {
   /** A getter function to retrieve whether the node is a wildcard. */
   bool isWildcard() const { return isWildcard_; }
 
+  /** A getter function to retrieve whether the node's associated config option
+   * is optional. */
+  bool isOptional() const { return isOptional_; }
+
   /** Setter function to set the expected bounds for this node's associated
    * config option. */
   template <typename T>
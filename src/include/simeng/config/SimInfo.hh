@@ -43,6 +43,18 @@ class SimInfo {
     getInstance()->extractValues();
   }
 
+  /** A function to replace the model config with a previously validated config
+   * tree, e.g. a copy of one retrieved through `getConfig()`. Skips the
+   * validation performed when a config is generated or modified, for use when
+   * repeatedly switching between known configs (e.g. during the execution of a
+   * test suite). Note, subsequent `addToConfig` calls are applied to the last
+   * generated or file-based config rather than `config`. */
+  static void setValidatedConfig(const ryml::Tree& config) {
+    getInstance()->validatedConfig_ = config;
+    // Update previously extracted values from the config file
+    getInstance()->extractValues();
+  }
+
   /** A function to generate a default config file based on a passed ISA. */
   static void generateDefault(ISA isa, bool force = false) {
     if (isa == ISA::AArch64)
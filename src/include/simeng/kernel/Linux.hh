@@ -1,10 +1,13 @@
 #pragma once
 
+#include <deque>
 #include <memory>
 #include <set>
 #include <unordered_map>
 #include <vector>
 
+#include "simeng/RegisterValue.hh"
+#include "simeng/arch/ProcessStateChange.hh"
 #include "simeng/kernel/LinuxProcess.hh"
 #include "simeng/version.hh"
 
@@ -63,6 +66,42 @@ struct vm_area_struct {
   std::shared_ptr<struct vm_area_struct> vm_next = NULL;
 };
 
+/** The scheduling status of a thread. */
+enum class LinuxThreadStatus {
+  /** The thread is executing on the core. */
+  Running,
+  /** The thread is ready to be resumed. */
+  Runnable,
+  /** The thread is blocked in a futex wait until woken. */
+  FutexWaiting,
+  /** The thread is blocked in a futex wait which may time out. */
+  TimedFutexWaiting,
+  /** The thread has exited. */
+  Exited
+};
+
+/** A state container for a thread of a Linux process. Threads are
+ * time-multiplexed onto the cores registered with the kernel, switching only
+ * at system calls. */
+struct LinuxThreadState {
+  /** The thread ID. */
+  int64_t tid;
+  /** The scheduling status of the thread. */
+  LinuxThreadStatus status = LinuxThreadStatus::Runnable;
+  /** The clear_child_tid value. */
+  uint64_t clearChildTid = 0;
+  /** The address of the futex the thread is waiting on, if any. */
+  uint64_t futexAddress = 0;
+  /** The address to resume execution from, whilst not running. */
+  uint64_t pc = 0;
+  /** The value of each architectural register, in order of register type and
+   * tag, whilst not running. */
+  std::vector<RegisterValue> context;
+  /** The value returned by the system call the thread is suspended in, to be
+   * supplied when it's resumed. */
+  int64_t pendingResult = 0;
+};
+
 /** A state container for a Linux process. */
 struct LinuxProcessState {
   /** The process ID. */
@@ -84,10 +123,14 @@ struct LinuxProcessState {
   /** Non-Contiguous memory allocations from the mmap system call. */
   std::vector<vm_area_struct> nonContiguousAllocations;
 
-  // Thread state
-  // TODO: Support multiple threads per process
-  /** The clear_child_tid value. */
-  uint64_t clearChildTid = 0;
+  /** The threads of the process, in order of creation. */
+  std::vector<LinuxThreadState> threads;
+  /** The index within `threads` of the thread running on each core, or -1 if
+   * the core is idle. */
+  std::vector<int64_t> runningThreads;
+  /** The IDs of the threads waiting on each futex, in the order they began
+   * waiting. */
+  std::unordered_map<uint64_t, std::deque<int64_t>> futexQueues;
 
   /** The virtual file descriptor mapping table. Maps virtual file descriptors
    * to host file descriptors */
@@ -134,9 +177,26 @@ class Linux {
   Linux(const std::string specialFiledirPath)
       : specialFilesDir_(specialFiledirPath) {}
 
-  /** Create a new Linux process running above this kernel. */
+  /** Create a new Linux process running above this kernel. Its initial
+   * thread runs on core 0. */
   void createProcess(const LinuxProcess& process);
 
+  /** Register an additional core able to run threads of the process, which
+   * starts idle. Returns the ID of the new core. */
+  uint16_t addCore();
+
+  /** Get the number of cores registered, including core 0. */
+  uint16_t getCoreCount() const;
+
+  /** Select the core making subsequent system calls. Operations on the
+   * running thread refer to the thread running on this core. */
+  void setCurrentCore(uint16_t core);
+
+  /** Provide the host memory holding the process image, where the cores'
+   * memory interfaces access it directly, such that file-backed mappings can
+   * be populated in place. */
+  void setProcessMemory(char* memory, uint64_t size);
+
   /** Retrieve the initial stack pointer. */
   uint64_t getInitialStackPointer() const;
 
@@ -151,6 +211,58 @@ class Linux {
   uint64_t clockGetTime(uint64_t clkId, uint64_t systemTimer, uint64_t& seconds,
                         uint64_t& nanoseconds);
 
+  /** clone syscall: create a new thread of the process, with the register
+   * context `context`, which will resume from `pc` with a return value of 0.
+   * Only the creation of threads sharing the process' memory and signal
+   * handlers is supported. Returns the new thread ID, or -EINVAL if the
+   * requested flags aren't supported. */
+  int64_t clone(uint64_t flags, uint64_t childTidPtr, uint64_t pc,
+                std::vector<RegisterValue> context);
+
+  /** exit syscall: terminate the running thread. Returns the thread's
+   * clear_child_tid value, which the caller should zero and wake a waiter on
+   * if non-zero. A new thread must then be scheduled using `switchThread()`.
+   */
+  uint64_t exitThread();
+
+  /** exit_group syscall: terminate all threads of the process, including
+   * those running on other cores. */
+  void exitGroup();
+
+  /** futex syscall, FUTEX_WAIT operation: block the running thread until
+   * woken by a wake operation on `uaddr`. If `timed` is set, the wait may time
+   * out instead, should no other thread be able to run. A new thread must then
+   * be scheduled using `switchThread()`. */
+  void futexWait(uint64_t uaddr, bool timed);
+
+  /** futex syscall, FUTEX_WAKE operation: wake at most `count` threads waiting
+   * on `uaddr`, in the order they began waiting. Returns the number of threads
+   * woken. */
+  int64_t futexWake(uint64_t uaddr, int64_t count);
+
+  /** Suspend the running thread, saving its register context `context` and
+   * the address `pc` to resume from, and resume the next runnable thread in
+   * round-robin order. The suspended thread itself is resumed if it's the only
+   * runnable thread. If no thread is runnable and no other core is running a
+   * thread, the first thread in a timed futex wait is resumed with a result of
+   * -ETIMEDOUT instead. Returns the thread to resume, or nullptr if no thread
+   * can run, in which case the core is left idle. */
+  const LinuxThreadState* switchThread(uint64_t pc,
+                                       std::vector<RegisterValue> context);
+
+  /** Resume a runnable thread on the current core, which must be idle, as by
+   * `switchThread()`. Returns nullptr if no thread can run. */
+  const LinuxThreadState* resumeThread();
+
+  /** Get the number of threads which haven't exited. */
+  size_t getLiveThreadCount() const;
+
+  /** Get the number of cores currently running a thread. */
+  size_t getRunningThreadCount() const;
+
+  /** Retrieve the thread running on the current core. */
+  const LinuxThreadState& getRunningThread() const;
+
   /** ftruncate syscall: truncate a file to an exact size. */
   int64_t ftruncate(uint64_t fd, uint64_t length);
 
@@ -182,7 +294,7 @@ class Linux {
   int64_t getgid() const;
   /** getegid syscall: get the process owner's effective group ID. */
   int64_t getegid() const;
-  /** gettid syscall: get the process owner's thread ID. */
+  /** gettid syscall: get the running thread's ID. */
   int64_t gettid() const;
 
   /** gettimeofday syscall: get the current time, using the system timer
@@ -200,7 +312,9 @@ class Linux {
   /** munmap syscall: deletes the mappings for the specified address range. */
   int64_t munmap(uint64_t addr, size_t length);
 
-  /** mmap syscall: map files or devices into memory. */
+  /** mmap syscall: map files or devices into memory. Only reserves the
+   * region of process memory; populating a file-backed mapping with the
+   * file's contents is left to the caller. Returns 0 on failure. */
   uint64_t mmap(uint64_t addr, size_t length, int prot, int flags, int fd,
                 off_t offset);
 
@@ -228,6 +342,20 @@ class Linux {
   /** read syscall: read buffer from a file. */
   int64_t read(int64_t fd, void* buf, uint64_t count);
 
+  /** Read up to `count` bytes from a file, starting at `offset`, without
+   * changing the file offset. Used to populate file-backed mappings. */
+  int64_t pread(int64_t fd, void* buf, uint64_t count, uint64_t offset);
+
+  /** Populate the file-backed mapping of `length` bytes at `address`, made by
+   * `mmap`, with the contents of the file `fd` from `offset`. Any part of the
+   * mapping beyond the end of the file reads as zero. If the process memory
+   * has been provided, the file's whole pages are mapped into it
+   * copy-on-write and the rest is read into it; otherwise, writes of the
+   * contents are added to `stateChange`. Returns false if the file couldn't
+   * be read. */
+  bool populateMapping(uint64_t address, size_t length, int64_t fd,
+                       uint64_t offset, arch::ProcessStateChange& stateChange);
+
   /** readv syscall: read buffers from a file. */
   int64_t readv(int64_t fd, const void* iovdata, int iovcnt);
 
@@ -251,9 +379,23 @@ class Linux {
    * to point to the SimEng equivalent. */
   std::string getSpecialFile(const std::string filename);
 
+  /** Retrieve the thread running on the current core. */
+  LinuxThreadState& runningThread();
+
+  /** Resume the first runnable thread on the current core, searching in
+   * round-robin order from the thread at index `first`. */
+  const LinuxThreadState* scheduleThread(size_t first);
+
+  /** The core making the current system call. */
+  uint16_t currentCore_ = 0;
+
   /** The state of the user-space processes running above the kernel. */
   std::vector<LinuxProcessState> processStates_;
 
+  /** The host memory holding the process image, if provided, and its size. */
+  char* processMemory_ = nullptr;
+  uint64_t processMemorySize_ = 0;
+
   /** Translation between special files paths and simeng replacement files. */
   std::unordered_map<std::string, const std::string> specialPathTranslations_;
 
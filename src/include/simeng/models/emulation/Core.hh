@@ -3,6 +3,8 @@
 #include <map>
 #include <queue>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "simeng/ArchitecturalRegisterFileSet.hh"
 #include "simeng/Core.hh"
@@ -13,15 +15,26 @@ namespace simeng {
 namespace models {
 namespace emulation {
 
-/** An emulation-style core model. Executes each instruction in turn. */
+/** An emulation-style core model. Executes each instruction in turn.
+ *
+ * Instructions are fetched, and memory accessed, directly within the process
+ * image, rather than through a memory interface. The data memory interface,
+ * which must be a flat interface to the same process image, is only used by
+ * exception handlers.
+ *
+ * Each tick executes a basic block: the instructions from the current PC up
+ * to and including the next branch. Blocks are predecoded once, cached by
+ * their start address, and replayed from cloned uops on later visits. All
+ * cached blocks are discarded whenever a store writes to a page holding a
+ * cached block, or an exception handler runs, as either may modify code. */
 class Core : public simeng::Core {
  public:
-  /** Construct an emulation-style core, providing memory interfaces for
-   * instructions and data, along with the instruction entry point and an ISA to
-   * use. */
-  Core(memory::MemoryInterface& instructionMemory,
-       memory::MemoryInterface& dataMemory, uint64_t entryPoint,
-       uint64_t programByteLength, const arch::Architecture& isa);
+  /** Construct an emulation-style core, providing the process image and a
+   * memory interface for data, along with the instruction entry point and an
+   * ISA to use. */
+  Core(char* processMemory, memory::MemoryInterface& dataMemory,
+       uint64_t entryPoint, uint64_t programByteLength,
+       const arch::Architecture& isa);
 
   /** Tick the core. */
   void tick() override;
@@ -40,17 +53,38 @@ class Core : public simeng::Core {
   std::map<std::string, std::string> getStats() const override;
 
  private:
+  /** A basic block of predecoded instructions. */
+  struct Block {
+    /** The predecoded macro-op of each instruction, in program order. These
+     * are never executed themselves, only their clones. */
+    std::vector<MacroOp> macroOps;
+
+    /** The size in bytes of each instruction. */
+    std::vector<uint8_t> sizes;
+  };
+
+  /** Predecode the basic block starting at `address`. */
+  Block decodeBlock(uint64_t address);
+
+  /** Execute the uops held in `macroOp_`, which together form one
+   * instruction. */
+  void executeMacroOp();
+
   /** Execute an instruction. */
   void execute(std::shared_ptr<Instruction>& uop);
 
+  /** Mark the cached blocks as stale if the memory written to by `target`
+   * overlaps a page holding any of them. */
+  void invalidateBlocksWrittenBy(const memory::MemoryAccessTarget& target);
+
   /** Handle an encountered exception. */
   void handleException(const std::shared_ptr<Instruction>& instruction);
 
   /** Process an active exception handler. */
   void processExceptionHandler();
 
-  /** A memory interface to access instructions. */
-  memory::MemoryInterface& instructionMemory_;
+  /** The process image, within which instructions and data are accessed. */
+  char* processMemory_;
 
   /** An architectural register file set, serving as a simple wrapper around the
    * register file set. */
@@ -59,13 +93,22 @@ class Core : public simeng::Core {
   /** A reusable macro-op vector to fill with uops. */
   MacroOp macroOp_;
 
+  /** The predecoded basic blocks, keyed by start address. */
+  std::unordered_map<uint64_t, Block> blockCache_;
+
+  /** The page numbers of the process image holding cached blocks. */
+  std::unordered_set<uint64_t> codePages_;
+
+  /** Whether the cached blocks may be stale, and must be discarded. */
+  bool blocksInvalidated_ = false;
+
   /** The previously generated addresses. */
   std::vector<simeng::memory::MemoryAccessTarget> previousAddresses_;
 
   /** The current program counter. */
   uint64_t pc_ = 0;
 
-  /** The length of the available instruction memory. */
+  /** The length of the process image. */
   uint64_t programByteLength_ = 0;
 
   /** The number of instructions executed. */
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <deque>
 #include <vector>
 
 #include "simeng/ArchitecturalRegisterFileSet.hh"
@@ -14,7 +15,24 @@ namespace simeng {
 namespace models {
 namespace inorder {
 
-/** A simple scalar in-order pipelined core model. */
+/** An entry in the in-order core's register scoreboard. */
+struct ScoreboardEntry {
+  /** The number of issued instructions yet to produce a value for the
+   * register. */
+  uint16_t pendingWrites = 0;
+  /** Whether the youngest of those instructions is a load. */
+  bool awaitingLoad = false;
+};
+
+/** An in-order pipelined core model, issuing up to `Pipeline-Widths:FrontEnd`
+ * instructions per cycle to an execution unit per configured port.
+ *
+ * Instructions are issued in program order once a register scoreboard shows
+ * their source operands are available, and only to a port on which they will
+ * finish executing after every older in-flight instruction. Instructions
+ * therefore execute, and take effect, strictly in program order, such that
+ * branch mispredictions and exceptions only discard younger instructions
+ * which haven't executed. */
 class Core : public simeng::Core {
  public:
   /** Construct a core model, providing an ISA and branch predictor to use,
@@ -23,7 +41,8 @@ class Core : public simeng::Core {
   Core(memory::MemoryInterface& instructionMemory,
        memory::MemoryInterface& dataMemory, uint64_t processMemorySize,
        uint64_t entryPoint, const arch::Architecture& isa,
-       BranchPredictor& branchPredictor);
+       BranchPredictor& branchPredictor,
+       ryml::ConstNodeRef config = config::SimInfo::getConfig());
 
   /** Tick the core. Ticks each of the pipeline stages sequentially, then ticks
    * the buffers between them. Checks for and executes pipeline flushes at the
@@ -62,12 +81,29 @@ class Core : public simeng::Core {
   /** Store data supplied by an instruction to memory. */
   void storeData(const std::shared_ptr<Instruction>& instruction);
 
-  /** Forward operands to the most recently decoded instruction. */
-  void forwardOperands(const span<Register>& destinations,
-                       const span<RegisterValue>& values);
+  /** Issue decoded instructions to the execution units, in program order,
+   * until one can't be issued this cycle. */
+  void issue();
+
+  /** Select a port to issue `uop` to this cycle. Returns false if no
+   * supported port can accept it, recording the cause of the stall. */
+  bool selectPort(const std::shared_ptr<Instruction>& uop, uint16_t& port);
+
+  /** Read the values of the pending source operands of `uop` from the
+   * register file. */
+  void readRegisters(const std::shared_ptr<Instruction>& uop);
+
+  /** Mark the oldest in-flight instruction as executed, releasing its
+   * destination registers in the scoreboard. */
+  void instructionExecuted();
+
+  /** Flush all issued instructions yet to execute, following a branch
+   * misprediction or exception raised by an older instruction. */
+  void flushInFlight();
 
-  /** Read pending registers for the most recently decoded instruction. */
-  void readRegisters();
+  /** Get the scoreboard entry for `reg`, or nullptr if the register isn't
+   * tracked (e.g. a zero register). */
+  ScoreboardEntry* getScoreboardEntry(const Register& reg);
 
   /** An architectural register file set, serving as a simple wrapper around the
    * register file set. */
@@ -79,12 +115,17 @@ class Core : public simeng::Core {
   /** The buffer between fetch and decode. */
   pipeline::PipelineBuffer<MacroOp> fetchToDecodeBuffer_;
 
-  /** The buffer between decode and execute. */
-  pipeline::PipelineBuffer<std::shared_ptr<Instruction>> decodeToExecuteBuffer_;
+  /** The buffer between decode and issue. */
+  pipeline::PipelineBuffer<std::shared_ptr<Instruction>> decodeToIssueBuffer_;
 
-  /** The buffer between execute and writeback. */
+  /** The input slot of each execution unit. Instructions are issued directly
+   * into the head slot, to be executed by the unit in the same cycle. */
   std::vector<pipeline::PipelineBuffer<std::shared_ptr<Instruction>>>
-      completionSlots_;
+      issuePorts_;
+
+  /** The timing wheel between the execution units and writeback, on which
+   * completed instructions are scheduled by writeback cycle. */
+  pipeline::TimingWheel<std::shared_ptr<Instruction>> completions_;
 
   /** The fetch unit; fetches instructions from memory. */
   pipeline::FetchUnit fetchUnit_;
@@ -92,16 +133,78 @@ class Core : public simeng::Core {
   /** The decode unit; decodes instructions into uops and reads operands. */
   pipeline::DecodeUnit decodeUnit_;
 
-  /** The execute unit; executes uops and sends to writeback, also forwarding
-   * results. */
-  pipeline::ExecuteUnit executeUnit_;
+  /** The execution units, one per port; execute uops and send to
+   * writeback. */
+  std::vector<pipeline::ExecuteUnit> executionUnits_;
 
   /** The writeback unit; writes uop results to the register files. */
   pipeline::WritebackUnit writebackUnit_;
 
+  /** The register scoreboard, indexed by register type and tag. */
+  std::vector<std::vector<ScoreboardEntry>> scoreboard_;
+
+  /** The issued instructions yet to execute, in program order. */
+  std::deque<std::shared_ptr<Instruction>> inFlight_;
+
+  /** Whether each execution unit is pipelined. */
+  std::vector<bool> pipelined_;
+
+  /** The blocking groups of each execution unit. */
+  std::vector<std::vector<uint16_t>> blockingGroups_;
+
+  /** The number of cycles the execution units have been ticked; matches the
+   * internal tick count of each unit. */
+  uint64_t executeCycle_ = 0;
+
+  /** The cycle on which each port's most recently issued instruction will
+   * execute. */
+  std::vector<uint64_t> portLastCompletion_;
+
+  /** The cycle from which each port may accept another instruction, after
+   * being stalled by a multi-cycle or unpipelined operation. */
+  std::vector<uint64_t> portStallUntil_;
+
+  /** The cycle on which each port's most recent blocking-group instruction
+   * will execute. */
+  std::vector<uint64_t> portBlockingUntil_;
+
+  /** The cycle and port on which the youngest issued instruction will
+   * execute. Younger instructions must execute later, or on a higher-indexed
+   * port in the same cycle. */
+  std::pair<uint64_t, uint16_t> lastCompletion_ = {0, 0};
+
   /** The number of times the pipeline has been flushed. */
   uint64_t flushes_ = 0;
 
+  /** Whether a branch misprediction was discovered by an execution unit during
+   * the cycle. */
+  bool executeFlush_ = false;
+
+  /** The target address of the branch misprediction discovered during the
+   * cycle. */
+  uint64_t executeFlushAddress_ = 0;
+
+  /** The number of cycles no instruction was available to issue. */
+  uint64_t frontendStalls_ = 0;
+
+  /** The number of cycles issue stalled waiting for a source operand to be
+   * produced by a non-load instruction. */
+  uint64_t dependencyStalls_ = 0;
+
+  /** The number of cycles issue stalled waiting for a source operand to be
+   * produced by a load. */
+  uint64_t loadUseStalls_ = 0;
+
+  /** The number of cycles issue stalled as no supported port was free. */
+  uint64_t portBusyStalls_ = 0;
+
+  /** The number of cycles issue stalled as an instruction would have finished
+   * executing before an older instruction. */
+  uint64_t completionOrderStalls_ = 0;
+
+  /** The number of cycles in which more than one instruction was issued. */
+  uint64_t multiIssueCycles_ = 0;
+
   /** Whether an exception was generated during the cycle. */
   bool exceptionGenerated_ = false;
 
@@ -2,6 +2,7 @@
 
 #include "simeng/ArchitecturalRegisterFileSet.hh"
 #include "simeng/Core.hh"
+#include "simeng/pipeline/CommitTrace.hh"
 #include "simeng/pipeline/DecodeUnit.hh"
 #include "simeng/pipeline/DispatchIssueUnit.hh"
 #include "simeng/pipeline/ExecuteUnit.hh"
@@ -49,6 +50,11 @@ class Core : public simeng::Core {
   /** Generate a map of statistics to report. */
   std::map<std::string, std::string> getStats() const override;
 
+  /** Check whether the core is blocked until an outstanding data memory
+   * request completes; either an exception handler is waiting on memory, or
+   * the ROB is full and no in-flight uop can progress without load data. */
+  bool isWaitingOnMemory() const override;
+
  private:
   /** Raise an exception to the core, providing the generating instruction. */
   void raiseException(const std::shared_ptr<Instruction>& instruction);
@@ -62,6 +68,20 @@ class Core : public simeng::Core {
   /** Inspect units and flush pipelines if required. */
   void flushIfNeeded();
 
+  /** Record the current cycle as the completion cycle of the uops due to be
+   * written back this cycle. Only used whilst writing a commit trace. */
+  void recordCompletions();
+
+  /** Record the current cycle as the fetch, decode, rename, or issue cycle of
+   * the uops output by each unit this cycle. Only used whilst writing a
+   * commit trace. */
+  void recordStageOutputs();
+
+  /** Append `uop`, committed this cycle, to the commit trace if it was
+   * fetched during the traced window of cycles, and falls within the traced
+   * window of instructions. */
+  void traceCommit(const Instruction& uop);
+
   const std::vector<simeng::RegisterFileStructure> physicalRegisterStructures_;
 
   const std::vector<uint16_t> physicalRegisterQuantities_;
@@ -86,10 +106,9 @@ class Core : public simeng::Core {
   std::vector<pipeline::PipelineBuffer<std::shared_ptr<Instruction>>>
       issuePorts_;
 
-  /** The completion slots; single-width buffers between execute and writeback.
-   */
-  std::vector<pipeline::PipelineBuffer<std::shared_ptr<Instruction>>>
-      completionSlots_;
+  /** The timing wheel between execute and writeback, on which the execution
+   * units and load/store queue schedule completed uops by writeback cycle. */
+  pipeline::TimingWheel<std::shared_ptr<Instruction>> completions_;
 
   /** The fetch unit; fetches instructions from memory. */
   pipeline::FetchUnit fetchUnit_;
@@ -100,6 +119,10 @@ class Core : public simeng::Core {
   /** The rename unit; renames instruction registers. */
   pipeline::RenameUnit renameUnit_;
 
+  /** The memory dependence predictor; predicts which loads depend on earlier
+   * in-flight stores. */
+  pipeline::StoreSetPredictor storeSetPredictor_;
+
   /** The dispatch/issue unit; dispatches instructions to the reservation
    * station, reads operands, and issues ready instructions to the execution
    * unit. */
@@ -134,6 +157,26 @@ class Core : public simeng::Core {
 
   /** A pointer to the instruction responsible for generating the exception. */
   std::shared_ptr<Instruction> exceptionGeneratingInstruction_;
+
+  /** The writer of the trace of committed uops, if enabled. */
+  std::unique_ptr<pipeline::TraceWriter> commitTrace_;
+
+  /** The first and last cycles in which fetched uops are traced; an end
+   * cycle of 0 traces until the simulation halts. */
+  uint64_t traceStartCycle_ = 0;
+  uint64_t traceEndCycle_ = 0;
+
+  /** The number of instructions committed before tracing begins, and the
+   * number traced; a count of 0 traces until the simulation halts. */
+  uint64_t traceStartInstruction_ = 0;
+  uint64_t traceInstructionCount_ = 0;
+
+  /** Whether a uop fetched within the traced window of cycles has committed. */
+  bool traceEntered_ = false;
+
+  /** Whether both traced windows have passed, such that uops are no longer
+   * recorded as they pass through each stage. */
+  bool traceFinished_ = false;
 };
 
 }  // namespace outoforder
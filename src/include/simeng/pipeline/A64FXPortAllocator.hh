@@ -26,7 +26,7 @@ class A64FXPortAllocator : public PortAllocator {
 
   /** Allocate a port for the specified instruction group; returns the allocated
    * port. */
-  uint16_t allocate(const std::vector<uint16_t>& ports) override;
+  uint16_t allocate(PortMask ports) override;
 
   /** Inform the allocator that an instruction was issued to the specified port.
    */
@@ -46,7 +46,7 @@ class A64FXPortAllocator : public PortAllocator {
 
  private:
   /** A mapping from issue ports to instruction attribute */
-  uint8_t attributeMapping(const std::vector<uint16_t>& ports);
+  uint8_t attributeMapping(PortMask ports);
 
   /** An approximate estimation of the index of an instruction within the input
    * buffer of the dispatch unit. Increments slot at each allocation thus cannot
@@ -57,7 +57,7 @@ class A64FXPortAllocator : public PortAllocator {
   std::function<void(std::vector<uint32_t>&)> rsSizes_;
 
   /** Mapping from reservation station to ports. */
-  std::vector<std::vector<uint16_t>> rsToPort_;
+  std::vector<PortMask> rsToPort_;
 
   /** Vector of free entries across all reservation stations. */
   std::vector<uint32_t> freeEntries_;
@@ -72,16 +72,17 @@ class A64FXPortAllocator : public PortAllocator {
   /** RSA with least free entries. */
   uint8_t RSAf_;
 
-  const std::vector<uint16_t> EXA_EXB_EAGA_EAGB = {2, 4, 5, 6};
-  const std::vector<uint16_t> EXA_EXB = {2, 4};
-  const std::vector<uint16_t> FLA_FLB = {0, 3};
-  const std::vector<uint16_t> EAGA_EAGB = {5, 6};
-  const std::vector<uint16_t> EXA = {2};
-  const std::vector<uint16_t> FLA = {0};
-  const std::vector<uint16_t> PR = {1};
-  const std::vector<uint16_t> EXB = {4};
-  const std::vector<uint16_t> FLB = {3};
-  const std::vector<uint16_t> BR = {7};
+  static constexpr PortMask EXA_EXB_EAGA_EAGB =
+      portBit(2) | portBit(4) | portBit(5) | portBit(6);
+  static constexpr PortMask EXA_EXB = portBit(2) | portBit(4);
+  static constexpr PortMask FLA_FLB = portBit(0) | portBit(3);
+  static constexpr PortMask EAGA_EAGB = portBit(5) | portBit(6);
+  static constexpr PortMask EXA = portBit(2);
+  static constexpr PortMask FLA = portBit(0);
+  static constexpr PortMask PR = portBit(1);
+  static constexpr PortMask EXB = portBit(4);
+  static constexpr PortMask FLB = portBit(3);
+  static constexpr PortMask BR = portBit(7);
 };
 
 }  // namespace pipeline
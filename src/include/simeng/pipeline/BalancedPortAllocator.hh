@@ -20,10 +20,10 @@ class BalancedPortAllocator : public PortAllocator {
   BalancedPortAllocator(
       const std::vector<std::vector<uint16_t>>& portArrangement);
 
-  /** Allocate the lowest weighted port available for the specified instruction
-   * group. Returns the allocated port, and increases the weight of the port.
-   */
-  uint16_t allocate(const std::vector<uint16_t>& ports) override;
+  /** Allocate the lowest weighted port of those supplied, preferring the
+   * lowest-indexed port on a tie. Returns the allocated port, and increases the
+   * weight of the port. */
+  uint16_t allocate(PortMask ports) override;
 
   /** Decrease the weight for the specified port. */
   void issued(uint16_t port) override;
@@ -49,6 +49,10 @@ class BalancedPortAllocator : public PortAllocator {
    * that port. */
   std::vector<uint16_t> weights;
 
+  /** The set of ports with a weighting of zero. Any such port supplied is the
+   * least-weighted, allowing allocation without inspecting `weights`. */
+  PortMask idlePorts_;
+
   /** Get the current sizes an capacity of the reservation stations */
   std::function<void(std::vector<uint32_t>&)> rsSizes_;
 };
@@ -0,0 +1,187 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "simeng/Instruction.hh"
+
+namespace simeng {
+namespace pipeline {
+
+/** A record of a single committed micro-operation, as held in a commit trace.
+ */
+struct CommitRecord {
+  /** The micro-operation's sequence ID. */
+  uint64_t sequenceId = 0;
+
+  /** The instruction ID shared by the micro-operations of one instruction. */
+  uint64_t instructionId = 0;
+
+  /** The address of the instruction. */
+  uint64_t address = 0;
+
+  /** The ISA-defined opcode of the instruction. */
+  uint32_t opcode = 0;
+
+  /** The assembly text of the instruction. Not held in binary commit traces,
+   * so empty for records read from one. */
+  std::string disassembly;
+
+  /** The cycles in which the micro-operation was fetched, decoded, renamed,
+   * issued, completed execution, and committed. A value of 0 denotes a stage
+   * the micro-operation didn't pass through, such as issue for one which
+   * raised an exception at decode. */
+  uint64_t fetchCycle = 0;
+  uint64_t decodeCycle = 0;
+  uint64_t renameCycle = 0;
+  uint64_t issueCycle = 0;
+  uint64_t completeCycle = 0;
+  uint64_t commitCycle = 0;
+
+  /** The (renamed) registers read by the micro-operation. */
+  std::vector<Register> sourceRegisters;
+
+  /** The (renamed) registers written by the micro-operation. */
+  std::vector<Register> destinationRegisters;
+
+  /** The memory accesses made by the micro-operation. */
+  std::vector<memory::MemoryAccessTarget> memoryAccesses;
+};
+
+/** An interface for writers of a trace of the micro-operations committed by a
+ * core. */
+class TraceWriter {
+ public:
+  virtual ~TraceWriter(){};
+
+  /** Append a record of `uop`, committed in `commitCycle`. */
+  virtual void record(const Instruction& uop, uint64_t commitCycle) = 0;
+};
+
+/** Writes a binary trace of the micro-operations committed by a core.
+ *
+ * Records are encoded into an in-memory block on the simulation thread, with
+ * each field held as a variable-length integer relative to the same field of
+ * the previous record, such that a typical record occupies around ten bytes.
+ * Filled blocks are handed to a background thread to be written to the file,
+ * keeping file I/O off the simulation thread; should the background thread
+ * fall behind, the simulation waits once a bounded number of blocks are
+ * queued. Use `CommitTraceReader` to read the trace back. */
+class CommitTraceWriter : public TraceWriter {
+ public:
+  /** Open a trace at `path`, replacing any existing file, and buffering
+   * records in blocks of `blockSize` bytes. */
+  explicit CommitTraceWriter(const std::string& path,
+                             size_t blockSize = 1 << 20);
+
+  /** Write all buffered records to the file, and close it. */
+  ~CommitTraceWriter() override;
+
+  /** Check whether the trace file was opened successfully. */
+  bool isOpen() const;
+
+  /** Append a record of `uop`, committed in `commitCycle`. */
+  void record(const Instruction& uop, uint64_t commitCycle) override;
+
+ private:
+  /** Append `value` to the active block as an unsigned LEB128 integer. */
+  void putUnsigned(uint64_t value);
+
+  /** Append `value` to the active block as a zigzag-encoded LEB128 integer. */
+  void putSigned(int64_t value);
+
+  /** Append a stage cycle of a record committed in `commitCycle`. */
+  void putStageCycle(uint64_t cycle, uint64_t commitCycle);
+
+  /** Queue the active block to be written, and start a new one. */
+  void submitBlock();
+
+  /** The background thread's loop; writes queued blocks until closed. */
+  void writeBlocks();
+
+  /** The path of the trace file, used to report errors. */
+  std::string path_;
+
+  /** The trace file. Only accessed by the background thread once opened. */
+  std::ofstream file_;
+
+  /** The size at which the active block is queued to be written. */
+  size_t blockSize_;
+
+  /** The block records are currently encoded into. */
+  std::vector<uint8_t> active_;
+
+  /** Filled blocks awaiting the background thread. */
+  std::deque<std::vector<uint8_t>> queued_;
+
+  /** Written blocks, retained such that their storage is reused. */
+  std::vector<std::vector<uint8_t>> spare_;
+
+  /** Guards `queued_`, `spare_`, and `closing_`. */
+  std::mutex mutex_;
+
+  /** Signals a change to `queued_` or `closing_`. */
+  std::condition_variable changed_;
+
+  /** Whether the writer is closing, such that the background thread exits
+   * once all queued blocks are written. */
+  bool closing_ = false;
+
+  /** The background thread writing blocks to the file. */
+  std::thread thread_;
+
+  /** The fields of the previous record, which each record is encoded
+   * relative to. */
+  uint64_t lastSequenceId_ = 0;
+  uint64_t lastInstructionId_ = 0;
+  uint64_t lastAddress_ = 0;
+  uint64_t lastCommitCycle_ = 0;
+  uint64_t lastMemoryAddress_ = 0;
+};
+
+/** Reads the records of a trace written by `CommitTraceWriter`. */
+class CommitTraceReader {
+ public:
+  /** Open the trace at `path`. */
+  explicit CommitTraceReader(const std::string& path);
+
+  /** Check whether the file was opened and holds a commit trace. */
+  bool isValid() const;
+
+  /** Read the next record into `record`. Returns false once all records have
+   * been read. */
+  bool next(CommitRecord& record);
+
+ private:
+  /** Read an unsigned LEB128 integer. */
+  uint64_t getUnsigned();
+
+  /** Read a zigzag-encoded LEB128 integer. */
+  int64_t getSigned();
+
+  /** Read a stage cycle of a record committed in `commitCycle`. */
+  uint64_t getStageCycle(uint64_t commitCycle);
+
+  /** The trace file. */
+  std::ifstream file_;
+
+  /** Whether the file holds a commit trace. */
+  bool valid_ = false;
+
+  /** The fields of the previous record, which each record is encoded
+   * relative to. */
+  uint64_t lastSequenceId_ = 0;
+  uint64_t lastInstructionId_ = 0;
+  uint64_t lastAddress_ = 0;
+  uint64_t lastCommitCycle_ = 0;
+  uint64_t lastMemoryAddress_ = 0;
+};
+
+}  // namespace pipeline
+}  // namespace simeng
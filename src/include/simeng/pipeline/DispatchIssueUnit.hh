@@ -11,6 +11,7 @@
 #include "simeng/config/SimInfo.hh"
 #include "simeng/pipeline/PipelineBuffer.hh"
 #include "simeng/pipeline/PortAllocator.hh"
+#include "simeng/pipeline/StoreSetPredictor.hh"
 
 namespace simeng {
 namespace pipeline {
@@ -46,18 +47,29 @@ struct dependencyEntry {
   uint16_t operandIndex;
 };
 
+/** An entry in the reservation station held back on a predicted memory
+ * dependence. */
+struct memoryDependencyEntry {
+  /** The load waiting on an earlier store to issue. */
+  std::shared_ptr<Instruction> uop;
+  /** The port to issue to. */
+  uint16_t port;
+};
+
 /** A dispatch/issue unit for an out-of-order pipelined processor. Reads
  * instruction operand and performs scoreboarding. Issues instructions to the
  * execution unit once ready. */
 class DispatchIssueUnit {
  public:
   /** Construct a dispatch/issue unit with references to input/output buffers,
-   * the register file, the port allocator, and a description of the number of
-   * physical registers the scoreboard needs to reflect. */
+   * the register file, the port allocator, the memory dependence predictor,
+   * and a description of the number of physical registers the scoreboard needs
+   * to reflect. */
   DispatchIssueUnit(
       PipelineBuffer<std::shared_ptr<Instruction>>& fromRename,
       std::vector<PipelineBuffer<std::shared_ptr<Instruction>>>& issuePorts,
       const RegisterFileSet& registerFileSet, PortAllocator& portAllocator,
+      StoreSetPredictor& storeSetPredictor,
       const std::vector<uint16_t>& physicalRegisterStructure,
       ryml::ConstNodeRef config = config::SimInfo::getConfig());
 
@@ -66,7 +78,7 @@ class DispatchIssueUnit {
   void tick();
 
   /** Identify the oldest ready instruction in the reservation station and issue
-   * it. */
+   * it. Loads held on a store issued this cycle are made ready for the next. */
   void issue();
 
   /** Forwards operands and performs register reads for the currently queued
@@ -77,6 +89,14 @@ class DispatchIssueUnit {
   /** Clear the RS of all flushed instructions. */
   void purgeFlushed();
 
+  /** Inform the unit that a load has started its memory accesses, supplying
+   * whether any were forwarded from an earlier in-flight store. Used to
+   * identify memory order violations avoided by holding the load back. */
+  void loadStarted(const std::shared_ptr<Instruction>& load, bool forwarded);
+
+  /** Query whether any uops are ready to issue. */
+  bool hasReadyUops() const;
+
   /** Retrieve the number of cycles this unit stalled due to insufficient RS
    * space. */
   uint64_t getRSStalls() const;
@@ -96,7 +116,19 @@ class DispatchIssueUnit {
   /** Retrieve the current sizes and capacities of the reservation stations*/
   void getRSSizes(std::vector<uint32_t>&) const;
 
+  /** Retrieve the number of loads held back on a predicted memory dependence.
+   */
+  uint64_t getLoadsDelayed() const;
+
+  /** Retrieve the number of held back loads which were later forwarded data
+   * from an earlier store, and so avoided a memory order violation. */
+  uint64_t getViolationsAvoided() const;
+
  private:
+  /** Release all loads held on the store with sequence ID `storeSeqId`, moving
+   * any with ready operands to their ready queue. */
+  void releaseMemoryDependents(uint64_t storeSeqId);
+
   /** A buffer of instructions to dispatch and read operands for. */
   PipelineBuffer<std::shared_ptr<Instruction>>& input_;
 
@@ -131,6 +163,25 @@ class DispatchIssueUnit {
   /** A reference to the execution port allocator. */
   PortAllocator& portAllocator_;
 
+  /** A reference to the memory dependence predictor. */
+  StoreSetPredictor& storeSetPredictor_;
+
+  /** A map of loads held on a predicted memory dependence, keyed by the
+   * sequence ID of the store they are waiting on to issue. */
+  std::unordered_map<uint64_t, std::vector<memoryDependencyEntry>>
+      memoryDependents_;
+
+  /** The sequence IDs of loads currently held on a predicted memory
+   * dependence. */
+  std::unordered_set<uint64_t> awaitingStore_;
+
+  /** The stores issued within the current cycle. */
+  std::vector<std::shared_ptr<Instruction>> issuedStores_;
+
+  /** Loads which were held on a predicted memory dependence but have yet to
+   * start their memory accesses, keyed by sequence ID. */
+  std::unordered_map<uint64_t, std::shared_ptr<Instruction>> delayedLoads_;
+
   /** The number of cycles stalled due to a full reservation station. */
   uint64_t rsStalls_ = 0;
 
@@ -144,6 +195,13 @@ class DispatchIssueUnit {
   /** The number of times an instruction was unable to issue due to a busy port.
    */
   uint64_t portBusyStalls_ = 0;
+
+  /** The number of loads held back on a predicted memory dependence. */
+  uint64_t loadsDelayed_ = 0;
+
+  /** The number of held back loads which were forwarded data from an earlier
+   * store. */
+  uint64_t violationsAvoided_ = 0;
 };
 
 }  // namespace pipeline
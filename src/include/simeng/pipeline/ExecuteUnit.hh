@@ -6,6 +6,7 @@
 #include "simeng/BranchPredictor.hh"
 #include "simeng/Instruction.hh"
 #include "simeng/pipeline/PipelineBuffer.hh"
+#include "simeng/pipeline/TimingWheel.hh"
 
 namespace simeng {
 namespace pipeline {
@@ -23,12 +24,13 @@ struct ExecutionUnitPipelineEntry {
  * forwards results. */
 class ExecuteUnit {
  public:
-  /** Constructs an execute unit with references to an input and output buffer,
-   * the currently used branch predictor, and handlers for forwarding operands,
+  /** Constructs an execute unit with references to an input buffer, the timing
+   * wheel on which executed instructions are scheduled for writeback, the
+   * currently used branch predictor, and handlers for forwarding operands,
    * loads/stores, and exceptions. */
   ExecuteUnit(
       PipelineBuffer<std::shared_ptr<Instruction>>& input,
-      PipelineBuffer<std::shared_ptr<Instruction>>& output,
+      TimingWheel<std::shared_ptr<Instruction>>& output,
       std::function<void(span<Register>, span<RegisterValue>)> forwardOperands,
       std::function<void(const std::shared_ptr<Instruction>&)> handleLoad,
       std::function<void(const std::shared_ptr<Instruction>&)> handleStore,
@@ -70,15 +72,15 @@ class ExecuteUnit {
   bool isEmpty() const;
 
  private:
-  /** Execute the supplied uop, write it into the output buffer, and forward
-   * results back to dispatch/issue. */
+  /** Execute the supplied uop, schedule it for writeback next cycle, and
+   * forward results back to dispatch/issue. */
   void execute(std::shared_ptr<Instruction>& uop);
 
   /** A buffer of instructions to execute. */
   PipelineBuffer<std::shared_ptr<Instruction>>& input_;
 
-  /** A buffer for writing executed instructions into. */
-  PipelineBuffer<std::shared_ptr<Instruction>>& output_;
+  /** A timing wheel to schedule the writeback of executed instructions on. */
+  TimingWheel<std::shared_ptr<Instruction>>& output_;
 
   /** A function handle called when forwarding operands. */
   std::function<void(span<Register>, span<RegisterValue>)> forwardOperands_;
@@ -19,17 +19,10 @@ enum class LoopBufferState {
 
 // Struct to hold information about a fetched instruction
 struct loopBufferEntry {
-  // Encoding of the instruction
-  const uint32_t encoding;
-
-  // Size of the instruction
-  const uint16_t instructionSize;
-
-  // PC of the instruction
-  const uint64_t address;
-
-  // Branch prediction made for instruction
-  const BranchPrediction prediction;
+  // Predecoded micro-ops of the instruction, including the branch prediction
+  // made for it, in the state they were supplied to decode. Replayed by
+  // cloning, rather than predecoding the instruction again
+  MacroOp macroOp;
 };
 
 /** A fetch and pre-decode unit for a pipelined processor. Responsible for
@@ -66,6 +59,13 @@ class FetchUnit {
    * branch. */
   uint64_t getBranchStalls() const;
 
+  /** Retrieve the number of macro-ops supplied to decode. */
+  uint64_t getMacroOpsFetched() const;
+
+  /** Retrieve the number of macro-ops supplied to decode from the loop
+   * buffer. */
+  uint64_t getLoopBufferSupplies() const;
+
   /** Clear the loop buffer. */
   void flushLoopBuffer();
 
@@ -105,6 +105,12 @@ class FetchUnit {
   /** The number of cycles fetch terminated early due to a predicted branch. */
   uint64_t branchStalls_ = 0;
 
+  /** The number of macro-ops supplied to decode. */
+  uint64_t macroOpsFetched_ = 0;
+
+  /** The number of macro-ops supplied to decode from the loop buffer. */
+  uint64_t loopBufferSupplies_ = 0;
+
   /** The size of a fetch block, in bytes. */
   uint16_t blockSize_;
 
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <deque>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "simeng/pipeline/CommitTrace.hh"
+
+namespace simeng {
+namespace pipeline {
+
+/** An event in the life of a micro-operation recorded in a Kanata log. */
+struct KonataEvent {
+  /** The cycle in which the event occurred. */
+  uint64_t cycle;
+
+  /** The log ID of the micro-operation; the index of its record. */
+  uint64_t id;
+
+  /** The stage entered, or the number of stages for the commit. */
+  uint8_t stage;
+};
+
+/** Writes the micro-operations committed by a core in the Kanata log format,
+ * such that their progress through the pipeline can be inspected in the
+ * Konata pipeline viewer.
+ *
+ * A Kanata log must list events in cycle order, but the stages of a
+ * micro-operation are only known once it commits, after younger
+ * micro-operations may already have been fetched. As micro-operations commit
+ * in program order, no later record holds an event before the first event of
+ * the latest record, so events up to that cycle are written periodically and
+ * only those of micro-operations still in flight at that point are held. */
+class KonataWriter : public TraceWriter {
+ public:
+  /** Open a log at `path`, replacing any existing file. Events are written
+   * once `flushThreshold` are held. */
+  explicit KonataWriter(const std::string& path,
+                        size_t flushThreshold = 1 << 16);
+
+  /** Write all remaining events to the log, and close it. */
+  ~KonataWriter() override;
+
+  /** Check whether the log file was opened successfully. */
+  bool isOpen() const;
+
+  /** Append a record of `uop`, committed in `commitCycle`. */
+  void record(const Instruction& uop, uint64_t commitCycle) override;
+
+  /** Append a committed micro-operation read from a binary commit trace. */
+  void record(const CommitRecord& record);
+
+ private:
+  /** Hold `record`, and write the events which can no longer be preceded by
+   * those of later records once enough are held. */
+  void append(CommitRecord record);
+
+  /** Write the events which occurred before `cycle`, in cycle order. */
+  void flush(uint64_t cycle);
+
+  /** Write the introduction and labels of the micro-operation `id`. */
+  void writeLabels(uint64_t id, const CommitRecord& record);
+
+  /** The log file. */
+  std::ofstream file_;
+
+  /** The number of held events at which they are written. */
+  size_t flushThreshold_;
+
+  /** The records whose commit is yet to be written, in commit order. */
+  std::deque<CommitRecord> records_;
+
+  /** The stage each held record was last written to be in; -2 for those yet
+   * to be introduced, and -1 for those yet to enter a stage. */
+  std::deque<int8_t> stages_;
+
+  /** The log ID of the first held record. */
+  uint64_t firstId_ = 0;
+
+  /** The events yet to be written. */
+  std::vector<KonataEvent> events_;
+
+  /** The first cycle of the latest record; no later record has an earlier
+   * event, so events before it may be written. */
+  uint64_t horizon_ = 0;
+
+  /** Whether a cycle has been written to the log yet. */
+  bool started_ = false;
+
+  /** The cycle the log was last advanced to. */
+  uint64_t cycle_ = 0;
+};
+
+}  // namespace pipeline
+}  // namespace simeng
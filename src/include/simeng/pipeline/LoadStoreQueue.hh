@@ -8,7 +8,7 @@
 
 #include "simeng/Instruction.hh"
 #include "simeng/memory/MemoryInterface.hh"
-#include "simeng/pipeline/PipelineBuffer.hh"
+#include "simeng/pipeline/TimingWheel.hh"
 
 namespace simeng {
 namespace pipeline {
@@ -16,6 +16,10 @@ namespace pipeline {
 /** The memory access types which are processed. */
 enum accessType { LOAD = 0, STORE };
 
+/** The number of low-order address bits ignored when bucketing in-flight
+ * memory accesses; accesses are grouped by the 64-byte region they touch. */
+const uint8_t ADDRESS_BUCKET_SHIFT = 6;
+
 /** A requestQueue_ entry. */
 struct requestEntry {
   /** The memory address(es) to be accessed. */
@@ -24,38 +28,52 @@ struct requestEntry {
   std::shared_ptr<Instruction> insn;
 };
 
+/** A storeAddressIndex_ entry. */
+struct storeAddressEntry {
+  /** The sequence ID of the store accessing the indexed address. */
+  uint64_t seqId;
+  /** The size of the store's access at the indexed address. */
+  uint16_t size;
+  /** The position of the access within the store's generated addresses. */
+  uint16_t index;
+};
+
 /** A load store queue (known as "load/store buffers" or "memory order buffer").
  * Holds in-flight memory access requests to ensure load/store consistency. */
 class LoadStoreQueue {
  public:
   /** Constructs a combined load/store queue model, simulating a shared queue
-   * for both load and store instructions, supplying completion slots for loads
-   * and an operand forwarding handler. */
+   * for both load and store instructions, supplying a timing wheel to schedule
+   * completed loads on, the number of loads which may complete each cycle, and
+   * an operand forwarding handler. */
   LoadStoreQueue(
       unsigned int maxCombinedSpace, memory::MemoryInterface& memory,
-      span<PipelineBuffer<std::shared_ptr<Instruction>>> completionSlots,
+      TimingWheel<std::shared_ptr<Instruction>>& completions,
+      uint16_t completionWidth,
       std::function<void(span<Register>, span<RegisterValue>)> forwardOperands,
       std::function<void(const std::shared_ptr<Instruction>&)> raiseException,
       bool exclusive = false, uint16_t loadBandwidth = UINT16_MAX,
       uint16_t storeBandwidth = UINT16_MAX,
       uint16_t permittedRequests = UINT16_MAX,
       uint16_t permittedLoads = UINT16_MAX,
-      uint16_t permittedStores = UINT16_MAX);
+      uint16_t permittedStores = UINT16_MAX, bool exemptForwardedLoads = false);
 
   /** Constructs a split load/store queue model, simulating discrete queues for
-   * load and store instructions, supplying completion slots for loads and an
-   * operand forwarding handler. */
+   * load and store instructions, supplying a timing wheel to schedule completed
+   * loads on, the number of loads which may complete each cycle, and an operand
+   * forwarding handler. */
   LoadStoreQueue(
       unsigned int maxLoadQueueSpace, unsigned int maxStoreQueueSpace,
       memory::MemoryInterface& memory,
-      span<PipelineBuffer<std::shared_ptr<Instruction>>> completionSlots,
+      TimingWheel<std::shared_ptr<Instruction>>& completions,
+      uint16_t completionWidth,
       std::function<void(span<Register>, span<RegisterValue>)> forwardOperands,
       std::function<void(const std::shared_ptr<Instruction>&)> raiseException,
       bool exclusive = false, uint16_t loadBandwidth = UINT16_MAX,
       uint16_t storeBandwidth = UINT16_MAX,
       uint16_t permittedRequests = UINT16_MAX,
       uint16_t permittedLoads = UINT16_MAX,
-      uint16_t permittedStores = UINT16_MAX);
+      uint16_t permittedStores = UINT16_MAX, bool exemptForwardedLoads = false);
 
   /** Retrieve the available space for load uops. For combined queue this is the
    * total remaining space. */
@@ -75,15 +93,19 @@ class LoadStoreQueue {
   /** Add a store uop to the queue. */
   void addStore(const std::shared_ptr<Instruction>& insn);
 
-  /** Add the load instruction's memory requests to the requestQueue_. */
-  void startLoad(const std::shared_ptr<Instruction>& insn);
+  /** Add the load instruction's memory requests to the requestQueue_. Returns
+   * `true` if any of the load's accesses will be forwarded from an earlier
+   * in-flight store. */
+  bool startLoad(const std::shared_ptr<Instruction>& insn);
 
   /** Supply the data to be stored by a store operation. */
   void supplyStoreData(const std::shared_ptr<Instruction>& insn);
 
   /** Commit and write the oldest store instruction to memory, removing it from
    * the store queue. Returns `true` if memory disambiguation has discovered a
-   * memory order violation during the commit. */
+   * memory order violation during the commit. If `exemptForwardedLoads_` is
+   * set, load accesses which are forwarded the store's data don't constitute a
+   * violation. */
   bool commitStore(const std::shared_ptr<Instruction>& uop);
 
   /** Remove the oldest load instruction from the load queue. */
@@ -98,6 +120,10 @@ class LoadStoreQueue {
   /** Process received load data and send any completed loads for writeback. */
   void tick();
 
+  /** Query whether any memory requests are waiting to be sent, or any received
+   * load data is waiting to be processed or written back. */
+  bool hasQueuedWork() const;
+
   /** Retrieve the load instruction associated with the most recently discovered
    * memory order violation. */
   std::shared_ptr<Instruction> getViolatingLoad() const;
@@ -112,12 +138,29 @@ class LoadStoreQueue {
                        span<const simeng::RegisterValue>>>
       storeQueue_;
 
-  /** Slots to write completed load instructions into for writeback. */
-  span<PipelineBuffer<std::shared_ptr<Instruction>>> completionSlots_;
+  /** A timing wheel to schedule the writeback of completed loads on. */
+  TimingWheel<std::shared_ptr<Instruction>>& completions_;
+
+  /** The maximum number of loads which may complete each cycle. */
+  uint16_t completionWidth_;
 
   /** Map of loads that have requested their data, keyed by sequence ID. */
   std::unordered_map<uint64_t, std::shared_ptr<Instruction>> requestedLoads_;
 
+  /** An index over the generated addresses of in-flight stores, keyed by the
+   * exact address accessed. Entries sharing an address are held in the order
+   * they were indexed. Used to find store-to-load forwarding candidates without
+   * searching the whole store queue. */
+  std::unordered_map<uint64_t, std::vector<storeAddressEntry>>
+      storeAddressIndex_;
+
+  /** An index over the generated addresses of the loads in requestedLoads_,
+   * keyed by address bucket (see `ADDRESS_BUCKET_SHIFT`). Values hold the
+   * sequence IDs of the loads accessing any byte within the bucket. Used to
+   * find memory order violations without comparing a committing store against
+   * every requested load. */
+  std::unordered_map<uint64_t, std::vector<uint64_t>> loadAddressIndex_;
+
   /** A function handler to call to forward the results of a completed load. */
   std::function<void(span<Register>, span<RegisterValue>)> forwardOperands_;
 
@@ -148,6 +191,31 @@ class LoadStoreQueue {
   /** Retrieve the total memory uop space available for a combined queue. */
   unsigned int getCombinedSpace() const;
 
+  /** Register the `addresses` accessed by the store with sequence ID `seqId` in
+   * storeAddressIndex_. */
+  void indexStoreAddresses(uint64_t seqId,
+                           span<const memory::MemoryAccessTarget> addresses);
+
+  /** Remove the `addresses` accessed by the store with sequence ID `seqId` from
+   * storeAddressIndex_. */
+  void unindexStoreAddresses(uint64_t seqId,
+                             span<const memory::MemoryAccessTarget> addresses);
+
+  /** Register the `addresses` accessed by the load with sequence ID `seqId` in
+   * loadAddressIndex_. */
+  void indexLoadAddresses(uint64_t seqId,
+                          span<const memory::MemoryAccessTarget> addresses);
+
+  /** Remove the `addresses` accessed by the load with sequence ID `seqId` from
+   * loadAddressIndex_. */
+  void unindexLoadAddresses(uint64_t seqId,
+                            span<const memory::MemoryAccessTarget> addresses);
+
+  /** Query whether the `load` access to `address` registered a confliction on
+   * the store with sequence ID `storeSeqId`, and so is forwarded its data. */
+  bool isForwarded(uint64_t storeSeqId, const std::shared_ptr<Instruction>& load,
+                   uint64_t address) const;
+
   /** A pointer to process memory. */
   memory::MemoryInterface& memory_;
 
@@ -193,6 +261,11 @@ class LoadStoreQueue {
 
   /** The number of loads and stores permitted per cycle. */
   std::array<uint16_t, 2> reqLimits_;
+
+  /** Whether load accesses forwarded the data of a committing store are exempt
+   * from memory order violations. Only set when a memory dependence predictor
+   * is in use, such that the timing of models without one is unchanged. */
+  bool exemptForwardedLoads_;
 };
 
 }  // namespace pipeline
@@ -24,7 +24,7 @@ class M1PortAllocator : public PortAllocator {
   /** Allocate the lowest weighted port available for the specified instruction
    * group. Returns the allocated port, and increases the weight of the port.
    */
-  uint16_t allocate(const std::vector<uint16_t>& ports) override;
+  uint16_t allocate(PortMask ports) override;
 
   /** Decrease the weight for the specified port. */
   void issued(uint16_t port) override;
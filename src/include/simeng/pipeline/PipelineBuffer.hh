@@ -12,21 +12,28 @@ namespace pipeline {
 // implementation)
 
 /** A tickable pipelined buffer. Values are shifted from the tail slot to the
- * head slot each time `tick()` is called. */
+ * head slot each time `tick()` is called.
+ *
+ * The buffer is a fixed-capacity ring of two rows of slots. Ticking swaps which
+ * row is the head and which is the tail, such that values are handed from one
+ * pipeline unit to the next without being copied or moved. */
 template <class T>
 class PipelineBuffer {
  public:
   /** Construct a pipeline buffer of width `width`, and fill all slots with
    * `initialValue`. */
   PipelineBuffer(uint16_t width, const T& initialValue)
-      : width(width), buffer(width * length, initialValue) {}
+      : width(width),
+        buffer(width * length, initialValue),
+        headOffset_(width),
+        tailOffset_(0) {}
 
   /** Tick the buffer and move head/tail pointers, or do nothing if it's
    * stalled. */
   void tick() {
     if (isStalled_) return;
 
-    headIsStart = !headIsStart;
+    std::swap(headOffset_, tailOffset_);
   }
 
   /** Return the slots waiting to be processed by the next pipeline unit */
@@ -40,26 +47,14 @@ class PipelineBuffer {
   }
 
   /** Get a tail slots pointer. */
-  T* getTailSlots() {
-    T* ptr = buffer.data();
-    return &ptr[headIsStart * width];
-  }
+  T* getTailSlots() { return buffer.data() + tailOffset_; }
   /** Get a const tail slots pointer. */
-  const T* getTailSlots() const {
-    const T* ptr = buffer.data();
-    return &ptr[headIsStart * width];
-  }
+  const T* getTailSlots() const { return buffer.data() + tailOffset_; }
 
   /** Get a head slots pointer. */
-  T* getHeadSlots() {
-    T* ptr = buffer.data();
-    return &ptr[!headIsStart * width];
-  }
+  T* getHeadSlots() { return buffer.data() + headOffset_; }
   /** Get a const head slots pointer. */
-  const T* getHeadSlots() const {
-    const T* ptr = buffer.data();
-    return &ptr[!headIsStart * width];
-  }
+  const T* getHeadSlots() const { return buffer.data() + headOffset_; }
 
   /** Check if the buffer is stalled. */
   bool isStalled() const { return isStalled_; }
@@ -80,8 +75,13 @@ class PipelineBuffer {
   /** The buffer. */
   std::vector<T> buffer;
 
-  /** The offset of the head pointer; either 0 or 1. */
-  bool headIsStart = 0;
+  /** The offset of the head row of slots within `buffer`; either 0 or
+   * `width`. */
+  size_t headOffset_;
+
+  /** The offset of the tail row of slots within `buffer`; either 0 or
+   * `width`. */
+  size_t tailOffset_;
 
   /** Whether the buffer is stalled or not. */
   bool isStalled_ = false;
@@ -2,6 +2,9 @@
 
 #include <cstdint>
 #include <functional>
+#include <vector>
+
+#include "simeng/PortMask.hh"
 
 namespace simeng {
 namespace pipeline {
@@ -18,9 +21,9 @@ class PortAllocator {
  public:
   virtual ~PortAllocator(){};
 
-  /** Allocate a port for the specified instruction group; returns the allocated
-   * port. */
-  virtual uint16_t allocate(const std::vector<uint16_t>& ports) = 0;
+  /** Allocate one of the set of supported `ports` for an instruction; returns
+   * the allocated port. */
+  virtual uint16_t allocate(PortMask ports) = 0;
 
   /** Inform the allocator that an instruction was issued to the specified port.
    */
@@ -1,21 +1,44 @@
 #pragma once
 
-#include <queue>
+#include <vector>
 
 #include "simeng/RegisterFileSet.hh"
 
 namespace simeng {
 namespace pipeline {
 
+/** A snapshot of the register renaming state, taken once an instruction has
+ * been renamed. */
+struct ratCheckpoint {
+  /** The ID of the instruction the snapshot was taken after. */
+  uint64_t insnId;
+
+  /** The architectural -> physical register mappings of each register type at
+   * the time of the snapshot. */
+  std::vector<std::vector<uint16_t>> mappingTable;
+
+  /** A bitmap, for each register type, of the physical registers allocated
+   * since the snapshot was taken. */
+  std::vector<std::vector<uint64_t>> allocated;
+};
+
 /** A Register Alias Table (RAT) implementation. Contains information on
- * the current register renaming state. */
+ * the current register renaming state.
+ *
+ * Upon a flush, allocations may either be rewound one at a time in reverse
+ * order, or the renaming state may be restored from a checkpoint in a single
+ * step. A bounded number of checkpoints are available, typically taken at
+ * branches such that recovery from a misprediction doesn't depend on the
+ * number of instructions flushed. */
 class RegisterAliasTable {
  public:
   /** Construct a RAT, supplying a description of the architectural register
-   * structure, and the corresponding numbers of physical registers that should
-   * be available. */
+   * structure, the corresponding numbers of physical registers that should
+   * be available, and the maximum number of checkpoints which may be held at
+   * once. */
   RegisterAliasTable(std::vector<RegisterFileStructure> architecturalStructure,
-                     std::vector<uint16_t> physicalRegisterCounts);
+                     std::vector<uint16_t> physicalRegisterCounts,
+                     uint16_t checkpointCount = 0);
 
   /** Retrieve the current physical register assigned to the provided
    * architectural register. */
@@ -43,7 +66,31 @@ class RegisterAliasTable {
    * is reinstated to the mapping table, and the provided register is freed. */
   void rewind(Register physical);
 
+  /** Take a checkpoint of the current renaming state, following the renaming
+   * of the instruction `insnId`. Returns false if no checkpoint is free. */
+  bool checkpoint(uint64_t insnId);
+
+  /** Release all checkpoints taken after instructions up to and including
+   * `insnId`, which has committed. */
+  void releaseCheckpoints(uint64_t insnId);
+
+  /** Discard all checkpoints taken after instructions newer than
+   * `afterInsnId`. If a checkpoint was taken after `afterInsnId` itself, the
+   * renaming state is restored from it, undoing all newer allocations, and
+   * true is returned. Otherwise, the caller must rewind each newer allocation.
+   */
+  bool restoreCheckpoint(uint64_t afterInsnId);
+
+  /** Get the number of checkpoints currently held. */
+  unsigned int getCheckpointsInUse() const;
+
  private:
+  /** Retrieve the youngest checkpoint held. */
+  ratCheckpoint& getYoungestCheckpoint();
+
+  /** Mark the physical register `tag` of type `type` as free. */
+  void freeRegister(uint8_t type, uint16_t tag);
+
   /** The register mapping tables. Holds a map of architectural -> physical
    * register mappings for each register type. */
   std::vector<std::vector<uint16_t>> mappingTable_;
@@ -57,9 +104,22 @@ class RegisterAliasTable {
    * register mappings for each register type. Used for rewind behaviour. */
   std::vector<std::vector<uint16_t>> destinationTable_;
 
-  /** The free register queues. Holds a list of unallocated physical registers
-   * for each register type. */
-  std::vector<std::queue<uint16_t>> freeQueues_;
+  /** The free register bitmaps. Holds a set bit for each unallocated physical
+   * register of each register type. */
+  std::vector<std::vector<uint64_t>> freeBitmaps_;
+
+  /** The number of unallocated physical registers of each register type. */
+  std::vector<uint16_t> freeCounts_;
+
+  /** The circular buffer of checkpoints, ordered from oldest to youngest. Each
+   * checkpoint's tables are allocated upfront. */
+  std::vector<ratCheckpoint> checkpoints_;
+
+  /** The index of the oldest checkpoint held. */
+  uint16_t checkpointHead_ = 0;
+
+  /** The number of checkpoints held. */
+  uint16_t checkpointsInUse_ = 0;
 };
 
 }  // namespace pipeline
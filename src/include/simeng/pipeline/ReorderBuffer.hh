@@ -1,11 +1,12 @@
 #pragma once
 
-#include <deque>
 #include <functional>
+#include <vector>
 
 #include "simeng/Instruction.hh"
 #include "simeng/pipeline/LoadStoreQueue.hh"
 #include "simeng/pipeline/RegisterAliasTable.hh"
+#include "simeng/pipeline/StoreSetPredictor.hh"
 
 namespace simeng {
 namespace pipeline {
@@ -23,6 +24,21 @@ struct latestBranch {
   uint64_t commitNumber;
 };
 
+/** A group of in-flight micro-operations sharing an instruction ID, as held
+ * contiguously within the reorder buffer. */
+struct microOpGroup {
+  /** The instruction ID shared by all micro-operations of the group. */
+  uint64_t insnId;
+
+  /** The reorder buffer slot holding the oldest micro-operation of the group.
+   */
+  uint32_t first;
+
+  /** The number of micro-operations of the group held in the reorder buffer.
+   */
+  uint32_t size;
+};
+
 /** Check if the instruction ID is less/greater than a given value used by
  *  binary_search. */
 struct idCompare {
@@ -38,27 +54,39 @@ struct idCompare {
 };
 
 /** A Reorder Buffer (ROB) implementation. Contains an in-order queue of
- * in-flight instructions. */
+ * in-flight instructions, held in a fixed-capacity circular buffer.
+ *
+ * Sequence IDs are allocated such that an instruction's slot is its sequence
+ * ID modulo the capacity, and likewise for the micro-operation group of each
+ * instruction ID. As such, both may be located without searching the buffer.
+ * Upon a flush, the next sequence and instruction IDs are advanced to the
+ * value mapping onto the new tail of the buffer; IDs therefore remain unique
+ * and increasing, but are not necessarily contiguous. */
 class ReorderBuffer {
  public:
   /** Constructs a reorder buffer of maximum size `maxSize`, supplying a
-   * reference to the register alias table. */
+   * reference to the register alias table. If provided, `traceCommit` is
+   * called with each micro-operation as it's committed. */
   ReorderBuffer(
       uint32_t maxSize, RegisterAliasTable& rat, LoadStoreQueue& lsq,
       std::function<void(const std::shared_ptr<Instruction>&)> raiseException,
       std::function<void(uint64_t branchAddress)> sendLoopBoundary,
-      BranchPredictor& predictor, uint16_t loopBufSize,
-      uint16_t loopDetectionThreshold);
+      BranchPredictor& predictor, StoreSetPredictor& storeSetPredictor,
+      uint16_t loopBufSize, uint16_t loopDetectionThreshold,
+      std::function<void(const Instruction& uop)> traceCommit = nullptr);
 
   /** Add the provided instruction to the ROB. */
   void reserve(const std::shared_ptr<Instruction>& insn);
 
+  /** Set all micro-operations of the instruction `insnId` as ready to commit,
+   * if all have been reserved and are waiting to commit. */
   void commitMicroOps(uint64_t insnId);
 
   /** Commit and remove up to `maxCommitSize` instructions. */
   unsigned int commit(uint64_t maxCommitSize);
 
-  /** Flush all instructions with a sequence ID greater than `afterSeqId`. */
+  /** Flush all instructions with an instruction ID greater than
+   * `afterInsnId`. */
   void flush(uint64_t afterInsnId);
 
   /** Retrieve the current size of the ROB. */
@@ -67,6 +95,10 @@ class ReorderBuffer {
   /** Retrieve the current amount of free space in the ROB. */
   unsigned int getFreeSpace() const;
 
+  /** Query whether the instruction at the head of the ROB is ready to commit.
+   */
+  bool isHeadCommitReady() const;
+
   /** Query whether a memory order violation was discovered in the most recent
    * cycle. */
   bool shouldFlush() const;
@@ -86,6 +118,12 @@ class ReorderBuffer {
   uint64_t getViolatingLoadsCount() const;
 
  private:
+  /** Remove the instruction at the head of the buffer. */
+  void popHead();
+
+  /** Retrieve the slot of the youngest in-flight micro-operation group. */
+  uint32_t getTailGroup() const;
+
   /** A reference to the register alias table. */
   RegisterAliasTable& rat_;
 
@@ -101,14 +139,39 @@ class ReorderBuffer {
   /** A function to send an instruction at a detected loop boundary. */
   std::function<void(uint64_t branchAddress)> sendLoopBoundary_;
 
+  /** A function to call with each committed micro-operation, if any. */
+  std::function<void(const Instruction& uop)> traceCommit_;
+
   /** Whether or not a loop has been detected. */
   bool loopDetected_ = false;
 
   /** A reference to the current branch predictor. */
   BranchPredictor& predictor_;
 
-  /** The buffer containing in-flight instructions. */
-  std::deque<std::shared_ptr<Instruction>> buffer_;
+  /** A reference to the memory dependence predictor, trained on each memory
+   * order violation. */
+  StoreSetPredictor& storeSetPredictor_;
+
+  /** The circular buffer containing in-flight instructions, indexed by
+   * sequence ID modulo `maxSize_`. */
+  std::vector<std::shared_ptr<Instruction>> buffer_;
+
+  /** The slot of the oldest in-flight instruction. */
+  uint32_t head_ = 0;
+
+  /** The number of in-flight instructions. */
+  uint32_t size_ = 0;
+
+  /** The circular buffer of in-flight micro-operation groups, indexed by
+   * instruction ID modulo `maxSize_`. */
+  std::vector<microOpGroup> groups_;
+
+  /** The slot of the oldest in-flight micro-operation group. */
+  uint32_t groupHead_ = 0;
+
+  /** The number of in-flight micro-operation groups. A group is retained
+   * until it is empty and its final micro-operation has been reserved. */
+  uint32_t groupCount_ = 0;
 
   /** Whether the core should be flushed after the most recent commit. */
   bool shouldFlush_ = false;
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "simeng/Instruction.hh"
+#include "simeng/config/SimInfo.hh"
+
+namespace simeng {
+namespace pipeline {
+
+/** A store set memory dependence predictor. Loads which have been caught
+ * executing ahead of an earlier, conflicting store are grouped with that store
+ * into a "store set". At dispatch, a load whose store set holds an in-flight
+ * store which has yet to issue is predicted to depend on it, and should be held
+ * back until that store issues.
+ *
+ * The predictor is formed of a Store Set ID Table (SSIT), indexed by
+ * instruction address, which maps loads and stores to a store set, and a Last
+ * Fetched Store Table (LFST), which holds the most recently dispatched store of
+ * each store set that is yet to issue. Both tables are periodically cleared so
+ * that stale dependences don't needlessly serialise loads. */
+class StoreSetPredictor {
+ public:
+  /** Construct a store set predictor, reading its table sizes and clearing
+   * interval from the supplied config. */
+  StoreSetPredictor(ryml::ConstNodeRef config = config::SimInfo::getConfig());
+
+  /** Tick the predictor, clearing all learnt store sets once every
+   * `clearInterval_` cycles. */
+  void tick();
+
+  /** Retrieve the in-flight store the supplied load is predicted to depend on,
+   * or nullptr if no dependence is predicted. */
+  std::shared_ptr<Instruction> getPredictedStore(
+      const std::shared_ptr<Instruction>& load) const;
+
+  /** Register a newly dispatched store as the latest store of its store set. */
+  void storeDispatched(const std::shared_ptr<Instruction>& store);
+
+  /** Inform the predictor that a store has issued, such that later loads of
+   * its store set no longer need to wait on it. */
+  void storeIssued(const std::shared_ptr<Instruction>& store);
+
+  /** Train the predictor on a memory order violation between the store at
+   * instruction address `storeAddress` and the load at `loadAddress`. */
+  void train(uint64_t storeAddress, uint64_t loadAddress);
+
+  /** Query whether the predictor is in use. */
+  bool isEnabled() const;
+
+ private:
+  /** Retrieve the SSIT index for the supplied instruction address. */
+  uint64_t getSSITIndex(uint64_t address) const;
+
+  /** Assign the SSIT entry at `index` to the store set `storeSetId`. Any store
+   * tracked under the entry's previous store set is forgotten, so that no load
+   * can be held on a store which is no longer tracked through the SSIT. */
+  void assignStoreSet(uint64_t index, uint32_t storeSetId);
+
+  /** Clear all entries of the SSIT and LFST. */
+  void clear();
+
+  /** An SSIT entry value denoting that no store set has been assigned. */
+  static constexpr uint32_t invalidStoreSet_ = UINT32_MAX;
+
+  /** Whether the predictor is in use. */
+  bool enabled_;
+
+  /** The store set ID table, mapping instruction addresses to store sets. */
+  std::vector<uint32_t> ssit_;
+
+  /** The last fetched store table, holding the latest dispatched but not yet
+   * issued store of each store set. */
+  std::vector<std::shared_ptr<Instruction>> lfst_;
+
+  /** The next store set ID to allocate. */
+  uint32_t nextStoreSetId_ = 0;
+
+  /** The number of cycles between clearing all learnt store sets; a value of 0
+   * disables clearing. */
+  uint64_t clearInterval_;
+
+  /** The number of cycles since the store sets were last cleared. */
+  uint64_t ticksSinceClear_ = 0;
+};
+
+}  // namespace pipeline
+}  // namespace simeng
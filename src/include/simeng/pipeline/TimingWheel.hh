@@ -0,0 +1,104 @@
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace simeng {
+namespace pipeline {
+
+/** A tickable timing wheel, holding events keyed by the cycle they fall due.
+ *
+ * Events are held in a ring of per-cycle buckets indexed by their due cycle, so
+ * scheduling an event and retrieving those due this cycle only touch the
+ * events concerned, regardless of how many producers may schedule them. The
+ * ring is doubled in size whenever an event is scheduled beyond its horizon.
+ * Bucket storage is retained once emptied, so a wheel in steady state does not
+ * allocate. */
+template <class T>
+class TimingWheel {
+ public:
+  /** Construct a timing wheel able to hold events up to `horizon` cycles in
+   * the future before growing. */
+  explicit TimingWheel(size_t horizon = 8) {
+    size_t size = 1;
+    while (size <= horizon) size <<= 1;
+    buckets_.resize(size);
+  }
+
+  /** Schedule `event` to fall due `delay` ticks from now. An event with a
+   * delay of zero is due this cycle. */
+  void schedule(T event, uint64_t delay) {
+    if (delay >= buckets_.size()) grow(delay);
+    buckets_[(current_ + delay) & (buckets_.size() - 1)].push_back(
+        std::move(event));
+    scheduled_++;
+  }
+
+  /** Get the events due this cycle, in the order they were scheduled. */
+  const std::vector<T>& getDueEvents() const { return buckets_[current_]; }
+
+  /** Get the events which will fall due `delay` ticks from now. */
+  const std::vector<T>& getEvents(uint64_t delay) const {
+    assert(delay < buckets_.size() && "Delay exceeds the wheel's horizon");
+    return buckets_[(current_ + delay) & (buckets_.size() - 1)];
+  }
+
+  /** Remove all events due this cycle, once processed. */
+  void clearDueEvents() {
+    scheduled_ -= buckets_[current_].size();
+    buckets_[current_].clear();
+  }
+
+  /** Tick the wheel, such that events due next cycle become due. Any events
+   * due this cycle which have not been cleared are carried over. */
+  void tick() {
+    auto& due = buckets_[current_];
+    current_ = (current_ + 1) & (buckets_.size() - 1);
+    if (due.empty()) return;
+
+    auto& next = buckets_[current_];
+    next.insert(next.begin(), std::make_move_iterator(due.begin()),
+                std::make_move_iterator(due.end()));
+    due.clear();
+  }
+
+  /** Check whether any events are scheduled, including those due this cycle.
+   */
+  bool empty() const { return scheduled_ == 0; }
+
+  /** Remove all scheduled events. */
+  void clear() {
+    for (auto& bucket : buckets_) bucket.clear();
+    scheduled_ = 0;
+  }
+
+ private:
+  /** Enlarge the ring to hold events at least `delay` ticks in the future,
+   * moving each bucket to the index of its due cycle in the enlarged ring. */
+  void grow(uint64_t delay) {
+    size_t size = buckets_.size();
+    while (size <= delay) size <<= 1;
+
+    std::vector<std::vector<T>> buckets(size);
+    for (size_t offset = 0; offset < buckets_.size(); offset++) {
+      buckets[offset] =
+          std::move(buckets_[(current_ + offset) & (buckets_.size() - 1)]);
+    }
+    buckets_ = std::move(buckets);
+    current_ = 0;
+  }
+
+  /** The ring of buckets, one per cycle; the size is a power of two. */
+  std::vector<std::vector<T>> buckets_;
+
+  /** The index of the bucket holding the events due this cycle. */
+  size_t current_ = 0;
+
+  /** The number of events currently scheduled. */
+  size_t scheduled_ = 0;
+};
+
+}  // namespace pipeline
+}  // namespace simeng
@@ -4,7 +4,7 @@
 
 #include "simeng/Instruction.hh"
 #include "simeng/RegisterFileSet.hh"
-#include "simeng/pipeline/PipelineBuffer.hh"
+#include "simeng/pipeline/TimingWheel.hh"
 
 namespace simeng {
 namespace pipeline {
@@ -13,22 +13,24 @@ namespace pipeline {
  * the register files. */
 class WritebackUnit {
  public:
-  /** Constructs a writeback unit with references to an input buffer and
-   * register file to write to. */
-  WritebackUnit(std::vector<PipelineBuffer<std::shared_ptr<Instruction>>>&
-                    completionSlots,
+  /** Constructs a writeback unit with references to the timing wheel on which
+   * completed instructions are scheduled, and the register file to write to.
+   */
+  WritebackUnit(TimingWheel<std::shared_ptr<Instruction>>& completions,
                 RegisterFileSet& registerFileSet,
                 std::function<void(uint64_t insnId)> flagMicroOpCommits);
 
-  /** Tick the writeback unit to perform its operation for this cycle. */
+  /** Tick the writeback unit to perform its operation for this cycle. Only the
+   * instructions scheduled to complete this cycle are processed. */
   void tick();
 
   /** Retrieve a count of the number of instructions retired. */
   uint64_t getInstructionsWrittenCount() const;
 
  private:
-  /** Buffers of completed instructions to process. */
-  std::vector<PipelineBuffer<std::shared_ptr<Instruction>>>& completionSlots_;
+  /** A timing wheel of completed instructions to process, keyed by the cycle
+   * they are written back. */
+  TimingWheel<std::shared_ptr<Instruction>>& completions_;
 
   /** The register file set to write results into. */
   RegisterFileSet& registerFileSet_;
@@ -6,7 +6,7 @@ CoreInstance::CoreInstance(std::string executablePath,
                            std::vector<std::string> executableArgs,
                            ryml::ConstNodeRef config)
     : config_(config),
-      kernel_(kernel::Linux(
+      kernel_(std::make_shared<kernel::Linux>(
           config_["CPU-Info"]["Special-File-Dir-Path"].as<std::string>())) {
   generateCoreModel(executablePath, executableArgs);
 }
@@ -14,7 +14,7 @@ CoreInstance::CoreInstance(std::string executablePath,
 CoreInstance::CoreInstance(uint8_t* assembledSource, size_t sourceSize,
                            ryml::ConstNodeRef config)
     : config_(config),
-      kernel_(kernel::Linux(
+      kernel_(std::make_shared<kernel::Linux>(
           config_["CPU-Info"]["Special-File-Dir-Path"].as<std::string>())),
       source_(assembledSource),
       sourceSize_(sourceSize),
@@ -24,6 +24,15 @@ CoreInstance::CoreInstance(uint8_t* assembledSource, size_t sourceSize,
   generateCoreModel("", std::vector<std::string>{});
 }
 
+CoreInstance::CoreInstance(const CoreInstance& primary, uint16_t coreId)
+    : config_(primary.config_),
+      kernel_(primary.kernel_),
+      coreId_(coreId),
+      processMemorySize_(primary.processMemorySize_),
+      processMemory_(primary.processMemory_) {
+  createMemoryInterfaces();
+}
+
 CoreInstance::~CoreInstance() {
   if (source_) {
     delete[] source_;
@@ -33,6 +42,10 @@ CoreInstance::~CoreInstance() {
 void CoreInstance::generateCoreModel(std::string executablePath,
                                      std::vector<std::string> executableArgs) {
   createProcess(executablePath, executableArgs);
+  createMemoryInterfaces();
+}
+
+void CoreInstance::createMemoryInterfaces() {
   // Check to see if either of the instruction or data memory interfaces should
   // be created. Don't create the core if either interface is marked as External
   // as they must be set manually prior to the core's creation.
@@ -117,7 +130,7 @@ void CoreInstance::createProcess(std::string executablePath,
   createProcessMemory();
 
   // Create the OS kernel with the process
-  kernel_.createProcess(*process_.get());
+  kernel_->createProcess(*process_.get());
 
   return;
 }
@@ -163,6 +176,10 @@ void CoreInstance::setL1InstructionMemory(
 }
 
 void CoreInstance::createL1DataMemory(const memory::MemInterfaceType type) {
+  // Both interface types access the process image directly, so the kernel may
+  // populate file-backed mappings in place
+  kernel_->setProcessMemory(processMemory_.get(), processMemorySize_);
+
   // Create a L1D cache instance based on type supplied
   if (type == memory::MemInterfaceType::Flat) {
     dataMemory_ = std::make_shared<memory::FlatMemoryInterface>(
@@ -209,11 +226,13 @@ void CoreInstance::createCore() {
     exit(1);
   }
 
-  // Create the architecture, with knowledge of the OS
+  // Create the architecture, with knowledge of the OS. The architecture
+  // retrieves the initial state of the thread running on this core
+  kernel_->setCurrentCore(coreId_);
   if (config::SimInfo::getISA() == config::ISA::RV64) {
-    arch_ = std::make_unique<arch::riscv::Architecture>(kernel_);
+    arch_ = std::make_unique<arch::riscv::Architecture>(*kernel_);
   } else if (config::SimInfo::getISA() == config::ISA::AArch64) {
-    arch_ = std::make_unique<arch::aarch64::Architecture>(kernel_);
+    arch_ = std::make_unique<arch::aarch64::Architecture>(*kernel_);
   }
 
   std::string predictorType =
@@ -239,25 +258,29 @@ void CoreInstance::createCore() {
   portAllocator_ =
       std::make_unique<pipeline::BalancedPortAllocator>(portArrangement);
 
-  // Construct the core object based on the defined simulation mode
-  uint64_t entryPoint = process_->getEntryPoint();
+  // Construct the core object based on the defined simulation mode. An
+  // additional core begins from wherever its thread was suspended
+  uint64_t entryPoint = process_ ? process_->getEntryPoint()
+                                 : kernel_->getRunningThread().pc;
   if (config::SimInfo::getSimMode() == config::SimulationMode::Emulation) {
     core_ = std::make_shared<models::emulation::Core>(
-        *instructionMemory_, *dataMemory_, entryPoint, processMemorySize_,
+        processMemory_.get(), *dataMemory_, entryPoint, processMemorySize_,
         *arch_);
   } else if (config::SimInfo::getSimMode() ==
              config::SimulationMode::InOrderPipelined) {
     core_ = std::make_shared<models::inorder::Core>(
         *instructionMemory_, *dataMemory_, processMemorySize_, entryPoint,
-        *arch_, *predictor_);
+        *arch_, *predictor_, config_);
   } else if (config::SimInfo::getSimMode() ==
              config::SimulationMode::Outoforder) {
     core_ = std::make_shared<models::outoforder::Core>(
         *instructionMemory_, *dataMemory_, processMemorySize_, entryPoint,
         *arch_, *predictor_, *portAllocator_, config_);
   }
+  core_->setCoreId(coreId_);
 
-  createSpecialFileDirectory();
+  // Only the first core creates the special files directory
+  if (process_) createSpecialFileDirectory();
 
   return;
 }
@@ -318,4 +341,8 @@ uint64_t CoreInstance::getProcessImageSize() const {
 
 uint64_t CoreInstance::getHeapStart() const { return process_->getHeapStart(); }
 
+std::shared_ptr<kernel::Linux> CoreInstance::getKernel() const {
+  return kernel_;
+}
+
 }  // namespace simeng
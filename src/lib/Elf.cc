@@ -1,11 +1,22 @@
 #include "simeng/Elf.hh"
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 #include <cstring>
-#include <fstream>
 #include <iostream>
 
 namespace simeng {
 
+template <typename T>
+bool Elf::read(uint64_t offset, T& value) const {
+  if (offset > fileSize_ || fileSize_ - offset < sizeof(T)) return false;
+  std::memcpy(&value, file_ + offset, sizeof(T));
+  return true;
+}
+
 /**
  * Extract information from an ELF binary.
  * 32-bit and 64-bit architectures have variance in the structs
@@ -14,13 +25,25 @@ namespace simeng {
  * https://man7.org/linux/man-pages/man5/elf.5.html
  */
 
-Elf::Elf(std::string path, char** imagePointer) {
-  std::ifstream file(path, std::ios::binary);
-
-  if (!file.is_open()) {
+Elf::Elf(std::string path) {
+  fd_ = open(path.c_str(), O_RDONLY);
+  if (fd_ < 0) {
     return;
   }
 
+  // Map the whole file; pages are only read from disk once accessed
+  struct stat fileStat;
+  if (fstat(fd_, &fileStat) == 0 && fileStat.st_size > 0) {
+    fileSize_ = fileStat.st_size;
+    void* mapping = mmap(nullptr, fileSize_, PROT_READ, MAP_PRIVATE, fd_, 0);
+    if (mapping == MAP_FAILED) {
+      std::cerr << "[SimEng:Elf] Failed to map Elf" << std::endl;
+      fileSize_ = 0;
+      return;
+    }
+    file_ = static_cast<const char*>(mapping);
+  }
+
   /**
    * In the Linux source tree the ELF header
    * is defined by the elf64_hdr struct for 64-bit systems.
@@ -34,9 +57,8 @@ Elf::Elf(std::string path, char** imagePointer) {
    * First four bytes of the ELF header represent the ELF Magic Number.
    */
   char elfMagic[4] = {0x7f, 'E', 'L', 'F'};
-  char fileMagic[4];
-  file.read(fileMagic, 4);
-  if (std::memcmp(elfMagic, fileMagic, sizeof(elfMagic))) {
+  if (fileSize_ < sizeof(elfMagic) ||
+      std::memcmp(elfMagic, file_, sizeof(elfMagic))) {
     std::cerr << "[SimEng:Elf] Elf magic does not match" << std::endl;
     return;
   }
@@ -47,16 +69,14 @@ Elf::Elf(std::string path, char** imagePointer) {
    */
 
   // Check whether this is a 32 or 64-bit executable
-  char bitFormat;
-  file.read(&bitFormat, sizeof(bitFormat));
+  char bitFormat = 0;
+  read(4, bitFormat);
   if (bitFormat != ElfBitFormat::Format64) {
     std::cerr << "[SimEng:Elf] Unsupported architecture detected in Elf"
               << std::endl;
     return;
   }
 
-  isValid_ = true;
-
   /**
    * Starting from the 24th byte of the ELF header a 64-bit value
    * represents the virtual address to which the system first transfers
@@ -64,10 +84,9 @@ Elf::Elf(std::string path, char** imagePointer) {
    * In `elf64_hdr` this value maps to the member `Elf64_Addr e_entry`.
    */
 
-  // Seek to the entry point of the file.
+  // Read the entry point of the file.
   // The information in between is discarded
-  file.seekg(0x18);
-  file.read(reinterpret_cast<char*>(&entryPoint_), sizeof(entryPoint_));
+  read(0x18, entryPoint_);
 
   /**
    * Starting from the 32nd byte of the ELF Header a 64-bit value
@@ -76,11 +95,11 @@ Elf::Elf(std::string path, char** imagePointer) {
    * In `elf64_hdr` this value maps to the member `Elf64_Addr e_phoff`.
    */
 
-  // Seek to the byte representing the start of the header offset table.
+  // Read the byte representing the start of the header offset table.
   // Holds the program header table's file offset in bytes.  If the file has no
   // program header table, this member holds zero
   uint64_t e_phoff = 0;
-  file.read(reinterpret_cast<char*>(&e_phoff), sizeof(e_phoff));
+  read(0x20, e_phoff);
 
   /**
    * Starting from the 54th byte of the ELF Header a 16-bit value indicates the
@@ -88,15 +107,17 @@ Elf::Elf(std::string path, char** imagePointer) {
    * are the same size. In the `elf64_hdr` struct this value maps to the member
    * `Elf64_Half e_phentsize`.
    */
-  // Seek to the byte representing header entry size.
-  file.seekg(0x36);
-  file.read(reinterpret_cast<char*>(&e_phentsize_), sizeof(e_phentsize_));
+  // Read the bytes representing header entry size.
+  read(0x36, e_phentsize_);
 
   /** Starting from the 56th byte a 16-bit value represents the number
    * of program header entries in the ELF Program header table. In the
    * `elf64_hdr` struct this value maps to `Elf64_Half e_phnum`.
    */
-  file.read(reinterpret_cast<char*>(&e_phnum_), sizeof(e_phnum_));
+  if (!read(0x38, e_phnum_)) {
+    std::cerr << "[SimEng:Elf] Elf header is truncated" << std::endl;
+    return;
+  }
 
   // Resize the header to equal the number of header entries.
   pheaders_.resize(e_phnum_);
@@ -107,7 +128,7 @@ Elf::Elf(std::string path, char** imagePointer) {
     // Since all headers entries have the same size.
     // We can extract the nth header using the header offset
     // and header entry size.
-    file.seekg(e_phoff + (i * e_phentsize_));
+    uint64_t headerOffset = e_phoff + (i * e_phentsize_);
     auto& header = pheaders_[i];
 
     /**
@@ -136,16 +157,21 @@ Elf::Elf(std::string path, char** imagePointer) {
      * beginning of the file at which the first byte of the segment resides.
      */
 
-    // Each address-related field is 8 bytes in a 64-bit ELF file
-    const int fieldBytes = 8;
-    file.read(reinterpret_cast<char*>(&(header.p_type)), sizeof(header.p_type));
-    file.seekg(4, std::ios::cur);  // Skip flags
-    file.read(reinterpret_cast<char*>(&(header.p_offset)), fieldBytes);
-    file.read(reinterpret_cast<char*>(&(header.p_vaddr)), fieldBytes);
-    file.read(reinterpret_cast<char*>(&(header.p_paddr)), fieldBytes);
-    file.read(reinterpret_cast<char*>(&(header.p_filesz)), fieldBytes);
-    file.read(reinterpret_cast<char*>(&(header.p_memsz)), fieldBytes);
+    // Each address-related field is 8 bytes in a 64-bit ELF file, and
+    // follows the 4-byte type and flags fields
+    read(headerOffset, header.p_type);
+    read(headerOffset + 8, header.p_offset);
+    read(headerOffset + 16, header.p_vaddr);
+    read(headerOffset + 24, header.p_paddr);
+    read(headerOffset + 32, header.p_filesz);
     // Skip p_align
+    if (!read(headerOffset + 40, header.p_memsz) ||
+        header.p_offset + header.p_filesz > fileSize_ ||
+        header.p_offset + header.p_filesz < header.p_offset) {
+      std::cerr << "[SimEng:Elf] Elf program header " << i << " is truncated"
+                << std::endl;
+      return;
+    }
 
     // To construct the process we look for the largest virtual address and
     // add it to the memory size of the header. This way we obtain a very
@@ -165,7 +191,12 @@ Elf::Elf(std::string path, char** imagePointer) {
     }
   }
 
-  *imagePointer = (char*)malloc(processImageSize_ * sizeof(char));
+  isValid_ = true;
+}
+
+void Elf::loadSegments(char* image) const {
+  const uint64_t hostPageSize = sysconf(_SC_PAGESIZE);
+
   /**
    * The ELF Program header has a member called `p_type`, which represents
    * the kind of data or memory segments described by the program header.
@@ -176,19 +207,39 @@ Elf::Elf(std::string path, char** imagePointer) {
 
   // Process headers; only observe LOAD sections for this basic implementation
   for (const auto& header : pheaders_) {
-    if (header.p_type == 1) {  // LOAD
-      file.seekg(header.p_offset);
-      // Read `p_filesz` bytes from `file` into the appropriate place in process
-      // memory
-      file.read(*imagePointer + header.p_vaddr, header.p_filesz);
+    if (header.p_type != 1 || header.p_filesz == 0) continue;  // LOAD
+
+    // Place `p_filesz` bytes from the file into the appropriate place in
+    // process memory. Where the segment is page-aligned in both the file and
+    // memory, as linkers arrange, map the pages it wholly covers; the partial
+    // pages at either end may be shared with another segment or with the
+    // zero-filled remainder of this one, so are copied instead
+    uint64_t start = header.p_vaddr;
+    uint64_t end = header.p_vaddr + header.p_filesz;
+    uint64_t mapStart = start;
+    uint64_t mapEnd = start;
+    if ((header.p_vaddr - header.p_offset) % hostPageSize == 0) {
+      uint64_t alignedStart =
+          (start + hostPageSize - 1) / hostPageSize * hostPageSize;
+      uint64_t alignedEnd = end / hostPageSize * hostPageSize;
+      if (alignedStart < alignedEnd &&
+          mmap(image + alignedStart, alignedEnd - alignedStart,
+               PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd_,
+               header.p_offset + (alignedStart - start)) != MAP_FAILED) {
+        mapStart = alignedStart;
+        mapEnd = alignedEnd;
+      }
     }
+    std::memcpy(image + start, file_ + header.p_offset, mapStart - start);
+    std::memcpy(image + mapEnd, file_ + header.p_offset + (mapEnd - start),
+                end - mapEnd);
   }
-
-  file.close();
-  return;
 }
 
-Elf::~Elf() {}
+Elf::~Elf() {
+  if (file_ != nullptr) munmap(const_cast<char*>(file_), fileSize_);
+  if (fd_ >= 0) close(fd_);
+}
 
 uint64_t Elf::getProcessImageSize() const { return processImageSize_; }
 
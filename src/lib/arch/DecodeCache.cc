@@ -0,0 +1,149 @@
+#include "simeng/arch/DecodeCache.hh"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+#include "simeng/version.hh"
+
+namespace simeng {
+namespace arch {
+
+/** The magic number at the start of every decode cache file. */
+static const char DECODE_CACHE_MAGIC[8] = {'S', 'E', 'D', 'C',
+                                           'A', 'C', 'H', 'E'};
+
+/** The version of the decode cache file format. Must be incremented whenever
+ * the layout of `header` or `entry` changes. */
+static const int DECODE_CACHE_VERSION = 1;
+
+DecodeCache::DecodeCache(const std::string& path, const std::string& isaKey)
+    : path_(path) {
+  if (path_.empty()) return;
+
+  std::string key = "v" + std::to_string(DECODE_CACHE_VERSION) +
+                    " simeng-" SIMENG_VERSION " capstone-" +
+                    std::to_string(CS_API_MAJOR) + "." +
+                    std::to_string(CS_API_MINOR) + " " + isaKey;
+  std::strncpy(key_, key.c_str(), sizeof(key_) - 1);
+
+  load();
+}
+
+DecodeCache::~DecodeCache() {
+  if (!isEnabled()) return;
+  if (!inserted_.empty()) save();
+  if (mapping_ != nullptr) munmap(mapping_, mappingSize_);
+}
+
+bool DecodeCache::isEnabled() const { return !path_.empty(); }
+
+void DecodeCache::load() {
+  int fd = ::open(path_.c_str(), O_RDONLY);
+  if (fd < 0) return;
+
+  struct ::stat fileStat;
+  if (fstat(fd, &fileStat) != 0 ||
+      static_cast<size_t>(fileStat.st_size) < sizeof(header)) {
+    ::close(fd);
+    return;
+  }
+
+  mappingSize_ = fileStat.st_size;
+  mapping_ = mmap(nullptr, mappingSize_, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (mapping_ == MAP_FAILED) {
+    mapping_ = nullptr;
+    return;
+  }
+
+  // Only use a cache file written in the same format, for the same ISA
+  // variant and disassembler
+  const header* fileHeader = static_cast<const header*>(mapping_);
+  if (std::memcmp(fileHeader->magic, DECODE_CACHE_MAGIC,
+                  sizeof(DECODE_CACHE_MAGIC)) != 0 ||
+      std::memcmp(fileHeader->key, key_, sizeof(key_)) != 0 ||
+      fileHeader->entrySize != sizeof(entry) ||
+      mappingSize_ < sizeof(header) + fileHeader->entryCount * sizeof(entry)) {
+    std::cerr << "[SimEng:DecodeCache] Ignoring incompatible decode cache '"
+              << path_ << "'" << std::endl;
+    munmap(mapping_, mappingSize_);
+    mapping_ = nullptr;
+    return;
+  }
+
+  const entry* entries = reinterpret_cast<const entry*>(
+      static_cast<const char*>(mapping_) + sizeof(header));
+  index_.reserve(fileHeader->entryCount);
+  for (uint64_t i = 0; i < fileHeader->entryCount; i++) {
+    index_.insert({entries[i].encoding, &entries[i]});
+  }
+}
+
+bool DecodeCache::lookup(uint32_t encoding, cs_insn& insn, cs_detail& detail,
+                         bool& success) const {
+  auto iter = index_.find(encoding);
+  if (iter == index_.end()) return false;
+
+  insn = iter->second->insn;
+  detail = iter->second->detail;
+  insn.detail = &detail;
+  success = iter->second->success;
+  return true;
+}
+
+void DecodeCache::insert(uint32_t encoding, const cs_insn& insn,
+                         const cs_detail& detail, bool success) {
+  if (!isEnabled() || index_.count(encoding)) return;
+
+  // Zero the entry first, such that padding bytes written to the file are
+  // deterministic
+  auto newEntry = std::make_unique<entry>();
+  std::memset(newEntry.get(), 0, sizeof(entry));
+  newEntry->encoding = encoding;
+  newEntry->success = success;
+  newEntry->insn = insn;
+  newEntry->insn.detail = nullptr;
+  newEntry->detail = detail;
+
+  index_.insert({encoding, newEntry.get()});
+  inserted_.push_back(std::move(newEntry));
+}
+
+void DecodeCache::save() const {
+  // Write to a temporary file unique to this process, then rename it over the
+  // cache file
+  std::string tempPath = path_ + ".tmp." + std::to_string(getpid());
+  std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+  if (!file.good()) {
+    std::cerr << "[SimEng:DecodeCache] Unable to write decode cache '"
+              << path_ << "'" << std::endl;
+    return;
+  }
+
+  header fileHeader = {};
+  std::memcpy(fileHeader.magic, DECODE_CACHE_MAGIC, sizeof(DECODE_CACHE_MAGIC));
+  std::memcpy(fileHeader.key, key_, sizeof(key_));
+  fileHeader.entrySize = sizeof(entry);
+  fileHeader.entryCount = index_.size();
+  file.write(reinterpret_cast<const char*>(&fileHeader), sizeof(header));
+  for (const auto& cached : index_) {
+    file.write(reinterpret_cast<const char*>(cached.second), sizeof(entry));
+  }
+  file.close();
+
+  if (!file.good() || std::rename(tempPath.c_str(), path_.c_str()) != 0) {
+    std::cerr << "[SimEng:DecodeCache] Unable to write decode cache '"
+              << path_ << "'" << std::endl;
+    std::remove(tempPath.c_str());
+  }
+}
+
+}  // namespace arch
+}  // namespace simeng
@@ -2,13 +2,19 @@
 #include <cassert>
 
 #include "InstructionMetadata.hh"
+#include "simeng/arch/aarch64/TableDecoder.hh"
 
 namespace simeng {
 namespace arch {
 namespace aarch64 {
 
+SharedDecodeCache<InstructionMetadata> Architecture::sharedMetadataCache_;
+
 Architecture::Architecture(kernel::Linux& kernel, ryml::ConstNodeRef config)
     : arch::Architecture(kernel),
+      persistentDecodeCache_(
+          config["Core"]["Decode-Cache-Path"].as<std::string>(), "AArch64"),
+      useTableDecoder_(config["Core"]["Table-Decoder"].as<bool>()),
       microDecoder_(std::make_unique<MicroDecoder>()),
       VL_(config["Core"]["Vector-Length"].as<uint64_t>()),
       SVL_(config["Core"]["Streaming-Vector-Length"].as<uint64_t>()),
@@ -90,8 +96,8 @@ Architecture::Architecture(kernel::Linux& kernel, ryml::ConstNodeRef config)
   }
 
   // ports entries in the groupExecutionInfo_ entries only apply for models
-  // using the outoforder core archetype
-  if (config::SimInfo::getSimMode() == config::SimulationMode::Outoforder) {
+  // using the pipelined core archetypes
+  if (config::SimInfo::getSimMode() != config::SimulationMode::Emulation) {
     // Create mapping between instructions groups and the ports that support
     // them
     for (size_t i = 0; i < config["Ports"].num_children(); i++) {
@@ -101,7 +107,7 @@ Architecture::Architecture(kernel::Linux& kernel, ryml::ConstNodeRef config)
       for (size_t j = 0; j < group_node.num_children(); j++) {
         uint16_t group = group_node[j].as<uint16_t>();
         uint16_t newPort = static_cast<uint16_t>(i);
-        groupExecutionInfo_[group].ports.push_back(newPort);
+        groupExecutionInfo_[group].ports |= portBit(newPort);
         // Add inherited support for those appropriate groups
         std::queue<uint16_t> groups;
         groups.push(group);
@@ -112,7 +118,8 @@ Architecture::Architecture(kernel::Linux& kernel, ryml::ConstNodeRef config)
             std::vector<uint16_t> inheritedGroups =
                 groupInheritance_.at(groups.front());
             for (size_t k = 0; k < inheritedGroups.size(); k++) {
-              groupExecutionInfo_[inheritedGroups[k]].ports.push_back(newPort);
+              groupExecutionInfo_[inheritedGroups[k]].ports |=
+                  portBit(newPort);
               groups.push(inheritedGroups[k]);
             }
           }
@@ -127,7 +134,7 @@ Architecture::Architecture(kernel::Linux& kernel, ryml::ConstNodeRef config)
         // inform later access to use group defined latencies instead
         uint16_t opcode = opcode_node[j].as<uint16_t>();
         opcodeExecutionInfo_.try_emplace(opcode, ExecutionInfo{0, 0, {}});
-        opcodeExecutionInfo_[opcode].ports.push_back(static_cast<uint8_t>(i));
+        opcodeExecutionInfo_[opcode].ports |= portBit(i);
       }
     }
   }
@@ -163,27 +170,39 @@ uint8_t Architecture::predecode(const uint8_t* ptr, uint16_t bytesAvailable,
   // Try to find the decoding in the decode cache
   auto iter = decodeCache_.find(insn);
   if (iter == decodeCache_.end()) {
-    // No decoding present. Generate a fresh decoding, and add to cache
-    cs_insn rawInsn;
-    cs_detail rawDetail;
-    rawInsn.detail = &rawDetail;
-
-    size_t size = 4;
-    uint64_t address = 0;
-
-    const uint8_t* encoding = reinterpret_cast<const uint8_t*>(ptr);
-
-    bool success =
-        cs_disasm_iter(capstoneHandle_, &encoding, &size, &address, &rawInsn);
-
-    auto metadata =
-        success ? InstructionMetadata(rawInsn) : InstructionMetadata(encoding);
+    // No decoding present. Use the metadata decoded by any simulation in this
+    // process if available, otherwise generate a fresh decoding
+    const InstructionMetadata* metadata = sharedMetadataCache_.find(insn);
+    if (metadata == nullptr) {
+      cs_insn rawInsn;
+      cs_detail rawDetail;
+      rawInsn.detail = &rawDetail;
+
+      const uint8_t* encoding = reinterpret_cast<const uint8_t*>(ptr);
+
+      // If enabled, frequently executed instructions are decoded from the
+      // decode table. Capstone is only invoked for the remainder, and only if
+      // the encoding hasn't been disassembled by any previous simulation
+      // sharing the persistent cache
+      bool success =
+          useTableDecoder_ && TableDecoder::decode(insn, rawInsn, rawDetail);
+      if (!success &&
+          !persistentDecodeCache_.lookup(insn, rawInsn, rawDetail, success)) {
+        size_t size = 4;
+        uint64_t address = 0;
+        success = cs_disasm_iter(capstoneHandle_, &encoding, &size, &address,
+                                 &rawInsn);
+        persistentDecodeCache_.insert(insn, rawInsn, rawDetail, success);
+      }
 
-    // Cache the metadata
-    metadataCache_.push_front(metadata);
+      // Cache the metadata
+      metadata = &sharedMetadataCache_.insert(
+          insn, success ? InstructionMetadata(rawInsn)
+                        : InstructionMetadata(encoding));
+    }
 
     // Create an instruction using the metadata
-    Instruction newInsn(*this, metadataCache_.front(), MicroOpInfo());
+    Instruction newInsn(*this, *metadata, MicroOpInfo());
     // Set execution information for this instruction
     newInsn.setExecutionInfo(getExecutionInfo(newInsn));
     // Cache the instruction
@@ -221,6 +240,23 @@ ProcessStateChange Architecture::getInitialState() const {
   // Set ProcessStateChange type
   changes.type = ChangeType::REPLACEMENT;
 
+  const auto& thread = linux_.getRunningThread();
+  if (!thread.context.empty()) {
+    // The core starts by resuming a thread created on another core, so takes
+    // on that thread's register context
+    auto regFileStruct = config::SimInfo::getArchRegStruct();
+    for (uint8_t type = 0; type < regFileStruct.size(); type++) {
+      for (uint16_t tag = 0; tag < regFileStruct[type].quantity; tag++) {
+        changes.modifiedRegisters.push_back({type, tag});
+      }
+    }
+    changes.modifiedRegisterValues = thread.context;
+    // Supply the result of the syscall the thread was suspended in
+    changes.modifiedRegisters.push_back({RegisterType::GENERAL, 0});
+    changes.modifiedRegisterValues.push_back(thread.pendingResult);
+    return changes;
+  }
+
   uint64_t stackPointer = linux_.getInitialStackPointer();
   // Set the stack pointer register
   changes.modifiedRegisters.push_back({RegisterType::GENERAL, 31});
@@ -262,7 +298,7 @@ ExecutionInfo Architecture::getExecutionInfo(const Instruction& insn) const {
     if (overrideInfo.latency != 0) exeInfo.latency = overrideInfo.latency;
     if (overrideInfo.stallCycles != 0)
       exeInfo.stallCycles = overrideInfo.stallCycles;
-    if (overrideInfo.ports.size()) exeInfo.ports = overrideInfo.ports;
+    if (overrideInfo.ports != 0) exeInfo.ports = overrideInfo.ports;
   }
   return exeInfo;
 }
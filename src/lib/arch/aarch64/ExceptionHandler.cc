@@ -2,6 +2,7 @@
 
 #include <sys/syscall.h>
 
+#include <cstring>
 #include <iomanip>
 #include <iostream>
 #include <ostream>
@@ -23,7 +24,11 @@ ExceptionHandler::ExceptionHandler(
   resumeHandling_ = [this]() { return init(); };
 }
 
-bool ExceptionHandler::tick() { return resumeHandling_(); }
+bool ExceptionHandler::tick() {
+  // Direct any system calls made to the kernel on behalf of this core
+  linux_.setCurrentCore(core_.getCoreId());
+  return resumeHandling_();
+}
 
 bool ExceptionHandler::init() {
   InstructionException exception = instruction_.getException();
@@ -355,7 +360,25 @@ bool ExceptionHandler::init() {
         stateChange.memoryAddressValues.push_back(statOut);
         break;
       }
+      case 93: {  // exit
+        // Clear and wake any waiter on the thread's clear_child_tid address
+        uint64_t clearChildTid = linux_.exitThread();
+        if (clearChildTid != 0) {
+          stateChange.memoryAddresses.push_back({clearChildTid, 4});
+          stateChange.memoryAddressValues.push_back(static_cast<uint32_t>(0));
+          linux_.futexWake(clearChildTid, 1);
+        }
+        if (linux_.getLiveThreadCount() == 0) {
+          auto exitCode = registerFileSet.get(R0).get<uint64_t>();
+          std::cout << "\n[SimEng:ExceptionHandler] Received exit syscall: "
+                       "terminating with exit code "
+                    << exitCode << std::endl;
+          return fatal();
+        }
+        return concludeSyscallAndSwitch(stateChange);
+      }
       case 94: {  // exit_group
+        linux_.exitGroup();
         auto exitCode = registerFileSet.get(R0).get<uint64_t>();
         std::cout << "\n[SimEng:ExceptionHandler] Received exit_group syscall: "
                      "terminating with exit code "
@@ -369,17 +392,35 @@ bool ExceptionHandler::init() {
         break;
       }
       case 98: {  // futex
-        // TODO: Functionality temporarily omitted as it is unused within
-        // workloads regions of interest and not required for their simulation
-        int op = registerFileSet.get(R1).get<int>();
-        if (op != 129) {
+        uint64_t uaddr = registerFileSet.get(R0).get<uint64_t>();
+        // Ignore the FUTEX_PRIVATE_FLAG and FUTEX_CLOCK_REALTIME options
+        int op = registerFileSet.get(R1).get<int>() & 0x7f;
+        uint32_t val = registerFileSet.get(R2).get<uint32_t>();
+        uint64_t timeoutPtr = registerFileSet.get(R3).get<uint64_t>();
+        if (op == 0 || op == 9) {  // FUTEX_WAIT or FUTEX_WAIT_BITSET
+          return readBufferThen(uaddr, 4, [=]() {
+            uint32_t current;
+            std::memcpy(&current, dataBuffer_.data(), 4);
+            if (current != val) {
+              int64_t retval = -EAGAIN;
+              ProcessStateChange stateChange = {
+                  ChangeType::REPLACEMENT, {R0}, {retval}};
+              return concludeSyscall(stateChange);
+            }
+            linux_.futexWait(uaddr, timeoutPtr != 0);
+            ProcessStateChange stateChange;
+            return concludeSyscallAndSwitch(stateChange);
+          });
+        } else if (op == 1 || op == 10) {  // FUTEX_WAKE or FUTEX_WAKE_BITSET
+          stateChange = {
+              ChangeType::REPLACEMENT, {R0}, {linux_.futexWake(uaddr, val)}};
+        } else {
           printException(instruction_);
           std::cout << "\n[SimEng:ExceptionHandler] Unsupported arguments for "
                        "syscall: "
                     << syscallId << std::endl;
           return fatal();
         }
-        stateChange = {ChangeType::REPLACEMENT, {R0}, {1ull}};
         break;
       }
       case 99: {  // set_robust_list
@@ -438,6 +479,9 @@ bool ExceptionHandler::init() {
         }
         break;
       }
+      case 124: {  // sched_yield
+        return concludeSyscallAndSwitch(stateChange);
+      }
       case 131: {  // tgkill
         // TODO: Functionality temporarily omitted since simeng only has a
         // single thread at the moment
@@ -512,10 +556,6 @@ bool ExceptionHandler::init() {
         }
         break;
       }
-      // TODO : as SimEng is single threaded, TID is same as PID.
-      // When SimEng becomes multi-threaded this syscall needs
-      // updating.
-      case 178:  // gettid
       case 172:  // getpid
         stateChange = {ChangeType::REPLACEMENT, {R0}, {linux_.getpid()}};
         break;
@@ -531,6 +571,9 @@ bool ExceptionHandler::init() {
       case 177:  // getegid
         stateChange = {ChangeType::REPLACEMENT, {R0}, {linux_.getegid()}};
         break;
+      case 178:  // gettid
+        stateChange = {ChangeType::REPLACEMENT, {R0}, {linux_.gettid()}};
+        break;
       case 179:  // sysinfo
         stateChange = {ChangeType::REPLACEMENT, {R0}, {0ull}};
         break;
@@ -556,6 +599,47 @@ bool ExceptionHandler::init() {
         stateChange = {ChangeType::REPLACEMENT, {R0}, {result}};
         break;
       }
+      case 220: {  // clone
+        uint64_t flags = registerFileSet.get(R0).get<uint64_t>();
+        uint64_t stackPtr = registerFileSet.get(R1).get<uint64_t>();
+        uint64_t parentTidPtr = registerFileSet.get(R2).get<uint64_t>();
+        uint64_t tls = registerFileSet.get(R3).get<uint64_t>();
+        uint64_t childTidPtr = registerFileSet.get(R4).get<uint64_t>();
+
+        // The new thread starts from a copy of the caller's registers, using
+        // the supplied stack and thread-local storage
+        auto regFileStruct = config::SimInfo::getArchRegStruct();
+        std::vector<RegisterValue> context = getRegisterContext();
+        if (stackPtr != 0) {
+          context[getContextIndex(SP, regFileStruct)] = stackPtr;
+        }
+        if (flags & 0x80000) {  // CLONE_SETTLS
+          Register tpidr = {
+              RegisterType::SYSTEM,
+              static_cast<uint16_t>(
+                  instruction_.getArchitecture().getSystemRegisterTag(
+                      ARM64_SYSREG_TPIDR_EL0))};
+          context[getContextIndex(tpidr, regFileStruct)] = tls;
+        }
+
+        int64_t tid = linux_.clone(flags, childTidPtr,
+                                   instruction_.getInstructionAddress() + 4,
+                                   std::move(context));
+        stateChange = {ChangeType::REPLACEMENT, {R0}, {tid}};
+        if (tid > 0) {
+          if (flags & 0x100000) {  // CLONE_PARENT_SETTID
+            stateChange.memoryAddresses.push_back({parentTidPtr, 4});
+            stateChange.memoryAddressValues.push_back(
+                static_cast<uint32_t>(tid));
+          }
+          if (flags & 0x1000000) {  // CLONE_CHILD_SETTID
+            stateChange.memoryAddresses.push_back({childTidPtr, 4});
+            stateChange.memoryAddressValues.push_back(
+                static_cast<uint32_t>(tid));
+          }
+        }
+        break;
+      }
       case 222: {  // mmap
         uint64_t addr = registerFileSet.get(R0).get<uint64_t>();
         size_t length = registerFileSet.get(R1).get<size_t>();
@@ -565,16 +649,31 @@ bool ExceptionHandler::init() {
         off_t offset = registerFileSet.get(R5).get<off_t>();
 
         // Currently, only support mmap from a malloc() call whose arguments
-        // match the first condition
-        if (addr == 0 && flags == 34 && fd == -1 && offset == 0) {
+        // match the first condition, or a kernel-placed mapping of a file
+        // which is either private (MAP_PRIVATE) or read-only and shared
+        // (MAP_SHARED without PROT_WRITE)
+        bool anonymous = (addr == 0 && flags == 34 && fd == -1 && offset == 0);
+        bool fileBacked =
+            (addr == 0 && fd >= 0 && !(flags & 0x30) &&
+             ((flags & 0x3) == 0x2 || ((flags & 0x3) == 0x1 && !(prot & 0x2))));
+        if (anonymous || fileBacked) {
           uint64_t result = linux_.mmap(addr, length, prot, flags, fd, offset);
           // An allocation of 0 signifies a failed allocation, return value from
           // syscall is changed to -1
           if (result == 0) {
             stateChange = {
                 ChangeType::REPLACEMENT, {R0}, {static_cast<int64_t>(-1)}};
-          } else {
-            stateChange = {ChangeType::REPLACEMENT, {R0}, {result}};
+            break;
+          }
+          stateChange = {ChangeType::REPLACEMENT, {R0}, {result}};
+
+          // Populate the mapping with the file's contents in a single step
+          if (fileBacked &&
+              !linux_.populateMapping(result, length, fd, offset,
+                                      stateChange)) {
+            linux_.munmap(result, length);
+            stateChange = {
+                ChangeType::REPLACEMENT, {R0}, {static_cast<int64_t>(-1)}};
           }
           break;
         } else {
@@ -864,6 +963,99 @@ bool ExceptionHandler::concludeSyscall(ProcessStateChange& stateChange) {
   return true;
 }
 
+bool ExceptionHandler::concludeSyscallAndSwitch(
+    ProcessStateChange& stateChange) {
+  int64_t tid = linux_.gettid();
+  const kernel::LinuxThreadState* next = linux_.switchThread(
+      instruction_.getInstructionAddress() + 4, getRegisterContext());
+  if (next == nullptr) {
+    if (linux_.getRunningThreadCount() == 0) {
+      printException(instruction_);
+      std::cout << "\n[SimEng:ExceptionHandler] No thread is able to run: "
+                   "all remaining threads are blocked"
+                << std::endl;
+      return fatal();
+    }
+    // Other cores may yet wake a thread for this one to run; apply the memory
+    // updates now, as they may be awaited by threads running elsewhere
+    for (size_t i = 0; i < stateChange.memoryAddresses.size(); i++) {
+      memory_.requestWrite(stateChange.memoryAddresses[i],
+                           stateChange.memoryAddressValues[i]);
+    }
+    resumeHandling_ = [this]() { return awaitThread(); };
+    return false;
+  }
+  return resumeThread(*next, stateChange, next->tid != tid);
+}
+
+bool ExceptionHandler::awaitThread() {
+  if (linux_.getLiveThreadCount() == 0) {
+    std::cout << "\n[SimEng:ExceptionHandler] Idle core halting: all threads "
+                 "have exited"
+              << std::endl;
+    return fatal();
+  }
+
+  const kernel::LinuxThreadState* next = linux_.resumeThread();
+  if (next == nullptr) {
+    if (linux_.getRunningThreadCount() == 0) {
+      std::cout << "\n[SimEng:ExceptionHandler] No thread is able to run: "
+                   "all remaining threads are blocked"
+                << std::endl;
+      return fatal();
+    }
+    return false;
+  }
+
+  ProcessStateChange stateChange;
+  return resumeThread(*next, stateChange, true);
+}
+
+bool ExceptionHandler::resumeThread(const kernel::LinuxThreadState& next,
+                                    ProcessStateChange& stateChange,
+                                    bool restoreContext) {
+  auto regFileStruct = config::SimInfo::getArchRegStruct();
+  ProcessStateChange switchChange = {ChangeType::REPLACEMENT, {}, {}};
+  if (restoreContext) {
+    // Restore the register context of the resumed thread
+    for (uint8_t type = 0; type < regFileStruct.size(); type++) {
+      for (uint16_t tag = 0; tag < regFileStruct[type].quantity; tag++) {
+        switchChange.modifiedRegisters.push_back({type, tag});
+      }
+    }
+    switchChange.modifiedRegisterValues = next.context;
+  }
+  // Supply the result of the syscall the resumed thread was suspended in
+  switchChange.modifiedRegisters.push_back(R0);
+  switchChange.modifiedRegisterValues.push_back(next.pendingResult);
+
+  switchChange.memoryAddresses = std::move(stateChange.memoryAddresses);
+  switchChange.memoryAddressValues = std::move(stateChange.memoryAddressValues);
+  result_ = {false, next.pc, switchChange};
+  return true;
+}
+
+std::vector<RegisterValue> ExceptionHandler::getRegisterContext() const {
+  const auto& registerFileSet = core_.getArchitecturalRegisterFileSet();
+  auto regFileStruct = config::SimInfo::getArchRegStruct();
+  std::vector<RegisterValue> context;
+  for (uint8_t type = 0; type < regFileStruct.size(); type++) {
+    for (uint16_t tag = 0; tag < regFileStruct[type].quantity; tag++) {
+      context.push_back(registerFileSet.get({type, tag}));
+    }
+  }
+  return context;
+}
+
+size_t ExceptionHandler::getContextIndex(
+    Register reg, const std::vector<RegisterFileStructure>& regFileStruct) {
+  size_t index = reg.tag;
+  for (uint8_t type = 0; type < reg.type; type++) {
+    index += regFileStruct[type].quantity;
+  }
+  return index;
+}
+
 const ExceptionResult& ExceptionHandler::getResult() const { return result_; }
 
 void ExceptionHandler::printException(const Instruction& insn) const {
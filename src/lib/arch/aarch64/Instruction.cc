@@ -21,6 +21,8 @@ Instruction::Instruction(const Architecture& architecture,
   isLastMicroOp_ = microOpInfo.isLastMicroOp;
   microOpIndex_ = microOpInfo.microOpIndex;
   decode();
+  executeHandler_ = isMicroOp_ ? &Instruction::executeMicroOp
+                               : getExecuteHandler(metadata_.opcode);
 }
 
 Instruction::Instruction(const Architecture& architecture,
@@ -163,8 +165,8 @@ uint16_t Instruction::getGroup() const {
 
 bool Instruction::canExecute() const { return (sourceOperandsPending_ == 0); }
 
-const std::vector<uint16_t>& Instruction::getSupportedPorts() {
-  if (supportedPorts_.size() == 0) {
+PortMask Instruction::getSupportedPorts() {
+  if (supportedPorts_ == 0) {
     exception_ = InstructionException::NoAvailablePort;
     exceptionEncountered_ = true;
   }
@@ -182,6 +184,20 @@ void Instruction::setExecutionInfo(const ExecutionInfo& info) {
   supportedPorts_ = info.ports;
 }
 
+std::shared_ptr<simeng::Instruction> Instruction::clone() const {
+  return std::make_shared<Instruction>(*this);
+}
+
+uint32_t Instruction::getOpcode() const { return metadata_.opcode; }
+
+std::string Instruction::getDisassembly() const {
+  std::string disassembly(metadata_.mnemonic);
+  if (!metadata_.operandStr.empty()) {
+    disassembly += " " + metadata_.operandStr;
+  }
+  return disassembly;
+}
+
 const InstructionMetadata& Instruction::getMetadata() const {
   return metadata_;
 }
@@ -8,9 +8,8 @@ namespace simeng {
 namespace arch {
 namespace aarch64 {
 
-void generateContiguousAddresses(
-    uint64_t baseAddr, uint16_t numVecElems, uint8_t size,
-    std::vector<simeng::memory::MemoryAccessTarget>& addresses) {
+void generateContiguousAddresses(uint64_t baseAddr, uint16_t numVecElems,
+                                 uint8_t size, MemoryAccessTargets& addresses) {
   for (uint16_t i = 0; i < numVecElems; i++) {
     addresses.push_back({baseAddr + (i * size), size});
   }
@@ -18,8 +17,7 @@ void generateContiguousAddresses(
 
 void generatePredicatedContiguousAddressBlocks(
     uint64_t baseAddr, uint16_t numVecElems, uint8_t elemSize, uint8_t predSize,
-    const uint64_t* pred,
-    std::vector<simeng::memory::MemoryAccessTarget>& addresses) {
+    const uint64_t* pred, MemoryAccessTargets& addresses) {
   bool recordingBlock = false;
   uint64_t currAddr = 0;
   uint16_t currSize = 0;
@@ -52,7 +50,7 @@ span<const memory::MemoryAccessTarget> Instruction::generateAddresses() {
   if (isMicroOp_) {
     switch (microOpcode_) {
       case MicroOpcode::LDR_ADDR: {
-        std::vector<simeng::memory::MemoryAccessTarget> addresses;
+        MemoryAccessTargets addresses;
         generateContiguousAddresses(
             sourceValues_[0].get<uint64_t>() + metadata_.operands[1].mem.disp,
             1, dataSize_, addresses);
@@ -61,7 +59,7 @@ span<const memory::MemoryAccessTarget> Instruction::generateAddresses() {
         break;
       }
       case MicroOpcode::STR_ADDR: {
-        std::vector<simeng::memory::MemoryAccessTarget> addresses;
+        MemoryAccessTargets addresses;
         generateContiguousAddresses(
             sourceValues_[0].get<uint64_t>() + metadata_.operands[0].mem.disp,
             1, dataSize_, addresses);
@@ -352,7 +350,7 @@ span<const memory::MemoryAccessTarget> Instruction::generateAddresses() {
                                     // lsl #3]
         const uint64_t base = sourceValues_[1].get<uint64_t>();
         uint64_t offset = sourceValues_[2].get<uint64_t>();
-        std::vector<memory::MemoryAccessTarget> addresses;
+        MemoryAccessTargets addresses;
         addresses.reserve(2);
 
         uint64_t addr = base + (offset * 8);
@@ -371,7 +369,7 @@ span<const memory::MemoryAccessTarget> Instruction::generateAddresses() {
         const uint64_t base = sourceValues_[1].get<uint64_t>();
         const int64_t offset =
             static_cast<int64_t>(metadata_.operands[3].mem.disp);
-        std::vector<memory::MemoryAccessTarget> addresses;
+        MemoryAccessTargets addresses;
         addresses.reserve(2);
 
         uint64_t addr = base + (offset * partition_num * 8);
@@ -390,7 +388,7 @@ span<const memory::MemoryAccessTarget> Instruction::generateAddresses() {
         const uint64_t base = sourceValues_[1].get<uint64_t>();
         const int64_t offset =
             static_cast<int64_t>(metadata_.operands[4].mem.disp);
-        std::vector<memory::MemoryAccessTarget> addresses;
+        MemoryAccessTargets addresses;
         addresses.reserve(3);
 
         uint64_t addr = base + (offset * partition_num * 8);
@@ -410,7 +408,7 @@ span<const memory::MemoryAccessTarget> Instruction::generateAddresses() {
         const uint64_t base = sourceValues_[1].get<uint64_t>();
         const int64_t offset =
             static_cast<int64_t>(metadata_.operands[5].mem.disp);
-        std::vector<memory::MemoryAccessTarget> addresses;
+        MemoryAccessTargets addresses;
         addresses.reserve(4);
 
         uint64_t addr = base + (offset * partition_num * 8);
@@ -515,7 +513,7 @@ span<const memory::MemoryAccessTarget> Instruction::generateAddresses() {
       case Opcode::AArch64_LDRWpre:    // ldr wt, [xn, #imm]!
       case Opcode::AArch64_LDRXui:     // ldr xt, [xn, #imm]
       case Opcode::AArch64_LDRXpre: {  // ldr xt, [xn, #imm]!
-        std::vector<simeng::memory::MemoryAccessTarget> addresses;
+        MemoryAccessTargets addresses;
         generateContiguousAddresses(
             sourceValues_[0].get<uint64_t>() + metadata_.operands[1].mem.disp,
             1, dataSize_, addresses);
@@ -529,7 +527,7 @@ span<const memory::MemoryAccessTarget> Instruction::generateAddresses() {
       case Opcode::AArch64_LDRSpost:    // ldr st, [xn], #imm
       case Opcode::AArch64_LDRWpost:    // ldr wt, [xn], #imm
       case Opcode::AArch64_LDRXpost: {  // ldr xt, [xn], #imm
-        std::vector<memory::MemoryAccessTarget> addresses;
+        MemoryAccessTargets addresses;
         generateContiguousAddresses(sourceValues_[0].get<uint64_t>(), 1,
                                     dataSize_, addresses);
         setMemoryAddresses(addresses);
@@ -655,7 +653,7 @@ span<const memory::MemoryAccessTarget> Instruction::generateAddresses() {
       case Opcode::AArch64_LDPWpre:    // ldp wt1, wt2, [xn, #imm!]
       case Opcode::AArch64_LDPXi:      // ldp xt1, xt2, [xn, #imm]
       case Opcode::AArch64_LDPXpre: {  // ldp xt1, xt2, [xn, #imm!]
-        std::vector<simeng::memory::MemoryAccessTarget> addresses;
+        MemoryAccessTargets addresses;
         generateContiguousAddresses(
             sourceValues_[0].get<uint64_t>() + metadata_.operands[2].mem.disp,
             2, dataSize_, addresses);
@@ -667,7 +665,7 @@ span<const memory::MemoryAccessTarget> Instruction::generateAddresses() {
       case Opcode::AArch64_LDPSpost:    // ldp st1, st2, [xn], #imm
       case Opcode::AArch64_LDPWpost:    // ldp wt1, wt2, [xn], #imm
       case Opcode::AArch64_LDPXpost: {  // ldp xt1, xt2, [xn], #imm
-        std::vector<memory::MemoryAccessTarget> addresses;
+        MemoryAccessTargets addresses;
         generateContiguousAddresses(sourceValues_[0].get<uint64_t>(), 2,
                                     dataSize_, addresses);
         setMemoryAddresses(addresses);
@@ -822,7 +820,7 @@ span<const memory::MemoryAccessTarget> Instruction::generateAddresses() {
         const uint64_t base = sourceValues_[2].get<uint64_t>();
         const uint64_t offset = sourceValues_[3].get<uint64_t>();
 
-        std::vector<memory::MemoryAccessTarget> addresses;
+        MemoryAccessTargets addresses;
         addresses.reserve(partition_num);
 
         generatePredicatedContiguousAddressBlocks(base + offset, partition_num,
@@ -838,7 +836,7 @@ span<const memory::MemoryAccessTarget> Instruction::generateAddresses() {
         const int64_t offset =
             static_cast<int64_t>(metadata_.operands[2].mem.disp);
 
-        std::vector<memory::MemoryAccessTarget> addresses;
+        MemoryAccessTargets addresses;
         addresses.reserve(partition_num);
         uint64_t addr = base + (offset * partition_num);
 
@@ -854,7 +852,7 @@ span<const memory::MemoryAccessTarget> Instruction::generateAddresses() {
         const uint64_t base = sourceValues_[2].get<uint64_t>();
         const uint64_t* offset = sourceValues_[3].getAsVector<uint64_t>();
 
-        std::vector<memory::MemoryAccessTarget> addresses;
+        MemoryAccessTargets addresses;
 
         for (int i = 0; i < partition_num; i++) {
           uint64_t shifted_active = 1ull << ((i % 8) * 8);
@@ -873,7 +871,7 @@ span<const memory::MemoryAccessTarget> Instruction::generateAddresses() {
         const uint64_t base = sourceValues_[2].get<uint64_t>();
         const uint64_t* offset = sourceValues_[3].getAsVector<uint64_t>();
 
-        std::vector<memory::MemoryAccessTarget> addresses;
+        MemoryAccessTargets addresses;
         addresses.reserve(partition_num);
 
         for (int i = 0; i < partition_num; i++) {
@@ -894,7 +892,7 @@ span<const memory::MemoryAccessTarget> Instruction::generateAddresses() {
         const uint64_t base = sourceValues_[2].get<uint64_t>();
         const uint64_t* offset = sourceValues_[3].getAsVector<uint64_t>();
 
-        std::vector<memory::MemoryAccessTarget> addresses;
+        MemoryAccessTargets addresses;
         addresses.reserve(partition_num);
 
         for (int i = 0; i < partition_num; i++) {
@@ -914,7 +912,7 @@ span<const memory::MemoryAccessTarget> Instruction::generateAddresses() {
         const uint64_t base = sourceValues_[2].get<uint64_t>();
         const uint64_t offset = sourceValues_[3].get<uint64_t>();
 
-        std::vector<memory::MemoryAccessTarget> addresses;
+        MemoryAccessTargets addresses;
         addresses.reserve(partition_num);
 
         generatePredicatedContiguousAddressBlocks(
@@ -930,7 +928,7 @@ span<const memory::MemoryAccessTarget> Instruction::generateAddresses() {
         const int64_t offset =
             static_cast<int64_t>(metadata_.operands[2].mem.disp);
 
-        std::vector<memory::MemoryAccessTarget> addresses;
+        MemoryAccessTargets addresses;
         addresses.reserve(partition_num);
 
         generatePredicatedContiguousAddressBlocks(
@@ -948,7 +946,7 @@ span<const memory::MemoryAccessTarget> Instruction::generateAddresses() {
         const int64_t offset =
             static_cast<int64_t>(metadata_.operands[3].mem.disp);
 
-        std::vector<memory::MemoryAccessTarget> addresses;
+        MemoryAccessTargets addresses;
         addresses.reserve(partition_num * 2);
 
         uint64_t addr = base + (offset * partition_num * 8);
@@ -971,7 +969,7 @@ span<const memory::MemoryAccessTarget> Instruction::generateAddresses() {
         if (metadata_.operands[2].mem.index)
           m = sourceValues_[partition_num + 3].get<uint64_t>() << 3;
 
-        std::vector<memory::MemoryAccessTarget> addresses;
+        MemoryAccessTargets addresses;
         addresses.reserve(partition_num);
 
         generatePredicatedContiguousAddressBlocks((n + m), partition_num, 8, 8,
@@ -992,7 +990,7 @@ span<const memory::MemoryAccessTarget> Instruction::generateAddresses() {
         if (metadata_.operands[2].mem.index)
           m = sourceValues_[partition_num + 3].get<uint64_t>() << 2;
 
-        std::vector<memory::MemoryAccessTarget> addresses;
+        MemoryAccessTargets addresses;
         addresses.reserve(partition_num);
 
         generatePredicatedContiguousAddressBlocks((n + m), partition_num, 4, 4,
@@ -1007,7 +1005,7 @@ span<const memory::MemoryAccessTarget> Instruction::generateAddresses() {
         const uint64_t base = sourceValues_[2].get<uint64_t>();
         const uint64_t offset = sourceValues_[3].get<uint64_t>();
 
-        std::vector<memory::MemoryAccessTarget> addresses;
+        MemoryAccessTargets addresses;
         addresses.reserve(partition_num);
 
         generatePredicatedContiguousAddressBlocks(
@@ -1022,7 +1020,7 @@ span<const memory::MemoryAccessTarget> Instruction::generateAddresses() {
         const uint64_t base = sourceValues_[2].get<uint64_t>();
         const uint64_t offset = sourceValues_[3].get<uint64_t>();
 
-        std::vector<memory::MemoryAccessTarget> addresses;
+        MemoryAccessTargets addresses;
         addresses.reserve(partition_num);
 
         generatePredicatedContiguousAddressBlocks(
@@ -1039,7 +1037,7 @@ span<const memory::MemoryAccessTarget> Instruction::generateAddresses() {
         const int64_t offset =
             static_cast<int64_t>(metadata_.operands[2].mem.disp);
 
-        std::vector<memory::MemoryAccessTarget> addresses;
+        MemoryAccessTargets addresses;
         addresses.reserve(partition_num);
 
         generatePredicatedContiguousAddressBlocks(
@@ -1056,7 +1054,7 @@ span<const memory::MemoryAccessTarget> Instruction::generateAddresses() {
         const int64_t offset =
             static_cast<int64_t>(metadata_.operands[2].mem.disp);
 
-        std::vector<memory::MemoryAccessTarget> addresses;
+        MemoryAccessTargets addresses;
         addresses.reserve(partition_num);
 
         for (int i = 0; i < partition_num; i++) {
@@ -1077,7 +1075,7 @@ span<const memory::MemoryAccessTarget> Instruction::generateAddresses() {
         const int64_t offset = static_cast<int64_t>(
             static_cast<int32_t>(metadata_.operands[2].mem.disp));
 
-        std::vector<memory::MemoryAccessTarget> addresses;
+        MemoryAccessTargets addresses;
         addresses.reserve(partition_num);
 
         for (int i = 0; i < partition_num; i++) {
@@ -1097,7 +1095,7 @@ span<const memory::MemoryAccessTarget> Instruction::generateAddresses() {
         const uint64_t base = sourceValues_[1].get<uint64_t>();
         const uint64_t* offset = sourceValues_[2].getAsVector<uint64_t>();
 
-        std::vector<memory::MemoryAccessTarget> addresses;
+        MemoryAccessTargets addresses;
         addresses.reserve(partition_num);
 
         for (int i = 0; i < partition_num; i++) {
@@ -1118,7 +1116,7 @@ span<const memory::MemoryAccessTarget> Instruction::generateAddresses() {
         const uint64_t base = sourceValues_[1].get<uint64_t>();
         const uint64_t* offset = sourceValues_[2].getAsVector<uint64_t>();
 
-        std::vector<memory::MemoryAccessTarget> addresses;
+        MemoryAccessTargets addresses;
         addresses.reserve(partition_num);
 
         for (int i = 0; i < partition_num; i++) {
@@ -1140,7 +1138,7 @@ span<const memory::MemoryAccessTarget> Instruction::generateAddresses() {
         const int64_t offset =
             static_cast<int64_t>(metadata_.operands[2].mem.disp);
 
-        std::vector<memory::MemoryAccessTarget> addresses;
+        MemoryAccessTargets addresses;
         addresses.reserve(partition_num);
 
         for (int i = 0; i < partition_num; i++) {
@@ -1162,7 +1160,7 @@ span<const memory::MemoryAccessTarget> Instruction::generateAddresses() {
         const int64_t offset =
             static_cast<int64_t>(metadata_.operands[2].mem.disp);
 
-        std::vector<memory::MemoryAccessTarget> addresses;
+        MemoryAccessTargets addresses;
         addresses.reserve(partition_num);
 
         for (int i = 0; i < partition_num; i++) {
@@ -1183,7 +1181,7 @@ span<const memory::MemoryAccessTarget> Instruction::generateAddresses() {
         const uint64_t n = sourceValues_[1].get<uint64_t>();
         const uint64_t* m = sourceValues_[2].getAsVector<uint64_t>();
 
-        std::vector<memory::MemoryAccessTarget> addresses;
+        MemoryAccessTargets addresses;
         addresses.reserve(partition_num);
 
         for (int i = 0; i < partition_num; i++) {
@@ -1204,7 +1202,7 @@ span<const memory::MemoryAccessTarget> Instruction::generateAddresses() {
         const uint64_t n = sourceValues_[1].get<uint64_t>();
         const uint32_t* m = sourceValues_[2].getAsVector<uint32_t>();
 
-        std::vector<memory::MemoryAccessTarget> addresses;
+        MemoryAccessTargets addresses;
         addresses.reserve(partition_num);
 
         for (int i = 0; i < partition_num; i++) {
@@ -1225,7 +1223,7 @@ span<const memory::MemoryAccessTarget> Instruction::generateAddresses() {
         const int64_t offset =
             static_cast<int64_t>(metadata_.operands[2].mem.disp);
 
-        std::vector<memory::MemoryAccessTarget> addresses;
+        MemoryAccessTargets addresses;
         addresses.reserve(partition_num);
 
         for (int i = 0; i < partition_num; i++) {
@@ -1241,7 +1239,7 @@ span<const memory::MemoryAccessTarget> Instruction::generateAddresses() {
       case Opcode::AArch64_ST1Fourv2s_POST: {  // st1 {vt.2s, vt2.2s, vt3.2s,
                                                // vt4.2s}, [xn], <#imm|xm>
         const uint64_t base = sourceValues_[4].get<uint64_t>();
-        std::vector<memory::MemoryAccessTarget> addresses;
+        MemoryAccessTargets addresses;
         addresses.reserve(4);
 
         for (int i = 0; i < 4; i++) {
@@ -1268,7 +1266,7 @@ span<const memory::MemoryAccessTarget> Instruction::generateAddresses() {
       case Opcode::AArch64_ST1Fourv4s_POST: {  // st1 {vt.4s, vt2.4s, vt3.4s,
                                                // vt4.4s}, [xn], <#imm|xm>
         const uint64_t base = sourceValues_[4].get<uint64_t>();
-        std::vector<memory::MemoryAccessTarget> addresses;
+        MemoryAccessTargets addresses;
         addresses.reserve(4);
 
         for (int i = 0; i < 4; i++) {
@@ -1292,7 +1290,7 @@ span<const memory::MemoryAccessTarget> Instruction::generateAddresses() {
       case Opcode::AArch64_ST1Twov4s_POST: {  // st1 {vt.4s, vt2.4s}, [xn],
                                               // <#imm|xm>
         const uint64_t base = sourceValues_[2].get<uint64_t>();
-        std::vector<memory::MemoryAccessTarget> addresses;
+        MemoryAccessTargets addresses;
         addresses.reserve(2);
 
         for (int i = 0; i < 2; i++) {
@@ -1328,7 +1326,7 @@ span<const memory::MemoryAccessTarget> Instruction::generateAddresses() {
       case Opcode::AArch64_ST2Twov4s_POST: {  // st2 {vt1.4s, vt2.4s}, [xn],
                                               // #imm
         const uint64_t base = sourceValues_[2].get<uint64_t>();
-        std::vector<memory::MemoryAccessTarget> addresses;
+        MemoryAccessTargets addresses;
         addresses.reserve(2);
 
         for (int i = 0; i < 2; i++) {
@@ -1368,7 +1366,7 @@ span<const memory::MemoryAccessTarget> Instruction::generateAddresses() {
       case Opcode::AArch64_STPWpre:    // stp wt1, wt2, [xn, #imm]!
       case Opcode::AArch64_STPXi:      // stp xt1, xt2, [xn, #imm]
       case Opcode::AArch64_STPXpre: {  // stp xt1, xt2, [xn, #imm]!
-        std::vector<simeng::memory::MemoryAccessTarget> addresses;
+        MemoryAccessTargets addresses;
         generateContiguousAddresses(
             sourceValues_[2].get<uint64_t>() + metadata_.operands[2].mem.disp,
             2, dataSize_, addresses);
@@ -1380,7 +1378,7 @@ span<const memory::MemoryAccessTarget> Instruction::generateAddresses() {
       case Opcode::AArch64_STPSpost:    // stp st1, st2, [xn], #imm
       case Opcode::AArch64_STPWpost:    // stp wt1, wt2, [xn], #imm
       case Opcode::AArch64_STPXpost: {  // stp xt1, xt2, [xn], #imm
-        std::vector<memory::MemoryAccessTarget> addresses;
+        MemoryAccessTargets addresses;
         generateContiguousAddresses(sourceValues_[2].get<uint64_t>(), 2,
                                     dataSize_, addresses);
         setMemoryAddresses(addresses);
@@ -1442,7 +1440,7 @@ span<const memory::MemoryAccessTarget> Instruction::generateAddresses() {
       case Opcode::AArch64_STRWpre:    // str wt, [xn, #imm]!
       case Opcode::AArch64_STRXui:     // str xt, [xn, #imm]
       case Opcode::AArch64_STRXpre: {  // str xt, [xn, #imm]!
-        std::vector<simeng::memory::MemoryAccessTarget> addresses;
+        MemoryAccessTargets addresses;
         generateContiguousAddresses(
             sourceValues_[1].get<uint64_t>() + metadata_.operands[1].mem.disp,
             1, dataSize_, addresses);
@@ -1456,7 +1454,7 @@ span<const memory::MemoryAccessTarget> Instruction::generateAddresses() {
       case Opcode::AArch64_STRSpost:    // str st, [xn], #imm
       case Opcode::AArch64_STRWpost:    // str wt, [xn], #imm
       case Opcode::AArch64_STRXpost: {  // str xt, [xn], #imm
-        std::vector<memory::MemoryAccessTarget> addresses;
+        MemoryAccessTargets addresses;
         generateContiguousAddresses(sourceValues_[1].get<uint64_t>(), 1,
                                     dataSize_, addresses);
         setMemoryAddresses(addresses);
@@ -6,18 +6,9 @@ namespace simeng {
 namespace arch {
 namespace aarch64 {
 
-std::unordered_map<uint32_t, std::vector<Instruction>>
-    MicroDecoder::microDecodeCache_;
-std::forward_list<InstructionMetadata> MicroDecoder::microMetadataCache_;
-
 MicroDecoder::MicroDecoder(ryml::ConstNodeRef config)
     : instructionSplit_(config["Core"]["Micro-Operations"].as<bool>()) {}
 
-MicroDecoder::~MicroDecoder() {
-  microDecodeCache_.clear();
-  microMetadataCache_.clear();
-}
-
 bool MicroDecoder::detectOverlap(arm64_reg registerA, arm64_reg registerB) {
   // Early checks on equivalent register ISA names
   if (registerA == registerB) return true;
@@ -0,0 +1,344 @@
+#include "simeng/arch/aarch64/TableDecoder.hh"
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+
+#include "InstructionMetadata.hh"
+
+namespace simeng {
+namespace arch {
+namespace aarch64 {
+
+namespace {
+
+/** The condition code mnemonic suffixes, indexed by encoded condition. */
+const char* const conditionNames[16] = {"eq", "ne", "hs", "lo", "mi", "pl",
+                                        "vs", "vc", "hi", "ls", "ge", "lt",
+                                        "gt", "le", "al", "nv"};
+
+// Extract bits `start` to `start+width` of `value`
+constexpr uint32_t bits(uint32_t value, uint8_t start, uint8_t width) {
+  return ((value >> start) & ((1 << width) - 1));
+}
+
+// Sign-extend a bitstring of length `currentLength`
+constexpr int64_t signExtend(uint32_t value, int currentLength) {
+  return static_cast<int64_t>(static_cast<uint64_t>(value)
+                              << (64 - currentLength)) >>
+         (64 - currentLength);
+}
+
+/** Get the Capstone identifier of general purpose register `tag`, accessed as
+ * a 64-bit register if `is64` is true. Tag 31 refers to the stack pointer if
+ * `spAt31` is true, or the zero register otherwise. */
+arm64_reg generalRegister(uint8_t tag, bool is64, bool spAt31) {
+  if (tag == 31) {
+    if (spAt31) return is64 ? ARM64_REG_SP : ARM64_REG_WSP;
+    return is64 ? ARM64_REG_XZR : ARM64_REG_WZR;
+  }
+  if (!is64) return static_cast<arm64_reg>(ARM64_REG_W0 + tag);
+  // X29 and X30 aren't contiguous with X0 -> X28
+  if (tag == 29) return ARM64_REG_X29;
+  if (tag == 30) return ARM64_REG_X30;
+  return static_cast<arm64_reg>(ARM64_REG_X0 + tag);
+}
+
+/** Print the name of general purpose register `tag`, as identified by
+ * `generalRegister`. */
+int printRegister(char* out, size_t size, uint8_t tag, bool is64,
+                  bool spAt31) {
+  if (tag == 31) {
+    if (spAt31) return std::snprintf(out, size, is64 ? "sp" : "wsp");
+    return std::snprintf(out, size, is64 ? "xzr" : "wzr");
+  }
+  return std::snprintf(out, size, "%c%u", is64 ? 'x' : 'w', tag);
+}
+
+/** Print an immediate operand, using hexadecimal for values above 9 as
+ * Capstone does. */
+int printImmediate(char* out, size_t size, int64_t imm) {
+  if (imm < 0) return std::snprintf(out, size, "#-0x%" PRIx64, -imm);
+  if (imm > 9) return std::snprintf(out, size, "#0x%" PRIx64, imm);
+  return std::snprintf(out, size, "#%" PRId64, imm);
+}
+
+/** Append a register operand to `detail`. */
+void addRegister(cs_detail& detail, arm64_reg reg, uint8_t access) {
+  cs_arm64_op& op = detail.arm64.operands[detail.arm64.op_count++];
+  op.vector_index = -1;
+  op.type = ARM64_OP_REG;
+  op.reg = reg;
+  op.access = access;
+}
+
+/** Append an immediate operand to `detail`. */
+void addImmediate(cs_detail& detail, int64_t imm) {
+  cs_arm64_op& op = detail.arm64.operands[detail.arm64.op_count++];
+  op.vector_index = -1;
+  op.type = ARM64_OP_IMM;
+  op.imm = imm;
+  op.access = CS_AC_READ;
+}
+
+/** Begin decoding the instruction `encoding` into `insn`, clearing `insn` and
+ * `detail` of any previous contents. */
+void begin(uint32_t encoding, unsigned int id, unsigned int opcode,
+           const char* mnemonic, cs_insn& insn, cs_detail& detail) {
+  std::memset(&insn, 0, sizeof(cs_insn));
+  std::memset(&detail, 0, sizeof(cs_detail));
+  insn.id = id;
+  insn.opcode = opcode;
+  insn.size = 4;
+  std::memcpy(insn.bytes, &encoding, 4);
+  std::strncpy(insn.mnemonic, mnemonic, CS_MNEMONIC_SIZE - 1);
+  insn.detail = &detail;
+  detail.arm64.cc = ARM64_CC_INVALID;
+}
+
+/** Mark the instruction as a branch, such that it's identified as one when
+ * decoded into an `Instruction`. */
+void addJumpGroup(cs_detail& detail) {
+  detail.groups[detail.groups_count++] = ARM64_GRP_JUMP;
+}
+
+// add{s}/sub{s} <rd|sp>, <rn|sp>, #imm{, lsl #12}
+void decodeAddSubImmediate(uint32_t encoding, unsigned int opcode,
+                           cs_insn& insn, cs_detail& detail) {
+  bool is64 = bits(encoding, 31, 1);
+  bool isSub = bits(encoding, 30, 1);
+  bool setsFlags = bits(encoding, 29, 1);
+  bool shifted = bits(encoding, 22, 1);
+  uint32_t imm = bits(encoding, 10, 12);
+  uint8_t rn = bits(encoding, 5, 5);
+  uint8_t rd = bits(encoding, 0, 5);
+
+  static const unsigned int ids[2][2] = {{ARM64_INS_ADD, ARM64_INS_ADDS},
+                                         {ARM64_INS_SUB, ARM64_INS_SUBS}};
+  static const char* const mnemonics[2][2] = {{"add", "adds"},
+                                              {"sub", "subs"}};
+  begin(encoding, ids[isSub][setsFlags], opcode, mnemonics[isSub][setsFlags],
+        insn, detail);
+
+  // Flag-setting variants write the zero register rather than the stack
+  // pointer
+  addRegister(detail, generalRegister(rd, is64, !setsFlags), CS_AC_WRITE);
+  addRegister(detail, generalRegister(rn, is64, true), CS_AC_READ);
+  addImmediate(detail, imm);
+  if (shifted) detail.arm64.operands[2].shift = {ARM64_SFT_LSL, 12};
+
+  if (setsFlags) {
+    detail.arm64.update_flags = true;
+    detail.regs_write[detail.regs_write_count++] = ARM64_REG_NZCV;
+  }
+
+  char* out = insn.op_str;
+  size_t size = sizeof(insn.op_str);
+  int length = printRegister(out, size, rd, is64, !setsFlags);
+  length += std::snprintf(out + length, size - length, ", ");
+  length += printRegister(out + length, size - length, rn, is64, true);
+  length += std::snprintf(out + length, size - length, ", ");
+  length += printImmediate(out + length, size - length, imm);
+  if (shifted) std::snprintf(out + length, size - length, ", lsl #12");
+}
+
+// movz <rd>, #imm{, lsl #shift}
+void decodeMoveWide(uint32_t encoding, unsigned int opcode, cs_insn& insn,
+                    cs_detail& detail) {
+  bool is64 = bits(encoding, 31, 1);
+  uint8_t shift = bits(encoding, 21, 2) * 16;
+  uint64_t imm = bits(encoding, 5, 16);
+  uint8_t rd = bits(encoding, 0, 5);
+
+  begin(encoding, ARM64_INS_MOVZ, opcode, "movz", insn, detail);
+
+  // The shift is folded into the immediate, as for the `mov` alias
+  addRegister(detail, generalRegister(rd, is64, false), CS_AC_WRITE);
+  addImmediate(detail, static_cast<int64_t>(imm << shift));
+  detail.arm64.operands[1].shift = {ARM64_SFT_LSL, 0};
+
+  char* out = insn.op_str;
+  size_t size = sizeof(insn.op_str);
+  int length = printRegister(out, size, rd, is64, false);
+  length += std::snprintf(out + length, size - length, ", ");
+  length += printImmediate(out + length, size - length, imm);
+  if (shift) std::snprintf(out + length, size - length, ", lsl #%u", shift);
+}
+
+// b label / bl label
+void decodeBranchImmediate(uint32_t encoding, unsigned int opcode,
+                           cs_insn& insn, cs_detail& detail) {
+  bool link = bits(encoding, 31, 1);
+  int64_t offset = signExtend(bits(encoding, 0, 26), 26) * 4;
+
+  begin(encoding, link ? ARM64_INS_BL : ARM64_INS_B, opcode, link ? "bl" : "b",
+        insn, detail);
+  addImmediate(detail, offset);
+  addJumpGroup(detail);
+  if (link) detail.regs_write[detail.regs_write_count++] = ARM64_REG_X30;
+
+  printImmediate(insn.op_str, sizeof(insn.op_str), offset);
+}
+
+// b.cond label
+void decodeConditionalBranch(uint32_t encoding, unsigned int opcode,
+                             cs_insn& insn, cs_detail& detail) {
+  uint8_t cond = bits(encoding, 0, 4);
+  int64_t offset = signExtend(bits(encoding, 5, 19), 19) * 4;
+
+  char mnemonic[8];
+  std::snprintf(mnemonic, sizeof(mnemonic), "b.%s", conditionNames[cond]);
+  begin(encoding, ARM64_INS_B, opcode, mnemonic, insn, detail);
+  // Capstone condition codes are offset by one from their encoding, to
+  // reserve zero for ARM64_CC_INVALID
+  detail.arm64.cc = static_cast<arm64_cc>(cond + 1);
+  addImmediate(detail, offset);
+  addJumpGroup(detail);
+  detail.regs_read[detail.regs_read_count++] = ARM64_REG_NZCV;
+
+  printImmediate(insn.op_str, sizeof(insn.op_str), offset);
+}
+
+// cbz <rt>, label / cbnz <rt>, label
+void decodeCompareBranch(uint32_t encoding, unsigned int opcode,
+                         cs_insn& insn, cs_detail& detail) {
+  bool is64 = bits(encoding, 31, 1);
+  bool nonZero = bits(encoding, 24, 1);
+  int64_t offset = signExtend(bits(encoding, 5, 19), 19) * 4;
+  uint8_t rt = bits(encoding, 0, 5);
+
+  begin(encoding, nonZero ? ARM64_INS_CBNZ : ARM64_INS_CBZ, opcode,
+        nonZero ? "cbnz" : "cbz", insn, detail);
+  addRegister(detail, generalRegister(rt, is64, false), CS_AC_READ);
+  addImmediate(detail, offset);
+  addJumpGroup(detail);
+
+  char* out = insn.op_str;
+  size_t size = sizeof(insn.op_str);
+  int length = printRegister(out, size, rt, is64, false);
+  length += std::snprintf(out + length, size - length, ", ");
+  printImmediate(out + length, size - length, offset);
+}
+
+// br <xn> / blr <xn> / ret {<xn>}
+void decodeBranchRegister(uint32_t encoding, unsigned int opcode,
+                          cs_insn& insn, cs_detail& detail) {
+  uint8_t opc = bits(encoding, 21, 2);
+  uint8_t rn = bits(encoding, 5, 5);
+
+  static const unsigned int ids[3] = {ARM64_INS_BR, ARM64_INS_BLR,
+                                      ARM64_INS_RET};
+  static const char* const mnemonics[3] = {"br", "blr", "ret"};
+  begin(encoding, ids[opc], opcode, mnemonics[opc], insn, detail);
+  addRegister(detail, generalRegister(rn, true, false), CS_AC_READ);
+  addJumpGroup(detail);
+  if (opc == 1) detail.regs_write[detail.regs_write_count++] = ARM64_REG_X30;
+
+  // The link register is implied by `ret`
+  if (opc != 2 || rn != 30) {
+    printRegister(insn.op_str, sizeof(insn.op_str), rn, true, false);
+  }
+}
+
+// ldr <rt>, [<xn|sp>{, #imm}] / str <rt>, [<xn|sp>{, #imm}]
+void decodeLoadStoreUnsigned(uint32_t encoding, unsigned int opcode,
+                             cs_insn& insn, cs_detail& detail) {
+  bool is64 = bits(encoding, 30, 1);
+  bool load = bits(encoding, 22, 1);
+  int32_t offset = bits(encoding, 10, 12) << (is64 ? 3 : 2);
+  uint8_t rn = bits(encoding, 5, 5);
+  uint8_t rt = bits(encoding, 0, 5);
+
+  begin(encoding, load ? ARM64_INS_LDR : ARM64_INS_STR, opcode,
+        load ? "ldr" : "str", insn, detail);
+  addRegister(detail, generalRegister(rt, is64, false),
+              load ? CS_AC_WRITE : CS_AC_READ);
+
+  cs_arm64_op& mem = detail.arm64.operands[detail.arm64.op_count++];
+  mem.vector_index = -1;
+  mem.type = ARM64_OP_MEM;
+  mem.mem = {generalRegister(rn, true, true), ARM64_REG_INVALID, offset};
+  mem.access = CS_AC_READ;
+
+  char* out = insn.op_str;
+  size_t size = sizeof(insn.op_str);
+  int length = printRegister(out, size, rt, is64, false);
+  length += std::snprintf(out + length, size - length, ", [");
+  length += printRegister(out + length, size - length, rn, true, true);
+  if (offset) {
+    length += std::snprintf(out + length, size - length, ", ");
+    length += printImmediate(out + length, size - length, offset);
+  }
+  std::snprintf(out + length, size - length, "]");
+}
+
+/** An entry of the decode table. Any encoding which matches `value` in the
+ * bits selected by `mask` is the instruction `opcode`, decoded by `decode`. */
+struct DecodeTableEntry {
+  uint32_t mask;
+  uint32_t value;
+  unsigned int opcode;
+  void (*decode)(uint32_t encoding, unsigned int opcode, cs_insn& insn,
+                 cs_detail& detail);
+};
+
+/** The decode table. Each entry covers all encodings of its opcode which the
+ * decoder supports; entries are ordered by how frequently their instructions
+ * are typically executed, such that the table can be searched linearly. */
+constexpr DecodeTableEntry decodeTable[] = {
+    // Loads and stores, unsigned immediate offset
+    {0xFFC00000, 0xF9400000, Opcode::AArch64_LDRXui, decodeLoadStoreUnsigned},
+    {0xFFC00000, 0xB9400000, Opcode::AArch64_LDRWui, decodeLoadStoreUnsigned},
+    {0xFFC00000, 0xF9000000, Opcode::AArch64_STRXui, decodeLoadStoreUnsigned},
+    {0xFFC00000, 0xB9000000, Opcode::AArch64_STRWui, decodeLoadStoreUnsigned},
+    // Add/subtract, immediate
+    {0xFF800000, 0x91000000, Opcode::AArch64_ADDXri, decodeAddSubImmediate},
+    {0xFF800000, 0x11000000, Opcode::AArch64_ADDWri, decodeAddSubImmediate},
+    {0xFF800000, 0xD1000000, Opcode::AArch64_SUBXri, decodeAddSubImmediate},
+    {0xFF800000, 0x51000000, Opcode::AArch64_SUBWri, decodeAddSubImmediate},
+    {0xFF800000, 0xF1000000, Opcode::AArch64_SUBSXri, decodeAddSubImmediate},
+    {0xFF800000, 0x71000000, Opcode::AArch64_SUBSWri, decodeAddSubImmediate},
+    {0xFF800000, 0xB1000000, Opcode::AArch64_ADDSXri, decodeAddSubImmediate},
+    {0xFF800000, 0x31000000, Opcode::AArch64_ADDSWri, decodeAddSubImmediate},
+    // Conditional and compare-and-branch
+    {0xFF000010, 0x54000000, Opcode::AArch64_Bcc, decodeConditionalBranch},
+    {0xFF000000, 0xB5000000, Opcode::AArch64_CBNZX, decodeCompareBranch},
+    {0xFF000000, 0x35000000, Opcode::AArch64_CBNZW, decodeCompareBranch},
+    {0xFF000000, 0xB4000000, Opcode::AArch64_CBZX, decodeCompareBranch},
+    {0xFF000000, 0x34000000, Opcode::AArch64_CBZW, decodeCompareBranch},
+    // Unconditional branches
+    {0xFC000000, 0x14000000, Opcode::AArch64_B, decodeBranchImmediate},
+    {0xFC000000, 0x94000000, Opcode::AArch64_BL, decodeBranchImmediate},
+    {0xFFFFFC1F, 0xD65F0000, Opcode::AArch64_RET, decodeBranchRegister},
+    {0xFFFFFC1F, 0xD63F0000, Opcode::AArch64_BLR, decodeBranchRegister},
+    {0xFFFFFC1F, 0xD61F0000, Opcode::AArch64_BR, decodeBranchRegister},
+    // Move wide, immediate. 32-bit variants may only shift by 0 or 16, so
+    // require the upper bit of the shift to be clear
+    {0xFF800000, 0xD2800000, Opcode::AArch64_MOVZXi, decodeMoveWide},
+    {0xFFC00000, 0x52800000, Opcode::AArch64_MOVZWi, decodeMoveWide},
+};
+
+}  // namespace
+
+bool TableDecoder::decode(uint32_t encoding, cs_insn& insn,
+                          cs_detail& detail) {
+  for (const auto& entry : decodeTable) {
+    if ((encoding & entry.mask) == entry.value) {
+      entry.decode(encoding, entry.opcode, insn, detail);
+      return true;
+    }
+  }
+  return false;
+}
+
+std::vector<TableDecoder::Pattern> TableDecoder::getPatterns() {
+  std::vector<Pattern> patterns;
+  for (const auto& entry : decodeTable) {
+    patterns.push_back({entry.mask, entry.value});
+  }
+  return patterns;
+}
+
+}  // namespace aarch64
+}  // namespace arch
+}  // namespace simeng
@@ -12,7 +12,10 @@ namespace arch {
 namespace riscv {
 
 Architecture::Architecture(kernel::Linux& kernel, ryml::ConstNodeRef config)
-    : arch::Architecture(kernel) {
+    : arch::Architecture(kernel),
+      persistentDecodeCache_(
+          config["Core"]["Decode-Cache-Path"].as<std::string>(),
+          config["Core"]["Compressed"].as<bool>() ? "RV64GC" : "RV64G") {
   // Set initial rounding mode for F/D extensions
   // TODO set fcsr accordingly when Zicsr extension supported
   fesetround(FE_TONEAREST);
@@ -109,8 +112,8 @@ Architecture::Architecture(kernel::Linux& kernel, ryml::ConstNodeRef config)
   }
 
   // ports entries in the groupExecutionInfo_ entries only apply for models
-  // using the outoforder core archetype
-  if (config::SimInfo::getSimMode() == config::SimulationMode::Outoforder) {
+  // using the pipelined core archetypes
+  if (config::SimInfo::getSimMode() != config::SimulationMode::Emulation) {
     // Create mapping between instructions groups and the ports that support
     // them
     for (size_t i = 0; i < config["Ports"].num_children(); i++) {
@@ -121,7 +124,7 @@ Architecture::Architecture(kernel::Linux& kernel, ryml::ConstNodeRef config)
         uint16_t group = group_node[j].as<uint16_t>();
         uint16_t newPort = static_cast<uint16_t>(i);
 
-        groupExecutionInfo_[group].ports.push_back(newPort);
+        groupExecutionInfo_[group].ports |= portBit(newPort);
         // Add inherited support for those appropriate groups
         std::queue<uint16_t> groups;
         groups.push(group);
@@ -132,7 +135,8 @@ Architecture::Architecture(kernel::Linux& kernel, ryml::ConstNodeRef config)
             std::vector<uint16_t> inheritedGroups =
                 groupInheritance_.at(groups.front());
             for (size_t k = 0; k < inheritedGroups.size(); k++) {
-              groupExecutionInfo_[inheritedGroups[k]].ports.push_back(newPort);
+              groupExecutionInfo_[inheritedGroups[k]].ports |=
+                  portBit(newPort);
               groups.push(inheritedGroups[k]);
             }
           }
@@ -147,7 +151,7 @@ Architecture::Architecture(kernel::Linux& kernel, ryml::ConstNodeRef config)
         // later access to use group defined latencies instead
         uint16_t opcode = opcode_node[j].as<uint16_t>();
         opcodeExecutionInfo_.try_emplace(opcode, ExecutionInfo{0, 0, {}});
-        opcodeExecutionInfo_[opcode].ports.push_back(static_cast<uint8_t>(i));
+        opcodeExecutionInfo_[opcode].ports |= portBit(i);
       }
     }
   }
@@ -221,12 +225,18 @@ uint8_t Architecture::predecode(const uint8_t* ptr, uint16_t bytesAvailable,
     // update this value
     rawInsn.size = insnSize;
 
-    uint64_t address = 0;
-
     const uint8_t* encoding = reinterpret_cast<const uint8_t*>(ptr);
 
-    bool success = cs_disasm_iter(capstoneHandle_, &encoding, &insnSize,
-                                  &address, &rawInsn);
+    // Only invoke Capstone if the encoding hasn't been disassembled by any
+    // previous simulation sharing the persistent cache
+    bool success;
+    if (!persistentDecodeCache_.lookup(insnEncoding, rawInsn, rawDetail,
+                                       success)) {
+      uint64_t address = 0;
+      success = cs_disasm_iter(capstoneHandle_, &encoding, &insnSize, &address,
+                               &rawInsn);
+      persistentDecodeCache_.insert(insnEncoding, rawInsn, rawDetail, success);
+    }
 
     auto metadata = success ? InstructionMetadata(rawInsn)
                             : InstructionMetadata(encoding, rawInsn.size);
@@ -280,6 +290,23 @@ ProcessStateChange Architecture::getInitialState() const {
   // Set ProcessStateChange type
   changes.type = ChangeType::REPLACEMENT;
 
+  const auto& thread = linux_.getRunningThread();
+  if (!thread.context.empty()) {
+    // The core starts by resuming a thread created on another core, so takes
+    // on that thread's register context
+    auto regFileStruct = config::SimInfo::getArchRegStruct();
+    for (uint8_t type = 0; type < regFileStruct.size(); type++) {
+      for (uint16_t tag = 0; tag < regFileStruct[type].quantity; tag++) {
+        changes.modifiedRegisters.push_back({type, tag});
+      }
+    }
+    changes.modifiedRegisterValues = thread.context;
+    // Supply the result of the syscall the thread was suspended in
+    changes.modifiedRegisters.push_back({RegisterType::GENERAL, 10});
+    changes.modifiedRegisterValues.push_back(thread.pendingResult);
+    return changes;
+  }
+
   uint64_t stackPointer = linux_.getInitialStackPointer();
   // Set the stack pointer register
   changes.modifiedRegisters.push_back({RegisterType::GENERAL, 2});
@@ -308,7 +335,7 @@ ExecutionInfo Architecture::getExecutionInfo(const Instruction& insn) const {
     if (overrideInfo.latency != 0) exeInfo.latency = overrideInfo.latency;
     if (overrideInfo.stallCycles != 0)
       exeInfo.stallCycles = overrideInfo.stallCycles;
-    if (overrideInfo.ports.size()) exeInfo.ports = overrideInfo.ports;
+    if (overrideInfo.ports != 0) exeInfo.ports = overrideInfo.ports;
   }
   return exeInfo;
 }
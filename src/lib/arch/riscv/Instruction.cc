@@ -17,6 +17,7 @@ Instruction::Instruction(const Architecture& architecture,
       exception_(metadata.getMetadataException()) {
   exceptionEncountered_ = metadata.getMetadataExceptionEncountered();
   decode();
+  executeHandler_ = getExecuteHandler(metadata_.opcode);
 }
 
 Instruction::Instruction(const Architecture& architecture,
@@ -147,8 +148,8 @@ uint16_t Instruction::getGroup() const {
 
 bool Instruction::canExecute() const { return (sourceOperandsPending_ == 0); }
 
-const std::vector<uint16_t>& Instruction::getSupportedPorts() {
-  if (supportedPorts_.size() == 0) {
+PortMask Instruction::getSupportedPorts() {
+  if (supportedPorts_ == 0) {
     exception_ = InstructionException::NoAvailablePort;
     exceptionEncountered_ = true;
   }
@@ -165,6 +166,20 @@ void Instruction::setExecutionInfo(const ExecutionInfo& info) {
   supportedPorts_ = info.ports;
 }
 
+std::shared_ptr<simeng::Instruction> Instruction::clone() const {
+  return std::make_shared<Instruction>(*this);
+}
+
+uint32_t Instruction::getOpcode() const { return metadata_.opcode; }
+
+std::string Instruction::getDisassembly() const {
+  std::string disassembly(metadata_.mnemonic);
+  if (!metadata_.operandStr.empty()) {
+    disassembly += " " + metadata_.operandStr;
+  }
+  return disassembly;
+}
+
 const InstructionMetadata& Instruction::getMetadata() const {
   return metadata_;
 }
@@ -180,1518 +180,2052 @@ void Instruction::execute() {
   // Implementation of rv64imafdc according to the v. 20191213 unprivileged spec
 
   executed_ = true;
-  switch (metadata_.opcode) {
-    case Opcode::RISCV_LB: {  // LB rd,rs1,imm
-      results_[0] =
-          RegisterValue(bitExtend(memoryData_[0].get<uint8_t>(), 8), 8);
-      break;
-    }
-    case Opcode::RISCV_LBU: {  // LBU rd,rs1,imm
-      results_[0] =
-          RegisterValue(zeroExtend(memoryData_[0].get<uint8_t>(), 8), 8);
-      break;
-    }
-    case Opcode::RISCV_LH: {  // LH rd,rs1,imm
-      results_[0] =
-          RegisterValue(bitExtend(memoryData_[0].get<uint16_t>(), 16), 8);
-      break;
-    }
-    case Opcode::RISCV_LHU: {  // LHU rd,rs1,imm
-      results_[0] =
-          RegisterValue(zeroExtend(memoryData_[0].get<uint16_t>(), 16), 8);
-      break;
-    }
-    case Opcode::RISCV_LW: {  // LW rd,rs1,imm
-      results_[0] =
-          RegisterValue(bitExtend(memoryData_[0].get<uint32_t>(), 32), 8);
-      break;
-    }
-    case Opcode::RISCV_LWU: {  // LWU rd,rs1,imm
-      results_[0] =
-          RegisterValue(zeroExtend(memoryData_[0].get<uint32_t>(), 32), 8);
-      break;
-    }
-    case Opcode::RISCV_LD: {  // LD rd,rs1,imm
-      results_[0] = RegisterValue(memoryData_[0].get<uint64_t>(), 8);
-      break;
-    }
-    case Opcode::RISCV_SB:  // SB rs1,rs2,imm
-      [[fallthrough]];
-    case Opcode::RISCV_SH:  // SH rs1,rs2,imm
-      [[fallthrough]];
-    case Opcode::RISCV_SW:  // SW rs1,rs2,imm
-      [[fallthrough]];
-    case Opcode::RISCV_SD: {  // SD rs1,rs2,imm
-      memoryData_[0] = sourceValues_[0];
-      break;
-    }
-    case Opcode::RISCV_SLL: {  // SLL rd,rs1,rs2
-      const int64_t rs1 = sourceValues_[0].get<int64_t>();
-      const int64_t rs2 =
-          sourceValues_[1].get<int64_t>() & 63;  // Only use lowest 6 bits
-      int64_t out = static_cast<int64_t>(rs1 << rs2);
-      results_[0] = RegisterValue(out, 8);
-      break;
-    }
-    case Opcode::RISCV_SLLI: {  // SLLI rd,rs1,shamt
-      const int64_t rs1 = sourceValues_[0].get<int64_t>();
-      const int64_t shamt = sourceImm_ & 63;  // Only use lowest 6 bits
-      int64_t out = static_cast<int64_t>(rs1 << shamt);
-      results_[0] = RegisterValue(out, 8);
-      break;
-    }
-    case Opcode::RISCV_SLLW: {  // SLLW rd,rs1,rs2
-      const int32_t rs1 = sourceValues_[0].get<int32_t>();
-      const int32_t rs2 =
-          sourceValues_[1].get<int32_t>() & 31;  // Only use lowest 5 bits
-      int64_t out = signExtendW(static_cast<int32_t>(rs1 << rs2));
-      results_[0] = RegisterValue(out, 8);
-      break;
-    }
-    case Opcode::RISCV_SLLIW: {  // SLLIW rd,rs1,shamt
-      const int32_t rs1 = sourceValues_[0].get<uint32_t>();
-      const int32_t shamt = sourceImm_ & 31;  // Only use lowest 5 bits
-      uint64_t out = signExtendW(static_cast<uint32_t>(rs1 << shamt));
-      results_[0] = RegisterValue(out, 8);
-      break;
-    }
-    case Opcode::RISCV_SRL: {  // SRL rd,rs1,rs2
-      const uint64_t rs1 = sourceValues_[0].get<uint64_t>();
-      const uint64_t rs2 =
-          sourceValues_[1].get<uint64_t>() & 63;  // Only use lowest 6 bits
-      uint64_t out = static_cast<uint64_t>(rs1 >> rs2);
-      results_[0] = RegisterValue(out, 8);
-      break;
-    }
-    case Opcode::RISCV_SRLI: {  // SRLI rd,rs1,shamt
-      const uint64_t rs1 = sourceValues_[0].get<uint64_t>();
-      const uint64_t shamt = sourceImm_ & 63;  // Only use lowest 6 bits
-      uint64_t out = static_cast<uint64_t>(rs1 >> shamt);
-      results_[0] = RegisterValue(out, 8);
-      break;
-    }
-    case Opcode::RISCV_SRLW: {  // SRLW rd,rs1,rs2
-      const uint32_t rs1 = sourceValues_[0].get<uint32_t>();
-      const uint32_t rs2 =
-          sourceValues_[1].get<uint32_t>() & 31;  // Only use lowest 5 bits
-      uint64_t out = signExtendW(static_cast<uint64_t>(rs1 >> rs2));
-      results_[0] = RegisterValue(out, 8);
-      break;
-    }
-    case Opcode::RISCV_SRLIW: {  // SRLIW rd,rs1,shamt
-      const uint32_t rs1 = sourceValues_[0].get<uint32_t>();
-      const uint32_t shamt = sourceImm_ & 31;  // Only use lowest 5 bits
-      uint64_t out = signExtendW(static_cast<uint32_t>(rs1 >> shamt));
-      results_[0] = RegisterValue(out, 8);
-      break;
-    }
-    case Opcode::RISCV_SRA: {  // SRA rd,rs1,rs2
-      const int64_t rs1 = sourceValues_[0].get<int64_t>();
-      const int64_t rs2 =
-          sourceValues_[1].get<int64_t>() & 63;  // Only use lowest 6 bits
-      int64_t out = static_cast<int64_t>(rs1 >> rs2);
-      results_[0] = RegisterValue(out, 8);
-      break;
-    }
-    case Opcode::RISCV_SRAI: {  // SRAI rd,rs1,shamt
-      const int64_t rs1 = sourceValues_[0].get<int64_t>();
-      const int64_t shamt = sourceImm_ & 63;  // Only use lowest 6 bits
-      int64_t out = static_cast<int64_t>(rs1 >> shamt);
-      results_[0] = RegisterValue(out, 8);
-      break;
-    }
-    case Opcode::RISCV_SRAW: {  // SRAW rd,rs1,rs2
-      const int32_t rs1 = sourceValues_[0].get<int32_t>();
-      const int32_t rs2 =
-          sourceValues_[1].get<int32_t>() & 31;  // Only use lowest 5 bits
-      int64_t out = static_cast<int32_t>(rs1 >> rs2);
-      results_[0] = RegisterValue(out, 8);
-      break;
-    }
-    case Opcode::RISCV_SRAIW: {  // SRAIW rd,rs1,shamt
-      const int32_t rs1 = sourceValues_[0].get<int32_t>();
-      const int32_t shamt = sourceImm_ & 31;  // Only use lowest 5 bits
-      int64_t out = static_cast<int32_t>(rs1 >> shamt);
-      results_[0] = RegisterValue(out, 8);
-      break;
-    }
-    case Opcode::RISCV_ADD: {  // ADD rd,rs1,rs2
-      const uint64_t rs1 = sourceValues_[0].get<uint64_t>();
-      const uint64_t rs2 = sourceValues_[1].get<uint64_t>();
-      uint64_t out = static_cast<uint64_t>(rs1 + rs2);
-      results_[0] = RegisterValue(out, 8);
-      break;
-    }
-    case Opcode::RISCV_ADDW: {  // ADDW rd,rs1,rs2
-      const int32_t rs1 = sourceValues_[0].get<int32_t>();
-      const int32_t rs2 = sourceValues_[1].get<int32_t>();
-      int64_t out = static_cast<int64_t>(static_cast<int32_t>(rs1 + rs2));
-      results_[0] = RegisterValue(out, 8);
-      break;
-    }
-    case Opcode::RISCV_ADDI: {  // ADDI rd,rs1,imm
-      const uint64_t rs1 = sourceValues_[0].get<uint64_t>();
-      uint64_t out = static_cast<uint64_t>(rs1 + sourceImm_);
-      results_[0] = RegisterValue(out, 8);
-      break;
-    }
-    case Opcode::RISCV_ADDIW: {  // ADDIW rd,rs1,imm
-      const int32_t rs1 = sourceValues_[0].get<int32_t>();
-      uint64_t out = signExtendW(rs1 + sourceImm_);
-      results_[0] = RegisterValue(out, 8);
-      break;
-    }
-    case Opcode::RISCV_SUB: {  // SUB rd,rs1,rs2
-      const uint64_t rs1 = sourceValues_[0].get<uint64_t>();
-      const uint64_t rs2 = sourceValues_[1].get<uint64_t>();
-      uint64_t out = static_cast<uint64_t>(rs1 - rs2);
-      results_[0] = RegisterValue(out, 8);
-      break;
-    }
-    case Opcode::RISCV_SUBW: {  // SUBW rd,rs1,rs2
-      const int32_t rs1 = sourceValues_[0].get<int32_t>();
-      const int32_t rs2 = sourceValues_[1].get<int32_t>();
-      int64_t out = static_cast<int64_t>(static_cast<int32_t>(rs1 - rs2));
-      results_[0] = RegisterValue(out, 8);
-      break;
-    }
-    case Opcode::RISCV_LUI: {                        // LUI rd,imm
-      uint64_t out = signExtendW(sourceImm_ << 12);  // Shift into upper 20 bits
-      results_[0] = RegisterValue(out, 8);
-      break;
-    }
-    case Opcode::RISCV_AUIPC: {  // AUIPC rd,imm
-      const int64_t pc = instructionAddress_;
-      const int64_t uimm =
-          signExtendW(sourceImm_ << 12);  // Shift into upper 20 bits
-      uint64_t out = static_cast<uint64_t>(pc + uimm);
-      results_[0] = RegisterValue(out, 8);
-      break;
-    }
-    case Opcode::RISCV_XOR: {  // XOR rd,rs1,rs2
-      const uint64_t rs1 = sourceValues_[0].get<uint64_t>();
-      const uint64_t rs2 = sourceValues_[1].get<uint64_t>();
-      uint64_t out = static_cast<uint64_t>(rs1 ^ rs2);
-      results_[0] = RegisterValue(out, 8);
-      break;
-    }
-    case Opcode::RISCV_XORI: {  // XORI rd,rs1,imm
-      const uint64_t rs1 = sourceValues_[0].get<uint64_t>();
-      uint64_t out = static_cast<uint64_t>(rs1 ^ sourceImm_);
-      results_[0] = RegisterValue(out, 8);
-      break;
-    }
-    case Opcode::RISCV_OR: {  // OR rd,rs1,rs2
-      const uint64_t rs1 = sourceValues_[0].get<uint64_t>();
-      const uint64_t rs2 = sourceValues_[1].get<uint64_t>();
-      uint64_t out = static_cast<uint64_t>(rs1 | rs2);
-      results_[0] = RegisterValue(out, 8);
-      break;
-    }
-    case Opcode::RISCV_ORI: {  // ORI rd,rs1,imm
-      const uint64_t rs1 = sourceValues_[0].get<uint64_t>();
-      uint64_t out = static_cast<uint64_t>(rs1 | sourceImm_);
-      results_[0] = RegisterValue(out, 8);
-      break;
-    }
-    case Opcode::RISCV_AND: {  // AND rd,rs1,rs2
-      const uint64_t rs1 = sourceValues_[0].get<uint64_t>();
-      const uint64_t rs2 = sourceValues_[1].get<uint64_t>();
-      uint64_t out = static_cast<uint64_t>(rs1 & rs2);
-      results_[0] = RegisterValue(out, 8);
-      break;
-    }
-    case Opcode::RISCV_ANDI: {  // ANDI rd,rs1,imm
-      const uint64_t rs1 = sourceValues_[0].get<uint64_t>();
-      uint64_t out = static_cast<uint64_t>(rs1 & sourceImm_);
-      results_[0] = RegisterValue(out, 8);
-      break;
-    }
-    case Opcode::RISCV_SLT: {  // SLT rd,rs1,rs2
-      const int64_t rs1 = sourceValues_[0].get<int64_t>();
-      const int64_t rs2 = sourceValues_[1].get<int64_t>();
-      if (rs1 < rs2) {
-        results_[0] = RegisterValue(static_cast<uint64_t>(1), 8);
-      } else {
-        results_[0] = RegisterValue(static_cast<uint64_t>(0), 8);
-      }
-      break;
-    }
-    case Opcode::RISCV_SLTU: {  // SLTU rd,rs1,rs2
-      const uint64_t rs1 = sourceValues_[0].get<uint64_t>();
-      const uint64_t rs2 = sourceValues_[1].get<uint64_t>();
-      if (rs1 < rs2) {
-        results_[0] = RegisterValue(static_cast<uint64_t>(1), 8);
-      } else {
-        results_[0] = RegisterValue(static_cast<uint64_t>(0), 8);
-      }
-      break;
-    }
-    case Opcode::RISCV_SLTI: {  // SLTI rd,rs1,imm
-      const int64_t rs1 = sourceValues_[0].get<int64_t>();
-      if (rs1 < sourceImm_) {
-        results_[0] = RegisterValue(static_cast<uint64_t>(1), 8);
-      } else {
-        results_[0] = RegisterValue(static_cast<uint64_t>(0), 8);
-      }
-      break;
-    }
-    case Opcode::RISCV_SLTIU: {  // SLTIU rd,rs1,imm
-      const uint64_t rs1 = sourceValues_[0].get<uint64_t>();
-      if (rs1 < static_cast<uint64_t>(sourceImm_)) {
-        results_[0] = RegisterValue(static_cast<uint64_t>(1), 8);
-      } else {
-        results_[0] = RegisterValue(static_cast<uint64_t>(0), 8);
-      }
-      break;
-    }
-    case Opcode::RISCV_BEQ: {  // BEQ rs1,rs2,imm
-      const uint64_t rs1 = sourceValues_[0].get<uint64_t>();
-      const uint64_t rs2 = sourceValues_[1].get<uint64_t>();
-      if (rs1 == rs2) {
-        branchAddress_ =
-            instructionAddress_ + sourceImm_;  // Set LSB of result to 0
-        branchTaken_ = true;
-      } else {
-        branchAddress_ = instructionAddress_ + metadata_.getInsnLength();
-        branchTaken_ = false;
-      }
-      break;
-    }
-    case Opcode::RISCV_BNE: {  // BNE rs1,rs2,imm
-      const uint64_t rs1 = sourceValues_[0].get<uint64_t>();
-      const uint64_t rs2 = sourceValues_[1].get<uint64_t>();
-      if (rs1 != rs2) {
-        branchAddress_ =
-            instructionAddress_ + sourceImm_;  // Set LSB of result to 0
-        branchTaken_ = true;
-      } else {
-        // Increase by instruction size to account for compressed instructions
-        branchAddress_ = instructionAddress_ + metadata_.getInsnLength();
-        branchTaken_ = false;
-      }
-      break;
-    }
-    case Opcode::RISCV_BLT: {  // BLT rs1,rs2,imm
-      const int64_t rs1 = sourceValues_[0].get<int64_t>();
-      const int64_t rs2 = sourceValues_[1].get<int64_t>();
-      if (rs1 < rs2) {
-        branchAddress_ =
-            instructionAddress_ + sourceImm_;  // Set LSB of result to 0
-        branchTaken_ = true;
-      } else {
-        branchAddress_ = instructionAddress_ + metadata_.getInsnLength();
-        branchTaken_ = false;
-      }
-      break;
-    }
-    case Opcode::RISCV_BLTU: {  // BLTU rs1,rs2,imm
-      const uint64_t rs1 = sourceValues_[0].get<uint64_t>();
-      const uint64_t rs2 = sourceValues_[1].get<uint64_t>();
-      if (rs1 < rs2) {
-        branchAddress_ =
-            instructionAddress_ + sourceImm_;  // Set LSB of result to 0
-        branchTaken_ = true;
-      } else {
-        branchAddress_ = instructionAddress_ + metadata_.getInsnLength();
-        branchTaken_ = false;
-      }
-      break;
-    }
-    case Opcode::RISCV_BGE: {  // BGE rs1,rs2,imm
-      const int64_t rs1 = sourceValues_[0].get<int64_t>();
-      const int64_t rs2 = sourceValues_[1].get<int64_t>();
-      if (rs1 >= rs2) {
-        branchAddress_ =
-            instructionAddress_ + sourceImm_;  // Set LSB of result to 0
-        branchTaken_ = true;
-      } else {
-        branchAddress_ = instructionAddress_ + metadata_.getInsnLength();
-        branchTaken_ = false;
-      }
-      break;
-    }
-    case Opcode::RISCV_BGEU: {  // BGEU rs1,rs2,imm
-      const uint64_t rs1 = sourceValues_[0].get<uint64_t>();
-      const uint64_t rs2 = sourceValues_[1].get<uint64_t>();
-      if (rs1 >= rs2) {
-        branchAddress_ =
-            instructionAddress_ + sourceImm_;  // Set LSB of result to 0
-        branchTaken_ = true;
-      } else {
-        branchAddress_ = instructionAddress_ + metadata_.getInsnLength();
-        branchTaken_ = false;
-      }
-      break;
-    }
-    case Opcode::RISCV_JAL: {  // JAL rd,imm
-      branchAddress_ =
-          instructionAddress_ + sourceImm_;  // Set LSB of result to 0
-      branchTaken_ = true;
-      results_[0] =
-          RegisterValue(instructionAddress_ + metadata_.getInsnLength(), 8);
-      break;
-    }
-    case Opcode::RISCV_JALR: {  // JALR rd,rs1,imm
-      branchAddress_ = (sourceValues_[0].get<uint64_t>() + sourceImm_) &
-                       ~1;  // Set LSB of result to 0
-      branchTaken_ = true;
-      results_[0] =
-          RegisterValue(instructionAddress_ + metadata_.getInsnLength(), 8);
-      break;
-    }
-      // TODO EBREAK
-      // used to return control to a debugging environment pg27 20191213
-    case Opcode::RISCV_ECALL: {  // ECALL
-      exceptionEncountered_ = true;
-      exception_ = InstructionException::SupervisorCall;
-      break;
-    }
-    case Opcode::RISCV_FENCE: {  // FENCE
-      // TODO currently modelled as a NOP as all codes are currently single
-      // threaded "Informally, no other RISC-V hart or external device can
-      // observe any operation in the successor set following a FENCE before
-      // any operation in the predecessor set preceding the FENCE."
-      // https://msyksphinz-self.github.io/riscv-isadoc/html/rvi.html#fence
-
-      /* "a simple implementation ... might be able to implement the FENCE
-       * instruction as a NOP", pg13 20191213 spec */
-      break;
-    }
+  (this->*executeHandler_)();
+}
+
+template <unsigned int opcode>
+void Instruction::executeOpcode() {
+  return executionNYI();
+}
+
+// LB rd,rs1,imm
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_LB>() {
+  results_[0] = RegisterValue(bitExtend(memoryData_[0].get<uint8_t>(), 8), 8);
+}
+
+// LBU rd,rs1,imm
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_LBU>() {
+  results_[0] = RegisterValue(zeroExtend(memoryData_[0].get<uint8_t>(), 8), 8);
+}
+
+// LH rd,rs1,imm
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_LH>() {
+  results_[0] = RegisterValue(bitExtend(memoryData_[0].get<uint16_t>(), 16), 8);
+}
+
+// LHU rd,rs1,imm
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_LHU>() {
+  results_[0] =
+      RegisterValue(zeroExtend(memoryData_[0].get<uint16_t>(), 16), 8);
+}
+
+// LW rd,rs1,imm
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_LW>() {
+  results_[0] = RegisterValue(bitExtend(memoryData_[0].get<uint32_t>(), 32), 8);
+}
+
+// LWU rd,rs1,imm
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_LWU>() {
+  results_[0] =
+      RegisterValue(zeroExtend(memoryData_[0].get<uint32_t>(), 32), 8);
+}
+
+// LD rd,rs1,imm
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_LD>() {
+  results_[0] = RegisterValue(memoryData_[0].get<uint64_t>(), 8);
+}
+
+// SD rs1,rs2,imm
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_SD>() {
+  memoryData_[0] = sourceValues_[0];
+}
+
+// SB rs1,rs2,imm
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_SB>() {
+  executeOpcode<Opcode::RISCV_SD>();
+}
+
+// SH rs1,rs2,imm
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_SH>() {
+  executeOpcode<Opcode::RISCV_SD>();
+}
+
+// SW rs1,rs2,imm
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_SW>() {
+  executeOpcode<Opcode::RISCV_SD>();
+}
+
+// SLL rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_SLL>() {
+  const int64_t rs1 = sourceValues_[0].get<int64_t>();
+  const int64_t rs2 =
+      sourceValues_[1].get<int64_t>() & 63;  // Only use lowest 6 bits
+  int64_t out = static_cast<int64_t>(rs1 << rs2);
+  results_[0] = RegisterValue(out, 8);
+}
+
+// SLLI rd,rs1,shamt
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_SLLI>() {
+  const int64_t rs1 = sourceValues_[0].get<int64_t>();
+  const int64_t shamt = sourceImm_ & 63;  // Only use lowest 6 bits
+  int64_t out = static_cast<int64_t>(rs1 << shamt);
+  results_[0] = RegisterValue(out, 8);
+}
+
+// SLLW rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_SLLW>() {
+  const int32_t rs1 = sourceValues_[0].get<int32_t>();
+  const int32_t rs2 =
+      sourceValues_[1].get<int32_t>() & 31;  // Only use lowest 5 bits
+  int64_t out = signExtendW(static_cast<int32_t>(rs1 << rs2));
+  results_[0] = RegisterValue(out, 8);
+}
+
+// SLLIW rd,rs1,shamt
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_SLLIW>() {
+  const int32_t rs1 = sourceValues_[0].get<uint32_t>();
+  const int32_t shamt = sourceImm_ & 31;  // Only use lowest 5 bits
+  uint64_t out = signExtendW(static_cast<uint32_t>(rs1 << shamt));
+  results_[0] = RegisterValue(out, 8);
+}
+
+// SRL rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_SRL>() {
+  const uint64_t rs1 = sourceValues_[0].get<uint64_t>();
+  const uint64_t rs2 =
+      sourceValues_[1].get<uint64_t>() & 63;  // Only use lowest 6 bits
+  uint64_t out = static_cast<uint64_t>(rs1 >> rs2);
+  results_[0] = RegisterValue(out, 8);
+}
+
+// SRLI rd,rs1,shamt
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_SRLI>() {
+  const uint64_t rs1 = sourceValues_[0].get<uint64_t>();
+  const uint64_t shamt = sourceImm_ & 63;  // Only use lowest 6 bits
+  uint64_t out = static_cast<uint64_t>(rs1 >> shamt);
+  results_[0] = RegisterValue(out, 8);
+}
+
+// SRLW rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_SRLW>() {
+  const uint32_t rs1 = sourceValues_[0].get<uint32_t>();
+  const uint32_t rs2 =
+      sourceValues_[1].get<uint32_t>() & 31;  // Only use lowest 5 bits
+  uint64_t out = signExtendW(static_cast<uint64_t>(rs1 >> rs2));
+  results_[0] = RegisterValue(out, 8);
+}
+
+// SRLIW rd,rs1,shamt
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_SRLIW>() {
+  const uint32_t rs1 = sourceValues_[0].get<uint32_t>();
+  const uint32_t shamt = sourceImm_ & 31;  // Only use lowest 5 bits
+  uint64_t out = signExtendW(static_cast<uint32_t>(rs1 >> shamt));
+  results_[0] = RegisterValue(out, 8);
+}
+
+// SRA rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_SRA>() {
+  const int64_t rs1 = sourceValues_[0].get<int64_t>();
+  const int64_t rs2 =
+      sourceValues_[1].get<int64_t>() & 63;  // Only use lowest 6 bits
+  int64_t out = static_cast<int64_t>(rs1 >> rs2);
+  results_[0] = RegisterValue(out, 8);
+}
+
+// SRAI rd,rs1,shamt
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_SRAI>() {
+  const int64_t rs1 = sourceValues_[0].get<int64_t>();
+  const int64_t shamt = sourceImm_ & 63;  // Only use lowest 6 bits
+  int64_t out = static_cast<int64_t>(rs1 >> shamt);
+  results_[0] = RegisterValue(out, 8);
+}
+
+// SRAW rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_SRAW>() {
+  const int32_t rs1 = sourceValues_[0].get<int32_t>();
+  const int32_t rs2 =
+      sourceValues_[1].get<int32_t>() & 31;  // Only use lowest 5 bits
+  int64_t out = static_cast<int32_t>(rs1 >> rs2);
+  results_[0] = RegisterValue(out, 8);
+}
+
+// SRAIW rd,rs1,shamt
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_SRAIW>() {
+  const int32_t rs1 = sourceValues_[0].get<int32_t>();
+  const int32_t shamt = sourceImm_ & 31;  // Only use lowest 5 bits
+  int64_t out = static_cast<int32_t>(rs1 >> shamt);
+  results_[0] = RegisterValue(out, 8);
+}
+
+// ADD rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_ADD>() {
+  const uint64_t rs1 = sourceValues_[0].get<uint64_t>();
+  const uint64_t rs2 = sourceValues_[1].get<uint64_t>();
+  uint64_t out = static_cast<uint64_t>(rs1 + rs2);
+  results_[0] = RegisterValue(out, 8);
+}
+
+// ADDW rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_ADDW>() {
+  const int32_t rs1 = sourceValues_[0].get<int32_t>();
+  const int32_t rs2 = sourceValues_[1].get<int32_t>();
+  int64_t out = static_cast<int64_t>(static_cast<int32_t>(rs1 + rs2));
+  results_[0] = RegisterValue(out, 8);
+}
+
+// ADDI rd,rs1,imm
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_ADDI>() {
+  const uint64_t rs1 = sourceValues_[0].get<uint64_t>();
+  uint64_t out = static_cast<uint64_t>(rs1 + sourceImm_);
+  results_[0] = RegisterValue(out, 8);
+}
+
+// ADDIW rd,rs1,imm
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_ADDIW>() {
+  const int32_t rs1 = sourceValues_[0].get<int32_t>();
+  uint64_t out = signExtendW(rs1 + sourceImm_);
+  results_[0] = RegisterValue(out, 8);
+}
+
+// SUB rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_SUB>() {
+  const uint64_t rs1 = sourceValues_[0].get<uint64_t>();
+  const uint64_t rs2 = sourceValues_[1].get<uint64_t>();
+  uint64_t out = static_cast<uint64_t>(rs1 - rs2);
+  results_[0] = RegisterValue(out, 8);
+}
+
+// SUBW rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_SUBW>() {
+  const int32_t rs1 = sourceValues_[0].get<int32_t>();
+  const int32_t rs2 = sourceValues_[1].get<int32_t>();
+  int64_t out = static_cast<int64_t>(static_cast<int32_t>(rs1 - rs2));
+  results_[0] = RegisterValue(out, 8);
+}
+
+// LUI rd,imm
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_LUI>() {
+  uint64_t out = signExtendW(sourceImm_ << 12);  // Shift into upper 20 bits
+  results_[0] = RegisterValue(out, 8);
+}
+
+// AUIPC rd,imm
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AUIPC>() {
+  const int64_t pc = instructionAddress_;
+  const int64_t uimm =
+      signExtendW(sourceImm_ << 12);  // Shift into upper 20 bits
+  uint64_t out = static_cast<uint64_t>(pc + uimm);
+  results_[0] = RegisterValue(out, 8);
+}
+
+// XOR rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_XOR>() {
+  const uint64_t rs1 = sourceValues_[0].get<uint64_t>();
+  const uint64_t rs2 = sourceValues_[1].get<uint64_t>();
+  uint64_t out = static_cast<uint64_t>(rs1 ^ rs2);
+  results_[0] = RegisterValue(out, 8);
+}
+
+// XORI rd,rs1,imm
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_XORI>() {
+  const uint64_t rs1 = sourceValues_[0].get<uint64_t>();
+  uint64_t out = static_cast<uint64_t>(rs1 ^ sourceImm_);
+  results_[0] = RegisterValue(out, 8);
+}
+
+// OR rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_OR>() {
+  const uint64_t rs1 = sourceValues_[0].get<uint64_t>();
+  const uint64_t rs2 = sourceValues_[1].get<uint64_t>();
+  uint64_t out = static_cast<uint64_t>(rs1 | rs2);
+  results_[0] = RegisterValue(out, 8);
+}
+
+// ORI rd,rs1,imm
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_ORI>() {
+  const uint64_t rs1 = sourceValues_[0].get<uint64_t>();
+  uint64_t out = static_cast<uint64_t>(rs1 | sourceImm_);
+  results_[0] = RegisterValue(out, 8);
+}
+
+// AND rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AND>() {
+  const uint64_t rs1 = sourceValues_[0].get<uint64_t>();
+  const uint64_t rs2 = sourceValues_[1].get<uint64_t>();
+  uint64_t out = static_cast<uint64_t>(rs1 & rs2);
+  results_[0] = RegisterValue(out, 8);
+}
+
+// ANDI rd,rs1,imm
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_ANDI>() {
+  const uint64_t rs1 = sourceValues_[0].get<uint64_t>();
+  uint64_t out = static_cast<uint64_t>(rs1 & sourceImm_);
+  results_[0] = RegisterValue(out, 8);
+}
+
+// SLT rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_SLT>() {
+  const int64_t rs1 = sourceValues_[0].get<int64_t>();
+  const int64_t rs2 = sourceValues_[1].get<int64_t>();
+  if (rs1 < rs2) {
+    results_[0] = RegisterValue(static_cast<uint64_t>(1), 8);
+  } else {
+    results_[0] = RegisterValue(static_cast<uint64_t>(0), 8);
+  }
+}
+
+// SLTU rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_SLTU>() {
+  const uint64_t rs1 = sourceValues_[0].get<uint64_t>();
+  const uint64_t rs2 = sourceValues_[1].get<uint64_t>();
+  if (rs1 < rs2) {
+    results_[0] = RegisterValue(static_cast<uint64_t>(1), 8);
+  } else {
+    results_[0] = RegisterValue(static_cast<uint64_t>(0), 8);
+  }
+}
+
+// SLTI rd,rs1,imm
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_SLTI>() {
+  const int64_t rs1 = sourceValues_[0].get<int64_t>();
+  if (rs1 < sourceImm_) {
+    results_[0] = RegisterValue(static_cast<uint64_t>(1), 8);
+  } else {
+    results_[0] = RegisterValue(static_cast<uint64_t>(0), 8);
+  }
+}
+
+// SLTIU rd,rs1,imm
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_SLTIU>() {
+  const uint64_t rs1 = sourceValues_[0].get<uint64_t>();
+  if (rs1 < static_cast<uint64_t>(sourceImm_)) {
+    results_[0] = RegisterValue(static_cast<uint64_t>(1), 8);
+  } else {
+    results_[0] = RegisterValue(static_cast<uint64_t>(0), 8);
+  }
+}
+
+// BEQ rs1,rs2,imm
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_BEQ>() {
+  const uint64_t rs1 = sourceValues_[0].get<uint64_t>();
+  const uint64_t rs2 = sourceValues_[1].get<uint64_t>();
+  if (rs1 == rs2) {
+    branchAddress_ =
+        instructionAddress_ + sourceImm_;  // Set LSB of result to 0
+    branchTaken_ = true;
+  } else {
+    branchAddress_ = instructionAddress_ + metadata_.getInsnLength();
+    branchTaken_ = false;
+  }
+}
+
+// BNE rs1,rs2,imm
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_BNE>() {
+  const uint64_t rs1 = sourceValues_[0].get<uint64_t>();
+  const uint64_t rs2 = sourceValues_[1].get<uint64_t>();
+  if (rs1 != rs2) {
+    branchAddress_ =
+        instructionAddress_ + sourceImm_;  // Set LSB of result to 0
+    branchTaken_ = true;
+  } else {
+    // Increase by instruction size to account for compressed instructions
+    branchAddress_ = instructionAddress_ + metadata_.getInsnLength();
+    branchTaken_ = false;
+  }
+}
+
+// BLT rs1,rs2,imm
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_BLT>() {
+  const int64_t rs1 = sourceValues_[0].get<int64_t>();
+  const int64_t rs2 = sourceValues_[1].get<int64_t>();
+  if (rs1 < rs2) {
+    branchAddress_ =
+        instructionAddress_ + sourceImm_;  // Set LSB of result to 0
+    branchTaken_ = true;
+  } else {
+    branchAddress_ = instructionAddress_ + metadata_.getInsnLength();
+    branchTaken_ = false;
+  }
+}
+
+// BLTU rs1,rs2,imm
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_BLTU>() {
+  const uint64_t rs1 = sourceValues_[0].get<uint64_t>();
+  const uint64_t rs2 = sourceValues_[1].get<uint64_t>();
+  if (rs1 < rs2) {
+    branchAddress_ =
+        instructionAddress_ + sourceImm_;  // Set LSB of result to 0
+    branchTaken_ = true;
+  } else {
+    branchAddress_ = instructionAddress_ + metadata_.getInsnLength();
+    branchTaken_ = false;
+  }
+}
+
+// BGE rs1,rs2,imm
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_BGE>() {
+  const int64_t rs1 = sourceValues_[0].get<int64_t>();
+  const int64_t rs2 = sourceValues_[1].get<int64_t>();
+  if (rs1 >= rs2) {
+    branchAddress_ =
+        instructionAddress_ + sourceImm_;  // Set LSB of result to 0
+    branchTaken_ = true;
+  } else {
+    branchAddress_ = instructionAddress_ + metadata_.getInsnLength();
+    branchTaken_ = false;
+  }
+}
+
+// BGEU rs1,rs2,imm
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_BGEU>() {
+  const uint64_t rs1 = sourceValues_[0].get<uint64_t>();
+  const uint64_t rs2 = sourceValues_[1].get<uint64_t>();
+  if (rs1 >= rs2) {
+    branchAddress_ =
+        instructionAddress_ + sourceImm_;  // Set LSB of result to 0
+    branchTaken_ = true;
+  } else {
+    branchAddress_ = instructionAddress_ + metadata_.getInsnLength();
+    branchTaken_ = false;
+  }
+}
+
+// JAL rd,imm
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_JAL>() {
+  branchAddress_ =
+      instructionAddress_ + sourceImm_;  // Set LSB of result to 0
+  branchTaken_ = true;
+  results_[0] =
+      RegisterValue(instructionAddress_ + metadata_.getInsnLength(), 8);
+}
+
+// JALR rd,rs1,imm
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_JALR>() {
+  branchAddress_ = (sourceValues_[0].get<uint64_t>() + sourceImm_) &
+                   ~1;  // Set LSB of result to 0
+  branchTaken_ = true;
+  results_[0] =
+      RegisterValue(instructionAddress_ + metadata_.getInsnLength(), 8);
+}
+
+// TODO EBREAK
+// used to return control to a debugging environment pg27 20191213
+
+// ECALL
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_ECALL>() {
+  exceptionEncountered_ = true;
+  exception_ = InstructionException::SupervisorCall;
+}
+
+// FENCE
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FENCE>() {
+  // TODO currently modelled as a NOP as all codes are currently single
+  // threaded "Informally, no other RISC-V hart or external device can
+  // observe any operation in the successor set following a FENCE before
+  // any operation in the predecessor set preceding the FENCE."
+  // https://msyksphinz-self.github.io/riscv-isadoc/html/rvi.html#fence
+
+  /* "a simple implementation ... might be able to implement the FENCE
+   * instruction as a NOP", pg13 20191213 spec */
+}
+
+// Atomic Extension (A)
+// TODO not implemented atomically
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_LR_W_AQ_RL>() {
+  // TODO set "reservation set" in memory, currently not needed as all
+  // codes are single threaded
+  // TODO check that address is naturally aligned to operand size,
+  //  if not raise address-misaligned/access-fault exception
+  // TODO use aq and rl bits to prevent reordering with other memory
+  // operations
+  results_[0] = RegisterValue(bitExtend(memoryData_[0].get<uint32_t>(), 32), 8);
+}
+
+// LR.W rd,rs1
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_LR_W>() {
+  executeOpcode<Opcode::RISCV_LR_W_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_LR_W_AQ>() {
+  executeOpcode<Opcode::RISCV_LR_W_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_LR_W_RL>() {
+  executeOpcode<Opcode::RISCV_LR_W_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_LR_D_AQ_RL>() {
+  results_[0] = RegisterValue(memoryData_[0].get<uint64_t>(), 8);
+}
+
+// LR.D rd,rs1
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_LR_D>() {
+  executeOpcode<Opcode::RISCV_LR_D_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_LR_D_AQ>() {
+  executeOpcode<Opcode::RISCV_LR_D_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_LR_D_RL>() {
+  executeOpcode<Opcode::RISCV_LR_D_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_SC_D_AQ_RL>() {
+  // TODO check "reservation set" hasn't been written to before performing
+  // store
+  // TODO write rd correctly based on whether sc succeeds
+  // TODO check that address is naturally aligned to operand size,
+  //  if not raise address-misaligned/access-fault exception
+  // TODO use aq and rl bits to prevent reordering with other memory
+  // operations
+  memoryData_[0] = sourceValues_[0];
+  results_[0] = RegisterValue(static_cast<uint64_t>(0), 8);
+}
+
+// SC.W rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_SC_W>() {
+  executeOpcode<Opcode::RISCV_SC_D_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_SC_W_AQ>() {
+  executeOpcode<Opcode::RISCV_SC_D_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_SC_W_RL>() {
+  executeOpcode<Opcode::RISCV_SC_D_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_SC_W_AQ_RL>() {
+  executeOpcode<Opcode::RISCV_SC_D_AQ_RL>();
+}
+
+// SC.D rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_SC_D>() {
+  executeOpcode<Opcode::RISCV_SC_D_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_SC_D_AQ>() {
+  executeOpcode<Opcode::RISCV_SC_D_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_SC_D_RL>() {
+  executeOpcode<Opcode::RISCV_SC_D_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOSWAP_W_AQ_RL>() {
+  // Load memory at address rs1 into rd
+  // Swap rd and rs2
+  // Store rd to memory at address rs1
+  // TODO raise address misaligned or access-fault errors
+  // TODO account for AQ and RL bits
+  int64_t rd = signExtendW(memoryData_[0].get<uint32_t>());
+  int32_t rs2 = sourceValues_[0].get<int32_t>();
+  results_[0] = RegisterValue(rd, 8);
+  memoryData_[0] = rs2;
+}
+
+// AMOSWAP.W rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOSWAP_W>() {
+  executeOpcode<Opcode::RISCV_AMOSWAP_W_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOSWAP_W_AQ>() {
+  executeOpcode<Opcode::RISCV_AMOSWAP_W_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOSWAP_W_RL>() {
+  executeOpcode<Opcode::RISCV_AMOSWAP_W_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOSWAP_D_AQ_RL>() {
+  uint64_t rd = memoryData_[0].get<uint64_t>();
+  uint64_t rs2 = sourceValues_[0].get<uint64_t>();
+  results_[0] = RegisterValue(rd, 8);
+  memoryData_[0] = rs2;
+}
+
+// AMOSWAP.D rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOSWAP_D>() {
+  executeOpcode<Opcode::RISCV_AMOSWAP_D_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOSWAP_D_AQ>() {
+  executeOpcode<Opcode::RISCV_AMOSWAP_D_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOSWAP_D_RL>() {
+  executeOpcode<Opcode::RISCV_AMOSWAP_D_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOADD_W_AQ_RL>() {
+  int64_t rd = signExtendW(memoryData_[0].get<uint32_t>());
+  results_[0] = RegisterValue(rd, 8);
+  memoryData_[0] = static_cast<int32_t>(rd + sourceValues_[0].get<int64_t>());
+}
+
+// AMOADD.W rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOADD_W>() {
+  executeOpcode<Opcode::RISCV_AMOADD_W_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOADD_W_AQ>() {
+  executeOpcode<Opcode::RISCV_AMOADD_W_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOADD_W_RL>() {
+  executeOpcode<Opcode::RISCV_AMOADD_W_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOADD_D_AQ_RL>() {
+  int64_t rd = memoryData_[0].get<uint64_t>();
+  results_[0] = RegisterValue(rd, 8);
+  memoryData_[0] = static_cast<int64_t>(rd + sourceValues_[0].get<int64_t>());
+}
+
+// AMOADD.D rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOADD_D>() {
+  executeOpcode<Opcode::RISCV_AMOADD_D_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOADD_D_AQ>() {
+  executeOpcode<Opcode::RISCV_AMOADD_D_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOADD_D_RL>() {
+  executeOpcode<Opcode::RISCV_AMOADD_D_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOAND_W_AQ_RL>() {
+  int64_t rd = signExtendW(memoryData_[0].get<uint32_t>());
+  results_[0] = RegisterValue(rd, 8);
+  memoryData_[0] = static_cast<int32_t>(rd & sourceValues_[0].get<int64_t>());
+}
+
+// AMOAND.W rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOAND_W>() {
+  executeOpcode<Opcode::RISCV_AMOAND_W_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOAND_W_AQ>() {
+  executeOpcode<Opcode::RISCV_AMOAND_W_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOAND_W_RL>() {
+  executeOpcode<Opcode::RISCV_AMOAND_W_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOAND_D_AQ_RL>() {
+  int64_t rd = memoryData_[0].get<uint64_t>();
+  results_[0] = RegisterValue(rd, 8);
+  memoryData_[0] = static_cast<int64_t>(rd & sourceValues_[0].get<int64_t>());
+}
+
+// AMOAND.D rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOAND_D>() {
+  executeOpcode<Opcode::RISCV_AMOAND_D_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOAND_D_AQ>() {
+  executeOpcode<Opcode::RISCV_AMOAND_D_AQ_RL>();
+}
 
-      // Atomic Extension (A)
-      // TODO not implemented atomically
-    case Opcode::RISCV_LR_W:  // LR.W rd,rs1
-    case Opcode::RISCV_LR_W_AQ:
-    case Opcode::RISCV_LR_W_RL:
-    case Opcode::RISCV_LR_W_AQ_RL: {
-      // TODO set "reservation set" in memory, currently not needed as all
-      // codes are single threaded
-      // TODO check that address is naturally aligned to operand size,
-      //  if not raise address-misaligned/access-fault exception
-      // TODO use aq and rl bits to prevent reordering with other memory
-      // operations
-      results_[0] =
-          RegisterValue(bitExtend(memoryData_[0].get<uint32_t>(), 32), 8);
-      break;
-    }
-    case Opcode::RISCV_LR_D:  // LR.D rd,rs1
-    case Opcode::RISCV_LR_D_AQ:
-    case Opcode::RISCV_LR_D_RL:
-    case Opcode::RISCV_LR_D_AQ_RL: {
-      results_[0] = RegisterValue(memoryData_[0].get<uint64_t>(), 8);
-      break;
-    }
-    case Opcode::RISCV_SC_W:  // SC.W rd,rs1,rs2
-    case Opcode::RISCV_SC_W_AQ:
-    case Opcode::RISCV_SC_W_RL:
-    case Opcode::RISCV_SC_W_AQ_RL:
-    case Opcode::RISCV_SC_D:  // SC.D rd,rs1,rs2
-    case Opcode::RISCV_SC_D_AQ:
-    case Opcode::RISCV_SC_D_RL:
-    case Opcode::RISCV_SC_D_AQ_RL: {
-      // TODO check "reservation set" hasn't been written to before performing
-      // store
-      // TODO write rd correctly based on whether sc succeeds
-      // TODO check that address is naturally aligned to operand size,
-      //  if not raise address-misaligned/access-fault exception
-      // TODO use aq and rl bits to prevent reordering with other memory
-      // operations
-      memoryData_[0] = sourceValues_[0];
-      results_[0] = RegisterValue(static_cast<uint64_t>(0), 8);
-      break;
-    }
-    case Opcode::RISCV_AMOSWAP_W:  // AMOSWAP.W rd,rs1,rs2
-    case Opcode::RISCV_AMOSWAP_W_AQ:
-    case Opcode::RISCV_AMOSWAP_W_RL:
-    case Opcode::RISCV_AMOSWAP_W_AQ_RL: {
-      // Load memory at address rs1 into rd
-      // Swap rd and rs2
-      // Store rd to memory at address rs1
-      // TODO raise address misaligned or access-fault errors
-      // TODO account for AQ and RL bits
-      int64_t rd = signExtendW(memoryData_[0].get<uint32_t>());
-      int32_t rs2 = sourceValues_[0].get<int32_t>();
-      results_[0] = RegisterValue(rd, 8);
-      memoryData_[0] = rs2;
-      break;
-    }
-    case Opcode::RISCV_AMOSWAP_D:  // AMOSWAP.D rd,rs1,rs2
-    case Opcode::RISCV_AMOSWAP_D_AQ:
-    case Opcode::RISCV_AMOSWAP_D_RL:
-    case Opcode::RISCV_AMOSWAP_D_AQ_RL: {
-      uint64_t rd = memoryData_[0].get<uint64_t>();
-      uint64_t rs2 = sourceValues_[0].get<uint64_t>();
-      results_[0] = RegisterValue(rd, 8);
-      memoryData_[0] = rs2;
-      break;
-    }
-    case Opcode::RISCV_AMOADD_W:  // AMOADD.W rd,rs1,rs2
-    case Opcode::RISCV_AMOADD_W_AQ:
-    case Opcode::RISCV_AMOADD_W_RL:
-    case Opcode::RISCV_AMOADD_W_AQ_RL: {
-      int64_t rd = signExtendW(memoryData_[0].get<uint32_t>());
-      results_[0] = RegisterValue(rd, 8);
-      memoryData_[0] =
-          static_cast<int32_t>(rd + sourceValues_[0].get<int64_t>());
-      break;
-    }
-    case Opcode::RISCV_AMOADD_D:  // AMOADD.D rd,rs1,rs2
-    case Opcode::RISCV_AMOADD_D_AQ:
-    case Opcode::RISCV_AMOADD_D_RL:
-    case Opcode::RISCV_AMOADD_D_AQ_RL: {
-      int64_t rd = memoryData_[0].get<uint64_t>();
-      results_[0] = RegisterValue(rd, 8);
-      memoryData_[0] =
-          static_cast<int64_t>(rd + sourceValues_[0].get<int64_t>());
-      break;
-    }
-    case Opcode::RISCV_AMOAND_W:  // AMOAND.W rd,rs1,rs2
-    case Opcode::RISCV_AMOAND_W_AQ:
-    case Opcode::RISCV_AMOAND_W_RL:
-    case Opcode::RISCV_AMOAND_W_AQ_RL: {
-      int64_t rd = signExtendW(memoryData_[0].get<uint32_t>());
-      results_[0] = RegisterValue(rd, 8);
-      memoryData_[0] =
-          static_cast<int32_t>(rd & sourceValues_[0].get<int64_t>());
-      break;
-    }
-    case Opcode::RISCV_AMOAND_D:  // AMOAND.D rd,rs1,rs2
-    case Opcode::RISCV_AMOAND_D_AQ:
-    case Opcode::RISCV_AMOAND_D_RL:
-    case Opcode::RISCV_AMOAND_D_AQ_RL: {
-      int64_t rd = memoryData_[0].get<uint64_t>();
-      results_[0] = RegisterValue(rd, 8);
-      memoryData_[0] =
-          static_cast<int64_t>(rd & sourceValues_[0].get<int64_t>());
-      break;
-    }
-    case Opcode::RISCV_AMOOR_W:  // AMOOR.W rd,rs1,rs2
-    case Opcode::RISCV_AMOOR_W_AQ:
-    case Opcode::RISCV_AMOOR_W_RL:
-    case Opcode::RISCV_AMOOR_W_AQ_RL: {
-      int64_t rd = signExtendW(memoryData_[0].get<uint32_t>());
-      results_[0] = RegisterValue(rd, 8);
-      memoryData_[0] =
-          static_cast<int32_t>(rd | sourceValues_[0].get<int64_t>());
-      break;
-    }
-    case Opcode::RISCV_AMOOR_D:  // AMOOR.D rd,rs1,rs2
-    case Opcode::RISCV_AMOOR_D_AQ:
-    case Opcode::RISCV_AMOOR_D_RL:
-    case Opcode::RISCV_AMOOR_D_AQ_RL: {
-      int64_t rd = memoryData_[0].get<uint64_t>();
-      results_[0] = RegisterValue(rd, 8);
-      memoryData_[0] =
-          static_cast<int64_t>(rd | sourceValues_[0].get<int64_t>());
-      break;
-    }
-    case Opcode::RISCV_AMOXOR_W:  // AMOXOR.W rd,rs1,rs2
-    case Opcode::RISCV_AMOXOR_W_AQ:
-    case Opcode::RISCV_AMOXOR_W_RL:
-    case Opcode::RISCV_AMOXOR_W_AQ_RL: {
-      int64_t rd = signExtendW(memoryData_[0].get<uint32_t>());
-      results_[0] = RegisterValue(rd, 8);
-      memoryData_[0] =
-          static_cast<int32_t>(rd ^ sourceValues_[0].get<int64_t>());
-      break;
-    }
-    case Opcode::RISCV_AMOXOR_D:  // AMOXOR.D rd,rs1,rs2
-    case Opcode::RISCV_AMOXOR_D_AQ:
-    case Opcode::RISCV_AMOXOR_D_RL:
-    case Opcode::RISCV_AMOXOR_D_AQ_RL: {
-      int64_t rd = memoryData_[0].get<uint64_t>();
-      results_[0] = RegisterValue(rd, 8);
-      memoryData_[0] =
-          static_cast<int64_t>(rd ^ sourceValues_[0].get<int64_t>());
-      break;
-    }
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOAND_D_RL>() {
+  executeOpcode<Opcode::RISCV_AMOAND_D_AQ_RL>();
+}
 
-    case Opcode::RISCV_AMOMIN_W:  // AMOMIN.W rd,rs1,rs2
-    case Opcode::RISCV_AMOMIN_W_AQ:
-    case Opcode::RISCV_AMOMIN_W_RL:
-    case Opcode::RISCV_AMOMIN_W_AQ_RL: {
-      results_[0] =
-          RegisterValue(signExtendW(memoryData_[0].get<int32_t>()), 8);
-      memoryData_[0] = std::min(memoryData_[0].get<int32_t>(),
-                                sourceValues_[0].get<int32_t>());
-      break;
-    }
-    case Opcode::RISCV_AMOMIN_D:  // AMOMIN.D rd,rs1,rs2
-    case Opcode::RISCV_AMOMIN_D_AQ:
-    case Opcode::RISCV_AMOMIN_D_RL:
-    case Opcode::RISCV_AMOMIN_D_AQ_RL: {
-      int64_t rd = memoryData_[0].get<int64_t>();
-      results_[0] = RegisterValue(rd, 8);
-      memoryData_[0] =
-          static_cast<int64_t>(std::min(rd, sourceValues_[0].get<int64_t>()));
-      break;
-    }
-    case Opcode::RISCV_AMOMINU_W:  // AMOMINU.W rd,rs1,rs2
-    case Opcode::RISCV_AMOMINU_W_AQ:
-    case Opcode::RISCV_AMOMINU_W_RL:
-    case Opcode::RISCV_AMOMINU_W_AQ_RL: {
-      results_[0] =
-          RegisterValue(signExtendW(memoryData_[0].get<uint32_t>()), 8);
-      memoryData_[0] = std::min(memoryData_[0].get<uint32_t>(),
-                                sourceValues_[0].get<uint32_t>());
-      break;
-    }
-    case Opcode::RISCV_AMOMINU_D:  // AMOMINU.D rd,rs1,rs2
-    case Opcode::RISCV_AMOMINU_D_AQ:
-    case Opcode::RISCV_AMOMINU_D_RL:
-    case Opcode::RISCV_AMOMINU_D_AQ_RL: {
-      uint64_t rd = memoryData_[0].get<uint64_t>();
-      results_[0] = RegisterValue(rd, 8);
-      memoryData_[0] =
-          static_cast<uint64_t>(std::min(rd, sourceValues_[0].get<uint64_t>()));
-      break;
-    }
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOOR_W_AQ_RL>() {
+  int64_t rd = signExtendW(memoryData_[0].get<uint32_t>());
+  results_[0] = RegisterValue(rd, 8);
+  memoryData_[0] = static_cast<int32_t>(rd | sourceValues_[0].get<int64_t>());
+}
 
-    case Opcode::RISCV_AMOMAX_W:  // AMOMAX.W rd,rs1,rs2
-    case Opcode::RISCV_AMOMAX_W_AQ:
-    case Opcode::RISCV_AMOMAX_W_RL:
-    case Opcode::RISCV_AMOMAX_W_AQ_RL: {
-      results_[0] =
-          RegisterValue(signExtendW(memoryData_[0].get<int32_t>()), 8);
-      memoryData_[0] = std::max(memoryData_[0].get<int32_t>(),
-                                sourceValues_[0].get<int32_t>());
-      break;
-    }
-    case Opcode::RISCV_AMOMAX_D:  // AMOMAX.D rd,rs1,rs2
-    case Opcode::RISCV_AMOMAX_D_AQ:
-    case Opcode::RISCV_AMOMAX_D_RL:
-    case Opcode::RISCV_AMOMAX_D_AQ_RL: {
-      int64_t rd = memoryData_[0].get<int64_t>();
-      results_[0] = RegisterValue(rd, 8);
-      memoryData_[0] =
-          static_cast<int64_t>(std::max(rd, sourceValues_[0].get<int64_t>()));
-      break;
-    }
-    case Opcode::RISCV_AMOMAXU_W:  // AMOMAXU.W rd,rs1,rs2
-    case Opcode::RISCV_AMOMAXU_W_AQ:
-    case Opcode::RISCV_AMOMAXU_W_RL:
-    case Opcode::RISCV_AMOMAXU_W_AQ_RL: {
-      results_[0] =
-          RegisterValue(signExtendW(memoryData_[0].get<uint32_t>()), 8);
-      memoryData_[0] = std::max(memoryData_[0].get<uint32_t>(),
-                                sourceValues_[0].get<uint32_t>());
-      break;
-    }
-    case Opcode::RISCV_AMOMAXU_D:  // AMOMAXU.D rd,rs1,rs2
-    case Opcode::RISCV_AMOMAXU_D_AQ:
-    case Opcode::RISCV_AMOMAXU_D_RL:
-    case Opcode::RISCV_AMOMAXU_D_AQ_RL: {
-      uint64_t rd = memoryData_[0].get<uint64_t>();
-      results_[0] = RegisterValue(rd, 8);
-      memoryData_[0] =
-          static_cast<uint64_t>(std::max(rd, sourceValues_[0].get<uint64_t>()));
-      break;
-    }
+// AMOOR.W rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOOR_W>() {
+  executeOpcode<Opcode::RISCV_AMOOR_W_AQ_RL>();
+}
 
-      // Integer multiplication division extension (M)
-    case Opcode::RISCV_MUL: {  // MUL rd,rs1,rs2
-      const int64_t rs1 = sourceValues_[0].get<int64_t>();
-      const int64_t rs2 = sourceValues_[1].get<int64_t>();
-      results_[0] = RegisterValue(static_cast<int64_t>(rs1 * rs2), 8);
-      break;
-    }
-      //    case Opcode::RISCV_MULH: {//MULH rd,rs1,rs2
-      //      return executionNYI();
-      //
-      //      const int64_t rs1 = operands[0].get<int64_t>();
-      //      const int64_t rs2 = operands[1].get<int64_t>();
-      //      results[0] = RegisterValue(mulhiss(rs1, rs2);
-      //      break;
-      //    }
-    case Opcode::RISCV_MULHU: {  // MULHU rd,rs1,rs2
-      const uint64_t rs1 = sourceValues_[0].get<uint64_t>();
-      const uint64_t rs2 = sourceValues_[1].get<uint64_t>();
-      results_[0] = RegisterValue(mulhiuu(rs1, rs2), 8);
-      break;
-    }
-      //    case Opcode::RISCV_MULHSU: {//MULHSU rd,rs1,rs2
-      //      return executionNYI();
-      //
-      //      const int64_t rs1 = operands[0].get<int64_t>();
-      //      const uint64_t rs2 = operands[1].get<uint64_t>();
-      //      results[0] = RegisterValue(mulhisu(rs1, rs2);
-      //      break;
-      //    }
-    case Opcode::RISCV_MULW: {  // MULW rd,rs1,rs2
-      const uint32_t rs1 = sourceValues_[0].get<uint32_t>();
-      const uint32_t rs2 = sourceValues_[1].get<uint32_t>();
-      results_[0] = RegisterValue(signExtendW(rs1 * rs2), 8);
-      break;
-    }
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOOR_W_AQ>() {
+  executeOpcode<Opcode::RISCV_AMOOR_W_AQ_RL>();
+}
 
-    case Opcode::RISCV_DIV: {  // DIV rd,rs1,rs2
-      const int64_t rs1 = sourceValues_[0].get<int64_t>();
-      const int64_t rs2 = sourceValues_[1].get<int64_t>();
-      if (rs2 == 0) {
-        // divide by zero
-        results_[0] = RegisterValue(static_cast<uint64_t>(-1), 8);
-      } else if (rs1 == static_cast<int64_t>(0x8000000000000000) && rs2 == -1) {
-        // division overflow
-        results_[0] = RegisterValue(rs1, 8);
-      } else {
-        results_[0] = RegisterValue(static_cast<int64_t>(rs1 / rs2), 8);
-      }
-      break;
-    }
-    case Opcode::RISCV_DIVW: {  // DIVW rd,rs1,rs2
-      const int32_t rs1 = sourceValues_[0].get<int32_t>();
-      const int32_t rs2 = sourceValues_[1].get<int32_t>();
-      if (rs2 == 0) {
-        // divide by zero
-        results_[0] = RegisterValue(static_cast<uint64_t>(-1), 8);
-      } else if (rs1 == static_cast<int32_t>(0x80000000) && rs2 == -1) {
-        // division overflow
-        results_[0] = RegisterValue(static_cast<int64_t>(signExtendW(rs1)), 8);
-      } else {
-        results_[0] =
-            RegisterValue(static_cast<int64_t>(signExtendW(rs1 / rs2)), 8);
-      }
-      break;
-    }
-    case Opcode::RISCV_DIVU: {  // DIVU rd,rs1,rs2
-      const uint64_t rs1 = sourceValues_[0].get<uint64_t>();
-      const uint64_t rs2 = sourceValues_[1].get<uint64_t>();
-      if (rs2 == 0) {
-        // divide by zero
-        results_[0] = RegisterValue(static_cast<uint64_t>(-1), 8);
-      } else {
-        results_[0] = RegisterValue(static_cast<uint64_t>(rs1 / rs2), 8);
-      }
-      break;
-    }
-    case Opcode::RISCV_DIVUW: {  // DIVUW rd,rs1,rs2
-      const uint32_t rs1 = sourceValues_[0].get<uint32_t>();
-      const uint32_t rs2 = sourceValues_[1].get<uint32_t>();
-      if (rs2 == 0) {
-        // divide by zero
-        results_[0] = RegisterValue(static_cast<uint64_t>(-1), 8);
-      } else {
-        results_[0] =
-            RegisterValue(static_cast<uint64_t>(signExtendW(rs1 / rs2)), 8);
-      }
-      break;
-    }
-    case Opcode::RISCV_REM: {  // REM rd,rs1,rs2
-      const int64_t rs1 = sourceValues_[0].get<int64_t>();
-      const int64_t rs2 = sourceValues_[1].get<int64_t>();
-      if (rs2 == 0) {
-        // divide by zero
-        results_[0] = RegisterValue(static_cast<uint64_t>(rs1), 8);
-      } else if (rs1 == static_cast<int64_t>(0x8000000000000000) && rs2 == -1) {
-        // division overflow
-        results_[0] = RegisterValue(static_cast<int64_t>(0), 8);
-      } else {
-        results_[0] = RegisterValue(static_cast<int64_t>(rs1 % rs2), 8);
-      }
-      break;
-    }
-    case Opcode::RISCV_REMW: {  // REMW rd,rs1,rs2
-      const int32_t rs1 = sourceValues_[0].get<int32_t>();
-      const int32_t rs2 = sourceValues_[1].get<int32_t>();
-      if (rs2 == 0) {
-        // divide by zero
-        results_[0] = RegisterValue(static_cast<int64_t>(signExtendW(rs1)), 8);
-      } else if (rs1 == static_cast<int32_t>(0x80000000) && rs2 == -1) {
-        // division overflow
-        results_[0] = RegisterValue(static_cast<int64_t>(0), 8);
-      } else {
-        results_[0] =
-            RegisterValue(static_cast<int64_t>(signExtendW(rs1 % rs2)), 8);
-      }
-      break;
-    }
-    case Opcode::RISCV_REMU: {  // REMU rd,rs1,rs2
-      const uint64_t rs1 = sourceValues_[0].get<uint64_t>();
-      const uint64_t rs2 = sourceValues_[1].get<uint64_t>();
-      if (rs2 == 0) {
-        // divide by zero
-        results_[0] = RegisterValue(rs1, 8);
-      } else {
-        results_[0] = RegisterValue(static_cast<uint64_t>(rs1 % rs2), 8);
-      }
-      break;
-    }
-    case Opcode::RISCV_REMUW: {  // REMUW rd,rs1,rs2
-      const uint32_t rs1 = sourceValues_[0].get<uint32_t>();
-      const uint32_t rs2 = sourceValues_[1].get<uint32_t>();
-      if (rs2 == 0) {
-        // divide by zero
-        results_[0] = RegisterValue(static_cast<int64_t>(signExtendW(rs1)), 8);
-      } else {
-        results_[0] =
-            RegisterValue(static_cast<uint64_t>(signExtendW(rs1 % rs2)), 8);
-      }
-      break;
-    }
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOOR_W_RL>() {
+  executeOpcode<Opcode::RISCV_AMOOR_W_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOOR_D_AQ_RL>() {
+  int64_t rd = memoryData_[0].get<uint64_t>();
+  results_[0] = RegisterValue(rd, 8);
+  memoryData_[0] = static_cast<int64_t>(rd | sourceValues_[0].get<int64_t>());
+}
+
+// AMOOR.D rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOOR_D>() {
+  executeOpcode<Opcode::RISCV_AMOOR_D_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOOR_D_AQ>() {
+  executeOpcode<Opcode::RISCV_AMOOR_D_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOOR_D_RL>() {
+  executeOpcode<Opcode::RISCV_AMOOR_D_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOXOR_W_AQ_RL>() {
+  int64_t rd = signExtendW(memoryData_[0].get<uint32_t>());
+  results_[0] = RegisterValue(rd, 8);
+  memoryData_[0] = static_cast<int32_t>(rd ^ sourceValues_[0].get<int64_t>());
+}
+
+// AMOXOR.W rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOXOR_W>() {
+  executeOpcode<Opcode::RISCV_AMOXOR_W_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOXOR_W_AQ>() {
+  executeOpcode<Opcode::RISCV_AMOXOR_W_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOXOR_W_RL>() {
+  executeOpcode<Opcode::RISCV_AMOXOR_W_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOXOR_D_AQ_RL>() {
+  int64_t rd = memoryData_[0].get<uint64_t>();
+  results_[0] = RegisterValue(rd, 8);
+  memoryData_[0] = static_cast<int64_t>(rd ^ sourceValues_[0].get<int64_t>());
+}
+
+// AMOXOR.D rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOXOR_D>() {
+  executeOpcode<Opcode::RISCV_AMOXOR_D_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOXOR_D_AQ>() {
+  executeOpcode<Opcode::RISCV_AMOXOR_D_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOXOR_D_RL>() {
+  executeOpcode<Opcode::RISCV_AMOXOR_D_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOMIN_W_AQ_RL>() {
+  results_[0] = RegisterValue(signExtendW(memoryData_[0].get<int32_t>()), 8);
+  memoryData_[0] = std::min(memoryData_[0].get<int32_t>(),
+                            sourceValues_[0].get<int32_t>());
+}
+
+// AMOMIN.W rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOMIN_W>() {
+  executeOpcode<Opcode::RISCV_AMOMIN_W_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOMIN_W_AQ>() {
+  executeOpcode<Opcode::RISCV_AMOMIN_W_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOMIN_W_RL>() {
+  executeOpcode<Opcode::RISCV_AMOMIN_W_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOMIN_D_AQ_RL>() {
+  int64_t rd = memoryData_[0].get<int64_t>();
+  results_[0] = RegisterValue(rd, 8);
+  memoryData_[0] =
+      static_cast<int64_t>(std::min(rd, sourceValues_[0].get<int64_t>()));
+}
+
+// AMOMIN.D rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOMIN_D>() {
+  executeOpcode<Opcode::RISCV_AMOMIN_D_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOMIN_D_AQ>() {
+  executeOpcode<Opcode::RISCV_AMOMIN_D_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOMIN_D_RL>() {
+  executeOpcode<Opcode::RISCV_AMOMIN_D_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOMINU_W_AQ_RL>() {
+  results_[0] = RegisterValue(signExtendW(memoryData_[0].get<uint32_t>()), 8);
+  memoryData_[0] = std::min(memoryData_[0].get<uint32_t>(),
+                            sourceValues_[0].get<uint32_t>());
+}
+
+// AMOMINU.W rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOMINU_W>() {
+  executeOpcode<Opcode::RISCV_AMOMINU_W_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOMINU_W_AQ>() {
+  executeOpcode<Opcode::RISCV_AMOMINU_W_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOMINU_W_RL>() {
+  executeOpcode<Opcode::RISCV_AMOMINU_W_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOMINU_D_AQ_RL>() {
+  uint64_t rd = memoryData_[0].get<uint64_t>();
+  results_[0] = RegisterValue(rd, 8);
+  memoryData_[0] =
+      static_cast<uint64_t>(std::min(rd, sourceValues_[0].get<uint64_t>()));
+}
+
+// AMOMINU.D rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOMINU_D>() {
+  executeOpcode<Opcode::RISCV_AMOMINU_D_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOMINU_D_AQ>() {
+  executeOpcode<Opcode::RISCV_AMOMINU_D_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOMINU_D_RL>() {
+  executeOpcode<Opcode::RISCV_AMOMINU_D_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOMAX_W_AQ_RL>() {
+  results_[0] = RegisterValue(signExtendW(memoryData_[0].get<int32_t>()), 8);
+  memoryData_[0] = std::max(memoryData_[0].get<int32_t>(),
+                            sourceValues_[0].get<int32_t>());
+}
+
+// AMOMAX.W rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOMAX_W>() {
+  executeOpcode<Opcode::RISCV_AMOMAX_W_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOMAX_W_AQ>() {
+  executeOpcode<Opcode::RISCV_AMOMAX_W_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOMAX_W_RL>() {
+  executeOpcode<Opcode::RISCV_AMOMAX_W_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOMAX_D_AQ_RL>() {
+  int64_t rd = memoryData_[0].get<int64_t>();
+  results_[0] = RegisterValue(rd, 8);
+  memoryData_[0] =
+      static_cast<int64_t>(std::max(rd, sourceValues_[0].get<int64_t>()));
+}
+
+// AMOMAX.D rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOMAX_D>() {
+  executeOpcode<Opcode::RISCV_AMOMAX_D_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOMAX_D_AQ>() {
+  executeOpcode<Opcode::RISCV_AMOMAX_D_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOMAX_D_RL>() {
+  executeOpcode<Opcode::RISCV_AMOMAX_D_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOMAXU_W_AQ_RL>() {
+  results_[0] = RegisterValue(signExtendW(memoryData_[0].get<uint32_t>()), 8);
+  memoryData_[0] = std::max(memoryData_[0].get<uint32_t>(),
+                            sourceValues_[0].get<uint32_t>());
+}
+
+// AMOMAXU.W rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOMAXU_W>() {
+  executeOpcode<Opcode::RISCV_AMOMAXU_W_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOMAXU_W_AQ>() {
+  executeOpcode<Opcode::RISCV_AMOMAXU_W_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOMAXU_W_RL>() {
+  executeOpcode<Opcode::RISCV_AMOMAXU_W_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOMAXU_D_AQ_RL>() {
+  uint64_t rd = memoryData_[0].get<uint64_t>();
+  results_[0] = RegisterValue(rd, 8);
+  memoryData_[0] =
+      static_cast<uint64_t>(std::max(rd, sourceValues_[0].get<uint64_t>()));
+}
+
+// AMOMAXU.D rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOMAXU_D>() {
+  executeOpcode<Opcode::RISCV_AMOMAXU_D_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOMAXU_D_AQ>() {
+  executeOpcode<Opcode::RISCV_AMOMAXU_D_AQ_RL>();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_AMOMAXU_D_RL>() {
+  executeOpcode<Opcode::RISCV_AMOMAXU_D_AQ_RL>();
+}
+
+// Integer multiplication division extension (M)
+
+// MUL rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_MUL>() {
+  const int64_t rs1 = sourceValues_[0].get<int64_t>();
+  const int64_t rs2 = sourceValues_[1].get<int64_t>();
+  results_[0] = RegisterValue(static_cast<int64_t>(rs1 * rs2), 8);
+}
+
+// MULH rd,rs1,rs2
+// template <>
+// void Instruction::executeOpcode<Opcode::RISCV_MULH>() {
+//   return executionNYI();
+//
+//   const int64_t rs1 = operands[0].get<int64_t>();
+//   const int64_t rs2 = operands[1].get<int64_t>();
+//   results[0] = RegisterValue(mulhiss(rs1, rs2);
+// }
+
+// MULHU rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_MULHU>() {
+  const uint64_t rs1 = sourceValues_[0].get<uint64_t>();
+  const uint64_t rs2 = sourceValues_[1].get<uint64_t>();
+  results_[0] = RegisterValue(mulhiuu(rs1, rs2), 8);
+}
+
+// MULHSU rd,rs1,rs2
+// template <>
+// void Instruction::executeOpcode<Opcode::RISCV_MULHSU>() {
+//   return executionNYI();
+//
+//   const int64_t rs1 = operands[0].get<int64_t>();
+//   const uint64_t rs2 = operands[1].get<uint64_t>();
+//   results[0] = RegisterValue(mulhisu(rs1, rs2);
+// }
+
+// MULW rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_MULW>() {
+  const uint32_t rs1 = sourceValues_[0].get<uint32_t>();
+  const uint32_t rs2 = sourceValues_[1].get<uint32_t>();
+  results_[0] = RegisterValue(signExtendW(rs1 * rs2), 8);
+}
+
+// DIV rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_DIV>() {
+  const int64_t rs1 = sourceValues_[0].get<int64_t>();
+  const int64_t rs2 = sourceValues_[1].get<int64_t>();
+  if (rs2 == 0) {
+    // divide by zero
+    results_[0] = RegisterValue(static_cast<uint64_t>(-1), 8);
+  } else if (rs1 == static_cast<int64_t>(0x8000000000000000) && rs2 == -1) {
+    // division overflow
+    results_[0] = RegisterValue(rs1, 8);
+  } else {
+    results_[0] = RegisterValue(static_cast<int64_t>(rs1 / rs2), 8);
+  }
+}
+
+// DIVW rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_DIVW>() {
+  const int32_t rs1 = sourceValues_[0].get<int32_t>();
+  const int32_t rs2 = sourceValues_[1].get<int32_t>();
+  if (rs2 == 0) {
+    // divide by zero
+    results_[0] = RegisterValue(static_cast<uint64_t>(-1), 8);
+  } else if (rs1 == static_cast<int32_t>(0x80000000) && rs2 == -1) {
+    // division overflow
+    results_[0] = RegisterValue(static_cast<int64_t>(signExtendW(rs1)), 8);
+  } else {
+    results_[0] =
+        RegisterValue(static_cast<int64_t>(signExtendW(rs1 / rs2)), 8);
+  }
+}
+
+// DIVU rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_DIVU>() {
+  const uint64_t rs1 = sourceValues_[0].get<uint64_t>();
+  const uint64_t rs2 = sourceValues_[1].get<uint64_t>();
+  if (rs2 == 0) {
+    // divide by zero
+    results_[0] = RegisterValue(static_cast<uint64_t>(-1), 8);
+  } else {
+    results_[0] = RegisterValue(static_cast<uint64_t>(rs1 / rs2), 8);
+  }
+}
+
+// DIVUW rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_DIVUW>() {
+  const uint32_t rs1 = sourceValues_[0].get<uint32_t>();
+  const uint32_t rs2 = sourceValues_[1].get<uint32_t>();
+  if (rs2 == 0) {
+    // divide by zero
+    results_[0] = RegisterValue(static_cast<uint64_t>(-1), 8);
+  } else {
+    results_[0] =
+        RegisterValue(static_cast<uint64_t>(signExtendW(rs1 / rs2)), 8);
+  }
+}
+
+// REM rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_REM>() {
+  const int64_t rs1 = sourceValues_[0].get<int64_t>();
+  const int64_t rs2 = sourceValues_[1].get<int64_t>();
+  if (rs2 == 0) {
+    // divide by zero
+    results_[0] = RegisterValue(static_cast<uint64_t>(rs1), 8);
+  } else if (rs1 == static_cast<int64_t>(0x8000000000000000) && rs2 == -1) {
+    // division overflow
+    results_[0] = RegisterValue(static_cast<int64_t>(0), 8);
+  } else {
+    results_[0] = RegisterValue(static_cast<int64_t>(rs1 % rs2), 8);
+  }
+}
+
+// REMW rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_REMW>() {
+  const int32_t rs1 = sourceValues_[0].get<int32_t>();
+  const int32_t rs2 = sourceValues_[1].get<int32_t>();
+  if (rs2 == 0) {
+    // divide by zero
+    results_[0] = RegisterValue(static_cast<int64_t>(signExtendW(rs1)), 8);
+  } else if (rs1 == static_cast<int32_t>(0x80000000) && rs2 == -1) {
+    // division overflow
+    results_[0] = RegisterValue(static_cast<int64_t>(0), 8);
+  } else {
+    results_[0] =
+        RegisterValue(static_cast<int64_t>(signExtendW(rs1 % rs2)), 8);
+  }
+}
+
+// REMU rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_REMU>() {
+  const uint64_t rs1 = sourceValues_[0].get<uint64_t>();
+  const uint64_t rs2 = sourceValues_[1].get<uint64_t>();
+  if (rs2 == 0) {
+    // divide by zero
+    results_[0] = RegisterValue(rs1, 8);
+  } else {
+    results_[0] = RegisterValue(static_cast<uint64_t>(rs1 % rs2), 8);
+  }
+}
+
+// REMUW rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_REMUW>() {
+  const uint32_t rs1 = sourceValues_[0].get<uint32_t>();
+  const uint32_t rs2 = sourceValues_[1].get<uint32_t>();
+  if (rs2 == 0) {
+    // divide by zero
+    results_[0] = RegisterValue(static_cast<int64_t>(signExtendW(rs1)), 8);
+  } else {
+    results_[0] =
+        RegisterValue(static_cast<uint64_t>(signExtendW(rs1 % rs2)), 8);
+  }
+}
+
+// Control and Status Register extension (Zicsr)
+
+// Currently do not read-modify-write ATOMICALLY
+// Left mostly unimplemented due to Capstone being unable to disassemble
+// CSR addresses. Some partial functionality is implemented for
+// correctness of other extensions
+
+// CSRRW rd,csr,rs1
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_CSRRW>() {
+  // TODO dummy implementation to allow progression and correct setting of
+  // floating point rounding modes. Full functionality to be implemented
+  // with Zicsr implementation
+
+  // Raise exception to force pipeline flush and commit of all older
+  // instructions in program order before execution. Execution
+  // logic in ExceptionHandler.cc
+  exceptionEncountered_ = true;
+  exception_ = InstructionException::PipelineFlush;
+}
+
+// CSRRWI rd,csr,imm
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_CSRRWI>() {
+  executionNYI();
+}
+
+// CSRRS rd,csr,rs1
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_CSRRS>() {
+  // dummy implementation to allow progression
+  // TODO implement fully when Zicsr extension is supported
+  results_[0] = RegisterValue(static_cast<uint64_t>(0), 8);
+}
+
+// CSRRSI rd,csr,imm
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_CSRRSI>() {
+  executionNYI();
+}
+
+// CSRRC rd,csr,rs1
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_CSRRC>() {
+  executionNYI();
+}
+
+// CSRRCI rd,csr,imm
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_CSRRCI>() {
+  executionNYI();
+}
+
+// Single-Precision Floating-Point (F)
+// Double-Precision Floating-Point (D)
+
+// FSD rs1,rs2,imm
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FSD>() {
+  memoryData_[0] = sourceValues_[0];
+}
+
+// FSW rs1,rs2,imm
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FSW>() {
+  memoryData_[0] = sourceValues_[0];
+}
+
+// FLD rd,rs1,imm
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FLD>() {
+  results_[0] = memoryData_[0].get<double>();
+}
+
+// FLW rd,rs1,imm
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FLW>() {
+  const float memSingle = memoryData_[0].get<float>();
+
+  results_[0] = RegisterValue(NanBoxFloat(memSingle), 8);
+}
+
+// FADD.D rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FADD_D>() {
+  setStaticRoundingModeThen([&] {
+    const double rs1 = sourceValues_[0].get<double>();
+    const double rs2 = sourceValues_[1].get<double>();
+
+    results_[0] = RegisterValue(rs1 + rs2, 8);
+  });
+}
+
+// FADD.S rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FADD_S>() {
+
+  setStaticRoundingModeThen([&] {
+    const float rs1 = checkNanBox(sourceValues_[0]);
+    const float rs2 = checkNanBox(sourceValues_[1]);
+
+    results_[0] = RegisterValue(NanBoxFloat(rs1 + rs2), 8);
+  });
+}
+
+// FSUB.D rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FSUB_D>() {
+
+  setStaticRoundingModeThen([&] {
+    const double rs1 = sourceValues_[0].get<double>();
+    const double rs2 = sourceValues_[1].get<double>();
+
+    results_[0] = RegisterValue(rs1 - rs2, 8);
+  });
+}
+
+// FSUB.S rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FSUB_S>() {
+
+  setStaticRoundingModeThen([&] {
+    const float rs1 = checkNanBox(sourceValues_[0]);
+    const float rs2 = checkNanBox(sourceValues_[1]);
+
+    results_[0] = RegisterValue(NanBoxFloat(rs1 - rs2), 8);
+  });
+}
+
+// FDIV.D rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FDIV_D>() {
+
+  setStaticRoundingModeThen([&] {
+    const double rs1 = sourceValues_[0].get<double>();
+    const double rs2 = sourceValues_[1].get<double>();
 
-      // Control and Status Register extension (Zicsr)
+    results_[0] = RegisterValue(rs1 / rs2, 8);
+  });
+}
 
-      // Currently do not read-modify-write ATOMICALLY
-      // Left mostly unimplemented due to Capstone being unable to disassemble
-      // CSR addresses. Some partial functionality is implemented for
-      // correctness of other extensions
-    case Opcode::RISCV_CSRRW: {  // CSRRW rd,csr,rs1
-      // TODO dummy implementation to allow progression and correct setting of
-      // floating point rounding modes. Full functionality to be implemented
-      // with Zicsr implementation
+// FDIV.S rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FDIV_S>() {
 
-      // Raise exception to force pipeline flush and commit of all older
-      // instructions in program order before execution. Execution
-      // logic in ExceptionHandler.cc
-      exceptionEncountered_ = true;
-      exception_ = InstructionException::PipelineFlush;
+  setStaticRoundingModeThen([&] {
+    const float rs1 = checkNanBox(sourceValues_[0]);
+    const float rs2 = checkNanBox(sourceValues_[1]);
 
-      break;
-    }
-    case Opcode::RISCV_CSRRWI: {  // CSRRWI rd,csr,imm
-      executionNYI();
-      break;
-    }
-    case Opcode::RISCV_CSRRS: {  // CSRRS rd,csr,rs1
-      // dummy implementation to allow progression
-      // TODO implement fully when Zicsr extension is supported
-      results_[0] = RegisterValue(static_cast<uint64_t>(0), 8);
-      break;
-    }
-    case Opcode::RISCV_CSRRSI: {  // CSRRSI rd,csr,imm
-      executionNYI();
-      break;
-    }
-    case Opcode::RISCV_CSRRC: {  // CSRRC rd,csr,rs1
-      executionNYI();
-      break;
-    }
-    case Opcode::RISCV_CSRRCI: {  // CSRRCI rd,csr,imm
-      executionNYI();
-      break;
-    }
+    results_[0] = RegisterValue(NanBoxFloat(rs1 / rs2), 8);
+  });
+}
 
-      // Single-Precision Floating-Point (F)
-      // Double-Precision Floating-Point (D)
-    case Opcode::RISCV_FSD: {  // FSD rs1,rs2,imm
-      memoryData_[0] = sourceValues_[0];
-      break;
-    }
-    case Opcode::RISCV_FSW: {  // FSW rs1,rs2,imm
-      memoryData_[0] = sourceValues_[0];
-      break;
-    }
-    case Opcode::RISCV_FLD: {  // FLD rd,rs1,imm
-      results_[0] = memoryData_[0].get<double>();
-      break;
-    }
-    case Opcode::RISCV_FLW: {  // FLW rd,rs1,imm
-      const float memSingle = memoryData_[0].get<float>();
+// FMUL.D rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FMUL_D>() {
 
-      results_[0] = RegisterValue(NanBoxFloat(memSingle), 8);
-      break;
-    }
+  setStaticRoundingModeThen([&] {
+    const double rs1 = sourceValues_[0].get<double>();
+    const double rs2 = sourceValues_[1].get<double>();
 
-    case Opcode::RISCV_FADD_D: {  // FADD.D rd,rs1,rs2
-      setStaticRoundingModeThen([&] {
-        const double rs1 = sourceValues_[0].get<double>();
-        const double rs2 = sourceValues_[1].get<double>();
+    results_[0] = RegisterValue(rs1 * rs2, 8);
+  });
+}
 
-        results_[0] = RegisterValue(rs1 + rs2, 8);
-      });
-      break;
-    }
-    case Opcode::RISCV_FADD_S: {  // FADD.S rd,rs1,rs2
+// FMUL.S rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FMUL_S>() {
 
-      setStaticRoundingModeThen([&] {
-        const float rs1 = checkNanBox(sourceValues_[0]);
-        const float rs2 = checkNanBox(sourceValues_[1]);
+  setStaticRoundingModeThen([&] {
+    const float rs1 = checkNanBox(sourceValues_[0]);
+    const float rs2 = checkNanBox(sourceValues_[1]);
 
-        results_[0] = RegisterValue(NanBoxFloat(rs1 + rs2), 8);
-      });
-      break;
-    }
-    case Opcode::RISCV_FSUB_D: {  // FSUB.D rd,rs1,rs2
+    results_[0] = RegisterValue(NanBoxFloat(rs1 * rs2), 8);
+  });
+}
 
-      setStaticRoundingModeThen([&] {
-        const double rs1 = sourceValues_[0].get<double>();
-        const double rs2 = sourceValues_[1].get<double>();
+// FSQRT.D rd,rs1
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FSQRT_D>() {
 
-        results_[0] = RegisterValue(rs1 - rs2, 8);
-      });
+  setStaticRoundingModeThen([&] {
+    const double rs1 = sourceValues_[0].get<double>();
 
-      break;
-    }
-    case Opcode::RISCV_FSUB_S: {  // FSUB.S rd,rs1,rs2
+    const double sqrtAns = sqrt(rs1);
 
-      setStaticRoundingModeThen([&] {
-        const float rs1 = checkNanBox(sourceValues_[0]);
-        const float rs2 = checkNanBox(sourceValues_[1]);
+    // With -ve rs1, sqrt = -NaN, but qemu returns canonical (+)NaN. Adjust
+    // for this here
+    const double res = std::isnan(sqrtAns) ? nanf("0") : sqrtAns;
 
-        results_[0] = RegisterValue(NanBoxFloat(rs1 - rs2), 8);
-      });
+    results_[0] = RegisterValue(res, 8);
+  });
+}
 
-      break;
-    }
-    case Opcode::RISCV_FDIV_D: {  // FDIV.D rd,rs1,rs2
+// FSQRT.S rd,rs1
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FSQRT_S>() {
 
-      setStaticRoundingModeThen([&] {
-        const double rs1 = sourceValues_[0].get<double>();
-        const double rs2 = sourceValues_[1].get<double>();
+  setStaticRoundingModeThen([&] {
+    const float rs1 = checkNanBox(sourceValues_[0]);
 
-        results_[0] = RegisterValue(rs1 / rs2, 8);
-      });
+    const float sqrtAns = sqrtf(rs1);
 
-      break;
-    }
-    case Opcode::RISCV_FDIV_S: {  // FDIV.S rd,rs1,rs2
+    // With -ve rs1, sqrt = -NaN, but qemu returns canonical (+)NaN. Adjust
+    // for this here
+    const float res = std::isnan(sqrtAns) ? nanf("0") : sqrtAns;
 
-      setStaticRoundingModeThen([&] {
-        const float rs1 = checkNanBox(sourceValues_[0]);
-        const float rs2 = checkNanBox(sourceValues_[1]);
+    results_[0] = RegisterValue(NanBoxFloat(res), 8);
+  });
+}
 
-        results_[0] = RegisterValue(NanBoxFloat(rs1 / rs2), 8);
-      });
+// FMIN.D rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FMIN_D>() {
+  const double rs1 = sourceValues_[0].get<double>();
+  const double rs2 = sourceValues_[1].get<double>();
+
+  // cpp fmin reference: This function is not required to be sensitive to
+  // the sign of zero, although some implementations additionally enforce
+  // that if one argument is +0 and the other is -0, then +0 is returned.
+  // But RISC-V spec requires -0.0 to be considered < +0.0
+  if (rs1 == 0 && rs2 == 0) {
+    results_[0] = RegisterValue(0x8000000000000000, 8);
+  } else {
+    results_[0] = RegisterValue(fmin(rs1, rs2), 8);
+  }
+}
 
-      break;
-    }
-    case Opcode::RISCV_FMUL_D: {  // FMUL.D rd,rs1,rs2
+// FMIN.S rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FMIN_S>() {
+  const float rs1 = checkNanBox(sourceValues_[0]);
+  const float rs2 = checkNanBox(sourceValues_[1]);
 
-      setStaticRoundingModeThen([&] {
-        const double rs1 = sourceValues_[0].get<double>();
-        const double rs2 = sourceValues_[1].get<double>();
+  // Comments regarding fminf similar to RISCV_FMIN_D
+  if (rs1 == 0 && rs2 == 0) {
+    results_[0] = RegisterValue(0xffffffff80000000, 8);
+  } else {
+    results_[0] = RegisterValue(NanBoxFloat(fminf(rs1, rs2)), 8);
+  }
+}
 
-        results_[0] = RegisterValue(rs1 * rs2, 8);
-      });
+// FMAX.D rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FMAX_D>() {
 
-      break;
-    }
-    case Opcode::RISCV_FMUL_S: {  // FMUL.S rd,rs1,rs2
+  const double rs1 = sourceValues_[0].get<double>();
+  const double rs2 = sourceValues_[1].get<double>();
 
-      setStaticRoundingModeThen([&] {
-        const float rs1 = checkNanBox(sourceValues_[0]);
-        const float rs2 = checkNanBox(sourceValues_[1]);
+  // cpp fmax reference: This function is not required to be sensitive to
+  // the sign of zero, although some implementations additionally enforce
+  // that if one argument is +0 and the other is -0, then +0 is returned.
+  // But RISC-V spec requires this to be the case
+  if (rs1 == 0 && rs2 == 0) {
+    results_[0] = RegisterValue(0x0000000000000000, 8);
+  } else {
+    results_[0] = RegisterValue(fmax(rs1, rs2), 8);
+  }
+}
 
-        results_[0] = RegisterValue(NanBoxFloat(rs1 * rs2), 8);
-      });
+// FMAX.S rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FMAX_S>() {
+  const float rs1 = checkNanBox(sourceValues_[0]);
+  const float rs2 = checkNanBox(sourceValues_[1]);
 
-      break;
-    }
-    case Opcode::RISCV_FSQRT_D: {  // FSQRT.D rd,rs1
+  // Comments regarding fmaxf similar to RISCV_FMAX_D
+  if (rs1 == 0 && rs2 == 0) {
+    results_[0] = RegisterValue(0xffffffff00000000, 8);
+  } else {
+    results_[0] = RegisterValue(NanBoxFloat(fmaxf(rs1, rs2)), 8);
+  }
+}
 
-      setStaticRoundingModeThen([&] {
-        const double rs1 = sourceValues_[0].get<double>();
+// TODO "The fused multiply-add instructions must set the invalid
+// operation exception flag when the multiplicands are ∞ and zero, even
+// when the addend is a quiet NaN." pg69, require Zicsr extension
 
-        const double sqrtAns = sqrt(rs1);
+// FMADD.D rd,rs1,rs2,rs3
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FMADD_D>() {
+  // The fused multiply-add instructions must set the invalid operation
+  // exception flag when the multiplicands are infinity and zero, even when
+  // the addend is a quiet NaN.
 
-        // With -ve rs1, sqrt = -NaN, but qemu returns canonical (+)NaN. Adjust
-        // for this here
-        const double res = std::isnan(sqrtAns) ? nanf("0") : sqrtAns;
+  setStaticRoundingModeThen([&] {
+    const double rs1 = sourceValues_[0].get<double>();
+    const double rs2 = sourceValues_[1].get<double>();
+    const double rs3 = sourceValues_[2].get<double>();
 
-        results_[0] = RegisterValue(res, 8);
-      });
+    results_[0] = RegisterValue(fma(rs1, rs2, rs3), 8);
+  });
+}
 
-      break;
-    }
-    case Opcode::RISCV_FSQRT_S: {  // FSQRT.S rd,rs1
+// FMADD.S rd,rs1,rs2,rs3
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FMADD_S>() {
 
-      setStaticRoundingModeThen([&] {
-        const float rs1 = checkNanBox(sourceValues_[0]);
+  setStaticRoundingModeThen([&] {
+    const float rs1 = checkNanBox(sourceValues_[0]);
+    const float rs2 = checkNanBox(sourceValues_[1]);
+    const float rs3 = checkNanBox(sourceValues_[2]);
 
-        const float sqrtAns = sqrtf(rs1);
+    if (std::isnan(rs1) || std::isnan(rs2) || std::isnan(rs3)) {
+      results_[0] = RegisterValue(NanBoxFloat(std::nanf("")), 8);
+    } else {
+      results_[0] = RegisterValue(NanBoxFloat(fmaf(rs1, rs2, rs3)), 8);
+    }
+  });
+}
 
-        // With -ve rs1, sqrt = -NaN, but qemu returns canonical (+)NaN. Adjust
-        // for this here
-        const float res = std::isnan(sqrtAns) ? nanf("0") : sqrtAns;
+// FNMSUB.D rd,rs1,rs2,rs3
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FNMSUB_D>() {
 
-        results_[0] = RegisterValue(NanBoxFloat(res), 8);
-      });
+  setStaticRoundingModeThen([&] {
+    const double rs1 = sourceValues_[0].get<double>();
+    const double rs2 = sourceValues_[1].get<double>();
+    const double rs3 = sourceValues_[2].get<double>();
 
-      break;
-    }
+    results_[0] = RegisterValue(-(rs1 * rs2) + rs3, 8);
+  });
+}
 
-    case Opcode::RISCV_FMIN_D: {  // FMIN.D rd,rs1,rs2
-      const double rs1 = sourceValues_[0].get<double>();
-      const double rs2 = sourceValues_[1].get<double>();
+// FNMSUB.S rd,rs1,rs2,rs3
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FNMSUB_S>() {
 
-      // cpp fmin reference: This function is not required to be sensitive to
-      // the sign of zero, although some implementations additionally enforce
-      // that if one argument is +0 and the other is -0, then +0 is returned.
-      // But RISC-V spec requires -0.0 to be considered < +0.0
-      if (rs1 == 0 && rs2 == 0) {
-        results_[0] = RegisterValue(0x8000000000000000, 8);
-      } else {
-        results_[0] = RegisterValue(fmin(rs1, rs2), 8);
-      }
+  setStaticRoundingModeThen([&] {
+    const float rs1 = checkNanBox(sourceValues_[0]);
+    const float rs2 = checkNanBox(sourceValues_[1]);
+    const float rs3 = checkNanBox(sourceValues_[2]);
 
-      break;
+    if (std::isnan(rs1) || std::isnan(rs2) || std::isnan(rs3)) {
+      results_[0] = RegisterValue(NanBoxFloat(std::nanf("")), 8);
+    } else {
+      results_[0] = RegisterValue(NanBoxFloat(-(rs1 * rs2) + rs3), 8);
     }
-    case Opcode::RISCV_FMIN_S: {  // FMIN.S rd,rs1,rs2
-      const float rs1 = checkNanBox(sourceValues_[0]);
-      const float rs2 = checkNanBox(sourceValues_[1]);
+  });
+}
 
-      // Comments regarding fminf similar to RISCV_FMIN_D
-      if (rs1 == 0 && rs2 == 0) {
-        results_[0] = RegisterValue(0xffffffff80000000, 8);
-      } else {
-        results_[0] = RegisterValue(NanBoxFloat(fminf(rs1, rs2)), 8);
-      }
+// FMSUB.D rd,rs1,rs2,rs3
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FMSUB_D>() {
 
-      break;
-    }
-    case Opcode::RISCV_FMAX_D: {  // FMAX.D rd,rs1,rs2
+  setStaticRoundingModeThen([&] {
+    const double rs1 = sourceValues_[0].get<double>();
+    const double rs2 = sourceValues_[1].get<double>();
+    const double rs3 = sourceValues_[2].get<double>();
 
-      const double rs1 = sourceValues_[0].get<double>();
-      const double rs2 = sourceValues_[1].get<double>();
+    results_[0] = RegisterValue((rs1 * rs2) - rs3, 8);
+  });
+}
 
-      // cpp fmax reference: This function is not required to be sensitive to
-      // the sign of zero, although some implementations additionally enforce
-      // that if one argument is +0 and the other is -0, then +0 is returned.
-      // But RISC-V spec requires this to be the case
-      if (rs1 == 0 && rs2 == 0) {
-        results_[0] = RegisterValue(0x0000000000000000, 8);
-      } else {
-        results_[0] = RegisterValue(fmax(rs1, rs2), 8);
-      }
-      break;
-    }
-    case Opcode::RISCV_FMAX_S: {  // FMAX.S rd,rs1,rs2
-      const float rs1 = checkNanBox(sourceValues_[0]);
-      const float rs2 = checkNanBox(sourceValues_[1]);
+// FMSUB.S rd,rs1,rs2,rs3
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FMSUB_S>() {
 
-      // Comments regarding fmaxf similar to RISCV_FMAX_D
-      if (rs1 == 0 && rs2 == 0) {
-        results_[0] = RegisterValue(0xffffffff00000000, 8);
-      } else {
-        results_[0] = RegisterValue(NanBoxFloat(fmaxf(rs1, rs2)), 8);
-      }
-      break;
-    }
+  setStaticRoundingModeThen([&] {
+    const float rs1 = checkNanBox(sourceValues_[0]);
+    const float rs2 = checkNanBox(sourceValues_[1]);
+    const float rs3 = checkNanBox(sourceValues_[2]);
 
-      // TODO "The fused multiply-add instructions must set the invalid
-      // operation exception flag when the multiplicands are ∞ and zero, even
-      // when the addend is a quiet NaN." pg69, require Zicsr extension
-    case Opcode::RISCV_FMADD_D: {  // FMADD.D rd,rs1,rs2,rs3
-      // The fused multiply-add instructions must set the invalid operation
-      // exception flag when the multiplicands are infinity and zero, even when
-      // the addend is a quiet NaN.
+    if (std::isnan(rs1) || std::isnan(rs2) || std::isnan(rs3)) {
+      results_[0] = RegisterValue(NanBoxFloat(std::nanf("")), 8);
+    } else {
+      results_[0] = RegisterValue(NanBoxFloat((rs1 * rs2) - rs3), 8);
+    }
+  });
+}
 
-      setStaticRoundingModeThen([&] {
-        const double rs1 = sourceValues_[0].get<double>();
-        const double rs2 = sourceValues_[1].get<double>();
-        const double rs3 = sourceValues_[2].get<double>();
+// FNMADD.D rd,rs1,rs2,rs3
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FNMADD_D>() {
 
-        results_[0] = RegisterValue(fma(rs1, rs2, rs3), 8);
-      });
+  setStaticRoundingModeThen([&] {
+    const double rs1 = sourceValues_[0].get<double>();
+    const double rs2 = sourceValues_[1].get<double>();
+    const double rs3 = sourceValues_[2].get<double>();
 
-      break;
-    }
-    case Opcode::RISCV_FMADD_S: {  // FMADD.S rd,rs1,rs2,rs3
+    results_[0] = RegisterValue(-(rs1 * rs2) - rs3, 8);
+  });
+}
 
-      setStaticRoundingModeThen([&] {
-        const float rs1 = checkNanBox(sourceValues_[0]);
-        const float rs2 = checkNanBox(sourceValues_[1]);
-        const float rs3 = checkNanBox(sourceValues_[2]);
+// FNMADD.S rd,rs1,rs2,rs3
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FNMADD_S>() {
 
-        if (std::isnan(rs1) || std::isnan(rs2) || std::isnan(rs3)) {
-          results_[0] = RegisterValue(NanBoxFloat(std::nanf("")), 8);
-        } else {
-          results_[0] = RegisterValue(NanBoxFloat(fmaf(rs1, rs2, rs3)), 8);
-        }
-      });
+  setStaticRoundingModeThen([&] {
+    const float rs1 = checkNanBox(sourceValues_[0]);
+    const float rs2 = checkNanBox(sourceValues_[1]);
+    const float rs3 = checkNanBox(sourceValues_[2]);
 
-      break;
+    // Some implementations return -NaN if certain inputs are NaN but spec
+    // requires +NaN. Ensure this happens
+    if (std::isnan(rs1) || std::isnan(rs2) || std::isnan(rs3)) {
+      results_[0] = RegisterValue(NanBoxFloat(std::nanf("")), 8);
+    } else {
+      results_[0] = RegisterValue(NanBoxFloat(-(rs1 * rs2) - rs3), 8);
     }
-    case Opcode::RISCV_FNMSUB_D: {  // FNMSUB.D rd,rs1,rs2,rs3
+  });
+}
 
-      setStaticRoundingModeThen([&] {
-        const double rs1 = sourceValues_[0].get<double>();
-        const double rs2 = sourceValues_[1].get<double>();
-        const double rs3 = sourceValues_[2].get<double>();
+// FCVT.D.L rd,rs1
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FCVT_D_L>() {
 
-        results_[0] = RegisterValue(-(rs1 * rs2) + rs3, 8);
-      });
+  setStaticRoundingModeThen([&] {
+    const int64_t rs1 = sourceValues_[0].get<int64_t>();
 
-      break;
-    }
-    case Opcode::RISCV_FNMSUB_S: {  // FNMSUB.S rd,rs1,rs2,rs3
+    results_[0] = RegisterValue((double)rs1, 8);
+  });
+}
 
-      setStaticRoundingModeThen([&] {
-        const float rs1 = checkNanBox(sourceValues_[0]);
-        const float rs2 = checkNanBox(sourceValues_[1]);
-        const float rs3 = checkNanBox(sourceValues_[2]);
+// FCVT.D.W rd,rs1
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FCVT_D_W>() {
 
-        if (std::isnan(rs1) || std::isnan(rs2) || std::isnan(rs3)) {
-          results_[0] = RegisterValue(NanBoxFloat(std::nanf("")), 8);
-        } else {
-          results_[0] = RegisterValue(NanBoxFloat(-(rs1 * rs2) + rs3), 8);
-        }
-      });
+  setStaticRoundingModeThen([&] {
+    const int32_t rs1 = sourceValues_[0].get<int32_t>();
 
-      break;
-    }
-    case Opcode::RISCV_FMSUB_D: {  // FMSUB.D rd,rs1,rs2,rs3
+    results_[0] = RegisterValue((double)rs1, 8);
+  });
+}
 
-      setStaticRoundingModeThen([&] {
-        const double rs1 = sourceValues_[0].get<double>();
-        const double rs2 = sourceValues_[1].get<double>();
-        const double rs3 = sourceValues_[2].get<double>();
+// FCVT.S.L rd,rs1
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FCVT_S_L>() {
 
-        results_[0] = RegisterValue((rs1 * rs2) - rs3, 8);
-      });
+  setStaticRoundingModeThen([&] {
+    const int64_t rs1 = sourceValues_[0].get<int64_t>();
 
-      break;
-    }
-    case Opcode::RISCV_FMSUB_S: {  // FMSUB.S rd,rs1,rs2,rs3
+    results_[0] = RegisterValue(NanBoxFloat((float)rs1), 8);
+  });
+}
 
-      setStaticRoundingModeThen([&] {
-        const float rs1 = checkNanBox(sourceValues_[0]);
-        const float rs2 = checkNanBox(sourceValues_[1]);
-        const float rs3 = checkNanBox(sourceValues_[2]);
+// FCVT.S.W rd,rs1
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FCVT_S_W>() {
 
-        if (std::isnan(rs1) || std::isnan(rs2) || std::isnan(rs3)) {
-          results_[0] = RegisterValue(NanBoxFloat(std::nanf("")), 8);
-        } else {
-          results_[0] = RegisterValue(NanBoxFloat((rs1 * rs2) - rs3), 8);
-        }
-      });
+  setStaticRoundingModeThen([&] {
+    const int32_t rs1 = sourceValues_[0].get<int32_t>();
 
-      break;
-    }
-    case Opcode::RISCV_FNMADD_D: {  // FNMADD.D rd,rs1,rs2,rs3
+    results_[0] = RegisterValue(NanBoxFloat((float)rs1), 8);
+  });
+}
 
-      setStaticRoundingModeThen([&] {
-        const double rs1 = sourceValues_[0].get<double>();
-        const double rs2 = sourceValues_[1].get<double>();
-        const double rs3 = sourceValues_[2].get<double>();
+// FCVT.W.D rd,rs1
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FCVT_W_D>() {
 
-        results_[0] = RegisterValue(-(rs1 * rs2) - rs3, 8);
-      });
+  setStaticRoundingModeThen([&] {
+    const double rs1 = sourceValues_[0].get<double>();
 
-      break;
+    if (std::isnan(rs1)) {
+      results_[0] = RegisterValue(0x7FFFFFFF, 8);
+    } else {
+      results_[0] = RegisterValue(signExtendW((int32_t)rint(rs1)), 8);
     }
-    case Opcode::RISCV_FNMADD_S: {  // FNMADD.S rd,rs1,rs2,rs3
-
-      setStaticRoundingModeThen([&] {
-        const float rs1 = checkNanBox(sourceValues_[0]);
-        const float rs2 = checkNanBox(sourceValues_[1]);
-        const float rs3 = checkNanBox(sourceValues_[2]);
-
-        // Some implementations return -NaN if certain inputs are NaN but spec
-        // requires +NaN. Ensure this happens
-        if (std::isnan(rs1) || std::isnan(rs2) || std::isnan(rs3)) {
-          results_[0] = RegisterValue(NanBoxFloat(std::nanf("")), 8);
-        } else {
-          results_[0] = RegisterValue(NanBoxFloat(-(rs1 * rs2) - rs3), 8);
-        }
-      });
+  });
+}
 
-      break;
+// FCVT.W.S rd,rs1
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FCVT_W_S>() {
+
+  setStaticRoundingModeThen([&] {
+    const float rs1 = checkNanBox(sourceValues_[0]);
+
+    if (std::isnan(rs1)) {
+      results_[0] = RegisterValue(0x7FFFFFFF, 8);
+    } else {
+      results_[0] = RegisterValue(signExtendW((int32_t)rintf(rs1)), 8);
     }
-    case Opcode::RISCV_FCVT_D_L: {  // FCVT.D.L rd,rs1
+  });
+}
 
-      setStaticRoundingModeThen([&] {
-        const int64_t rs1 = sourceValues_[0].get<int64_t>();
+// FCVT.L.D rd,rs1
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FCVT_L_D>() {
 
-        results_[0] = RegisterValue((double)rs1, 8);
-      });
+  setStaticRoundingModeThen([&] {
+    const double rs1 = sourceValues_[0].get<double>();
 
-      break;
+    if (std::isnan(rs1)) {
+      results_[0] = RegisterValue(0x7FFFFFFFFFFFFFFF, 8);
+    } else {
+      results_[0] = RegisterValue((int64_t)rint(rs1), 8);
     }
-    case Opcode::RISCV_FCVT_D_W: {  // FCVT.D.W rd,rs1
+  });
+}
 
-      setStaticRoundingModeThen([&] {
-        const int32_t rs1 = sourceValues_[0].get<int32_t>();
+// FCVT.L.S rd,rs1
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FCVT_L_S>() {
 
-        results_[0] = RegisterValue((double)rs1, 8);
-      });
+  setStaticRoundingModeThen([&] {
+    const float rs1 = checkNanBox(sourceValues_[0]);
 
-      break;
+    if (std::isnan(rs1)) {
+      results_[0] = RegisterValue(0x7FFFFFFFFFFFFFFF, 8);
+    } else {
+      results_[0] = RegisterValue((int64_t)rintf(rs1), 8);
     }
-    case Opcode::RISCV_FCVT_S_L: {  // FCVT.S.L rd,rs1
+  });
+}
 
-      setStaticRoundingModeThen([&] {
-        const int64_t rs1 = sourceValues_[0].get<int64_t>();
+// FCVT.WU.D rd,rs1
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FCVT_WU_D>() {
 
-        results_[0] = RegisterValue(NanBoxFloat((float)rs1), 8);
-      });
+  setStaticRoundingModeThen([&] {
+    const double rs1 = sourceValues_[0].get<double>();
 
-      break;
+    if (std::isnan(rs1) || rs1 >= pow(2, 32) - 1) {
+      results_[0] = RegisterValue(0xFFFFFFFFFFFFFFFF, 8);
+    } else {
+      if (rs1 < 0) {
+        // TODO: set csr flag when Zicsr implementation is complete
+        results_[0] = RegisterValue((uint64_t)0, 8);
+      } else {
+        results_[0] = RegisterValue(signExtendW((uint32_t)rint(rs1)), 8);
+      }
     }
-    case Opcode::RISCV_FCVT_S_W: {  // FCVT.S.W rd,rs1
+  });
+}
 
-      setStaticRoundingModeThen([&] {
-        const int32_t rs1 = sourceValues_[0].get<int32_t>();
+// FCVT.WU.S rd,rs1
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FCVT_WU_S>() {
 
-        results_[0] = RegisterValue(NanBoxFloat((float)rs1), 8);
-      });
+  setStaticRoundingModeThen([&] {
+    const float rs1 = checkNanBox(sourceValues_[0]);
 
-      break;
+    if (std::isnan(rs1) || rs1 >= pow(2, 32) - 1) {
+      results_[0] = RegisterValue(0xFFFFFFFFFFFFFFFF, 8);
+    } else {
+      if (rs1 < 0) {
+        // TODO: set csr flag when Zicsr implementation is complete
+        results_[0] = RegisterValue((uint64_t)0, 8);
+      } else {
+        results_[0] = RegisterValue(signExtendW((uint32_t)rintf(rs1)), 8);
+      }
     }
-    case Opcode::RISCV_FCVT_W_D: {  // FCVT.W.D rd,rs1
+  });
+}
 
-      setStaticRoundingModeThen([&] {
-        const double rs1 = sourceValues_[0].get<double>();
+// FCVT.LU.D rd,rs1
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FCVT_LU_D>() {
 
-        if (std::isnan(rs1)) {
-          results_[0] = RegisterValue(0x7FFFFFFF, 8);
-        } else {
-          results_[0] = RegisterValue(signExtendW((int32_t)rint(rs1)), 8);
-        }
-      });
+  setStaticRoundingModeThen([&] {
+    const double rs1 = sourceValues_[0].get<double>();
 
-      break;
+    if (std::isnan(rs1) || rs1 >= pow(2, 64) - 1) {
+      results_[0] = RegisterValue(0xFFFFFFFFFFFFFFFF, 8);
+    } else {
+      if (rs1 < 0) {
+        // TODO: set csr flag when Zicsr implementation is complete
+        results_[0] = RegisterValue((uint64_t)0, 8);
+      } else {
+        results_[0] = RegisterValue((uint64_t)rint(rs1), 8);
+      }
     }
-    case Opcode::RISCV_FCVT_W_S: {  // FCVT.W.S rd,rs1
+  });
+}
 
-      setStaticRoundingModeThen([&] {
-        const float rs1 = checkNanBox(sourceValues_[0]);
+// FCVT.LU.S rd,rs1
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FCVT_LU_S>() {
 
-        if (std::isnan(rs1)) {
-          results_[0] = RegisterValue(0x7FFFFFFF, 8);
-        } else {
-          results_[0] = RegisterValue(signExtendW((int32_t)rintf(rs1)), 8);
-        }
-      });
+  setStaticRoundingModeThen([&] {
+    const float rs1 = checkNanBox(sourceValues_[0]);
 
-      break;
+    if (std::isnan(rs1) || rs1 >= pow(2, 64) - 1) {
+      results_[0] = RegisterValue(0xFFFFFFFFFFFFFFFF, 8);
+    } else {
+      if (rs1 < 0) {
+        // TODO: set csr flag when Zicsr implementation is complete
+        results_[0] = RegisterValue((uint64_t)0, 8);
+      } else {
+        results_[0] = RegisterValue((uint64_t)rintf(rs1), 8);
+      }
     }
-    case Opcode::RISCV_FCVT_L_D: {  // FCVT.L.D rd,rs1
+  });
+}
 
-      setStaticRoundingModeThen([&] {
-        const double rs1 = sourceValues_[0].get<double>();
+// FCVT.D.LU rd,rs1
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FCVT_D_LU>() {
 
-        if (std::isnan(rs1)) {
-          results_[0] = RegisterValue(0x7FFFFFFFFFFFFFFF, 8);
-        } else {
-          results_[0] = RegisterValue((int64_t)rint(rs1), 8);
-        }
-      });
+  setStaticRoundingModeThen([&] {
+    const uint64_t rs1 = sourceValues_[0].get<uint64_t>();
 
-      break;
-    }
-    case Opcode::RISCV_FCVT_L_S: {  // FCVT.L.S rd,rs1
+    results_[0] = RegisterValue((double)rs1, 8);
+  });
+}
 
-      setStaticRoundingModeThen([&] {
-        const float rs1 = checkNanBox(sourceValues_[0]);
+// FCVT.D.WU rd,rs1
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FCVT_D_WU>() {
 
-        if (std::isnan(rs1)) {
-          results_[0] = RegisterValue(0x7FFFFFFFFFFFFFFF, 8);
-        } else {
-          results_[0] = RegisterValue((int64_t)rintf(rs1), 8);
-        }
-      });
+  setStaticRoundingModeThen([&] {
+    const uint32_t rs1 = sourceValues_[0].get<uint32_t>();
 
-      break;
-    }
-    case Opcode::RISCV_FCVT_WU_D: {  // FCVT.WU.D rd,rs1
-
-      setStaticRoundingModeThen([&] {
-        const double rs1 = sourceValues_[0].get<double>();
-
-        if (std::isnan(rs1) || rs1 >= pow(2, 32) - 1) {
-          results_[0] = RegisterValue(0xFFFFFFFFFFFFFFFF, 8);
-        } else {
-          if (rs1 < 0) {
-            // TODO: set csr flag when Zicsr implementation is complete
-            results_[0] = RegisterValue((uint64_t)0, 8);
-          } else {
-            results_[0] = RegisterValue(signExtendW((uint32_t)rint(rs1)), 8);
-          }
-        }
-      });
+    results_[0] = RegisterValue((double)rs1, 8);
+  });
+}
 
-      break;
-    }
-    case Opcode::RISCV_FCVT_WU_S: {  // FCVT.WU.S rd,rs1
-
-      setStaticRoundingModeThen([&] {
-        const float rs1 = checkNanBox(sourceValues_[0]);
-
-        if (std::isnan(rs1) || rs1 >= pow(2, 32) - 1) {
-          results_[0] = RegisterValue(0xFFFFFFFFFFFFFFFF, 8);
-        } else {
-          if (rs1 < 0) {
-            // TODO: set csr flag when Zicsr implementation is complete
-            results_[0] = RegisterValue((uint64_t)0, 8);
-          } else {
-            results_[0] = RegisterValue(signExtendW((uint32_t)rintf(rs1)), 8);
-          }
-        }
-      });
+// FCVT.S.LU rd,rs1
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FCVT_S_LU>() {
 
-      break;
-    }
-    case Opcode::RISCV_FCVT_LU_D: {  // FCVT.LU.D rd,rs1
-
-      setStaticRoundingModeThen([&] {
-        const double rs1 = sourceValues_[0].get<double>();
-
-        if (std::isnan(rs1) || rs1 >= pow(2, 64) - 1) {
-          results_[0] = RegisterValue(0xFFFFFFFFFFFFFFFF, 8);
-        } else {
-          if (rs1 < 0) {
-            // TODO: set csr flag when Zicsr implementation is complete
-            results_[0] = RegisterValue((uint64_t)0, 8);
-          } else {
-            results_[0] = RegisterValue((uint64_t)rint(rs1), 8);
-          }
-        }
-      });
+  setStaticRoundingModeThen([&] {
+    const uint64_t rs1 = sourceValues_[0].get<uint64_t>();
 
-      break;
-    }
-    case Opcode::RISCV_FCVT_LU_S: {  // FCVT.LU.S rd,rs1
-
-      setStaticRoundingModeThen([&] {
-        const float rs1 = checkNanBox(sourceValues_[0]);
-
-        if (std::isnan(rs1) || rs1 >= pow(2, 64) - 1) {
-          results_[0] = RegisterValue(0xFFFFFFFFFFFFFFFF, 8);
-        } else {
-          if (rs1 < 0) {
-            // TODO: set csr flag when Zicsr implementation is complete
-            results_[0] = RegisterValue((uint64_t)0, 8);
-          } else {
-            results_[0] = RegisterValue((uint64_t)rintf(rs1), 8);
-          }
-        }
-      });
+    results_[0] = RegisterValue(NanBoxFloat((float)rs1), 8);
+  });
+}
 
-      break;
-    }
-    case Opcode::RISCV_FCVT_D_LU: {  // FCVT.D.LU rd,rs1
+// FCVT.S.WU rd,rs1
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FCVT_S_WU>() {
 
-      setStaticRoundingModeThen([&] {
-        const uint64_t rs1 = sourceValues_[0].get<uint64_t>();
+  setStaticRoundingModeThen([&] {
+    const uint32_t rs1 = sourceValues_[0].get<uint32_t>();
 
-        results_[0] = RegisterValue((double)rs1, 8);
-      });
+    results_[0] = RegisterValue(NanBoxFloat((float)rs1), 8);
+  });
+}
 
-      break;
-    }
-    case Opcode::RISCV_FCVT_D_WU: {  // FCVT.D.WU rd,rs1
+// FCVT.D.S rd,rs1
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FCVT_D_S>() {
+  const float rs1 = checkNanBox(sourceValues_[0]);
 
-      setStaticRoundingModeThen([&] {
-        const uint32_t rs1 = sourceValues_[0].get<uint32_t>();
+  results_[0] = RegisterValue((double)rs1, 8);
+}
 
-        results_[0] = RegisterValue((double)rs1, 8);
-      });
+// FCVT.S.D rd,rs1
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FCVT_S_D>() {
+  const double rs1 = sourceValues_[0].get<double>();
 
-      break;
-    }
-    case Opcode::RISCV_FCVT_S_LU: {  // FCVT.S.LU rd,rs1
+  results_[0] = RegisterValue(NanBoxFloat((float)rs1), 8);
+}
 
-      setStaticRoundingModeThen([&] {
-        const uint64_t rs1 = sourceValues_[0].get<uint64_t>();
+// FSGNJ.D rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FSGNJ_D>() {
+  const double rs1 = sourceValues_[0].get<double>();
+  const double rs2 = sourceValues_[1].get<double>();
 
-        results_[0] = RegisterValue(NanBoxFloat((float)rs1), 8);
-      });
+  results_[0] = RegisterValue(std::copysign(rs1, rs2), 8);
+}
 
-      break;
-    }
-    case Opcode::RISCV_FCVT_S_WU: {  // FCVT.S.WU rd,rs1
+// FSGNJ.S rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FSGNJ_S>() {
+  const float rs1 = checkNanBox(sourceValues_[0]);
+  const float rs2 = checkNanBox(sourceValues_[1]);
 
-      setStaticRoundingModeThen([&] {
-        const uint32_t rs1 = sourceValues_[0].get<uint32_t>();
+  results_[0] = RegisterValue(NanBoxFloat(std::copysign(rs1, rs2)), 8);
+}
 
-        results_[0] = RegisterValue(NanBoxFloat((float)rs1), 8);
-      });
+// FSGNJN.D rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FSGNJN_D>() {
+  const double rs1 = sourceValues_[0].get<double>();
+  const double rs2 = sourceValues_[1].get<double>();
 
-      break;
-    }
+  results_[0] = RegisterValue(std::copysign(rs1, -rs2), 8);
+}
 
-    case Opcode::RISCV_FCVT_D_S: {  // FCVT.D.S rd,rs1
-      const float rs1 = checkNanBox(sourceValues_[0]);
+// FSGNJN.S rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FSGNJN_S>() {
+  const float rs1 = checkNanBox(sourceValues_[0]);
+  const float rs2 = checkNanBox(sourceValues_[1]);
 
-      results_[0] = RegisterValue((double)rs1, 8);
-      break;
-    }
-    case Opcode::RISCV_FCVT_S_D: {  // FCVT.S.D rd,rs1
-      const double rs1 = sourceValues_[0].get<double>();
+  results_[0] = RegisterValue(NanBoxFloat(std::copysign(rs1, -rs2)), 8);
+}
 
-      results_[0] = RegisterValue(NanBoxFloat((float)rs1), 8);
-      break;
-    }
+// FSGNJX.D rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FSGNJX_D>() {
+  const double rs1 = sourceValues_[0].get<double>();
+  const double rs2 = sourceValues_[1].get<double>();
 
-    case Opcode::RISCV_FSGNJ_D: {  // FSGNJ.D rd,rs1,rs2
-      const double rs1 = sourceValues_[0].get<double>();
-      const double rs2 = sourceValues_[1].get<double>();
+  const double xorSign = pow(-1, std::signbit(rs1) ^ std::signbit(rs2));
 
-      results_[0] = RegisterValue(std::copysign(rs1, rs2), 8);
-      break;
-    }
-    case Opcode::RISCV_FSGNJ_S: {  // FSGNJ.S rd,rs1,rs2
-      const float rs1 = checkNanBox(sourceValues_[0]);
-      const float rs2 = checkNanBox(sourceValues_[1]);
+  results_[0] = RegisterValue(std::copysign(rs1, xorSign), 8);
+}
 
-      results_[0] = RegisterValue(NanBoxFloat(std::copysign(rs1, rs2)), 8);
-      break;
-    }
-    case Opcode::RISCV_FSGNJN_D: {  // FSGNJN.D rd,rs1,rs2
-      const double rs1 = sourceValues_[0].get<double>();
-      const double rs2 = sourceValues_[1].get<double>();
+// FSGNJX.S rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FSGNJX_S>() {
+  const float rs1 = checkNanBox(sourceValues_[0]);
+  const float rs2 = checkNanBox(sourceValues_[1]);
 
-      results_[0] = RegisterValue(std::copysign(rs1, -rs2), 8);
-      break;
-    }
+  const float xorSign = pow(-1, std::signbit(rs1) ^ std::signbit(rs2));
 
-    case Opcode::RISCV_FSGNJN_S: {  // FSGNJN.S rd,rs1,rs2
-      const float rs1 = checkNanBox(sourceValues_[0]);
-      const float rs2 = checkNanBox(sourceValues_[1]);
+  results_[0] = RegisterValue(NanBoxFloat(std::copysign(rs1, xorSign)), 8);
+}
 
-      results_[0] = RegisterValue(NanBoxFloat(std::copysign(rs1, -rs2)), 8);
-      break;
-    }
-    case Opcode::RISCV_FSGNJX_D: {  // FSGNJX.D rd,rs1,rs2
-      const double rs1 = sourceValues_[0].get<double>();
-      const double rs2 = sourceValues_[1].get<double>();
+// FMV.D.X rd,rs1
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FMV_D_X>() {
+  const double rs1 = sourceValues_[0].get<double>();
 
-      const double xorSign = pow(-1, std::signbit(rs1) ^ std::signbit(rs2));
+  results_[0] = RegisterValue(rs1, 8);
+}
 
-      results_[0] = RegisterValue(std::copysign(rs1, xorSign), 8);
-      break;
-    }
-    case Opcode::RISCV_FSGNJX_S: {  // FSGNJX.S rd,rs1,rs2
-      const float rs1 = checkNanBox(sourceValues_[0]);
-      const float rs2 = checkNanBox(sourceValues_[1]);
+// FMV.X.D rd,rs1
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FMV_X_D>() {
+  const double rs1 = sourceValues_[0].get<double>();
 
-      const float xorSign = pow(-1, std::signbit(rs1) ^ std::signbit(rs2));
+  results_[0] = RegisterValue(rs1, 8);
+}
 
-      results_[0] = RegisterValue(NanBoxFloat(std::copysign(rs1, xorSign)), 8);
-      break;
-    }
+// FMV.W.X rd,rs1
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FMV_W_X>() {
+  const float rs1 = sourceValues_[0].get<float>();
 
-    case Opcode::RISCV_FMV_D_X: {  // FMV.D.X rd,rs1
-      const double rs1 = sourceValues_[0].get<double>();
+  results_[0] = RegisterValue(NanBoxFloat(rs1), 8);
+}
 
-      results_[0] = RegisterValue(rs1, 8);
-      break;
-    }
-    case Opcode::RISCV_FMV_X_D: {  // FMV.X.D rd,rs1
-      const double rs1 = sourceValues_[0].get<double>();
+// FMV.X.W rd,rs1
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FMV_X_W>() {
+  const uint64_t rs1 = sourceValues_[0].get<uint64_t>();
 
-      results_[0] = RegisterValue(rs1, 8);
-      break;
-    }
-    case Opcode::RISCV_FMV_W_X: {  // FMV.W.X rd,rs1
-      const float rs1 = sourceValues_[0].get<float>();
+  results_[0] = RegisterValue(signExtendW(rs1), 8);
+}
 
-      results_[0] = RegisterValue(NanBoxFloat(rs1), 8);
-      break;
-    }
-    case Opcode::RISCV_FMV_X_W: {  // FMV.X.W rd,rs1
-      const uint64_t rs1 = sourceValues_[0].get<uint64_t>();
+// TODO FLT.S and FLE.S perform what the IEEE 754-2008 standard refers
+// to as signaling comparisons: that is, they set the invalid operation
+// exception flag if either input is NaN. FEQ.S performs a quiet
+// comparison: it only sets the invalid operation exception flag if
+// either input is a signaling NaN. For all three instructions, the
+// result is 0 if either operand is NaN. This requires a proper
+// implementation of the Zicsr extension
+
+// FEQ.D rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FEQ_D>() {
+  // TODO FEQ.S performs a quiet
+  // comparison: it only sets the invalid operation exception flag if
+  // either input is a signaling NaN. Qemu doesn't seem to set CSR flags
+  // with sNANs so unsure of correct implementation. Also require proper
+  // Zicsr implementation
+  const double rs1 = sourceValues_[0].get<double>();
+  const double rs2 = sourceValues_[1].get<double>();
+
+  if (rs1 == rs2 && !std::isnan(rs1) && !std::isnan(rs2)) {
+    results_[0] = RegisterValue(static_cast<uint64_t>(1), 8);
+  } else {
+    results_[0] = RegisterValue(static_cast<uint64_t>(0), 8);
+  }
+}
 
-      results_[0] = RegisterValue(signExtendW(rs1), 8);
-      break;
-    }
+// FEQ.S rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FEQ_S>() {
+  const float rs1 = checkNanBox(sourceValues_[0]);
+  const float rs2 = checkNanBox(sourceValues_[1]);
 
-      // TODO FLT.S and FLE.S perform what the IEEE 754-2008 standard refers
-      // to as signaling comparisons: that is, they set the invalid operation
-      // exception flag if either input is NaN. FEQ.S performs a quiet
-      // comparison: it only sets the invalid operation exception flag if
-      // either input is a signaling NaN. For all three instructions, the
-      // result is 0 if either operand is NaN. This requires a proper
-      // implementation of the Zicsr extension
-    case Opcode::RISCV_FEQ_D: {  // FEQ.D rd,rs1,rs2
-      // TODO FEQ.S performs a quiet
-      // comparison: it only sets the invalid operation exception flag if
-      // either input is a signaling NaN. Qemu doesn't seem to set CSR flags
-      // with sNANs so unsure of correct implementation. Also require proper
-      // Zicsr implementation
-      const double rs1 = sourceValues_[0].get<double>();
-      const double rs2 = sourceValues_[1].get<double>();
-
-      if (rs1 == rs2 && !std::isnan(rs1) && !std::isnan(rs2)) {
-        results_[0] = RegisterValue(static_cast<uint64_t>(1), 8);
-      } else {
-        results_[0] = RegisterValue(static_cast<uint64_t>(0), 8);
-      }
-      break;
-    }
-    case Opcode::RISCV_FEQ_S: {  // FEQ.S rd,rs1,rs2
-      const float rs1 = checkNanBox(sourceValues_[0]);
-      const float rs2 = checkNanBox(sourceValues_[1]);
+  if (rs1 == rs2 && !std::isnan(rs1) && !std::isnan(rs2)) {
+    results_[0] = RegisterValue(static_cast<uint64_t>(1), 8);
+  } else {
+    results_[0] = RegisterValue(static_cast<uint64_t>(0), 8);
+  }
+}
 
-      if (rs1 == rs2 && !std::isnan(rs1) && !std::isnan(rs2)) {
-        results_[0] = RegisterValue(static_cast<uint64_t>(1), 8);
-      } else {
-        results_[0] = RegisterValue(static_cast<uint64_t>(0), 8);
-      }
-      break;
-    }
-    case Opcode::RISCV_FLT_D: {  // FLT.D rd,rs1,rs2
-      const double rs1 = sourceValues_[0].get<double>();
-      const double rs2 = sourceValues_[1].get<double>();
+// FLT.D rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FLT_D>() {
+  const double rs1 = sourceValues_[0].get<double>();
+  const double rs2 = sourceValues_[1].get<double>();
 
-      if (std::isnan(rs1) || std::isnan(rs2)) {
-        // TODO: set csr flag when Zicsr implementation is complete
-      }
-      if (rs1 < rs2 && !std::isnan(rs1) && !std::isnan(rs2)) {
-        results_[0] = RegisterValue(static_cast<uint64_t>(1), 8);
-      } else {
-        results_[0] = RegisterValue(static_cast<uint64_t>(0), 8);
-      }
-      break;
-    }
-    case Opcode::RISCV_FLT_S: {  // FLT.S rd,rs1,rs2
-      const float rs1 = checkNanBox(sourceValues_[0]);
-      const float rs2 = checkNanBox(sourceValues_[1]);
+  if (std::isnan(rs1) || std::isnan(rs2)) {
+    // TODO: set csr flag when Zicsr implementation is complete
+  }
+  if (rs1 < rs2 && !std::isnan(rs1) && !std::isnan(rs2)) {
+    results_[0] = RegisterValue(static_cast<uint64_t>(1), 8);
+  } else {
+    results_[0] = RegisterValue(static_cast<uint64_t>(0), 8);
+  }
+}
 
-      if (std::isnan(rs1) || std::isnan(rs2)) {
-        // TODO: set csr flag when Zicsr implementation is complete
-      }
-      if (rs1 < rs2 && !std::isnan(rs1) && !std::isnan(rs2)) {
-        results_[0] = RegisterValue(static_cast<uint64_t>(1), 8);
-      } else {
-        results_[0] = RegisterValue(static_cast<uint64_t>(0), 8);
-      }
-      break;
-    }
-    case Opcode::RISCV_FLE_D: {  // FLE.D rd,rs1,rs2
-      const double rs1 = sourceValues_[0].get<double>();
-      const double rs2 = sourceValues_[1].get<double>();
+// FLT.S rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FLT_S>() {
+  const float rs1 = checkNanBox(sourceValues_[0]);
+  const float rs2 = checkNanBox(sourceValues_[1]);
 
-      if (std::isnan(rs1) || std::isnan(rs2)) {
-        // TODO: set csr flag when Zicsr implementation is complete
-      }
-      if (rs1 <= rs2 && !std::isnan(rs1) && !std::isnan(rs2)) {
-        results_[0] = RegisterValue(static_cast<uint64_t>(1), 8);
-      } else {
-        results_[0] = RegisterValue(static_cast<uint64_t>(0), 8);
-      }
-      break;
-    }
-    case Opcode::RISCV_FLE_S: {  // FLE.S rd,rs1,rs2
-      const float rs1 = checkNanBox(sourceValues_[0]);
-      const float rs2 = checkNanBox(sourceValues_[1]);
+  if (std::isnan(rs1) || std::isnan(rs2)) {
+    // TODO: set csr flag when Zicsr implementation is complete
+  }
+  if (rs1 < rs2 && !std::isnan(rs1) && !std::isnan(rs2)) {
+    results_[0] = RegisterValue(static_cast<uint64_t>(1), 8);
+  } else {
+    results_[0] = RegisterValue(static_cast<uint64_t>(0), 8);
+  }
+}
 
-      if (std::isnan(rs1) || std::isnan(rs2)) {
-        // TODO: set csr flag when Zicsr implementation is complete
-      }
-      if (rs1 <= rs2 && !std::isnan(rs1) && !std::isnan(rs2)) {
-        results_[0] = RegisterValue(static_cast<uint64_t>(1), 8);
-      } else {
-        results_[0] = RegisterValue(static_cast<uint64_t>(0), 8);
-      }
-      break;
-    }
-    case Opcode::RISCV_FCLASS_S: {
-      executionNYI();
-      break;
-    }
-    case Opcode::RISCV_FCLASS_D: {
-      executionNYI();
-      break;
-    }
+// FLE.D rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FLE_D>() {
+  const double rs1 = sourceValues_[0].get<double>();
+  const double rs2 = sourceValues_[1].get<double>();
 
-    default:
-      return executionNYI();
+  if (std::isnan(rs1) || std::isnan(rs2)) {
+    // TODO: set csr flag when Zicsr implementation is complete
   }
+  if (rs1 <= rs2 && !std::isnan(rs1) && !std::isnan(rs2)) {
+    results_[0] = RegisterValue(static_cast<uint64_t>(1), 8);
+  } else {
+    results_[0] = RegisterValue(static_cast<uint64_t>(0), 8);
+  }
+}
+
+// FLE.S rd,rs1,rs2
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FLE_S>() {
+  const float rs1 = checkNanBox(sourceValues_[0]);
+  const float rs2 = checkNanBox(sourceValues_[1]);
+
+  if (std::isnan(rs1) || std::isnan(rs2)) {
+    // TODO: set csr flag when Zicsr implementation is complete
+  }
+  if (rs1 <= rs2 && !std::isnan(rs1) && !std::isnan(rs2)) {
+    results_[0] = RegisterValue(static_cast<uint64_t>(1), 8);
+  } else {
+    results_[0] = RegisterValue(static_cast<uint64_t>(0), 8);
+  }
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FCLASS_S>() {
+  executionNYI();
+}
+
+template <>
+void Instruction::executeOpcode<Opcode::RISCV_FCLASS_D>() {
+  executionNYI();
+}
+
+template <size_t... opcodes>
+std::array<Instruction::ExecuteHandler, sizeof...(opcodes)>
+Instruction::makeExecuteHandlers(std::index_sequence<opcodes...>) {
+  return {&Instruction::executeOpcode<opcodes>...};
+}
+
+Instruction::ExecuteHandler Instruction::getExecuteHandler(
+    unsigned int opcode) {
+  static const auto handlers = makeExecuteHandlers(
+      std::make_index_sequence<Opcode::RISCV_INSTRUCTION_LIST_END>());
+  if (opcode >= handlers.size()) return &Instruction::executionNYI;
+  return handlers[opcode];
 }
 
 }  // namespace riscv
 }  // namespace arch
-}  // namespace simeng
\ No newline at end of file
+}  // namespace simeng
@@ -5,6 +5,7 @@
 
 #include "arch/aarch64/InstructionMetadata.hh"
 #include "arch/riscv/InstructionMetadata.hh"
+#include "simeng/PortMask.hh"
 
 namespace simeng {
 namespace config {
@@ -366,6 +367,10 @@ void ModelConfig::setExpectations(bool isDefault) {
   expectations_["Core"]["Micro-Operations"].setValueSet(
       std::vector{false, true});
 
+  expectations_["Core"].addChild(
+      ExpectationNode::createExpectation<std::string>("", "Decode-Cache-Path",
+                                                      true));
+
   if (isa_ == ISA::AArch64) {
     expectations_["Core"].addChild(ExpectationNode::createExpectation<uint64_t>(
         128, "Vector-Length", true));
@@ -377,6 +382,11 @@ void ModelConfig::setExpectations(bool isDefault) {
         128, "Streaming-Vector-Length", true));
     expectations_["Core"]["Streaming-Vector-Length"].setValueSet(
         std::vector<uint64_t>{128, 256, 512, 1024, 2048});
+
+    expectations_["Core"].addChild(ExpectationNode::createExpectation<bool>(
+        false, "Table-Decoder", true));
+    expectations_["Core"]["Table-Decoder"].setValueSet(
+        std::vector{false, true});
   }
 
   // Fetch
@@ -497,6 +507,12 @@ void ModelConfig::setExpectations(bool isDefault) {
       ExpectationNode::createExpectation<uint32_t>(16, "Store"));
   expectations_["Queue-Sizes"]["Store"].setValueBounds<uint32_t>(1, UINT32_MAX);
 
+  expectations_["Queue-Sizes"].addChild(
+      ExpectationNode::createExpectation<uint16_t>(8, "Rename-Checkpoints",
+                                                   true));
+  expectations_["Queue-Sizes"]["Rename-Checkpoints"].setValueBounds<uint16_t>(
+      0, UINT16_MAX);
+
   // Branch-Predictor
   expectations_.addChild(
       ExpectationNode::createExpectation("Branch-Predictor"));
@@ -563,6 +579,31 @@ void ModelConfig::setExpectations(bool isDefault) {
     }
   }
 
+  // Memory-Dependence-Predictor
+  expectations_.addChild(
+      ExpectationNode::createExpectation("Memory-Dependence-Predictor", true));
+
+  expectations_["Memory-Dependence-Predictor"].addChild(
+      ExpectationNode::createExpectation<std::string>("None", "Type", true));
+  expectations_["Memory-Dependence-Predictor"]["Type"].setValueSet(
+      std::vector<std::string>{"None", "Store-Set"});
+
+  expectations_["Memory-Dependence-Predictor"].addChild(
+      ExpectationNode::createExpectation<uint32_t>(1024, "SSIT-Size", true));
+  expectations_["Memory-Dependence-Predictor"]["SSIT-Size"]
+      .setValueBounds<uint32_t>(1, UINT32_MAX);
+
+  expectations_["Memory-Dependence-Predictor"].addChild(
+      ExpectationNode::createExpectation<uint32_t>(128, "LFST-Size", true));
+  expectations_["Memory-Dependence-Predictor"]["LFST-Size"]
+      .setValueBounds<uint32_t>(1, UINT32_MAX - 1);
+
+  expectations_["Memory-Dependence-Predictor"].addChild(
+      ExpectationNode::createExpectation<uint64_t>(1000000, "Clear-Interval",
+                                                   true));
+  expectations_["Memory-Dependence-Predictor"]["Clear-Interval"]
+      .setValueBounds<uint64_t>(0, UINT64_MAX);
+
   // L1-Data-Memory
   expectations_.addChild(ExpectationNode::createExpectation("L1-Data-Memory"));
 
@@ -828,6 +869,41 @@ void ModelConfig::setExpectations(bool isDefault) {
       ExpectationNode::createExpectation<uint64_t>(1, "Package-Count", true));
   expectations_["CPU-Info"]["Package-Count"].setValueBounds<uint64_t>(
       1, UINT16_MAX);
+
+  // Commit-Trace
+  expectations_.addChild(
+      ExpectationNode::createExpectation("Commit-Trace", true));
+
+  expectations_["Commit-Trace"].addChild(
+      ExpectationNode::createExpectation<std::string>("", "Path", true));
+
+  expectations_["Commit-Trace"].addChild(
+      ExpectationNode::createExpectation<std::string>("Binary", "Format",
+                                                      true));
+  expectations_["Commit-Trace"]["Format"].setValueSet(
+      std::vector<std::string>{"Binary", "Konata"});
+
+  expectations_["Commit-Trace"].addChild(
+      ExpectationNode::createExpectation<uint64_t>(0, "Start-Cycle", true));
+  expectations_["Commit-Trace"]["Start-Cycle"].setValueBounds<uint64_t>(
+      0, UINT64_MAX);
+
+  expectations_["Commit-Trace"].addChild(
+      ExpectationNode::createExpectation<uint64_t>(0, "End-Cycle", true));
+  expectations_["Commit-Trace"]["End-Cycle"].setValueBounds<uint64_t>(
+      0, UINT64_MAX);
+
+  expectations_["Commit-Trace"].addChild(
+      ExpectationNode::createExpectation<uint64_t>(0, "Start-Instruction",
+                                                   true));
+  expectations_["Commit-Trace"]["Start-Instruction"].setValueBounds<uint64_t>(
+      0, UINT64_MAX);
+
+  expectations_["Commit-Trace"].addChild(
+      ExpectationNode::createExpectation<uint64_t>(0, "Instruction-Count",
+                                                   true));
+  expectations_["Commit-Trace"]["Instruction-Count"].setValueBounds<uint64_t>(
+      0, UINT64_MAX);
 }
 
 void ModelConfig::recursiveValidate(ExpectationNode expectation,
@@ -888,6 +964,15 @@ void ModelConfig::recursiveValidate(ExpectationNode expectation,
       if (!result.valid)
         invalid_ << "\t- "
                  << hierarchyString + nodeKey + " " + result.message + "\n";
+      // If an optional section of the config file made up of named options is
+      // missing, fill in its children such that their default values are also
+      // injected. Sections of wildcard entries, such as Latencies, have no
+      // defaults and are left empty
+      if (result.valid && child.isOptional() && child.getChildren().size() &&
+          child.getChildren().front().getKey() != wildcard) {
+        rymlChild |= ryml::MAP;
+        recursiveValidate(child, rymlChild, hierarchyString + nodeKey + ":");
+      }
     }
   }
 }
@@ -982,6 +1067,12 @@ void ModelConfig::postValidation() {
              << ") must match the number of ports ("
              << configTree_["Ports"].num_children() << ")\n";
   }
+  // Port sets are held as a PortMask, bounding the number of ports definable
+  if (configTree_["Ports"].num_children() > MAX_PORTS) {
+    invalid_ << "\t- The number of ports ("
+             << configTree_["Ports"].num_children()
+             << ") must not exceed " << MAX_PORTS << "\n";
+  }
   std::vector<std::string> portnames;
   std::unordered_map<std::string, uint16_t> portIndexes;
   uint16_t idx = 0;
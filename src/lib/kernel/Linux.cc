@@ -4,6 +4,7 @@
 #include <errno.h>
 #include <fcntl.h>
 #include <sys/ioctl.h>
+#include <sys/mman.h>
 #include <sys/resource.h>
 #include <sys/stat.h>
 #include <sys/termios.h>
@@ -26,6 +27,10 @@ void Linux::createProcess(const LinuxProcess& process) {
                             process.getHeapStart(),
                             process.getInitialStackPointer(),
                             process.getMmapStart(), process.getPageSize()});
+  // The initial thread shares its ID with the process
+  processStates_.back().threads.push_back(
+      {processStates_.back().pid, LinuxThreadStatus::Running});
+  processStates_.back().runningThreads.push_back(0);
   processStates_.back().fileDescriptorTable.push_back(STDIN_FILENO);
   processStates_.back().fileDescriptorTable.push_back(STDOUT_FILENO);
   processStates_.back().fileDescriptorTable.push_back(STDERR_FILENO);
@@ -37,6 +42,34 @@ void Linux::createProcess(const LinuxProcess& process) {
        "/sys/devices/system/cpu/online", "core_id", "physical_package_id"});
 }
 
+uint16_t Linux::addCore() {
+  assert(processStates_.size() > 0);
+  processStates_[0].runningThreads.push_back(-1);
+  return processStates_[0].runningThreads.size() - 1;
+}
+
+uint16_t Linux::getCoreCount() const {
+  assert(processStates_.size() > 0);
+  return processStates_[0].runningThreads.size();
+}
+
+void Linux::setCurrentCore(uint16_t core) {
+  assert(core < getCoreCount() && "Attempted to select an unregistered core");
+  currentCore_ = core;
+}
+
+LinuxThreadState& Linux::runningThread() {
+  assert(processStates_.size() > 0);
+  auto& state = processStates_[0];
+  assert(state.runningThreads[currentCore_] >= 0 &&
+         "Attempted to retrieve the running thread of an idle core");
+  return state.threads[state.runningThreads[currentCore_]];
+}
+
+const LinuxThreadState& Linux::getRunningThread() const {
+  return const_cast<Linux*>(this)->runningThread();
+}
+
 int64_t Linux::getHostDirFD(int64_t vdfd) {
   // -100 = AT_FCWD on linux. Pass back AT_FDCWD for host platform e.g. -2 for
   // macOS
@@ -82,6 +115,11 @@ std::string Linux::getSpecialFile(const std::string filename) {
   return filename;
 }
 
+void Linux::setProcessMemory(char* memory, uint64_t size) {
+  processMemory_ = memory;
+  processMemorySize_ = size;
+}
+
 uint64_t Linux::getInitialStackPointer() const {
   assert(processStates_.size() > 0 &&
          "Attempted to retrieve a stack pointer before creating a process");
@@ -119,6 +157,148 @@ uint64_t Linux::clockGetTime(uint64_t clkId, uint64_t systemTimer,
   }
 }
 
+int64_t Linux::clone(uint64_t flags, uint64_t childTidPtr, uint64_t pc,
+                     std::vector<RegisterValue> context) {
+  assert(processStates_.size() > 0);
+  // Only the creation of threads sharing the address space and signal handlers
+  // of the process (i.e. with CLONE_VM, CLONE_SIGHAND and CLONE_THREAD set), as
+  // by pthread_create, is supported
+  const uint64_t required = 0x100 | 0x800 | 0x10000;
+  if ((flags & required) != required) return -EINVAL;
+
+  auto& state = processStates_[0];
+  LinuxThreadState thread;
+  thread.tid = state.pid + state.threads.size();
+  if (flags & 0x200000) {  // CLONE_CHILD_CLEARTID
+    thread.clearChildTid = childTidPtr;
+  }
+  thread.pc = pc;
+  thread.context = std::move(context);
+  state.threads.push_back(std::move(thread));
+  return state.threads.back().tid;
+}
+
+uint64_t Linux::exitThread() {
+  auto& thread = runningThread();
+  thread.status = LinuxThreadStatus::Exited;
+  return thread.clearChildTid;
+}
+
+void Linux::exitGroup() {
+  assert(processStates_.size() > 0);
+  auto& state = processStates_[0];
+  for (auto& thread : state.threads) thread.status = LinuxThreadStatus::Exited;
+  state.futexQueues.clear();
+}
+
+void Linux::futexWait(uint64_t uaddr, bool timed) {
+  auto& thread = runningThread();
+  auto& state = processStates_[0];
+  thread.status = timed ? LinuxThreadStatus::TimedFutexWaiting
+                        : LinuxThreadStatus::FutexWaiting;
+  thread.futexAddress = uaddr;
+  state.futexQueues[uaddr].push_back(thread.tid);
+}
+
+int64_t Linux::futexWake(uint64_t uaddr, int64_t count) {
+  assert(processStates_.size() > 0);
+  auto& state = processStates_[0];
+  auto queue = state.futexQueues.find(uaddr);
+  if (queue == state.futexQueues.end()) return 0;
+
+  int64_t woken = 0;
+  while (woken < count && !queue->second.empty()) {
+    auto& thread = state.threads[queue->second.front() - state.pid];
+    queue->second.pop_front();
+    thread.status = LinuxThreadStatus::Runnable;
+    thread.pendingResult = 0;
+    woken++;
+  }
+  if (queue->second.empty()) state.futexQueues.erase(queue);
+  return woken;
+}
+
+const LinuxThreadState* Linux::switchThread(
+    uint64_t pc, std::vector<RegisterValue> context) {
+  // Save the context of the suspended thread
+  auto& current = runningThread();
+  if (current.status == LinuxThreadStatus::Running) {
+    current.status = LinuxThreadStatus::Runnable;
+    current.pendingResult = 0;
+  }
+  if (current.status != LinuxThreadStatus::Exited) {
+    current.pc = pc;
+    current.context = std::move(context);
+  }
+
+  // Consider the suspended thread last
+  auto& state = processStates_[0];
+  size_t suspended = state.runningThreads[currentCore_];
+  state.runningThreads[currentCore_] = -1;
+  return scheduleThread(suspended + 1);
+}
+
+const LinuxThreadState* Linux::resumeThread() {
+  assert(processStates_.size() > 0);
+  assert(processStates_[0].runningThreads[currentCore_] < 0 &&
+         "Attempted to resume a thread on a core already running one");
+  return scheduleThread(0);
+}
+
+const LinuxThreadState* Linux::scheduleThread(size_t first) {
+  auto& state = processStates_[0];
+  auto& threads = state.threads;
+
+  // Find the next runnable thread
+  size_t next = threads.size();
+  for (size_t i = 0; i < threads.size(); i++) {
+    size_t index = (first + i) % threads.size();
+    if (threads[index].status == LinuxThreadStatus::Runnable) {
+      next = index;
+      break;
+    }
+  }
+
+  if (next == threads.size()) {
+    // With no thread able to run on any core, time out the first timed futex
+    // wait
+    if (getRunningThreadCount() > 0) return nullptr;
+    for (size_t i = 0; i < threads.size(); i++) {
+      if (threads[i].status == LinuxThreadStatus::TimedFutexWaiting) {
+        next = i;
+        break;
+      }
+    }
+    if (next == threads.size()) return nullptr;
+
+    uint64_t uaddr = threads[next].futexAddress;
+    auto& queue = state.futexQueues[uaddr];
+    queue.erase(std::find(queue.begin(), queue.end(), threads[next].tid));
+    if (queue.empty()) state.futexQueues.erase(uaddr);
+    threads[next].pendingResult = -ETIMEDOUT;
+  }
+
+  state.runningThreads[currentCore_] = next;
+  threads[next].status = LinuxThreadStatus::Running;
+  return &threads[next];
+}
+
+size_t Linux::getLiveThreadCount() const {
+  assert(processStates_.size() > 0);
+  return std::count_if(processStates_[0].threads.begin(),
+                       processStates_[0].threads.end(),
+                       [](const LinuxThreadState& thread) {
+                         return thread.status != LinuxThreadStatus::Exited;
+                       });
+}
+
+size_t Linux::getRunningThreadCount() const {
+  assert(processStates_.size() > 0);
+  return std::count_if(processStates_[0].runningThreads.begin(),
+                       processStates_[0].runningThreads.end(),
+                       [](int64_t thread) { return thread >= 0; });
+}
+
 int64_t Linux::ftruncate(uint64_t fd, uint64_t length) {
   assert(fd < processStates_[0].fileDescriptorTable.size());
   int64_t hfd = processStates_[0].fileDescriptorTable[fd];
@@ -303,8 +483,7 @@ int64_t Linux::getuid() const { return 0; }
 int64_t Linux::geteuid() const { return 0; }
 int64_t Linux::getgid() const { return 0; }
 int64_t Linux::getegid() const { return 0; }
-// TODO update for multithreaded processes
-int64_t Linux::gettid() const { return 0; }
+int64_t Linux::gettid() const { return getRunningThread().tid; }
 
 int64_t Linux::gettimeofday(uint64_t systemTimer, timeval* tv, timeval* tz) {
   // TODO: Ideally this should get the system timer from the core directly
@@ -407,9 +586,17 @@ int64_t Linux::munmap(uint64_t addr, size_t length) {
 }
 
 uint64_t Linux::mmap(uint64_t addr, size_t length, [[maybe_unused]] int prot,
-                     [[maybe_unused]] int flags, [[maybe_unused]] int fd,
-                     [[maybe_unused]] off_t offset) {
+                     [[maybe_unused]] int flags, int fd, off_t offset) {
   LinuxProcessState* lps = &processStates_[0];
+  if (fd != -1) {
+    // A file-backed mapping must be of an open file, from an offset which is a
+    // multiple of the process page size
+    if (fd < 0 || static_cast<size_t>(fd) >= lps->fileDescriptorTable.size() ||
+        lps->fileDescriptorTable[fd] < 0 || offset < 0 ||
+        offset % lps->pageSize != 0) {
+      return 0;
+    }
+  }
   std::shared_ptr<struct vm_area_struct> newAlloc(new vm_area_struct);
   if (addr == 0) {  // Kernel decides allocation
     if (lps->contiguousAllocations.size() > 1) {
@@ -614,6 +801,74 @@ int64_t Linux::read(int64_t fd, void* buf, uint64_t count) {
   return ::read(hfd, buf, count);
 }
 
+int64_t Linux::pread(int64_t fd, void* buf, uint64_t count, uint64_t offset) {
+  assert(fd >= 0 && static_cast<size_t>(fd) <
+                        processStates_[0].fileDescriptorTable.size());
+  int64_t hfd = processStates_[0].fileDescriptorTable[fd];
+  if (hfd < 0) {
+    return EBADF;
+  }
+
+  // Read until `count` bytes or the end of the file is reached, as a single
+  // host call may return fewer bytes than requested
+  uint64_t totalRead = 0;
+  while (totalRead < count) {
+    int64_t bytesRead = ::pread(hfd, static_cast<char*>(buf) + totalRead,
+                                count - totalRead, offset + totalRead);
+    if (bytesRead < 0) return -1;
+    if (bytesRead == 0) break;
+    totalRead += bytesRead;
+  }
+  return totalRead;
+}
+
+bool Linux::populateMapping(uint64_t address, size_t length, int64_t fd,
+                            uint64_t offset,
+                            arch::ProcessStateChange& stateChange) {
+  if (processMemory_ == nullptr || address + length > processMemorySize_) {
+    // Without direct access to process memory, read the contents and write
+    // them in 128-byte chunks as part of the state change
+    std::vector<char> contents(length, 0);
+    if (pread(fd, contents.data(), length, offset) < 0) return false;
+    for (uint64_t done = 0; done < length; done += 128) {
+      uint8_t chunk = std::min<uint64_t>(length - done, 128);
+      stateChange.memoryAddresses.push_back({address + done, chunk});
+      stateChange.memoryAddressValues.push_back(
+          {contents.data() + done, chunk});
+    }
+    return true;
+  }
+
+  // Map the host pages wholly covered by both the mapping and the file
+  // copy-on-write, as the ELF loader does for loadable segments, such that
+  // they're only read once accessed and writes never reach the file. Pages
+  // past the end of the file can't be mapped, as accessing them would fault.
+  char* mapping = processMemory_ + address;
+  const uint64_t hostPageSize = sysconf(_SC_PAGESIZE);
+  const int64_t hfd = processStates_[0].fileDescriptorTable[fd];
+  uint64_t mapped = 0;
+  struct ::stat fileStat;
+  if (reinterpret_cast<uintptr_t>(mapping) % hostPageSize == 0 &&
+      offset % hostPageSize == 0 && ::fstat(hfd, &fileStat) == 0 &&
+      static_cast<uint64_t>(fileStat.st_size) > offset) {
+    uint64_t available = std::min<uint64_t>(length, fileStat.st_size - offset);
+    uint64_t pages = available / hostPageSize * hostPageSize;
+    if (pages > 0 &&
+        ::mmap(mapping, pages, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED,
+               hfd, offset) != MAP_FAILED) {
+      mapped = pages;
+    }
+  }
+
+  // Read the rest directly into process memory, clearing any part beyond the
+  // end of the file, as the region may have held an earlier mapping
+  int64_t bytesRead =
+      pread(fd, mapping + mapped, length - mapped, offset + mapped);
+  if (bytesRead < 0) return false;
+  std::memset(mapping + mapped + bytesRead, 0, length - mapped - bytesRead);
+  return true;
+}
+
 int64_t Linux::readv(int64_t fd, const void* iovdata, int iovcnt) {
   assert(fd > 0 && static_cast<size_t>(fd) <
                        processStates_[0].fileDescriptorTable.size());
@@ -641,9 +896,9 @@ int64_t Linux::schedSetAffinity(pid_t pid, size_t cpusetsize, uint64_t mask) {
   return 0;
 }
 int64_t Linux::setTidAddress(uint64_t tidptr) {
-  assert(processStates_.size() > 0);
-  processStates_[0].clearChildTid = tidptr;
-  return processStates_[0].pid;
+  auto& thread = runningThread();
+  thread.clearChildTid = tidptr;
+  return thread.tid;
 }
 
 int64_t Linux::write(int64_t fd, const void* buf, uint64_t count) {
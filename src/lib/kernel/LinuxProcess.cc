@@ -1,5 +1,7 @@
 #include "simeng/kernel/LinuxProcess.hh"
 
+#include <sys/mman.h>
+
 #include <cassert>
 #include <cstring>
 #include <iostream>
@@ -16,6 +18,23 @@ uint64_t alignToBoundary(uint64_t value, uint64_t boundary) {
   return value + (boundary - remainder);
 }
 
+/** Allocate a zero-filled process image of `size` bytes. The image is
+ * reserved as an anonymous mapping, such that host memory is only committed
+ * to the pages the process touches, and the large unused regions of a
+ * typically sparse image cost nothing. */
+static std::shared_ptr<char> allocateProcessImage(uint64_t size) {
+  void* image = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+  if (image == MAP_FAILED) {
+    std::cerr << "[SimEng:LinuxProcess] ProcessImage cannot be constructed "
+                 "successfully! Allocation failed."
+              << std::endl;
+    exit(EXIT_FAILURE);
+  }
+  return std::shared_ptr<char>(static_cast<char*>(image),
+                               [size](char* ptr) { munmap(ptr, size); });
+}
+
 LinuxProcess::LinuxProcess(const std::vector<std::string>& commandLine,
                            ryml::ConstNodeRef config)
     : STACK_SIZE(config["Process-Image"]["Stack-Size"].as<uint64_t>()),
@@ -23,8 +42,7 @@ LinuxProcess::LinuxProcess(const std::vector<std::string>& commandLine,
       commandLine_(commandLine) {
   // Parse ELF file
   assert(commandLine.size() > 0);
-  char* unwrappedProcImgPtr;
-  Elf elf(commandLine[0], &unwrappedProcImgPtr);
+  Elf elf(commandLine[0]);
   if (!elf.isValid()) {
     return;
   }
@@ -47,19 +65,11 @@ LinuxProcess::LinuxProcess(const std::vector<std::string>& commandLine,
   // Calculate process image size, including heap + stack
   size_ = heapStart_ + HEAP_SIZE + STACK_SIZE;
 
-  char* temp = (char*)realloc(unwrappedProcImgPtr, size_ * sizeof(char));
-  if (temp == NULL) {
-    free(unwrappedProcImgPtr);
-    std::cerr << "[SimEng:LinuxProcess] ProcessImage cannot be constructed "
-                 "successfully! "
-                 "Reallocation failed."
-              << std::endl;
-    exit(EXIT_FAILURE);
-  }
-  unwrappedProcImgPtr = temp;
+  processImage_ = allocateProcessImage(size_);
+  char* unwrappedProcImgPtr = processImage_.get();
+  elf.loadSegments(unwrappedProcImgPtr);
 
   createStack(&unwrappedProcImgPtr);
-  processImage_ = std::shared_ptr<char>(unwrappedProcImgPtr, free);
 }
 
 LinuxProcess::LinuxProcess(span<const uint8_t> instructions,
@@ -81,11 +91,11 @@ LinuxProcess::LinuxProcess(span<const uint8_t> instructions,
       alignToBoundary(heapStart_ + (HEAP_SIZE + STACK_SIZE) / 2, pageSize_);
 
   size_ = heapStart_ + HEAP_SIZE + STACK_SIZE;
-  char* unwrappedProcImgPtr = (char*)calloc(size_, sizeof(char));
+  processImage_ = allocateProcessImage(size_);
+  char* unwrappedProcImgPtr = processImage_.get();
   std::copy(instructions.begin(), instructions.end(), unwrappedProcImgPtr);
 
   createStack(&unwrappedProcImgPtr);
-  processImage_ = std::shared_ptr<char>(unwrappedProcImgPtr, free);
 }
 
 LinuxProcess::~LinuxProcess() {}
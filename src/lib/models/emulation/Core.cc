@@ -1,19 +1,26 @@
 #include "simeng/models/emulation/Core.hh"
 
+#include <algorithm>
 #include <cstring>
 
 namespace simeng {
 namespace models {
 namespace emulation {
 
-/** The number of bytes fetched each cycle. */
+/** The number of bytes fetched for each instruction. */
 const uint8_t FETCH_SIZE = 4;
 
-Core::Core(memory::MemoryInterface& instructionMemory,
-           memory::MemoryInterface& dataMemory, uint64_t entryPoint,
-           uint64_t programByteLength, const arch::Architecture& isa)
+/** The maximum number of instructions in a basic block. */
+const size_t MAX_BLOCK_SIZE = 64;
+
+/** The granularity at which stores are checked for writes to cached code. */
+const uint64_t CODE_PAGE_SIZE = 4096;
+
+Core::Core(char* processMemory, memory::MemoryInterface& dataMemory,
+           uint64_t entryPoint, uint64_t programByteLength,
+           const arch::Architecture& isa)
     : simeng::Core(dataMemory, isa, config::SimInfo::getArchRegStruct()),
-      instructionMemory_(instructionMemory),
+      processMemory_(processMemory),
       architecturalRegisterFileSet_(registerFileSet_),
       pc_(entryPoint),
       programByteLength_(programByteLength) {
@@ -28,9 +35,6 @@ Core::Core(memory::MemoryInterface& instructionMemory,
       "Emulation core is only compatable with a Flat Instruction Memory "
       "Interface.");
 
-  // Pre-load the first instruction
-  instructionMemory_.requestRead({pc_, FETCH_SIZE});
-
   // Query and apply initial state
   auto state = isa.getInitialState();
   applyStateChange(state);
@@ -44,31 +48,81 @@ void Core::tick() {
     return;
   }
 
-  ticks_++;
-  isa_.updateSystemTimerRegisters(&registerFileSet_, ticks_);
+  // Find the basic block starting at the PC, predecoding it on first visit
+  auto iter = blockCache_.find(pc_);
+  if (iter == blockCache_.end()) {
+    iter = blockCache_.emplace(pc_, decodeBlock(pc_)).first;
+  }
+  const auto& block = iter->second;
 
-  // Fetch & Decode
-  assert(macroOp_.empty() &&
-         "Cannot begin emulation tick with un-executed micro-ops.");
-  // We only fetch one instruction at a time, so only ever one result in
-  // complete reads
-  const auto& instructionBytes = instructionMemory_.getCompletedReads()[0].data;
-  // Predecode fetched data
-  auto bytesRead = isa_.predecode(instructionBytes.getAsVector<uint8_t>(),
-                                  FETCH_SIZE, pc_, macroOp_);
-  // Clear the fetched data
-  instructionMemory_.clearCompletedReads();
+  // Execute the block's instructions in turn, leaving it early if control
+  // doesn't pass to the next instruction in the block
+  for (size_t i = 0; i < block.macroOps.size(); i++) {
+    ticks_++;
+    isa_.updateSystemTimerRegisters(&registerFileSet_, ticks_);
 
-  pc_ += bytesRead;
+    assert(macroOp_.empty() &&
+           "Cannot begin emulation tick with un-executed micro-ops.");
+    for (const auto& uop : block.macroOps[i]) {
+      macroOp_.push_back(uop->clone());
+    }
+    uint64_t nextPc = pc_ + block.sizes[i];
+    pc_ = nextPc;
 
-  // Loop over all micro-ops and execute one by one
-  while (!macroOp_.empty()) {
-    auto& uop = macroOp_.front();
+    executeMacroOp();
+    macroOp_.clear();
+    if (hasHalted_) return;
+    instructionsExecuted_++;
+
+    if (pc_ != nextPc || blocksInvalidated_) break;
+  }
+
+  // The block may have been discarded, so only once it's no longer in use
+  if (blocksInvalidated_) {
+    blockCache_.clear();
+    codePages_.clear();
+    blocksInvalidated_ = false;
+  }
+}
+
+Core::Block Core::decodeBlock(uint64_t address) {
+  Block block;
+  while (address < programByteLength_) {
+    // Fetch & Decode directly from the process image
+    MacroOp macroOp;
+    uint16_t bytesAvailable =
+        std::min<uint64_t>(FETCH_SIZE, programByteLength_ - address);
+    auto bytesRead = isa_.predecode(
+        reinterpret_cast<const uint8_t*>(processMemory_ + address),
+        bytesAvailable, address, macroOp);
+    if (bytesRead == 0) break;
+
+    // Record each page the instruction occupies
+    uint64_t lastPage = (address + bytesRead - 1) / CODE_PAGE_SIZE;
+    for (uint64_t page = address / CODE_PAGE_SIZE; page <= lastPage; page++) {
+      codePages_.insert(page);
+    }
+    address += bytesRead;
 
+    // End the block after any instruction which may redirect control
+    bool endsBlock = block.macroOps.size() + 1 == MAX_BLOCK_SIZE;
+    for (const auto& uop : macroOp) {
+      if (uop->isBranch() || uop->exceptionEncountered()) endsBlock = true;
+    }
+    block.macroOps.push_back(std::move(macroOp));
+    block.sizes.push_back(bytesRead);
+    if (endsBlock) break;
+  }
+  return block;
+}
+
+void Core::executeMacroOp() {
+  // Loop over all micro-ops and execute one by one
+  for (auto& uop : macroOp_) {
     if (uop->exceptionEncountered()) {
       handleException(uop);
       // If fatal, return
-      if (hasHalted_) return;
+      if (hasHalted_) break;
     }
 
     // Issue
@@ -87,27 +141,21 @@ void Core::tick() {
       if (uop->exceptionEncountered()) {
         handleException(uop);
         // If fatal, return
-        if (hasHalted_) return;
+        if (hasHalted_) break;
       }
-      if (addresses.size() > 0) {
-        // Memory reads required; request them
-        for (auto const& target : addresses) {
-          dataMemory_.requestRead(target);
-          // Save addresses for use by instructions that perform a LD and STR
-          // (i.e. single instruction atomics)
-          previousAddresses_.push_back(target);
-        }
-        // Emulation core can only be used with a Flat memory interface, so data
-        // is ready immediately
-        const auto& completedReads = dataMemory_.getCompletedReads();
-        assert(
-            completedReads.size() == addresses.size() &&
-            "Number of completed reads does not match the number of requested "
-            "reads.");
-        for (const auto& response : completedReads) {
-          uop->supplyData(response.target.address, response.data);
+      for (auto const& target : addresses) {
+        // Read directly from the process image, supplying an invalid value
+        // to signal a fault for reads outside of it
+        if (target.address + target.size > programByteLength_) {
+          uop->supplyData(target.address, RegisterValue());
+        } else {
+          uop->supplyData(
+              target.address,
+              RegisterValue(processMemory_ + target.address, target.size));
         }
-        dataMemory_.clearCompletedReads();
+        // Save addresses for use by instructions that perform a LD and STR
+        // (i.e. single instruction atomics)
+        previousAddresses_.push_back(target);
       }
     } else if (uop->isStoreAddress()) {
       auto addresses = uop->generateAddresses();
@@ -115,7 +163,7 @@ void Core::tick() {
       if (uop->exceptionEncountered()) {
         handleException(uop);
         // If fatal, return
-        if (hasHalted_) return;
+        if (hasHalted_) break;
       }
       // Store addresses for use by next store data operation in `execute()`
       for (auto const& target : addresses) {
@@ -123,16 +171,11 @@ void Core::tick() {
       }
       if (!uop->isStoreData()) {
         // No further action needed, move onto next micro-op
-        macroOp_.erase(macroOp_.begin());
         continue;
       }
     }
     execute(uop);
-    macroOp_.erase(macroOp_.begin());
   }
-  instructionsExecuted_++;
-  // Fetch memory for next cycle
-  instructionMemory_.requestRead({pc_, FETCH_SIZE});
 }
 
 bool Core::hasHalted() const { return hasHalted_; }
@@ -163,7 +206,15 @@ void Core::execute(std::shared_ptr<Instruction>& uop) {
   if (uop->isStoreData()) {
     auto data = uop->getData();
     for (size_t i = 0; i < previousAddresses_.size(); i++) {
-      dataMemory_.requestWrite(previousAddresses_[i], data[i]);
+      const auto& target = previousAddresses_[i];
+      if (target.address + target.size > programByteLength_) {
+        std::cerr << "[SimEng:Core] Attempted to write beyond memory limit."
+                  << std::endl;
+        exit(1);
+      }
+      std::memcpy(processMemory_ + target.address, data[i].getAsVector<char>(),
+                  target.size);
+      invalidateBlocksWrittenBy(target);
     }
   } else if (uop->isBranch()) {
     pc_ = uop->getBranchAddress();
@@ -179,6 +230,15 @@ void Core::execute(std::shared_ptr<Instruction>& uop) {
   }
 }
 
+void Core::invalidateBlocksWrittenBy(
+    const memory::MemoryAccessTarget& target) {
+  uint64_t lastPage = (target.address + target.size - 1) / CODE_PAGE_SIZE;
+  for (uint64_t page = target.address / CODE_PAGE_SIZE; page <= lastPage;
+       page++) {
+    if (codePages_.count(page)) blocksInvalidated_ = true;
+  }
+}
+
 void Core::handleException(const std::shared_ptr<Instruction>& instruction) {
   exceptionHandler_ = isa_.handleException(instruction, *this, dataMemory_);
   processExceptionHandler();
@@ -201,6 +261,10 @@ void Core::processExceptionHandler() {
   } else {
     pc_ = result.instructionAddress;
     applyStateChange(result.stateChange);
+    // The handler may have written to memory holding cached blocks
+    for (const auto& target : result.stateChange.memoryAddresses) {
+      invalidateBlocksWrittenBy(target);
+    }
   }
 
   // Clear the handler
@@ -1,5 +1,6 @@
 #include "simeng/models/inorder/Core.hh"
 
+#include <algorithm>
 #include <iomanip>
 #include <ios>
 #include <sstream>
@@ -12,27 +13,46 @@ namespace inorder {
 Core::Core(memory::MemoryInterface& instructionMemory,
            memory::MemoryInterface& dataMemory, uint64_t processMemorySize,
            uint64_t entryPoint, const arch::Architecture& isa,
-           BranchPredictor& branchPredictor)
+           BranchPredictor& branchPredictor, ryml::ConstNodeRef config)
     : simeng::Core(dataMemory, isa, config::SimInfo::getArchRegStruct()),
       architecturalRegisterFileSet_(registerFileSet_),
-      fetchToDecodeBuffer_(1, {}),
-      decodeToExecuteBuffer_(1, nullptr),
-      completionSlots_(1, {1, nullptr}),
+      fetchToDecodeBuffer_(config["Pipeline-Widths"]["FrontEnd"].as<uint16_t>(),
+                           {}),
+      decodeToIssueBuffer_(config["Pipeline-Widths"]["FrontEnd"].as<uint16_t>(),
+                           nullptr),
+      issuePorts_(config["Execution-Units"].num_children(), {1, nullptr}),
       fetchUnit_(fetchToDecodeBuffer_, instructionMemory, processMemorySize,
-                 entryPoint,
-                 config::SimInfo::getConfig()["Fetch"]["Fetch-Block-Size"]
-                     .as<uint16_t>(),
+                 entryPoint, config["Fetch"]["Fetch-Block-Size"].as<uint16_t>(),
                  isa, branchPredictor),
-      decodeUnit_(fetchToDecodeBuffer_, decodeToExecuteBuffer_,
-                  branchPredictor),
-      executeUnit_(
-          decodeToExecuteBuffer_, completionSlots_[0],
-          [this](auto regs, auto values) { forwardOperands(regs, values); },
-          [this](auto instruction) { handleLoad(instruction); },
-          [this](auto instruction) { storeData(instruction); },
-          [this](auto instruction) { raiseException(instruction); },
-          branchPredictor, false),
-      writebackUnit_(completionSlots_, registerFileSet_, [](auto insnId) {}) {
+      decodeUnit_(fetchToDecodeBuffer_, decodeToIssueBuffer_, branchPredictor),
+      writebackUnit_(completions_, registerFileSet_, [](auto insnId) {}) {
+  for (size_t i = 0; i < config["Execution-Units"].num_children(); i++) {
+    // Create vector of blocking groups
+    std::vector<uint16_t> blockingGroups = {};
+    for (ryml::ConstNodeRef grp :
+         config["Execution-Units"][i]["Blocking-Group-Nums"]) {
+      blockingGroups.push_back(grp.as<uint16_t>());
+    }
+    pipelined_.push_back(config["Execution-Units"][i]["Pipelined"].as<bool>());
+    blockingGroups_.push_back(blockingGroups);
+    executionUnits_.emplace_back(
+        issuePorts_[i], completions_,
+        // Results are read from the register file once written back, so
+        // forwarding only signals that the instruction has executed
+        [this](auto regs, auto values) { instructionExecuted(); },
+        [this](auto instruction) { handleLoad(instruction); },
+        [this](auto instruction) { storeData(instruction); },
+        [this](auto instruction) { raiseException(instruction); },
+        branchPredictor, pipelined_.back(), blockingGroups);
+  }
+  portLastCompletion_.resize(executionUnits_.size(), 0);
+  portStallUntil_.resize(executionUnits_.size(), 0);
+  portBlockingUntil_.resize(executionUnits_.size(), 0);
+
+  for (const auto& regFile : config::SimInfo::getArchRegStruct()) {
+    scoreboard_.emplace_back(regFile.quantity);
+  }
+
   // Query and apply initial state
   auto state = isa.getInitialState();
   applyStateChange(state);
@@ -49,29 +69,40 @@ void Core::tick() {
     return;
   }
 
-  // Writeback must be ticked at start of cycle, to ensure decode reads the
+  // Writeback must be ticked at start of cycle, to ensure issue reads the
   // correct values
   writebackUnit_.tick();
 
   // Tick units
   fetchUnit_.tick();
   decodeUnit_.tick();
-  executeUnit_.tick();
+  issue();
+
+  executeFlush_ = false;
+  for (auto& unit : executionUnits_) {
+    unit.tick();
+    if (unit.shouldFlush() && !executeFlush_) {
+      // Discard younger instructions before any further units execute them
+      executeFlush_ = true;
+      executeFlushAddress_ = unit.getFlushAddress();
+      flushInFlight();
+    } else if (exceptionGenerated_ && !inFlight_.empty()) {
+      flushInFlight();
+    }
+  }
 
   // Wipe any data read responses, as they will have been handled by this point
   dataMemory_.clearCompletedReads();
 
-  // Read pending registers for ready-to-execute uop; must happen after execute
-  // to allow operand forwarding to take place first
-  readRegisters();
-
   // Tick buffers
   // Each unit must have wiped the entries at the head of the buffer after use,
   // as these will now loop around and become the tail.
   fetchToDecodeBuffer_.tick();
-  decodeToExecuteBuffer_.tick();
-  // Only ever 1 completion slot
-  completionSlots_[0].tick();
+  decodeToIssueBuffer_.tick();
+  for (auto& buffer : issuePorts_) {
+    buffer.tick();
+  }
+  completions_.tick();
 
   if (exceptionGenerated_) {
     handleException();
@@ -80,15 +111,15 @@ void Core::tick() {
   }
 
   // Check for flush
-  if (executeUnit_.shouldFlush()) {
+  if (executeFlush_) {
     // Flush was requested at execute stage
-    // Update PC and wipe younger buffers (Fetch/Decode, Decode/Execute)
-    auto targetAddress = executeUnit_.getFlushAddress();
-
+    // Update PC and wipe younger buffers (Fetch/Decode, Decode/Issue)
     fetchUnit_.flushLoopBuffer();
-    fetchUnit_.updatePC(targetAddress);
+    fetchUnit_.updatePC(executeFlushAddress_);
     fetchToDecodeBuffer_.fill({});
-    decodeToExecuteBuffer_.fill(nullptr);
+    fetchToDecodeBuffer_.stall(false);
+    decodeToIssueBuffer_.fill(nullptr);
+    decodeToIssueBuffer_.stall(false);
     decodeUnit_.purgeFlushed();
 
     flushes_++;
@@ -113,24 +144,40 @@ bool Core::hasHalted() const {
   }
 
   // Core is considered to have halted when the fetch unit has halted, there
-  // are no uops pending in any buffer, the execute unit is not currently
-  // processing an instructions and no exception is currently being handled.
+  // are no uops pending in any buffer, the execution units are not currently
+  // processing any instructions and no exception is currently being handled.
+  if (!fetchUnit_.hasHalted() || exceptionHandler_ != nullptr) {
+    return false;
+  }
 
-  // Units place uops in buffer tail, but if buffer is stalled, uops do not
-  // move to head slots and so remain in tail slots. Buffer head appears
-  // empty. Check emptiness accordingly
-  auto decSlots = fetchToDecodeBuffer_.getPendingSlots()[0];
-  bool decodePending = decSlots.size() > 0;
+  // Buffers may be stalled with uops in either row, so check every slot
+  const auto* decodeSlots = fetchToDecodeBuffer_.getTailSlots();
+  const auto* issueSlots = decodeToIssueBuffer_.getTailSlots();
+  for (size_t slot = 0; slot < fetchToDecodeBuffer_.getWidth(); slot++) {
+    if (decodeSlots[slot].size() > 0 ||
+        fetchToDecodeBuffer_.getHeadSlots()[slot].size() > 0) {
+      return false;
+    }
+  }
+  for (size_t slot = 0; slot < decodeToIssueBuffer_.getWidth(); slot++) {
+    if (issueSlots[slot] != nullptr ||
+        decodeToIssueBuffer_.getHeadSlots()[slot] != nullptr) {
+      return false;
+    }
+  }
 
-  auto exeSlots = decodeToExecuteBuffer_.getPendingSlots()[0];
-  bool executePending = exeSlots != nullptr;
+  for (size_t port = 0; port < executionUnits_.size(); port++) {
+    if (!executionUnits_[port].isEmpty() ||
+        issuePorts_[port].getHeadSlots()[0] != nullptr) {
+      return false;
+    }
+  }
 
-  auto writeSlots = completionSlots_[0].getPendingSlots()[0];
-  bool writebackPending = writeSlots != nullptr;
+  if (!completions_.empty()) {
+    return false;
+  }
 
-  return (fetchUnit_.hasHalted() && !decodePending && !writebackPending &&
-          !executePending && executeUnit_.isEmpty() &&
-          exceptionHandler_ == nullptr);
+  return true;
 }
 
 const ArchitecturalRegisterFileSet& Core::getArchitecturalRegisterFileSet()
@@ -151,8 +198,10 @@ std::map<std::string, std::string> Core::getStats() const {
   // Sum up the branch stats reported across the execution units.
   uint64_t totalBranchesExecuted = 0;
   uint64_t totalBranchMispredicts = 0;
-  totalBranchesExecuted += executeUnit_.getBranchExecutedCount();
-  totalBranchMispredicts += executeUnit_.getBranchMispredictedCount();
+  for (const auto& unit : executionUnits_) {
+    totalBranchesExecuted += unit.getBranchExecutedCount();
+    totalBranchMispredicts += unit.getBranchMispredictedCount();
+  }
   auto branchMissRate = 100.0f * static_cast<float>(totalBranchMispredicts) /
                         static_cast<float>(totalBranchesExecuted);
   std::ostringstream branchMissRateStr;
@@ -164,10 +213,25 @@ std::map<std::string, std::string> Core::getStats() const {
           {"flushes", std::to_string(flushes_)},
           {"branch.executed", std::to_string(totalBranchesExecuted)},
           {"branch.mispredict", std::to_string(totalBranchMispredicts)},
-          {"branch.missrate", branchMissRateStr.str()}};
+          {"branch.missrate", branchMissRateStr.str()},
+          {"fetch.branchStalls", std::to_string(fetchUnit_.getBranchStalls())},
+          {"decode.earlyFlushes",
+           std::to_string(decodeUnit_.getEarlyFlushes())},
+          {"issue.frontendStalls", std::to_string(frontendStalls_)},
+          {"issue.dependencyStalls", std::to_string(dependencyStalls_)},
+          {"issue.loadUseStalls", std::to_string(loadUseStalls_)},
+          {"issue.portBusyStalls", std::to_string(portBusyStalls_)},
+          {"issue.completionOrderStalls",
+           std::to_string(completionOrderStalls_)},
+          {"issue.multiIssueCycles", std::to_string(multiIssueCycles_)}};
 }
 
 void Core::raiseException(const std::shared_ptr<Instruction>& instruction) {
+  if (!inFlight_.empty() && inFlight_.front() == instruction) {
+    // The instruction has executed; any younger instructions are flushed
+    // before the exception is handled
+    inFlight_.pop_front();
+  }
   exceptionGenerated_ = true;
   exceptionGeneratingInstruction_ = instruction;
 }
@@ -175,6 +239,10 @@ void Core::raiseException(const std::shared_ptr<Instruction>& instruction) {
 void Core::handleException() {
   exceptionGenerated_ = false;
 
+  // Retire any older instructions which finished executing this cycle, such
+  // that their results are visible to the exception handler
+  writebackUnit_.tick();
+
   exceptionHandler_ =
       isa_.handleException(exceptionGeneratingInstruction_, *this, dataMemory_);
 
@@ -182,9 +250,10 @@ void Core::handleException() {
 
   // Flush pipeline
   fetchToDecodeBuffer_.fill({});
-  decodeToExecuteBuffer_.fill(nullptr);
+  fetchToDecodeBuffer_.stall(false);
+  decodeToIssueBuffer_.fill(nullptr);
+  decodeToIssueBuffer_.stall(false);
   decodeUnit_.purgeFlushed();
-  completionSlots_[0].fill(nullptr);
 }
 
 void Core::processExceptionHandler() {
@@ -223,10 +292,9 @@ void Core::handleLoad(const std::shared_ptr<Instruction>& instruction) {
     return;
   }
 
-  forwardOperands(instruction->getDestinationRegisters(),
-                  instruction->getResults());
-  // Manually add the instruction to the writeback input buffer
-  completionSlots_[0].getTailSlots()[0] = instruction;
+  instructionExecuted();
+  // Manually schedule the instruction for writeback
+  completions_.schedule(instruction, 1);
 }
 
 void Core::loadData(const std::shared_ptr<Instruction>& instruction) {
@@ -240,6 +308,9 @@ void Core::loadData(const std::shared_ptr<Instruction>& instruction) {
   for (const auto& response : dataMemory_.getCompletedReads()) {
     instruction->supplyData(response.target.address, response.data);
   }
+  // Several loads may execute in a cycle; don't supply these responses to the
+  // next
+  dataMemory_.clearCompletedReads();
 
   assert(instruction->hasAllData() &&
          "Load instruction failed to obtain all data this cycle");
@@ -267,43 +338,143 @@ void Core::storeData(const std::shared_ptr<Instruction>& instruction) {
   }
 }
 
-void Core::forwardOperands(const span<Register>& registers,
-                           const span<RegisterValue>& values) {
-  assert(registers.size() == values.size() &&
-         "Mismatched register and value vector sizes");
-
-  const auto& uop = decodeToExecuteBuffer_.getTailSlots()[0];
-  if (uop == nullptr) {
-    return;
-  }
-
-  auto sourceRegisters = uop->getSourceRegisters();
-  for (size_t i = 0; i < registers.size(); i++) {
-    // Check each forwarded register vs source operands and supply for each
-    // match
-    for (size_t operand = 0; operand < sourceRegisters.size(); operand++) {
-      const auto& sourceReg = sourceRegisters[operand];
-      if (uop->canExecute()) {
-        return;
+void Core::issue() {
+  // Execution units are ticked immediately after issue
+  executeCycle_++;
+  decodeToIssueBuffer_.stall(false);
+
+  auto* slots = decodeToIssueBuffer_.getHeadSlots();
+  bool available = false;
+  uint16_t issued = 0;
+  for (size_t slot = 0; slot < decodeToIssueBuffer_.getWidth(); slot++) {
+    auto& uop = slots[slot];
+    if (uop == nullptr) continue;
+    available = true;
+
+    if (uop->exceptionEncountered()) {
+      // Exception encountered during decode; raise it once all older
+      // instructions have executed
+      if (inFlight_.empty()) {
+        raiseException(uop);
+        uop = nullptr;
+      } else {
+        decodeToIssueBuffer_.stall(true);
       }
-      if (sourceReg == registers[i] && !uop->isOperandReady(operand)) {
-        // Supply the operand
-        uop->supplyOperand(operand, values[i]);
+      break;
+    }
+
+    // Stall until every source operand has been produced
+    bool ready = true;
+    const auto& sourceRegisters = uop->getSourceRegisters();
+    for (size_t i = 0; i < sourceRegisters.size(); i++) {
+      if (uop->isOperandReady(i)) continue;
+      const auto* entry = getScoreboardEntry(sourceRegisters[i]);
+      if (entry != nullptr && entry->pendingWrites > 0) {
+        if (entry->awaitingLoad) {
+          loadUseStalls_++;
+        } else {
+          dependencyStalls_++;
+        }
+        ready = false;
+        break;
       }
     }
+
+    uint16_t port;
+    if (!ready || !selectPort(uop, port)) {
+      decodeToIssueBuffer_.stall(true);
+      break;
+    }
+
+    readRegisters(uop);
+    for (const auto& reg : uop->getDestinationRegisters()) {
+      auto* entry = getScoreboardEntry(reg);
+      if (entry == nullptr) continue;
+      entry->pendingWrites++;
+      entry->awaitingLoad = uop->isLoad();
+    }
+
+    inFlight_.push_back(uop);
+    issuePorts_[port].getHeadSlots()[0] = std::move(uop);
+    uop = nullptr;
+    issued++;
   }
+
+  if (!available) frontendStalls_++;
+  if (issued > 1) multiIssueCycles_++;
 }
 
-void Core::readRegisters() {
-  if (decodeToExecuteBuffer_.isStalled()) {
-    return;
+bool Core::selectPort(const std::shared_ptr<Instruction>& uop,
+                      uint16_t& port) {
+  const PortMask supportedPorts = uop->getSupportedPorts();
+  assert(supportedPorts != 0 &&
+         "Attempted to issue an instruction without a supported port");
+
+  uint64_t latency = std::max<uint16_t>(uop->getLatency(), 1);
+  bool orderStalled = false;
+  bool found = false;
+  std::pair<uint64_t, uint16_t> completion;
+  for (PortMask remaining = supportedPorts; remaining != 0;
+       remaining &= remaining - 1) {
+    const uint16_t candidate = lowestPort(remaining);
+    bool blocking =
+        std::find(blockingGroups_[candidate].begin(),
+                  blockingGroups_[candidate].end(),
+                  uop->getGroup()) != blockingGroups_[candidate].end();
+    // The unit must have space to accept the instruction this cycle
+    if (issuePorts_[candidate].getHeadSlots()[0] != nullptr ||
+        executeCycle_ < portStallUntil_[candidate] ||
+        (blocking && executeCycle_ <= portBlockingUntil_[candidate])) {
+      continue;
+    }
+
+    // Units execute their instructions in the order received, so the
+    // instruction may wait behind those already in the unit
+    std::pair<uint64_t, uint16_t> candidateCompletion = {
+        std::max(executeCycle_ + latency - 1,
+                 portLastCompletion_[candidate] + 1),
+        candidate};
+    // Units are ticked in port order, so the instruction executes after every
+    // older instruction if it completes later, or at the same time on a later
+    // port
+    if (candidateCompletion <= lastCompletion_) {
+      orderStalled = true;
+      continue;
+    }
+
+    if (!found || candidateCompletion < completion) {
+      completion = candidateCompletion;
+      found = true;
+    }
   }
 
-  const auto& uop = decodeToExecuteBuffer_.getTailSlots()[0];
-  if (uop == nullptr) {
-    return;
+  if (!found) {
+    if (orderStalled) {
+      completionOrderStalls_++;
+    } else {
+      portBusyStalls_++;
+    }
+    return false;
+  }
+
+  port = completion.second;
+  portLastCompletion_[port] = completion.first;
+  if (std::find(blockingGroups_[port].begin(), blockingGroups_[port].end(),
+                uop->getGroup()) != blockingGroups_[port].end()) {
+    portBlockingUntil_[port] = completion.first;
+  } else {
+    // Mirror the stall the execution unit applies to multi-cycle operations
+    uint64_t stallCycles =
+        pipelined_[port] ? uop->getStallCycles() : uop->getLatency();
+    if (stallCycles > 1) {
+      portStallUntil_[port] = executeCycle_ + stallCycles - 1;
+    }
   }
+  lastCompletion_ = completion;
+  return true;
+}
 
+void Core::readRegisters(const std::shared_ptr<Instruction>& uop) {
   // Register read
   // Identify missing registers and supply values
   const auto& sourceRegisters = uop->getSourceRegisters();
@@ -315,6 +486,52 @@ void Core::readRegisters() {
   }
 }
 
+void Core::instructionExecuted() {
+  assert(!inFlight_.empty() &&
+         "Attempted to execute an instruction which wasn't issued");
+
+  for (const auto& reg : inFlight_.front()->getDestinationRegisters()) {
+    auto* entry = getScoreboardEntry(reg);
+    if (entry == nullptr) continue;
+    if (--entry->pendingWrites == 0) {
+      entry->awaitingLoad = false;
+    }
+  }
+  inFlight_.pop_front();
+}
+
+void Core::flushInFlight() {
+  for (auto& uop : inFlight_) {
+    uop->setFlushed();
+  }
+  inFlight_.clear();
+
+  // No issued instructions remain to write any register
+  for (auto& regFile : scoreboard_) {
+    std::fill(regFile.begin(), regFile.end(), ScoreboardEntry());
+  }
+
+  for (auto& unit : executionUnits_) {
+    unit.purgeFlushed();
+  }
+
+  // The units' pipelines are now empty, and any stalls caused by flushed
+  // instructions cleared
+  std::fill(portLastCompletion_.begin(), portLastCompletion_.end(),
+            executeCycle_);
+  std::fill(portStallUntil_.begin(), portStallUntil_.end(), 0);
+  std::fill(portBlockingUntil_.begin(), portBlockingUntil_.end(), 0);
+  lastCompletion_ = {executeCycle_, 0};
+}
+
+ScoreboardEntry* Core::getScoreboardEntry(const Register& reg) {
+  if (reg.type >= scoreboard_.size() ||
+      reg.tag >= scoreboard_[reg.type].size()) {
+    return nullptr;
+  }
+  return &scoreboard_[reg.type][reg.tag];
+}
+
 }  // namespace inorder
 }  // namespace models
 }  // namespace simeng
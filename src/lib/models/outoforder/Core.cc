@@ -6,6 +6,8 @@
 #include <sstream>
 #include <string>
 
+#include "simeng/pipeline/KonataWriter.hh"
+
 namespace simeng {
 namespace models {
 namespace outoforder {
@@ -18,8 +20,9 @@ Core::Core(memory::MemoryInterface& instructionMemory,
     : simeng::Core(dataMemory, isa, config::SimInfo::getPhysRegStruct()),
       physicalRegisterStructures_(config::SimInfo::getPhysRegStruct()),
       physicalRegisterQuantities_(config::SimInfo::getPhysRegQuantities()),
-      registerAliasTable_(config::SimInfo::getArchRegStruct(),
-                          physicalRegisterQuantities_),
+      registerAliasTable_(
+          config::SimInfo::getArchRegStruct(), physicalRegisterQuantities_,
+          config["Queue-Sizes"]["Rename-Checkpoints"].as<uint16_t>()),
       mappedRegisterFileSet_(registerFileSet_, registerAliasTable_),
       fetchToDecodeBuffer_(config["Pipeline-Widths"]["FrontEnd"].as<uint16_t>(),
                            {}),
@@ -28,10 +31,6 @@ Core::Core(memory::MemoryInterface& instructionMemory,
       renameToDispatchBuffer_(
           config["Pipeline-Widths"]["FrontEnd"].as<uint16_t>(), nullptr),
       issuePorts_(config["Execution-Units"].num_children(), {1, nullptr}),
-      completionSlots_(
-          config["Execution-Units"].num_children() +
-              config["Pipeline-Widths"]["LSQ-Completion"].as<uint16_t>(),
-          {1, nullptr}),
       fetchUnit_(fetchToDecodeBuffer_, instructionMemory, processMemorySize,
                  entryPoint, config["Fetch"]["Fetch-Block-Size"].as<uint16_t>(),
                  isa, branchPredictor),
@@ -39,10 +38,12 @@ Core::Core(memory::MemoryInterface& instructionMemory,
       renameUnit_(decodeToRenameBuffer_, renameToDispatchBuffer_,
                   reorderBuffer_, registerAliasTable_, loadStoreQueue_,
                   physicalRegisterStructures_.size()),
+      storeSetPredictor_(config),
       dispatchIssueUnit_(renameToDispatchBuffer_, issuePorts_, registerFileSet_,
-                         portAllocator, physicalRegisterQuantities_),
+                         portAllocator, storeSetPredictor_,
+                         physicalRegisterQuantities_),
       writebackUnit_(
-          completionSlots_, registerFileSet_,
+          completions_, registerFileSet_,
           [this](auto insnId) { reorderBuffer_.commitMicroOps(insnId); }),
       reorderBuffer_(
           config["Queue-Sizes"]["ROB"].as<uint32_t>(), registerAliasTable_,
@@ -51,13 +52,18 @@ Core::Core(memory::MemoryInterface& instructionMemory,
           [this](auto branchAddress) {
             fetchUnit_.registerLoopBoundary(branchAddress);
           },
-          branchPredictor, config["Fetch"]["Loop-Buffer-Size"].as<uint16_t>(),
-          config["Fetch"]["Loop-Detection-Threshold"].as<uint16_t>()),
+          branchPredictor, storeSetPredictor_,
+          config["Fetch"]["Loop-Buffer-Size"].as<uint16_t>(),
+          config["Fetch"]["Loop-Detection-Threshold"].as<uint16_t>(),
+          config["Commit-Trace"]["Path"].as<std::string>().empty()
+              ? nullptr
+              : std::function<void(const Instruction&)>(
+                    [this](const Instruction& uop) { traceCommit(uop); })),
       loadStoreQueue_(
           config["Queue-Sizes"]["Load"].as<uint32_t>(),
           config["Queue-Sizes"]["Store"].as<uint32_t>(), dataMemory,
-          {completionSlots_.data() + config["Execution-Units"].num_children(),
-           config["Pipeline-Widths"]["LSQ-Completion"].as<uint16_t>()},
+          completions_,
+          config["Pipeline-Widths"]["LSQ-Completion"].as<uint16_t>(),
           [this](auto regs, auto values) {
             dispatchIssueUnit_.forwardOperands(regs, values);
           },
@@ -70,7 +76,9 @@ Core::Core(memory::MemoryInterface& instructionMemory,
           config["LSQ-L1-Interface"]["Permitted-Loads-Per-Cycle"]
               .as<uint16_t>(),
           config["LSQ-L1-Interface"]["Permitted-Stores-Per-Cycle"]
-              .as<uint16_t>()),
+              .as<uint16_t>(),
+          config["Memory-Dependence-Predictor"]["Type"].as<std::string>() !=
+              "None"),
       portAllocator_(portAllocator),
       commitWidth_(config["Pipeline-Widths"]["Commit"].as<uint16_t>()) {
   for (size_t i = 0; i < config["Execution-Units"].num_children(); i++) {
@@ -81,15 +89,35 @@ Core::Core(memory::MemoryInterface& instructionMemory,
       blockingGroups.push_back(grp.as<uint16_t>());
     }
     executionUnits_.emplace_back(
-        issuePorts_[i], completionSlots_[i],
+        issuePorts_[i], completions_,
         [this](auto regs, auto values) {
           dispatchIssueUnit_.forwardOperands(regs, values);
         },
-        [this](auto uop) { loadStoreQueue_.startLoad(uop); },
+        [this](auto uop) {
+          bool forwarded = loadStoreQueue_.startLoad(uop);
+          dispatchIssueUnit_.loadStarted(uop, forwarded);
+        },
         [this](auto uop) { loadStoreQueue_.supplyStoreData(uop); },
         [](auto uop) { uop->setCommitReady(); }, branchPredictor,
         config["Execution-Units"][i]["Pipelined"].as<bool>(), blockingGroups);
   }
+  std::string commitTracePath =
+      config["Commit-Trace"]["Path"].as<std::string>();
+  if (!commitTracePath.empty()) {
+    if (config["Commit-Trace"]["Format"].as<std::string>() == "Konata") {
+      commitTrace_ = std::make_unique<pipeline::KonataWriter>(commitTracePath);
+    } else {
+      commitTrace_ =
+          std::make_unique<pipeline::CommitTraceWriter>(commitTracePath);
+    }
+    traceStartCycle_ = config["Commit-Trace"]["Start-Cycle"].as<uint64_t>();
+    traceEndCycle_ = config["Commit-Trace"]["End-Cycle"].as<uint64_t>();
+    traceStartInstruction_ =
+        config["Commit-Trace"]["Start-Instruction"].as<uint64_t>();
+    traceInstructionCount_ =
+        config["Commit-Trace"]["Instruction-Count"].as<uint64_t>();
+  }
+
   // Provide reservation size getter to A64FX port allocator
   portAllocator.setRSSizeGetter([this](std::vector<uint32_t>& sizeVec) {
     dispatchIssueUnit_.getRSSizes(sizeVec);
@@ -114,6 +142,15 @@ void Core::tick() {
   // Tick port allocators internal functionality at start of cycle
   portAllocator_.tick();
 
+  // Tick the memory dependence predictor to age out learnt dependences
+  storeSetPredictor_.tick();
+
+  // Only record the stages of uops whilst those fetched within the traced
+  // window may be in flight
+  const bool tracing =
+      commitTrace_ && !traceFinished_ && ticks_ >= traceStartCycle_;
+  if (tracing) recordCompletions();
+
   // Writeback must be ticked at start of cycle, to ensure decode reads the
   // correct values
   writebackUnit_.tick();
@@ -133,6 +170,8 @@ void Core::tick() {
   // Late tick for the dispatch/issue unit to issue newly ready uops
   dispatchIssueUnit_.issue();
 
+  if (tracing) recordStageOutputs();
+
   // Tick buffers
   // Each unit must have wiped the entries at the head of the buffer after use,
   // as these will now loop around and become the tail.
@@ -142,9 +181,7 @@ void Core::tick() {
   for (auto& issuePort : issuePorts_) {
     issuePort.tick();
   }
-  for (auto& completionSlot : completionSlots_) {
-    completionSlot.tick();
-  }
+  completions_.tick();
 
   // Commit instructions from ROB
   reorderBuffer_.commit(commitWidth_);
@@ -194,6 +231,37 @@ bool Core::hasHalted() const {
   return true;
 }
 
+bool Core::isWaitingOnMemory() const {
+  if (hasHalted_ || !dataMemory_.hasPendingRequests()) return false;
+
+  // The exception handler waits for all memory requests to complete
+  if (exceptionHandler_ != nullptr) return true;
+
+  // With the ROB full no further instructions can be renamed, so only those
+  // already in flight may issue memory requests
+  if (reorderBuffer_.getFreeSpace() > 0 || reorderBuffer_.isHeadCommitReady()) {
+    return false;
+  }
+
+  auto bufferEmpty = [](const auto& buffer) {
+    auto slots = buffer.getHeadSlots();
+    for (size_t slot = 0; slot < buffer.getWidth(); slot++) {
+      if (slots[slot] != nullptr) return false;
+    }
+    return true;
+  };
+  if (!bufferEmpty(renameToDispatchBuffer_)) return false;
+  for (const auto& issuePort : issuePorts_) {
+    if (!bufferEmpty(issuePort)) return false;
+  }
+  for (const auto& eu : executionUnits_) {
+    if (!eu.isEmpty()) return false;
+  }
+
+  return !dispatchIssueUnit_.hasReadyUops() && completions_.empty() &&
+         !loadStoreQueue_.hasQueuedWork();
+}
+
 const ArchitecturalRegisterFileSet& Core::getArchitecturalRegisterFileSet()
     const {
   return mappedRegisterFileSet_;
@@ -211,6 +279,16 @@ std::map<std::string, std::string> Core::getStats() const {
 
   auto branchStalls = fetchUnit_.getBranchStalls();
 
+  auto loopBufferSupplies = fetchUnit_.getLoopBufferSupplies();
+  auto macroOpsFetched = fetchUnit_.getMacroOpsFetched();
+  // Report a rate of 0 rather than NaN if nothing has been fetched yet
+  auto loopBufferHitRate =
+      macroOpsFetched == 0 ? 0.0f
+                           : 100.0f * static_cast<float>(loopBufferSupplies) /
+                                 static_cast<float>(macroOpsFetched);
+  std::ostringstream loopBufferHitRateStr;
+  loopBufferHitRateStr << std::setprecision(3) << loopBufferHitRate << "%";
+
   auto earlyFlushes = decodeUnit_.getEarlyFlushes();
 
   auto allocationStalls = renameUnit_.getAllocationStalls();
@@ -222,6 +300,8 @@ std::map<std::string, std::string> Core::getStats() const {
   auto frontendStalls = dispatchIssueUnit_.getFrontendStalls();
   auto backendStalls = dispatchIssueUnit_.getBackendStalls();
   auto portBusyStalls = dispatchIssueUnit_.getPortBusyStalls();
+  auto loadsDelayed = dispatchIssueUnit_.getLoadsDelayed();
+  auto violationsAvoided = dispatchIssueUnit_.getViolationsAvoided();
 
   uint64_t totalBranchesExecuted = 0;
   uint64_t totalBranchMispredicts = 0;
@@ -241,12 +321,15 @@ std::map<std::string, std::string> Core::getStats() const {
           {"ipc", ipcStr.str()},
           {"flushes", std::to_string(flushes_)},
           {"fetch.branchStalls", std::to_string(branchStalls)},
+          {"fetch.loopBufferSupplies", std::to_string(loopBufferSupplies)},
+          {"fetch.loopBufferHitRate", loopBufferHitRateStr.str()},
           {"decode.earlyFlushes", std::to_string(earlyFlushes)},
           {"rename.allocationStalls", std::to_string(allocationStalls)},
           {"rename.robStalls", std::to_string(robStalls)},
           {"rename.lqStalls", std::to_string(lqStalls)},
           {"rename.sqStalls", std::to_string(sqStalls)},
           {"dispatch.rsStalls", std::to_string(rsStalls)},
+          {"dispatch.loadsDelayed", std::to_string(loadsDelayed)},
           {"issue.frontendStalls", std::to_string(frontendStalls)},
           {"issue.backendStalls", std::to_string(backendStalls)},
           {"issue.portBusyStalls", std::to_string(portBusyStalls)},
@@ -254,7 +337,8 @@ std::map<std::string, std::string> Core::getStats() const {
           {"branch.mispredict", std::to_string(totalBranchMispredicts)},
           {"branch.missrate", branchMissRateStr.str()},
           {"lsq.loadViolations",
-           std::to_string(reorderBuffer_.getViolatingLoadsCount())}};
+           std::to_string(reorderBuffer_.getViolatingLoadsCount())},
+          {"lsq.violationsAvoided", std::to_string(violationsAvoided)}};
 }
 
 void Core::raiseException(const std::shared_ptr<Instruction>& instruction) {
@@ -378,6 +462,72 @@ void Core::flushIfNeeded() {
   }
 }
 
+void Core::recordCompletions() {
+  // Uops not written back this cycle remain due, so only record the first
+  // cycle each was due
+  for (const auto& uop : completions_.getDueEvents()) {
+    if (uop->getCompleteCycle() == 0) uop->setCompleteCycle(ticks_);
+  }
+}
+
+void Core::recordStageOutputs() {
+  // Entries held in a stalled buffer's tail remain from an earlier cycle, so
+  // only record the first cycle each uop was output. Uops fetched after the
+  // window are left unrecorded, and so aren't traced.
+  if (traceEndCycle_ == 0 || ticks_ <= traceEndCycle_) {
+    auto fetchSlots = fetchToDecodeBuffer_.getTailSlots();
+    for (size_t slot = 0; slot < fetchToDecodeBuffer_.getWidth(); slot++) {
+      for (const auto& uop : fetchSlots[slot]) {
+        if (uop->getFetchCycle() == 0) uop->setFetchCycle(ticks_);
+      }
+    }
+  }
+  auto decodeSlots = decodeToRenameBuffer_.getTailSlots();
+  for (size_t slot = 0; slot < decodeToRenameBuffer_.getWidth(); slot++) {
+    const auto& uop = decodeSlots[slot];
+    if (uop != nullptr && uop->getDecodeCycle() == 0) {
+      uop->setDecodeCycle(ticks_);
+    }
+  }
+  auto renameSlots = renameToDispatchBuffer_.getTailSlots();
+  for (size_t slot = 0; slot < renameToDispatchBuffer_.getWidth(); slot++) {
+    const auto& uop = renameSlots[slot];
+    if (uop != nullptr && uop->getRenameCycle() == 0) {
+      uop->setRenameCycle(ticks_);
+    }
+  }
+  for (auto& issuePort : issuePorts_) {
+    const auto& uop = issuePort.getTailSlots()[0];
+    if (uop != nullptr && uop->getIssueCycle() == 0) {
+      uop->setIssueCycle(ticks_);
+    }
+  }
+}
+
+void Core::traceCommit(const Instruction& uop) {
+  // Uops fetched outside the window of cycles have no fetch cycle recorded.
+  // As uops commit in program order, those fetched within the window commit
+  // together; once a later uop commits, none remain in flight.
+  if (uop.getFetchCycle() == 0) {
+    if (traceEntered_ && traceEndCycle_ != 0 && ticks_ > traceEndCycle_) {
+      traceFinished_ = true;
+    }
+    return;
+  }
+  traceEntered_ = true;
+
+  // The committed instruction count already includes that of a final uop
+  uint64_t instruction = reorderBuffer_.getInstructionsCommittedCount() -
+                         (uop.isLastMicroOp() ? 1 : 0);
+  if (instruction < traceStartInstruction_) return;
+  if (traceInstructionCount_ != 0 &&
+      instruction >= traceStartInstruction_ + traceInstructionCount_) {
+    traceFinished_ = true;
+    return;
+  }
+  commitTrace_->record(uop, ticks_);
+}
+
 }  // namespace outoforder
 }  // namespace models
 }  // namespace simeng
@@ -10,10 +10,11 @@ namespace pipeline {
 A64FXPortAllocator::A64FXPortAllocator(
     const std::vector<std::vector<uint16_t>>& portArrangement)
     :  // Initialise reservation station to port mapping
-      rsToPort_({{0, 1, 2}, {3, 4}, {5}, {6}, {7}}) {}
+      rsToPort_({toPortMask({0, 1, 2}), toPortMask({3, 4}), toPortMask({5}),
+                 toPortMask({6}), toPortMask({7})}) {}
 
-uint16_t A64FXPortAllocator::allocate(const std::vector<uint16_t>& ports) {
-  assert(ports.size() &&
+uint16_t A64FXPortAllocator::allocate(PortMask ports) {
+  assert(ports != 0 &&
          "No supported ports supplied; cannot allocate from a empty set");
   const uint8_t attribute = attributeMapping(ports);
 
@@ -133,13 +134,11 @@ uint16_t A64FXPortAllocator::allocate(const std::vector<uint16_t>& ports) {
   assert(foundRS && "Unsupported group; cannot allocate reservation station");
   dispatchSlot_++;
 
-  for (auto option : ports) {
-    if (std::find(rsToPort_[rs].begin(), rsToPort_[rs].end(), option) !=
-        rsToPort_[rs].end()) {
-      port = option;
-      foundPort = true;
-      break;
-    }
+  // Take the lowest-indexed supplied port belonging to the reservation station
+  const PortMask options = ports & rsToPort_[rs];
+  if (options != 0) {
+    port = lowestPort(options);
+    foundPort = true;
   }
 
   assert(foundPort && "Unsupported group; cannot allocate a port");
@@ -150,8 +149,7 @@ void A64FXPortAllocator::issued(uint16_t port) {}
 
 void A64FXPortAllocator::deallocate(uint16_t port) { issued(port); }
 
-uint8_t A64FXPortAllocator::attributeMapping(
-    const std::vector<uint16_t>& ports) {
+uint8_t A64FXPortAllocator::attributeMapping(PortMask ports) {
   uint8_t attribute = 0;
   // Only used in assertion so produces warning in release mode
   [[maybe_unused]] bool foundAttribute = false;
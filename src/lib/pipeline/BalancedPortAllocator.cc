@@ -7,33 +7,37 @@ namespace pipeline {
 
 BalancedPortAllocator::BalancedPortAllocator(
     const std::vector<std::vector<uint16_t>>& portArrangement)
-    : weights(portArrangement.size(), 0) {}
+    : weights(portArrangement.size(), 0),
+      idlePorts_(portArrangement.size() < MAX_PORTS
+                     ? portBit(portArrangement.size()) - 1
+                     : ~PortMask(0)) {
+  assert(portArrangement.size() <= MAX_PORTS &&
+         "More ports supplied than a PortMask can represent");
+}
 
-uint16_t BalancedPortAllocator::allocate(const std::vector<uint16_t>& ports) {
-  assert(ports.size() &&
+uint16_t BalancedPortAllocator::allocate(PortMask ports) {
+  assert(ports != 0 &&
          "No supported ports supplied; cannot allocate from a empty set");
-  bool foundPort = false;
-  uint16_t bestWeight = 0xFFFF;
-  uint16_t bestPort = 0;
-  for (const auto& portIndex : ports) {
+  uint16_t bestPort;
+  PortMask idle = ports & idlePorts_;
+  if (idle != 0) {
+    bestPort = lowestPort(idle);
+  } else {
     // Search for the lowest-weighted port available
-    if (!foundPort || weights[portIndex] < bestWeight) {
-      foundPort = true;
-      bestWeight = weights[portIndex];
-      bestPort = portIndex;
-    }
+    bestPort = lowestPort(ports);
+    forEachPort(ports & (ports - 1), [&](uint16_t port) {
+      if (weights[port] < weights[bestPort]) bestPort = port;
+    });
   }
 
-  assert(foundPort && "Unsupported group; cannot allocate a port");
-
   // Increment the weight of the allocated port
-  weights[bestPort]++;
+  if (weights[bestPort]++ == 0) idlePorts_ &= ~portBit(bestPort);
   return bestPort;
 }
 
 void BalancedPortAllocator::issued(uint16_t port) {
   assert(weights[port] > 0);
-  weights[port]--;
+  if (--weights[port] == 0) idlePorts_ |= portBit(port);
 }
 void BalancedPortAllocator::deallocate(uint16_t port) { issued(port); }
 
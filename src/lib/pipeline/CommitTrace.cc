@@ -0,0 +1,218 @@
+#include "simeng/pipeline/CommitTrace.hh"
+
+#include <cstring>
+#include <iostream>
+
+namespace simeng {
+namespace pipeline {
+
+/** The magic number at the start of every commit trace file. */
+static const char COMMIT_TRACE_MAGIC[8] = {'S', 'E', 'C', 'O',
+                                           'M', 'M', 'I', 'T'};
+
+/** The version of the commit trace file format. Must be incremented whenever
+ * the encoding of a record changes. */
+static const uint8_t COMMIT_TRACE_VERSION = 2;
+
+/** The number of filled blocks which may await the background thread before
+ * the simulation waits for it. */
+static const size_t MAX_QUEUED_BLOCKS = 8;
+
+CommitTraceWriter::CommitTraceWriter(const std::string& path, size_t blockSize)
+    : path_(path),
+      file_(path, std::ios::binary | std::ios::trunc),
+      blockSize_(blockSize) {
+  if (!file_.is_open()) {
+    std::cerr << "[SimEng:CommitTraceWriter] Could not open commit trace '"
+              << path << "'" << std::endl;
+    return;
+  }
+  file_.write(COMMIT_TRACE_MAGIC, sizeof(COMMIT_TRACE_MAGIC));
+  file_.put(static_cast<char>(COMMIT_TRACE_VERSION));
+
+  active_.reserve(blockSize_);
+  thread_ = std::thread([this]() { writeBlocks(); });
+}
+
+CommitTraceWriter::~CommitTraceWriter() {
+  if (!isOpen()) return;
+  submitBlock();
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    closing_ = true;
+  }
+  changed_.notify_all();
+  thread_.join();
+}
+
+bool CommitTraceWriter::isOpen() const { return thread_.joinable(); }
+
+void CommitTraceWriter::record(const Instruction& uop, uint64_t commitCycle) {
+  if (!isOpen()) return;
+
+  putUnsigned(uop.getSequenceId() - lastSequenceId_);
+  putUnsigned(uop.getInstructionId() - lastInstructionId_);
+  putSigned(uop.getInstructionAddress() - lastAddress_);
+  putUnsigned(uop.getOpcode());
+  putUnsigned(commitCycle - lastCommitCycle_);
+  putStageCycle(uop.getFetchCycle(), commitCycle);
+  putStageCycle(uop.getDecodeCycle(), commitCycle);
+  putStageCycle(uop.getRenameCycle(), commitCycle);
+  putStageCycle(uop.getIssueCycle(), commitCycle);
+  putStageCycle(uop.getCompleteCycle(), commitCycle);
+  lastSequenceId_ = uop.getSequenceId();
+  lastInstructionId_ = uop.getInstructionId();
+  lastAddress_ = uop.getInstructionAddress();
+  lastCommitCycle_ = commitCycle;
+
+  for (const auto& registers :
+       {uop.getSourceRegisters(), uop.getDestinationRegisters()}) {
+    putUnsigned(registers.size());
+    for (const auto& reg : registers) {
+      putUnsigned(reg.type);
+      putUnsigned(reg.tag);
+    }
+  }
+
+  const auto& accesses = uop.getGeneratedAddresses();
+  putUnsigned(accesses.size());
+  for (const auto& access : accesses) {
+    putSigned(access.address - lastMemoryAddress_);
+    putUnsigned(access.size);
+    lastMemoryAddress_ = access.address;
+  }
+
+  if (active_.size() >= blockSize_) submitBlock();
+}
+
+void CommitTraceWriter::putUnsigned(uint64_t value) {
+  while (value >= 0x80) {
+    active_.push_back(static_cast<uint8_t>(value | 0x80));
+    value >>= 7;
+  }
+  active_.push_back(static_cast<uint8_t>(value));
+}
+
+void CommitTraceWriter::putSigned(int64_t value) {
+  putUnsigned((static_cast<uint64_t>(value) << 1) ^
+              static_cast<uint64_t>(value >> 63));
+}
+
+void CommitTraceWriter::putStageCycle(uint64_t cycle, uint64_t commitCycle) {
+  // Stages are held as the number of cycles before commit, offset by one such
+  // that 0 denotes a stage which wasn't recorded
+  putUnsigned(cycle == 0 ? 0 : commitCycle - cycle + 1);
+}
+
+void CommitTraceWriter::submitBlock() {
+  if (active_.empty()) return;
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  changed_.wait(lock, [this]() { return queued_.size() < MAX_QUEUED_BLOCKS; });
+  queued_.push_back(std::move(active_));
+  if (spare_.empty()) {
+    active_ = std::vector<uint8_t>();
+    active_.reserve(blockSize_);
+  } else {
+    active_ = std::move(spare_.back());
+    spare_.pop_back();
+  }
+  lock.unlock();
+  changed_.notify_all();
+}
+
+void CommitTraceWriter::writeBlocks() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    changed_.wait(lock, [this]() { return closing_ || !queued_.empty(); });
+    if (queued_.empty()) break;
+
+    std::vector<uint8_t> block = std::move(queued_.front());
+    queued_.pop_front();
+    lock.unlock();
+    changed_.notify_all();
+
+    // Once a write has failed, discard the remaining blocks rather than
+    // stalling the simulation; the error is reported once the file closes
+    if (file_) {
+      file_.write(reinterpret_cast<const char*>(block.data()), block.size());
+    }
+    block.clear();
+
+    lock.lock();
+    spare_.push_back(std::move(block));
+  }
+  file_.close();
+  if (!file_) {
+    std::cerr << "[SimEng:CommitTraceWriter] Could not write commit trace '"
+              << path_ << "'" << std::endl;
+  }
+}
+
+CommitTraceReader::CommitTraceReader(const std::string& path)
+    : file_(path, std::ios::binary) {
+  char magic[sizeof(COMMIT_TRACE_MAGIC)];
+  if (!file_.read(magic, sizeof(magic))) return;
+  valid_ = std::memcmp(magic, COMMIT_TRACE_MAGIC, sizeof(magic)) == 0 &&
+           file_.get() == COMMIT_TRACE_VERSION;
+}
+
+bool CommitTraceReader::isValid() const { return valid_; }
+
+bool CommitTraceReader::next(CommitRecord& record) {
+  if (!valid_ || file_.peek() == std::ifstream::traits_type::eof()) {
+    return false;
+  }
+
+  record.sequenceId = lastSequenceId_ += getUnsigned();
+  record.instructionId = lastInstructionId_ += getUnsigned();
+  record.address = lastAddress_ += getSigned();
+  record.opcode = getUnsigned();
+  record.commitCycle = lastCommitCycle_ += getUnsigned();
+  record.fetchCycle = getStageCycle(record.commitCycle);
+  record.decodeCycle = getStageCycle(record.commitCycle);
+  record.renameCycle = getStageCycle(record.commitCycle);
+  record.issueCycle = getStageCycle(record.commitCycle);
+  record.completeCycle = getStageCycle(record.commitCycle);
+
+  for (auto* registers :
+       {&record.sourceRegisters, &record.destinationRegisters}) {
+    registers->resize(getUnsigned());
+    for (auto& reg : *registers) {
+      reg.type = getUnsigned();
+      reg.tag = getUnsigned();
+    }
+  }
+
+  record.memoryAccesses.resize(getUnsigned());
+  for (auto& access : record.memoryAccesses) {
+    access.address = lastMemoryAddress_ += getSigned();
+    access.size = getUnsigned();
+  }
+
+  return static_cast<bool>(file_);
+}
+
+uint64_t CommitTraceReader::getUnsigned() {
+  uint64_t value = 0;
+  for (int shift = 0; shift < 64; shift += 7) {
+    int byte = file_.get();
+    if (byte == std::ifstream::traits_type::eof()) break;
+    value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+    if (!(byte & 0x80)) break;
+  }
+  return value;
+}
+
+int64_t CommitTraceReader::getSigned() {
+  uint64_t value = getUnsigned();
+  return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+uint64_t CommitTraceReader::getStageCycle(uint64_t commitCycle) {
+  uint64_t offset = getUnsigned();
+  return offset == 0 ? 0 : commitCycle - offset + 1;
+}
+
+}  // namespace pipeline
+}  // namespace simeng
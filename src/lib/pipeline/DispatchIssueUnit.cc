@@ -10,6 +10,7 @@ DispatchIssueUnit::DispatchIssueUnit(
     PipelineBuffer<std::shared_ptr<Instruction>>& fromRename,
     std::vector<PipelineBuffer<std::shared_ptr<Instruction>>>& issuePorts,
     const RegisterFileSet& registerFileSet, PortAllocator& portAllocator,
+    StoreSetPredictor& storeSetPredictor,
     const std::vector<uint16_t>& physicalRegisterStructure,
     ryml::ConstNodeRef config)
     : input_(fromRename),
@@ -17,7 +18,8 @@ DispatchIssueUnit::DispatchIssueUnit(
       registerFileSet_(registerFileSet),
       scoreboard_(physicalRegisterStructure.size()),
       dependencyMatrix_(physicalRegisterStructure.size()),
-      portAllocator_(portAllocator) {
+      portAllocator_(portAllocator),
+      storeSetPredictor_(storeSetPredictor) {
   // Initialise scoreboard
   for (size_t type = 0; type < physicalRegisterStructure.size(); type++) {
     scoreboard_[type].assign(physicalRegisterStructure[type], true);
@@ -67,7 +69,7 @@ void DispatchIssueUnit::tick() {
       continue;
     }
 
-    const std::vector<uint16_t>& supportedPorts = uop->getSupportedPorts();
+    PortMask supportedPorts = uop->getSupportedPorts();
     if (uop->exceptionEncountered()) {
       // Exception; mark as ready to commit, and remove from pipeline
       uop->setCommitReady();
@@ -121,6 +123,24 @@ void DispatchIssueUnit::tick() {
       scoreboard_[reg.type][reg.tag] = false;
     }
 
+    // Hold back loads predicted to depend on an earlier store until that store
+    // has issued
+    if (storeSetPredictor_.isEnabled()) {
+      if (uop->isLoad()) {
+        auto store = storeSetPredictor_.getPredictedStore(uop);
+        if (store != nullptr) {
+          memoryDependents_[store->getSequenceId()].push_back({uop, port});
+          awaitingStore_.insert(uop->getSequenceId());
+          delayedLoads_.emplace(uop->getSequenceId(), uop);
+          loadsDelayed_++;
+          ready = false;
+        }
+      }
+      if (uop->isStoreAddress()) {
+        storeSetPredictor_.storeDispatched(uop);
+      }
+    }
+
     // Increment dispatches made and RS occupied entries size
     dispatches_[RS_Index]++;
     rs.currentSize++;
@@ -149,6 +169,8 @@ void DispatchIssueUnit::issue() {
 
     if (queue.size() > 0) {
       auto& uop = queue.front();
+      if (storeSetPredictor_.isEnabled() && uop->isStoreAddress())
+        issuedStores_.push_back(uop);
       issuePorts_[i].getTailSlots()[0] = std::move(uop);
       queue.pop_front();
 
@@ -161,6 +183,14 @@ void DispatchIssueUnit::issue() {
     }
   }
 
+  // Release any loads held on the stores issued this cycle. Done after all
+  // ports have issued so that a released load can't issue alongside its store
+  for (const auto& store : issuedStores_) {
+    storeSetPredictor_.storeIssued(store);
+    releaseMemoryDependents(store->getSequenceId());
+  }
+  issuedStores_.clear();
+
   if (issued == 0) {
     for (const auto& rs : reservationStations_) {
       if (rs.currentSize != 0) {
@@ -186,7 +216,8 @@ void DispatchIssueUnit::forwardOperands(const span<Register>& registers,
     auto& dependents = dependencyMatrix_[reg.type][reg.tag];
     for (auto& entry : dependents) {
       entry.uop->supplyOperand(entry.operandIndex, values[i]);
-      if (entry.uop->canExecute()) {
+      if (entry.uop->canExecute() &&
+          !awaitingStore_.count(entry.uop->getSequenceId())) {
         // Add the now-ready instruction to the relevant ready queue
         auto rsInfo = portMapping_[entry.port];
         reservationStations_[rsInfo.first].ports[rsInfo.second].ready.push_back(
@@ -241,6 +272,40 @@ void DispatchIssueUnit::purgeFlushed() {
     }
   }
 
+  // Remove flushed loads held on a predicted memory dependence
+  auto itStore = memoryDependents_.begin();
+  while (itStore != memoryDependents_.end()) {
+    auto& dependents = itStore->second;
+    auto it = dependents.begin();
+    while (it != dependents.end()) {
+      auto& entry = *it;
+      if (entry.uop->isFlushed()) {
+        auto rsIndex = portMapping_[entry.port].first;
+        if (!flushed_[rsIndex].count(entry.uop)) {
+          flushed_[rsIndex].insert(entry.uop);
+          portAllocator_.deallocate(entry.port);
+        }
+        awaitingStore_.erase(entry.uop->getSequenceId());
+        it = dependents.erase(it);
+      } else {
+        it++;
+      }
+    }
+    if (dependents.empty()) {
+      itStore = memoryDependents_.erase(itStore);
+    } else {
+      itStore++;
+    }
+  }
+  auto itLoad = delayedLoads_.begin();
+  while (itLoad != delayedLoads_.end()) {
+    if (itLoad->second->isFlushed()) {
+      itLoad = delayedLoads_.erase(itLoad);
+    } else {
+      itLoad++;
+    }
+  }
+
   // Update reservation station size
   for (uint8_t i = 0; i < reservationStations_.size(); i++) {
     assert(reservationStations_[i].currentSize >= flushed_[i].size());
@@ -248,6 +313,38 @@ void DispatchIssueUnit::purgeFlushed() {
   }
 }
 
+void DispatchIssueUnit::loadStarted(const std::shared_ptr<Instruction>& load,
+                                    bool forwarded) {
+  if (delayedLoads_.erase(load->getSequenceId()) && forwarded) {
+    violationsAvoided_++;
+  }
+}
+
+void DispatchIssueUnit::releaseMemoryDependents(uint64_t storeSeqId) {
+  auto itStore = memoryDependents_.find(storeSeqId);
+  if (itStore == memoryDependents_.end()) return;
+
+  for (auto& entry : itStore->second) {
+    awaitingStore_.erase(entry.uop->getSequenceId());
+    // Loads still waiting on operands are made ready by forwardOperands
+    if (entry.uop->canExecute()) {
+      auto rsInfo = portMapping_[entry.port];
+      reservationStations_[rsInfo.first].ports[rsInfo.second].ready.push_back(
+          std::move(entry.uop));
+    }
+  }
+  memoryDependents_.erase(itStore);
+}
+
+bool DispatchIssueUnit::hasReadyUops() const {
+  for (const auto& rs : reservationStations_) {
+    for (const auto& port : rs.ports) {
+      if (port.ready.size() > 0) return true;
+    }
+  }
+  return false;
+}
+
 uint64_t DispatchIssueUnit::getRSStalls() const { return rsStalls_; }
 uint64_t DispatchIssueUnit::getFrontendStalls() const {
   return frontendStalls_;
@@ -263,5 +360,10 @@ void DispatchIssueUnit::getRSSizes(std::vector<uint32_t>& sizes) const {
   }
 }
 
+uint64_t DispatchIssueUnit::getLoadsDelayed() const { return loadsDelayed_; }
+uint64_t DispatchIssueUnit::getViolationsAvoided() const {
+  return violationsAvoided_;
+}
+
 }  // namespace pipeline
 }  // namespace simeng
@@ -8,7 +8,7 @@ namespace pipeline {
 
 ExecuteUnit::ExecuteUnit(
     PipelineBuffer<std::shared_ptr<Instruction>>& input,
-    PipelineBuffer<std::shared_ptr<Instruction>>& output,
+    TimingWheel<std::shared_ptr<Instruction>>& output,
     std::function<void(span<Register>, span<RegisterValue>)> forwardOperands,
     std::function<void(const std::shared_ptr<Instruction>&)> handleLoad,
     std::function<void(const std::shared_ptr<Instruction>&)> handleStore,
@@ -160,7 +160,7 @@ void ExecuteUnit::execute(std::shared_ptr<Instruction>& uop) {
   // Operand forwarding; allows a dependent uop to execute next cycle
   forwardOperands_(uop->getDestinationRegisters(), uop->getResults());
 
-  output_.getTailSlots()[0] = std::move(uop);
+  output_.schedule(std::move(uop), 1);
 }
 
 bool ExecuteUnit::shouldFlush() const { return shouldFlush_; }
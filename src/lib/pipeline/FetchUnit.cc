@@ -38,25 +38,19 @@ void FetchUnit::tick() {
     auto outputSlots = output_.getTailSlots();
     for (size_t slot = 0; slot < output_.getWidth(); slot++) {
       auto& macroOp = outputSlots[slot];
-      auto bytesRead = isa_.predecode(
-          reinterpret_cast<const uint8_t*>(&(loopBuffer_.front().encoding)),
-          loopBuffer_.front().instructionSize, loopBuffer_.front().address,
-          macroOp);
-
-      if (bytesRead == 0) {
-        std::cout << "[SimEng:FetchUnit] Predecode returned 0 bytes while loop "
-                     "buffer supplying"
-                  << std::endl;
-        exit(1);
-      }
+      const auto& entry = loopBuffer_.front();
 
-      // Set prediction to recorded value during loop buffer filling
-      if (macroOp[0]->isBranch()) {
-        macroOp[0]->setBranchPrediction(loopBuffer_.front().prediction);
+      // Supply fresh instances of the recorded micro-ops, which already hold
+      // the branch prediction made during loop buffer filling
+      macroOp.resize(entry.macroOp.size());
+      for (size_t uop = 0; uop < entry.macroOp.size(); uop++) {
+        macroOp[uop] = entry.macroOp[uop]->clone();
       }
+      macroOpsFetched_++;
+      loopBufferSupplies_++;
 
       // Cycle queue by moving front entry to back
-      loopBuffer_.push_back(loopBuffer_.front());
+      loopBuffer_.push_back(std::move(loopBuffer_.front()));
       loopBuffer_.pop_front();
     }
     return;
@@ -150,12 +144,17 @@ void FetchUnit::tick() {
       macroOp[0]->setBranchPrediction(prediction);
     }
 
+    macroOpsFetched_++;
+
     if (loopBufferState_ == LoopBufferState::FILLING) {
-      // Record instruction fetch information in loop body
-      uint32_t encoding;
-      memcpy(&encoding, buffer + bufferOffset, sizeof(uint32_t));
-      loopBuffer_.push_back(
-          {encoding, bytesRead, pc_, macroOp[0]->getBranchPrediction()});
+      // Record a copy of the predecoded instruction in the loop body, before
+      // it's modified by later pipeline stages
+      MacroOp recorded;
+      recorded.reserve(macroOp.size());
+      for (const auto& uop : macroOp) {
+        recorded.push_back(uop->clone());
+      }
+      loopBuffer_.push_back({std::move(recorded)});
 
       if (pc_ == loopBoundaryAddress_) {
         if (macroOp[0]->isBranch() &&
@@ -265,6 +264,12 @@ void FetchUnit::requestFromPC() {
 
 uint64_t FetchUnit::getBranchStalls() const { return branchStalls_; }
 
+uint64_t FetchUnit::getMacroOpsFetched() const { return macroOpsFetched_; }
+
+uint64_t FetchUnit::getLoopBufferSupplies() const {
+  return loopBufferSupplies_;
+}
+
 void FetchUnit::flushLoopBuffer() {
   loopBuffer_.clear();
   loopBufferState_ = LoopBufferState::IDLE;
@@ -0,0 +1,162 @@
+#include "simeng/pipeline/KonataWriter.hh"
+
+#include <algorithm>
+#include <iostream>
+#include <limits>
+
+namespace simeng {
+namespace pipeline {
+
+/** The number of pipeline stages shown for each micro-operation. */
+static const uint8_t KONATA_STAGE_COUNT = 5;
+
+/** The names shown for each pipeline stage. Each stage lasts from the cycle
+ * the micro-operation entered it, until it entered the next. */
+static const char* KONATA_STAGE_NAMES[KONATA_STAGE_COUNT] = {"F", "Dc", "Rn",
+                                                             "Is", "Cm"};
+
+KonataWriter::KonataWriter(const std::string& path, size_t flushThreshold)
+    : file_(path, std::ios::trunc), flushThreshold_(flushThreshold) {
+  if (!file_.is_open()) {
+    std::cerr << "[SimEng:KonataWriter] Could not open Konata log '" << path
+              << "'" << std::endl;
+    return;
+  }
+  file_ << "Kanata\t0004\n";
+}
+
+KonataWriter::~KonataWriter() {
+  if (isOpen()) flush(std::numeric_limits<uint64_t>::max());
+}
+
+bool KonataWriter::isOpen() const { return file_.is_open(); }
+
+void KonataWriter::record(const Instruction& uop, uint64_t commitCycle) {
+  if (!isOpen()) return;
+
+  CommitRecord record;
+  record.sequenceId = uop.getSequenceId();
+  record.instructionId = uop.getInstructionId();
+  record.address = uop.getInstructionAddress();
+  record.opcode = uop.getOpcode();
+  record.disassembly = uop.getDisassembly();
+  record.fetchCycle = uop.getFetchCycle();
+  record.decodeCycle = uop.getDecodeCycle();
+  record.renameCycle = uop.getRenameCycle();
+  record.issueCycle = uop.getIssueCycle();
+  record.completeCycle = uop.getCompleteCycle();
+  record.commitCycle = commitCycle;
+
+  const auto& sources = uop.getSourceRegisters();
+  record.sourceRegisters.assign(sources.begin(), sources.end());
+  const auto& destinations = uop.getDestinationRegisters();
+  record.destinationRegisters.assign(destinations.begin(), destinations.end());
+  const auto& accesses = uop.getGeneratedAddresses();
+  record.memoryAccesses.assign(accesses.begin(), accesses.end());
+
+  append(std::move(record));
+}
+
+void KonataWriter::record(const CommitRecord& record) {
+  if (isOpen()) append(record);
+}
+
+void KonataWriter::append(CommitRecord record) {
+  const uint64_t id = firstId_ + records_.size();
+  const uint64_t stageCycles[KONATA_STAGE_COUNT] = {
+      record.fetchCycle, record.decodeCycle, record.renameCycle,
+      record.issueCycle, record.completeCycle};
+  uint64_t firstCycle = record.commitCycle;
+  for (uint8_t stage = 0; stage < KONATA_STAGE_COUNT; stage++) {
+    // Skip stages the micro-operation didn't pass through
+    if (stageCycles[stage] == 0) continue;
+    events_.push_back({stageCycles[stage], id, stage});
+    firstCycle = std::min(firstCycle, stageCycles[stage]);
+  }
+  events_.push_back({record.commitCycle, id, KONATA_STAGE_COUNT});
+  horizon_ = std::max(horizon_, firstCycle);
+
+  records_.push_back(std::move(record));
+  stages_.push_back(-2);
+  if (events_.size() >= flushThreshold_) flush(horizon_);
+}
+
+void KonataWriter::flush(uint64_t cycle) {
+  // Events must be listed in cycle order; the sort is stable such that the
+  // events of each cycle remain in commit order
+  std::stable_sort(events_.begin(), events_.end(),
+                   [](const KonataEvent& a, const KonataEvent& b) {
+                     return a.cycle < b.cycle;
+                   });
+
+  auto event = events_.begin();
+  for (; event != events_.end() && event->cycle < cycle; event++) {
+    if (!started_) {
+      cycle_ = event->cycle;
+      file_ << "C=\t" << cycle_ << "\n";
+      started_ = true;
+    } else if (event->cycle > cycle_) {
+      file_ << "C\t" << event->cycle - cycle_ << "\n";
+      cycle_ = event->cycle;
+    }
+
+    const size_t index = event->id - firstId_;
+    int8_t& stage = stages_[index];
+    if (stage == -2) {
+      writeLabels(event->id, records_[index]);
+      stage = -1;
+    }
+
+    if (stage >= 0) {
+      file_ << "E\t" << event->id << "\t0\t" << KONATA_STAGE_NAMES[stage]
+            << "\n";
+    }
+    if (event->stage < KONATA_STAGE_COUNT) {
+      file_ << "S\t" << event->id << "\t0\t"
+            << KONATA_STAGE_NAMES[event->stage] << "\n";
+    } else {
+      // Retire the micro-operation, using its log ID as its retire ID
+      file_ << "R\t" << event->id << "\t" << event->id << "\t0\n";
+    }
+    stage = event->stage;
+  }
+  events_.erase(events_.begin(), event);
+
+  // Release the records of retired micro-operations
+  while (!stages_.empty() && stages_.front() == KONATA_STAGE_COUNT) {
+    records_.pop_front();
+    stages_.pop_front();
+    firstId_++;
+  }
+}
+
+void KonataWriter::writeLabels(uint64_t id, const CommitRecord& record) {
+  file_ << "I\t" << id << "\t" << record.sequenceId << "\t0\n";
+  file_ << "L\t" << id << "\t0\t0x" << std::hex << record.address << std::dec
+        << ": ";
+  if (record.disassembly.empty()) {
+    file_ << "opcode " << record.opcode;
+  } else {
+    file_ << record.disassembly;
+  }
+  file_ << "\n";
+
+  file_ << "L\t" << id << "\t1\tSequence ID: " << record.sequenceId
+        << ", Instruction ID: " << record.instructionId << ", Sources:";
+  for (const auto& reg : record.sourceRegisters) {
+    file_ << " " << unsigned(reg.type) << ":" << reg.tag;
+  }
+  file_ << ", Destinations:";
+  for (const auto& reg : record.destinationRegisters) {
+    file_ << " " << unsigned(reg.type) << ":" << reg.tag;
+  }
+  file_ << ", Memory:";
+  for (const auto& access : record.memoryAccesses) {
+    file_ << " 0x" << std::hex << access.address << std::dec << "("
+          << access.size << ")";
+  }
+  file_ << "\n";
+}
+
+}  // namespace pipeline
+}  // namespace simeng
@@ -1,10 +1,11 @@
 #include "simeng/pipeline/LoadStoreQueue.hh"
 
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <cstring>
 #include <iostream>
-#include <list>
+#include <tuple>
 
 namespace simeng {
 namespace pipeline {
@@ -17,15 +18,23 @@ bool requestsOverlap(memory::MemoryAccessTarget a,
   return !(a.address + a.size <= b.address || b.address + b.size <= a.address);
 }
 
+/** Retrieve the first and last address buckets touched by request `a`. */
+std::pair<uint64_t, uint64_t> getBucketRange(memory::MemoryAccessTarget a) {
+  uint64_t last = a.address + (a.size > 0 ? a.size - 1 : 0);
+  return {a.address >> ADDRESS_BUCKET_SHIFT, last >> ADDRESS_BUCKET_SHIFT};
+}
+
 LoadStoreQueue::LoadStoreQueue(
     unsigned int maxCombinedSpace, memory::MemoryInterface& memory,
-    span<PipelineBuffer<std::shared_ptr<Instruction>>> completionSlots,
+    TimingWheel<std::shared_ptr<Instruction>>& completions,
+    uint16_t completionWidth,
     std::function<void(span<Register>, span<RegisterValue>)> forwardOperands,
     std::function<void(const std::shared_ptr<Instruction>&)> raiseException,
     bool exclusive, uint16_t loadBandwidth, uint16_t storeBandwidth,
     uint16_t permittedRequests, uint16_t permittedLoads,
-    uint16_t permittedStores)
-    : completionSlots_(completionSlots),
+    uint16_t permittedStores, bool exemptForwardedLoads)
+    : completions_(completions),
+      completionWidth_(completionWidth),
       forwardOperands_(forwardOperands),
       raiseException_(raiseException),
       maxCombinedSpace_(maxCombinedSpace),
@@ -36,18 +45,21 @@ LoadStoreQueue::LoadStoreQueue(
       storeBandwidth_(storeBandwidth),
       totalLimit_(permittedRequests),
       // Set per-cycle limits for each request type
-      reqLimits_{permittedLoads, permittedStores} {}
+      reqLimits_{permittedLoads, permittedStores},
+      exemptForwardedLoads_(exemptForwardedLoads) {}
 
 LoadStoreQueue::LoadStoreQueue(
     unsigned int maxLoadQueueSpace, unsigned int maxStoreQueueSpace,
     memory::MemoryInterface& memory,
-    span<PipelineBuffer<std::shared_ptr<Instruction>>> completionSlots,
+    TimingWheel<std::shared_ptr<Instruction>>& completions,
+    uint16_t completionWidth,
     std::function<void(span<Register>, span<RegisterValue>)> forwardOperands,
     std::function<void(const std::shared_ptr<Instruction>&)> raiseException,
     bool exclusive, uint16_t loadBandwidth, uint16_t storeBandwidth,
     uint16_t permittedRequests, uint16_t permittedLoads,
-    uint16_t permittedStores)
-    : completionSlots_(completionSlots),
+    uint16_t permittedStores, bool exemptForwardedLoads)
+    : completions_(completions),
+      completionWidth_(completionWidth),
       forwardOperands_(forwardOperands),
       raiseException_(raiseException),
       maxLoadQueueSpace_(maxLoadQueueSpace),
@@ -59,7 +71,8 @@ LoadStoreQueue::LoadStoreQueue(
       storeBandwidth_(storeBandwidth),
       totalLimit_(permittedRequests),
       // Set per-cycle limits for each request type
-      reqLimits_{permittedLoads, permittedStores} {}
+      reqLimits_{permittedLoads, permittedStores},
+      exemptForwardedLoads_(exemptForwardedLoads) {}
 
 unsigned int LoadStoreQueue::getLoadQueueSpace() const {
   if (combined_) {
@@ -100,7 +113,8 @@ void LoadStoreQueue::addStore(const std::shared_ptr<Instruction>& insn) {
   storeQueue_.push_back({insn, {}});
 }
 
-void LoadStoreQueue::startLoad(const std::shared_ptr<Instruction>& insn) {
+bool LoadStoreQueue::startLoad(const std::shared_ptr<Instruction>& insn) {
+  bool forwarded = false;
   const auto& ld_addresses = insn->getGeneratedAddresses();
   if (ld_addresses.size() == 0) {
     // Early execution if not addresses need to be accessed
@@ -109,7 +123,7 @@ void LoadStoreQueue::startLoad(const std::shared_ptr<Instruction>& insn) {
     if (insn->exceptionEncountered()) {
       // Exception; don't pass insn to completedLoads_
       raiseException_(insn);
-      return;
+      return false;
     }
 
     completedLoads_.push(insn);
@@ -121,58 +135,76 @@ void LoadStoreQueue::startLoad(const std::shared_ptr<Instruction>& insn) {
     auto& reqAddrQueue = requestLoadQueue_[tickCounter_ + insn->getLSQLatency()]
                              .back()
                              .reqAddresses;
-    // Store load addresses temporarily so that conflictions are
-    // only registered once on most recent (program order) store
-    std::list<simeng::memory::MemoryAccessTarget> temp_load_addr(
-        ld_addresses.begin(), ld_addresses.end());
-
-    // Detect reordering conflicts
-    if (storeQueue_.size() > 0) {
-      uint64_t seqId = insn->getSequenceId();
-      for (auto itSt = storeQueue_.rbegin(); itSt != storeQueue_.rend();
-           itSt++) {
-        const auto& store = itSt->first;
-        // If entry is earlier in the program order than load, detect conflicts
-        if (store->getSequenceId() < seqId) {
-          const auto& str_addresses = store->getGeneratedAddresses();
-          // Iterate over possible matches between store and load addresses
-          for (const auto& str : str_addresses) {
-            auto itLd = temp_load_addr.begin();
-            while (itLd != temp_load_addr.end()) {
-              // If conflict exists, register in conflictionMap_ and delay
-              // load request(s) until conflicting store retires
-              if (itLd->address == str.address) {
-                // Load access size must be no larger than the store access size
-                // to ensure all data is encapsulated in the later forwarding
-                if (itLd->size <= str.size) {
-                  conflictionMap_[store->getSequenceId()][str.address]
-                      .push_back({insn, itLd->size});
-                } else {
-                  // To ensure load doesn't match on an earlier store, generate
-                  // load request for address
-                  reqAddrQueue.push(*itLd);
-                }
-                // Remove from temporary vector so the confliction can't be
-                // registered again
-                itLd = temp_load_addr.erase(itLd);
-              } else {
-                itLd++;
-              }
-            }
+
+    // Detect reordering conflicts. Each load address may only register a
+    // confliction on the most recent (program order) store that is earlier
+    // than the load and accesses the same address
+    uint64_t seqId = insn->getSequenceId();
+    std::vector<bool> conflicted(ld_addresses.size(), false);
+    // Load addresses which matched a store access too small to forward from,
+    // held as {store sequence ID, store address index, load address index}
+    std::vector<std::tuple<uint64_t, uint16_t, size_t>> oversized;
+    if (storeAddressIndex_.size() > 0) {
+      for (size_t i = 0; i < ld_addresses.size(); i++) {
+        const auto& ld = ld_addresses[i];
+        const auto& itAddr = storeAddressIndex_.find(ld.address);
+        if (itAddr == storeAddressIndex_.end()) continue;
+        // Find the youngest store which is earlier in the program order than
+        // the load
+        const storeAddressEntry* match = nullptr;
+        for (const auto& entry : itAddr->second) {
+          if (entry.seqId < seqId &&
+              (match == nullptr || entry.seqId > match->seqId)) {
+            match = &entry;
           }
         }
+        if (match == nullptr) continue;
+        conflicted[i] = true;
+        // Load access size must be no larger than the store access size to
+        // ensure all data is encapsulated in the later forwarding
+        if (ld.size <= match->size) {
+          // Register in conflictionMap_ and delay load request until
+          // conflicting store retires
+          conflictionMap_[match->seqId][ld.address].push_back({insn, ld.size});
+          forwarded = true;
+        } else {
+          oversized.push_back({match->seqId, match->index, i});
+        }
       }
     }
+    // To ensure oversized loads don't match on an earlier store, generate load
+    // requests for them in the order a youngest-first search of the store
+    // queue would discover them
+    std::sort(oversized.begin(), oversized.end(),
+              [](const auto& a, const auto& b) {
+                if (std::get<0>(a) != std::get<0>(b))
+                  return std::get<0>(a) > std::get<0>(b);
+                return std::make_pair(std::get<1>(a), std::get<2>(a)) <
+                       std::make_pair(std::get<1>(b), std::get<2>(b));
+              });
+    for (const auto& entry : oversized)
+      reqAddrQueue.push(ld_addresses[std::get<2>(entry)]);
+
     // If addresses remain that had no conflictions, generate those load
     // request(s)
-    for (const auto& ld_addr : temp_load_addr) reqAddrQueue.emplace(ld_addr);
+    for (size_t i = 0; i < ld_addresses.size(); i++) {
+      if (!conflicted[i]) reqAddrQueue.push(ld_addresses[i]);
+    }
 
     // Register active load
     requestedLoads_.emplace(insn->getSequenceId(), insn);
+    indexLoadAddresses(seqId, ld_addresses);
   }
+  return forwarded;
 }
 
 void LoadStoreQueue::supplyStoreData(const std::shared_ptr<Instruction>& insn) {
+  // Store addresses are generated alongside the call to this function, so
+  // register them for memory disambiguation
+  if (insn->isStoreAddress() && !insn->isFlushed()) {
+    indexStoreAddresses(insn->getSequenceId(), insn->getGeneratedAddresses());
+  }
+
   if (!insn->isStoreData()) return;
   // Get identifier values
   const uint64_t macroOpNum = insn->getInstructionId();
@@ -214,6 +246,8 @@ bool LoadStoreQueue::commitStore(const std::shared_ptr<Instruction>& uop) {
     return false;
   }
 
+  unindexStoreAddresses(uop->getSequenceId(), addresses);
+
   requestStoreQueue_[tickCounter_ + uop->getLSQLatency()].push_back({{}, uop});
   // Submit request write to memory interface early as the architectural state
   // considers the store to be retired and thus its operation complete
@@ -226,24 +260,32 @@ bool LoadStoreQueue::commitStore(const std::shared_ptr<Instruction>& uop) {
         .reqAddresses.push(addresses[i]);
   }
 
-  // Check all loads that have requested memory
+  // Check all loads that have requested memory from a region this store writes
+  // to
   violatingLoad_ = nullptr;
-  for (const auto& load : requestedLoads_) {
-    // Skip loads that are younger than the oldest violating load
-    if (violatingLoad_ &&
-        load.second->getSequenceId() > violatingLoad_->getSequenceId())
-      continue;
-    // Violation invalid if the load and store entries are generated by the same
-    // uop
-    if (load.second->getSequenceId() != uop->getSequenceId()) {
-      const auto& loadedAddresses = load.second->getGeneratedAddresses();
-      // Iterate over store addresses
-      for (const auto& storeReq : addresses) {
+  for (const auto& storeReq : addresses) {
+    const auto bucketRange = getBucketRange(storeReq);
+    for (uint64_t bucket = bucketRange.first; bucket <= bucketRange.second;
+         bucket++) {
+      const auto& itBucket = loadAddressIndex_.find(bucket);
+      if (itBucket == loadAddressIndex_.end()) continue;
+      for (const auto& loadSeqId : itBucket->second) {
+        // Violation invalid if the load and store entries are generated by the
+        // same uop. Skip loads that are younger than the oldest violating load
+        if (loadSeqId == uop->getSequenceId() ||
+            (violatingLoad_ && loadSeqId > violatingLoad_->getSequenceId()))
+          continue;
+        const auto& load = requestedLoads_.at(loadSeqId);
         // Iterate over load addresses
-        for (const auto& loadReq : loadedAddresses) {
-          // Check for overlapping requests, and flush if discovered
-          if (requestsOverlap(storeReq, loadReq)) {
-            violatingLoad_ = load.second;
+        for (const auto& loadReq : load->getGeneratedAddresses()) {
+          // Check for overlapping requests, and flush if discovered. If
+          // exempt, an access forwarded this store's data has read the correct
+          // value
+          if (requestsOverlap(storeReq, loadReq) &&
+              !(exemptForwardedLoads_ &&
+                isForwarded(uop->getSequenceId(), load, loadReq.address))) {
+            violatingLoad_ = load;
+            break;
           }
         }
       }
@@ -292,7 +334,10 @@ void LoadStoreQueue::commitLoad(const std::shared_ptr<Instruction>& uop) {
   while (it != loadQueue_.end()) {
     const auto& entry = *it;
     if (entry->isLoad()) {
-      requestedLoads_.erase(entry->getSequenceId());
+      if (requestedLoads_.erase(entry->getSequenceId())) {
+        unindexLoadAddresses(entry->getSequenceId(),
+                             entry->getGeneratedAddresses());
+      }
       it = loadQueue_.erase(it);
       break;
     } else {
@@ -307,7 +352,10 @@ void LoadStoreQueue::purgeFlushed() {
   while (itLd != loadQueue_.end()) {
     const auto& entry = *itLd;
     if (entry->isFlushed()) {
-      requestedLoads_.erase(entry->getSequenceId());
+      if (requestedLoads_.erase(entry->getSequenceId())) {
+        unindexLoadAddresses(entry->getSequenceId(),
+                             entry->getGeneratedAddresses());
+      }
       itLd = loadQueue_.erase(itLd);
     } else {
       itLd++;
@@ -321,6 +369,8 @@ void LoadStoreQueue::purgeFlushed() {
     const auto& entry = itSt->first;
     if (entry->isFlushed()) {
       conflictionMap_.erase(entry->getSequenceId());
+      unindexStoreAddresses(entry->getSequenceId(),
+                            entry->getGeneratedAddresses());
       itSt = storeQueue_.erase(itSt);
     } else {
       itSt++;
@@ -538,7 +588,7 @@ void LoadStoreQueue::tick() {
 
   // Pop from the front of the completed loads queue and send to writeback
   size_t count = 0;
-  while (completedLoads_.size() > 0 && count < completionSlots_.size()) {
+  while (completedLoads_.size() > 0 && count < completionWidth_) {
     const auto& insn = completedLoads_.front();
 
     // Don't process load instruction if it has been flushed
@@ -550,7 +600,7 @@ void LoadStoreQueue::tick() {
     // Forward the results
     forwardOperands_(insn->getDestinationRegisters(), insn->getResults());
 
-    completionSlots_[count].getTailSlots()[0] = std::move(insn);
+    completions_.schedule(insn, 1);
 
     completedLoads_.pop();
 
@@ -558,11 +608,91 @@ void LoadStoreQueue::tick() {
   }
 }
 
+void LoadStoreQueue::indexStoreAddresses(
+    uint64_t seqId, span<const memory::MemoryAccessTarget> addresses) {
+  for (size_t i = 0; i < addresses.size(); i++) {
+    auto& entries = storeAddressIndex_[addresses[i].address];
+    // Ensure an access is only indexed once if store data is supplied by the
+    // same uop more than once
+    bool indexed = false;
+    for (const auto& entry : entries) {
+      if (entry.seqId == seqId && entry.index == i) {
+        indexed = true;
+        break;
+      }
+    }
+    if (!indexed)
+      entries.push_back({seqId, addresses[i].size, static_cast<uint16_t>(i)});
+  }
+}
+
+void LoadStoreQueue::unindexStoreAddresses(
+    uint64_t seqId, span<const memory::MemoryAccessTarget> addresses) {
+  for (const auto& target : addresses) {
+    const auto& itAddr = storeAddressIndex_.find(target.address);
+    if (itAddr == storeAddressIndex_.end()) continue;
+    auto& entries = itAddr->second;
+    entries.erase(std::remove_if(entries.begin(), entries.end(),
+                                 [seqId](const storeAddressEntry& entry) {
+                                   return entry.seqId == seqId;
+                                 }),
+                  entries.end());
+    if (entries.size() == 0) storeAddressIndex_.erase(itAddr);
+  }
+}
+
+void LoadStoreQueue::indexLoadAddresses(
+    uint64_t seqId, span<const memory::MemoryAccessTarget> addresses) {
+  for (const auto& target : addresses) {
+    const auto bucketRange = getBucketRange(target);
+    for (uint64_t bucket = bucketRange.first; bucket <= bucketRange.second;
+         bucket++) {
+      auto& loads = loadAddressIndex_[bucket];
+      // Accesses of the same load frequently share a bucket; only register the
+      // load once per bucket
+      if (loads.size() == 0 || loads.back() != seqId) loads.push_back(seqId);
+    }
+  }
+}
+
+void LoadStoreQueue::unindexLoadAddresses(
+    uint64_t seqId, span<const memory::MemoryAccessTarget> addresses) {
+  for (const auto& target : addresses) {
+    const auto bucketRange = getBucketRange(target);
+    for (uint64_t bucket = bucketRange.first; bucket <= bucketRange.second;
+         bucket++) {
+      const auto& itBucket = loadAddressIndex_.find(bucket);
+      if (itBucket == loadAddressIndex_.end()) continue;
+      auto& loads = itBucket->second;
+      loads.erase(std::remove(loads.begin(), loads.end(), seqId), loads.end());
+      if (loads.size() == 0) loadAddressIndex_.erase(itBucket);
+    }
+  }
+}
+
+bool LoadStoreQueue::isForwarded(uint64_t storeSeqId,
+                                 const std::shared_ptr<Instruction>& load,
+                                 uint64_t address) const {
+  const auto& itSt = conflictionMap_.find(storeSeqId);
+  if (itSt == conflictionMap_.end()) return false;
+  const auto& itAddr = itSt->second.find(address);
+  if (itAddr == itSt->second.end()) return false;
+  for (const auto& pair : itAddr->second) {
+    if (pair.first == load) return true;
+  }
+  return false;
+}
+
 std::shared_ptr<Instruction> LoadStoreQueue::getViolatingLoad() const {
   return violatingLoad_;
 }
 
 bool LoadStoreQueue::isCombined() const { return combined_; }
 
+bool LoadStoreQueue::hasQueuedWork() const {
+  return requestLoadQueue_.size() > 0 || requestStoreQueue_.size() > 0 ||
+         completedLoads_.size() > 0 || memory_.getCompletedReads().size() > 0;
+}
+
 }  // namespace pipeline
 }  // namespace simeng
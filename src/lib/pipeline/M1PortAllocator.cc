@@ -12,8 +12,8 @@ M1PortAllocator::M1PortAllocator(
     std::vector<std::pair<uint8_t, uint64_t>> rsArrangement)
     : weights(portArrangement.size(), 0), rsArrangement_(rsArrangement) {}
 
-uint16_t M1PortAllocator::allocate(const std::vector<uint16_t>& ports) {
-  assert(ports.size() &&
+uint16_t M1PortAllocator::allocate(PortMask ports) {
+  assert(ports != 0 &&
          "No supported ports supplied; cannot allocate from a empty set");
   bool foundPort = false;
   uint16_t bestPort = 0;
@@ -28,7 +28,7 @@ uint16_t M1PortAllocator::allocate(const std::vector<uint16_t>& ports) {
   rsFreeSpaces.clear();
   rsSizes_(rsFreeSpaces);
 
-  for (const auto& portIndex : ports) {
+  forEachPort(ports, [&](uint16_t portIndex) {
     auto rsIndex = rsArrangement_[portIndex].first;
     auto rsSize = rsArrangement_[portIndex].second;
     auto rsFreeSpace = rsFreeSpaces[rsIndex];
@@ -45,7 +45,7 @@ uint16_t M1PortAllocator::allocate(const std::vector<uint16_t>& ports) {
         bestPort = portIndex;
       }
     }
-  }
+  });
 
   assert(foundPort && foundRS && "Unsupported group; cannot allocate a port");
 
@@ -1,5 +1,7 @@
 #include "simeng/pipeline/RegisterAliasTable.hh"
 
+#include <algorithm>
+#include <bitset>
 #include <cassert>
 
 namespace simeng {
@@ -7,11 +9,13 @@ namespace pipeline {
 
 RegisterAliasTable::RegisterAliasTable(
     std::vector<RegisterFileStructure> architecturalStructure,
-    std::vector<uint16_t> physicalRegisterCounts)
+    std::vector<uint16_t> physicalRegisterCounts, uint16_t checkpointCount)
     : mappingTable_(architecturalStructure.size()),
       historyTable_(architecturalStructure.size()),
       destinationTable_(architecturalStructure.size()),
-      freeQueues_(architecturalStructure.size()) {
+      freeBitmaps_(architecturalStructure.size()),
+      freeCounts_(architecturalStructure.size()),
+      checkpoints_(checkpointCount) {
   assert(architecturalStructure.size() == physicalRegisterCounts.size() &&
          "The number of physical register types does not match the number of "
          "architectural register types");
@@ -30,15 +34,26 @@ RegisterAliasTable::RegisterAliasTable(
       mappingTable_[type][tag] = tag;
     }
 
-    // Add remaining physical registers to free queue
+    // Mark remaining physical registers as free
+    freeBitmaps_[type].resize((physCount + 63) / 64);
     for (size_t tag = archCount; tag < physCount; tag++) {
-      freeQueues_[type].push(tag);
+      freeRegister(type, tag);
     }
 
     // Set up history/destination tables
     historyTable_[type].resize(physCount);
     destinationTable_[type].resize(physCount);
   }
+
+  // Allocate the checkpoint tables upfront, such that taking a checkpoint
+  // only copies the current state
+  for (auto& checkpoint : checkpoints_) {
+    checkpoint.mappingTable = mappingTable_;
+    checkpoint.allocated.resize(freeBitmaps_.size());
+    for (size_t type = 0; type < freeBitmaps_.size(); type++) {
+      checkpoint.allocated[type].resize(freeBitmaps_[type].size());
+    }
+  }
 }
 
 Register RegisterAliasTable::getMapping(Register architectural) const {
@@ -55,7 +70,7 @@ Register RegisterAliasTable::getMapping(Register architectural) const {
 
 bool RegisterAliasTable::canAllocate(uint8_t type,
                                      unsigned int quantity) const {
-  return (freeQueues_[type].size() >= quantity);
+  return (freeCounts_[type] >= quantity);
 }
 
 bool RegisterAliasTable::canRename(uint8_t type) const {
@@ -64,16 +79,30 @@ bool RegisterAliasTable::canRename(uint8_t type) const {
 }
 
 unsigned int RegisterAliasTable::freeRegistersAvailable(uint8_t type) const {
-  return freeQueues_[type].size();
+  return freeCounts_[type];
 }
 
 Register RegisterAliasTable::allocate(Register architectural) {
-  std::queue<uint16_t>& freeQueue = freeQueues_[architectural.type];
-  assert(freeQueue.size() > 0 &&
+  auto& freeBitmap = freeBitmaps_[architectural.type];
+  assert(freeCounts_[architectural.type] > 0 &&
          "Attempted to allocate free register when none were available");
 
-  auto tag = freeQueue.front();
-  freeQueue.pop();
+  // Take the lowest-numbered free register
+  size_t word = 0;
+  while (freeBitmap[word] == 0) word++;
+  uint16_t bit = 0;
+  while (!((freeBitmap[word] >> bit) & 1)) bit++;
+  uint16_t tag = word * 64 + bit;
+  freeBitmap[word] &= ~(1ull << bit);
+  freeCounts_[architectural.type]--;
+
+  // Record the allocation against every checkpoint held, such that it may be
+  // undone upon restoring any of them
+  for (uint16_t i = 0; i < checkpointsInUse_; i++) {
+    auto& checkpoint =
+        checkpoints_[(checkpointHead_ + i) % checkpoints_.size()];
+    checkpoint.allocated[architectural.type][word] |= (1ull << bit);
+  }
 
   // Keep the old physical register in the history table
   historyTable_[architectural.type][tag] =
@@ -88,10 +117,12 @@ Register RegisterAliasTable::allocate(Register architectural) {
 }
 
 void RegisterAliasTable::commit(Register physical) {
+  // Registers which weren't renamed have no previous mapping to free
+  if (!physical.renamed) return;
   // Find the register previously mapped to the same architectural register and
   // free it
   auto oldTag = historyTable_[physical.type][physical.tag];
-  freeQueues_[physical.type].push(oldTag);
+  freeRegister(physical.type, oldTag);
 }
 
 void RegisterAliasTable::rewind(Register physical) {
@@ -103,8 +134,76 @@ void RegisterAliasTable::rewind(Register physical) {
   // Rewind the mapping table to the old physical tag
   mappingTable_[physical.type][destinationTag] =
       historyTable_[physical.type][physical.tag];
-  // Add the rewound physical tag back to the free queue
-  freeQueues_[physical.type].push(physical.tag);
+  // Free the rewound physical tag
+  freeRegister(physical.type, physical.tag);
+}
+
+bool RegisterAliasTable::checkpoint(uint64_t insnId) {
+  if (checkpointsInUse_ == checkpoints_.size()) return false;
+
+  checkpointsInUse_++;
+  auto& checkpoint = getYoungestCheckpoint();
+  checkpoint.insnId = insnId;
+  for (size_t type = 0; type < mappingTable_.size(); type++) {
+    checkpoint.mappingTable[type] = mappingTable_[type];
+    std::fill(checkpoint.allocated[type].begin(),
+              checkpoint.allocated[type].end(), 0);
+  }
+  return true;
+}
+
+void RegisterAliasTable::releaseCheckpoints(uint64_t insnId) {
+  while (checkpointsInUse_ > 0 &&
+         checkpoints_[checkpointHead_].insnId <= insnId) {
+    checkpointHead_ = (checkpointHead_ + 1) % checkpoints_.size();
+    checkpointsInUse_--;
+  }
+}
+
+bool RegisterAliasTable::restoreCheckpoint(uint64_t afterInsnId) {
+  // Checkpoints taken after flushed instructions are no longer of use
+  while (checkpointsInUse_ > 0 &&
+         getYoungestCheckpoint().insnId > afterInsnId) {
+    checkpointsInUse_--;
+  }
+  if (checkpointsInUse_ == 0 ||
+      getYoungestCheckpoint().insnId != afterInsnId) {
+    return false;
+  }
+
+  // Reinstate the mapping tables, and free every register allocated since the
+  // checkpoint was taken. The checkpoint is retained, now holding the current
+  // state
+  auto& checkpoint = getYoungestCheckpoint();
+  for (size_t type = 0; type < mappingTable_.size(); type++) {
+    mappingTable_[type] = checkpoint.mappingTable[type];
+    auto& freeBitmap = freeBitmaps_[type];
+    auto& allocated = checkpoint.allocated[type];
+    for (size_t word = 0; word < freeBitmap.size(); word++) {
+      freeCounts_[type] +=
+          std::bitset<64>(allocated[word] & ~freeBitmap[word]).count();
+      freeBitmap[word] |= allocated[word];
+      allocated[word] = 0;
+    }
+  }
+  return true;
+}
+
+unsigned int RegisterAliasTable::getCheckpointsInUse() const {
+  return checkpointsInUse_;
+}
+
+ratCheckpoint& RegisterAliasTable::getYoungestCheckpoint() {
+  return checkpoints_[(checkpointHead_ + checkpointsInUse_ - 1) %
+                      checkpoints_.size()];
+}
+
+void RegisterAliasTable::freeRegister(uint8_t type, uint16_t tag) {
+  uint64_t mask = 1ull << (tag % 64);
+  assert(!(freeBitmaps_[type][tag / 64] & mask) &&
+         "Attempted to free a register which is already free");
+  freeBitmaps_[type][tag / 64] |= mask;
+  freeCounts_[type]++;
 }
 
 }  // namespace pipeline
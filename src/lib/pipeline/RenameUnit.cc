@@ -115,6 +115,12 @@ void RenameUnit::tick() {
     // Reserve a slot in the ROB for this uop
     reorderBuffer_.reserve(uop);
 
+    // Checkpoint the renaming state once a branch has been fully renamed, such
+    // that it can be quickly restored upon a misprediction
+    if (uop->isBranch() && uop->isLastMicroOp()) {
+      rat_.checkpoint(uop->getInstructionId());
+    }
+
     // Add to the load/store queue if appropriate
     if (isLoad) {
       lsq_.addLoad(uop);
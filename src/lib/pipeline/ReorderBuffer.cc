@@ -11,85 +11,92 @@ ReorderBuffer::ReorderBuffer(
     uint32_t maxSize, RegisterAliasTable& rat, LoadStoreQueue& lsq,
     std::function<void(const std::shared_ptr<Instruction>&)> raiseException,
     std::function<void(uint64_t branchAddress)> sendLoopBoundary,
-    BranchPredictor& predictor, uint16_t loopBufSize,
-    uint16_t loopDetectionThreshold)
+    BranchPredictor& predictor, StoreSetPredictor& storeSetPredictor,
+    uint16_t loopBufSize, uint16_t loopDetectionThreshold,
+    std::function<void(const Instruction& uop)> traceCommit)
     : rat_(rat),
       lsq_(lsq),
       maxSize_(maxSize),
       raiseException_(raiseException),
       sendLoopBoundary_(sendLoopBoundary),
+      traceCommit_(traceCommit),
       predictor_(predictor),
+      storeSetPredictor_(storeSetPredictor),
+      buffer_(maxSize, nullptr),
+      groups_(maxSize),
       loopBufSize_(loopBufSize),
       loopDetectionThreshold_(loopDetectionThreshold) {}
 
 void ReorderBuffer::reserve(const std::shared_ptr<Instruction>& insn) {
-  assert(buffer_.size() < maxSize_ &&
+  assert(size_ < maxSize_ &&
          "Attempted to reserve entry in reorder buffer when already full");
+  uint32_t slot = seqId_ % maxSize_;
+  assert(slot == (static_cast<uint64_t>(head_) + size_) % maxSize_ &&
+         "Sequence ID doesn't map onto the tail of the reorder buffer");
   insn->setSequenceId(seqId_);
   seqId_++;
   insn->setInstructionId(insnId_);
+
+  // Open a new micro-op group unless the youngest group is still awaiting
+  // further micro-ops of this instruction
+  uint32_t groupSlot = insnId_ % maxSize_;
+  if (groupCount_ == 0 || groups_[getTailGroup()].insnId != insnId_) {
+    groups_[groupSlot] = {insnId_, slot, 0};
+    groupCount_++;
+  }
+  groups_[groupSlot].size++;
   if (insn->isLastMicroOp()) insnId_++;
 
-  buffer_.push_back(insn);
+  buffer_[slot] = insn;
+  size_++;
 }
 
 void ReorderBuffer::commitMicroOps(uint64_t insnId) {
-  if (buffer_.size()) {
-    size_t index = 0;
-    uint64_t firstOp = UINT64_MAX;
-    bool validForCommit = false;
-    bool foundFirstInstance = false;
-
-    // Find first instance of uop belonging to macro-op instruction
-    for (; index < buffer_.size(); index++) {
-      if (buffer_[index]->getInstructionId() == insnId) {
-        firstOp = index;
-        foundFirstInstance = true;
-        break;
-      }
-    }
+  if (groupCount_ == 0) return;
 
-    if (foundFirstInstance) {
-      // If found, see if all uops are committable
-      for (; index < buffer_.size(); index++) {
-        if (buffer_[index]->getInstructionId() != insnId) break;
-        if (!buffer_[index]->isWaitingCommit()) {
-          return;
-        } else if (buffer_[index]->isLastMicroOp()) {
-          // all microOps must be in ROB for the commit to be valid
-          validForCommit = true;
-        }
-      }
-      if (!validForCommit) return;
+  // Ensure the group is in-flight before inspecting it
+  uint32_t groupSlot = insnId % maxSize_;
+  uint32_t groupOffset = (groupSlot + maxSize_ - groupHead_) % maxSize_;
+  if (groupOffset >= groupCount_ || groups_[groupSlot].insnId != insnId) return;
+  const auto& group = groups_[groupSlot];
 
-      assert(firstOp != UINT64_MAX && "firstOp hasn't been populated");
-      // No early return thus all uops are committable
-      for (; firstOp < buffer_.size(); firstOp++) {
-        if (buffer_[firstOp]->getInstructionId() != insnId) break;
-        buffer_[firstOp]->setCommitReady();
-      }
+  // See if all uops are committable
+  bool validForCommit = false;
+  for (uint32_t i = 0; i < group.size; i++) {
+    const auto& uop = buffer_[(group.first + i) % maxSize_];
+    if (!uop->isWaitingCommit()) {
+      return;
+    } else if (uop->isLastMicroOp()) {
+      // all microOps must be in ROB for the commit to be valid
+      validForCommit = true;
     }
   }
-  return;
+  if (!validForCommit) return;
+
+  // No early return thus all uops are committable
+  for (uint32_t i = 0; i < group.size; i++) {
+    buffer_[(group.first + i) % maxSize_]->setCommitReady();
+  }
 }
 
 unsigned int ReorderBuffer::commit(uint64_t maxCommitSize) {
   shouldFlush_ = false;
   size_t maxCommits =
-      std::min(static_cast<size_t>(maxCommitSize), buffer_.size());
+      std::min(static_cast<size_t>(maxCommitSize), static_cast<size_t>(size_));
 
   unsigned int n;
   for (n = 0; n < maxCommits; n++) {
-    auto& uop = buffer_[0];
+    auto& uop = buffer_[head_];
     if (!uop->canCommit()) {
       break;
     }
 
     if (uop->isLastMicroOp()) instructionsCommitted_++;
+    if (traceCommit_) traceCommit_(*uop);
 
     if (uop->exceptionEncountered()) {
       raiseException_(uop);
-      buffer_.pop_front();
+      popHead();
       return n + 1;
     }
 
@@ -97,6 +104,7 @@ unsigned int ReorderBuffer::commit(uint64_t maxCommitSize) {
     for (size_t i = 0; i < destinations.size(); i++) {
       rat_.commit(destinations[i]);
     }
+    rat_.releaseCheckpoints(uop->getInstructionId());
 
     // If it's a memory op, commit the entry at the head of the respective queue
     if (uop->isLoad()) {
@@ -108,11 +116,14 @@ unsigned int ReorderBuffer::commit(uint64_t maxCommitSize) {
         loadViolations_++;
         // Memory order violation found; aborting commits and flushing
         auto load = lsq_.getViolatingLoad();
+        // Learn the dependence so the load waits on the store in future
+        storeSetPredictor_.train(uop->getInstructionAddress(),
+                                 load->getInstructionAddress());
         shouldFlush_ = true;
         flushAfter_ = load->getInstructionId() - 1;
         pc_ = load->getInstructionAddress();
 
-        buffer_.pop_front();
+        popHead();
         return n + 1;
       }
     }
@@ -152,35 +163,61 @@ unsigned int ReorderBuffer::commit(uint64_t maxCommitSize) {
                           0};
       }
     }
-    buffer_.pop_front();
+    popHead();
   }
 
   return n;
 }
 
 void ReorderBuffer::flush(uint64_t afterInsnId) {
-  // Iterate backwards from the tail of the queue to find and remove ops newer
-  // than `afterInsnId`
-  while (!buffer_.empty()) {
-    auto& uop = buffer_.back();
-    if (uop->getInstructionId() <= afterInsnId) {
+  // Iterate backwards from the youngest micro-op group to find and remove ops
+  // newer than `afterInsnId`
+  uint64_t nextInsnId = insnId_;
+  // Where possible, restore the renaming state from a checkpoint rather than
+  // rewinding each flushed allocation
+  bool restored = rat_.restoreCheckpoint(afterInsnId);
+  while (groupCount_ > 0) {
+    const auto& group = groups_[getTailGroup()];
+    if (group.insnId <= afterInsnId) {
       break;
     }
 
-    // To rewind destination registers in correct history order, rewinding of
-    // register renaming is done backwards
-    auto destinations = uop->getDestinationRegisters();
-    for (int i = destinations.size() - 1; i >= 0; i--) {
-      const auto& reg = destinations[i];
-      // Only rewind the register if it was renamed
-      if (reg.renamed) rat_.rewind(reg);
-    }
-    uop->setFlushed();
-    // If the instruction is a branch, supply address to branch flushing logic
-    if (uop->isBranch()) {
-      predictor_.flush(uop->getInstructionAddress());
+    for (uint32_t i = group.size; i > 0; i--) {
+      auto& uop = buffer_[(group.first + i - 1) % maxSize_];
+      if (!restored) {
+        // To rewind destination registers in correct history order, rewinding
+        // of register renaming is done backwards
+        auto destinations = uop->getDestinationRegisters();
+        for (int j = destinations.size() - 1; j >= 0; j--) {
+          const auto& reg = destinations[j];
+          // Only rewind the register if it was renamed
+          if (reg.renamed) rat_.rewind(reg);
+        }
+      }
+      uop->setFlushed();
+      // If the instruction is a branch, supply address to branch flushing logic
+      if (uop->isBranch()) {
+        predictor_.flush(uop->getInstructionAddress());
+      }
+      uop = nullptr;
     }
-    buffer_.pop_back();
+    size_ -= group.size;
+    groupCount_--;
+    // Never reuse the ID of a flushed instruction, even one which was only
+    // partially reserved
+    nextInsnId = std::max(nextInsnId, group.insnId + 1);
+  }
+
+  // Advance the next sequence ID to that which maps onto the new tail slot
+  uint64_t tail = (static_cast<uint64_t>(head_) + size_) % maxSize_;
+  seqId_ += (tail + maxSize_ - seqId_ % maxSize_) % maxSize_;
+  // Likewise for the next instruction ID, unless the youngest remaining group
+  // is still awaiting further micro-ops
+  if (groupCount_ == 0 || groups_[getTailGroup()].insnId != insnId_) {
+    uint64_t tailGroup =
+        (static_cast<uint64_t>(groupHead_) + groupCount_) % maxSize_;
+    insnId_ =
+        nextInsnId + (tailGroup + maxSize_ - nextInsnId % maxSize_) % maxSize_;
   }
 
   // Reset branch counter and loop detection
@@ -188,10 +225,12 @@ void ReorderBuffer::flush(uint64_t afterInsnId) {
   loopDetected_ = false;
 }
 
-unsigned int ReorderBuffer::size() const { return buffer_.size(); }
+unsigned int ReorderBuffer::size() const { return size_; }
+
+unsigned int ReorderBuffer::getFreeSpace() const { return maxSize_ - size_; }
 
-unsigned int ReorderBuffer::getFreeSpace() const {
-  return maxSize_ - buffer_.size();
+bool ReorderBuffer::isHeadCommitReady() const {
+  return size_ > 0 && buffer_[head_]->canCommit();
 }
 
 bool ReorderBuffer::shouldFlush() const { return shouldFlush_; }
@@ -206,5 +245,24 @@ uint64_t ReorderBuffer::getViolatingLoadsCount() const {
   return loadViolations_;
 }
 
+void ReorderBuffer::popHead() {
+  buffer_[head_] = nullptr;
+  head_ = (head_ + 1) % maxSize_;
+  size_--;
+
+  // The head instruction always belongs to the oldest micro-op group
+  auto& group = groups_[groupHead_];
+  group.first = head_;
+  group.size--;
+  if (group.size == 0 && group.insnId != insnId_) {
+    groupHead_ = (groupHead_ + 1) % maxSize_;
+    groupCount_--;
+  }
+}
+
+uint32_t ReorderBuffer::getTailGroup() const {
+  return (static_cast<uint64_t>(groupHead_) + groupCount_ - 1) % maxSize_;
+}
+
 }  // namespace pipeline
 }  // namespace simeng
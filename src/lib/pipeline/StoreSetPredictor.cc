@@ -0,0 +1,119 @@
+#include "simeng/pipeline/StoreSetPredictor.hh"
+
+#include <algorithm>
+
+namespace simeng {
+namespace pipeline {
+
+StoreSetPredictor::StoreSetPredictor(ryml::ConstNodeRef config)
+    : enabled_(config["Memory-Dependence-Predictor"]["Type"]
+                   .as<std::string>() == "Store-Set"),
+      clearInterval_(config["Memory-Dependence-Predictor"]["Clear-Interval"]
+                         .as<uint64_t>()) {
+  // Only allocate the prediction tables if the predictor is in use
+  if (enabled_) {
+    ssit_.assign(
+        config["Memory-Dependence-Predictor"]["SSIT-Size"].as<uint32_t>(),
+        invalidStoreSet_);
+    lfst_.resize(
+        config["Memory-Dependence-Predictor"]["LFST-Size"].as<uint32_t>());
+  }
+}
+
+void StoreSetPredictor::tick() {
+  if (!enabled_ || clearInterval_ == 0) return;
+
+  ticksSinceClear_++;
+  if (ticksSinceClear_ == clearInterval_) {
+    clear();
+    ticksSinceClear_ = 0;
+  }
+}
+
+std::shared_ptr<Instruction> StoreSetPredictor::getPredictedStore(
+    const std::shared_ptr<Instruction>& load) const {
+  if (!enabled_) return nullptr;
+
+  uint32_t storeSetId = ssit_[getSSITIndex(load->getInstructionAddress())];
+  if (storeSetId == invalidStoreSet_) return nullptr;
+
+  const auto& store = lfst_[storeSetId];
+  // A dependence is only predicted on a store which is still in-flight and
+  // earlier than the load in the program order. The latter check also stops
+  // a uop which both loads and stores from waiting on itself
+  if (store == nullptr || store->isFlushed() ||
+      store->getSequenceId() >= load->getSequenceId())
+    return nullptr;
+
+  return store;
+}
+
+void StoreSetPredictor::storeDispatched(
+    const std::shared_ptr<Instruction>& store) {
+  if (!enabled_) return;
+
+  uint32_t storeSetId = ssit_[getSSITIndex(store->getInstructionAddress())];
+  if (storeSetId != invalidStoreSet_) lfst_[storeSetId] = store;
+}
+
+void StoreSetPredictor::storeIssued(const std::shared_ptr<Instruction>& store) {
+  if (!enabled_) return;
+
+  uint32_t storeSetId = ssit_[getSSITIndex(store->getInstructionAddress())];
+  // Only invalidate the LFST entry if a later store of the same store set
+  // hasn't since replaced it
+  if (storeSetId != invalidStoreSet_ && lfst_[storeSetId] == store)
+    lfst_[storeSetId] = nullptr;
+}
+
+void StoreSetPredictor::train(uint64_t storeAddress, uint64_t loadAddress) {
+  if (!enabled_) return;
+
+  uint64_t storeIndex = getSSITIndex(storeAddress);
+  uint64_t loadIndex = getSSITIndex(loadAddress);
+  uint32_t storeSetId = ssit_[storeIndex];
+  uint32_t loadSetId = ssit_[loadIndex];
+
+  if (storeSetId == invalidStoreSet_ && loadSetId == invalidStoreSet_) {
+    // Neither instruction belongs to a store set; allocate a new one for both
+    uint32_t newSetId = nextStoreSetId_;
+    nextStoreSetId_ = (nextStoreSetId_ + 1) % lfst_.size();
+    assignStoreSet(storeIndex, newSetId);
+    assignStoreSet(loadIndex, newSetId);
+  } else if (storeSetId == invalidStoreSet_) {
+    // Only the load belongs to a store set; add the store to it
+    assignStoreSet(storeIndex, loadSetId);
+  } else if (loadSetId == invalidStoreSet_) {
+    // Only the store belongs to a store set; add the load to it
+    assignStoreSet(loadIndex, storeSetId);
+  } else if (storeSetId != loadSetId) {
+    // Both belong to different store sets; merge them into the set with the
+    // smaller ID so that repeated merges converge on a single store set
+    uint32_t mergedSetId = std::min(storeSetId, loadSetId);
+    assignStoreSet(storeIndex, mergedSetId);
+    assignStoreSet(loadIndex, mergedSetId);
+  }
+}
+
+bool StoreSetPredictor::isEnabled() const { return enabled_; }
+
+uint64_t StoreSetPredictor::getSSITIndex(uint64_t address) const {
+  // Discard the lower bits of the address which are constant across aligned
+  // instructions
+  return (address >> 2) % ssit_.size();
+}
+
+void StoreSetPredictor::assignStoreSet(uint64_t index, uint32_t storeSetId) {
+  uint32_t oldSetId = ssit_[index];
+  if (oldSetId != invalidStoreSet_ && oldSetId != storeSetId)
+    lfst_[oldSetId] = nullptr;
+  ssit_[index] = storeSetId;
+}
+
+void StoreSetPredictor::clear() {
+  std::fill(ssit_.begin(), ssit_.end(), invalidStoreSet_);
+  std::fill(lfst_.begin(), lfst_.end(), nullptr);
+}
+
+}  // namespace pipeline
+}  // namespace simeng
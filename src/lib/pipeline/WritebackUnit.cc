@@ -6,21 +6,15 @@ namespace simeng {
 namespace pipeline {
 
 WritebackUnit::WritebackUnit(
-    std::vector<PipelineBuffer<std::shared_ptr<Instruction>>>& completionSlots,
+    TimingWheel<std::shared_ptr<Instruction>>& completions,
     RegisterFileSet& registerFileSet,
     std::function<void(uint64_t insnId)> flagMicroOpCommits)
-    : completionSlots_(completionSlots),
+    : completions_(completions),
       registerFileSet_(registerFileSet),
       flagMicroOpCommits_(flagMicroOpCommits) {}
 
 void WritebackUnit::tick() {
-  for (size_t slot = 0; slot < completionSlots_.size(); slot++) {
-    auto& uop = completionSlots_[slot].getHeadSlots()[0];
-
-    if (uop == nullptr) {
-      continue;
-    }
-
+  for (const auto& uop : completions_.getDueEvents()) {
     auto& results = uop->getResults();
     auto& destinations = uop->getDestinationRegisters();
     for (size_t i = 0; i < results.size(); i++) {
@@ -35,9 +29,8 @@ void WritebackUnit::tick() {
       uop->setCommitReady();
       instructionsWritten_++;
     }
-
-    completionSlots_[slot].getHeadSlots()[0] = nullptr;
   }
+  completions_.clearDueEvents();
 }
 
 uint64_t WritebackUnit::getInstructionsWrittenCount() const {
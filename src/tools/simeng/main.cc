@@ -11,11 +11,8 @@
 #include "simeng/version.hh"
 
 /** Tick the provided core model until it halts. */
-uint64_t simulate(simeng::Core& core,
-                  simeng::memory::MemoryInterface& dataMemory,
-                  simeng::memory::MemoryInterface& instructionMemory) {
-  uint64_t iterations = 0;
-
+void simulate(simeng::Core& core, simeng::memory::MemoryInterface& dataMemory,
+              simeng::memory::MemoryInterface& instructionMemory) {
   // Tick the core and memory interfaces until the program has halted
   while (!core.hasHalted() || dataMemory.hasPendingRequests()) {
     // Tick the core
@@ -24,11 +21,7 @@ uint64_t simulate(simeng::Core& core,
     // Tick memory
     instructionMemory.tick();
     dataMemory.tick();
-
-    iterations++;
   }
-
-  return iterations;
 }
 
 int main(int argc, char** argv) {
@@ -117,27 +110,29 @@ int main(int argc, char** argv) {
 
   // Run simulation
   std::cout << "[SimEng] Starting...\n" << std::endl;
-  uint64_t iterations = 0;
   auto startTime = std::chrono::high_resolution_clock::now();
-  iterations = simulate(*core, *dataMemory, *instructionMemory);
+  simulate(*core, *dataMemory, *instructionMemory);
 
   // Get timing information
   auto endTime = std::chrono::high_resolution_clock::now();
   auto duration =
       std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime)
           .count();
-  double khz = (iterations / (static_cast<double>(duration) / 1000.0)) / 1000.0;
+  // Report the core's cycle count rather than the number of calls to tick(),
+  // as the emulation core may execute several instructions per tick
+  auto stats = core->getStats();
+  uint64_t cycles = std::stoull(stats["cycles"]);
+  double khz = (cycles / (static_cast<double>(duration) / 1000.0)) / 1000.0;
   uint64_t retired = core->getInstructionsRetiredCount();
   double mips = (retired / (static_cast<double>(duration))) / 1000.0;
 
   // Print stats
   std::cout << std::endl;
-  auto stats = core->getStats();
   for (const auto& [key, value] : stats) {
     std::cout << "[SimEng] " << key << ": " << value << std::endl;
   }
   std::cout << std::endl;
-  std::cout << "[SimEng] Finished " << iterations << " ticks in " << duration
+  std::cout << "[SimEng] Finished " << cycles << " cycles in " << duration
             << "ms (" << std::round(khz) << " kHz, " << std::setprecision(2)
             << mips << " MIPS)" << std::endl;
 
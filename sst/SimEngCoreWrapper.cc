@@ -17,9 +17,10 @@ SimEngCoreWrapper::SimEngCoreWrapper(SST::ComponentId_t id, SST::Params& params)
     : SST::Component(id) {
   output_.init("[SSTSimEng:SimEngCoreWrapper] " + getName() + ":@p:@l ", 999, 0,
                SST::Output::STDOUT);
+  clockHandler_ = new SST::Clock::Handler<SimEngCoreWrapper>(
+      this, &SimEngCoreWrapper::clockTick);
   clock_ = registerClock(params.find<std::string>("clock", "1GHz"),
-                         new SST::Clock::Handler<SimEngCoreWrapper>(
-                             this, &SimEngCoreWrapper::clockTick));
+                         clockHandler_);
 
   // Extract variables from config.py
   executablePath_ = params.find<std::string>("executable_path", "");
@@ -31,8 +32,27 @@ SimEngCoreWrapper::SimEngCoreWrapper(SST::ComponentId_t id, SST::Params& params)
   assembleWithSource_ = params.find<bool>("assemble_with_source", false);
   heapStr_ = params.find<std::string>("heap", "");
   debug_ = params.find<bool>("debug", false);
+  suspendClockOnMemoryStall_ =
+      params.find<bool>("suspend_clock_on_memory_stall", false);
+  std::string processGroup = params.find<std::string>("process_group", "");
+
+  // A component of a process group without a workload of its own runs threads
+  // of the process created by another component of the group
+  if (processGroup.length() > 0) {
+    // The cores of a group share a kernel and the RegisterValue pool, neither
+    // of which is thread-safe
+    SST::RankInfo ranks = getNumRanks();
+    if (ranks.rank > 1 || ranks.thread > 1) {
+      output_.verbose(CALL_INFO, 1, 0,
+                      "A simulation containing a process group must run in a "
+                      "single SST rank with a single thread.\n");
+      std::exit(EXIT_FAILURE);
+    }
+    processGroup_ = &getProcessGroup(processGroup);
+    secondary_ = executablePath_.length() == 0 && !assembleWithSource_;
+  }
 
-  if (executablePath_.length() == 0 && !assembleWithSource_) {
+  if (executablePath_.length() == 0 && !assembleWithSource_ && !secondary_) {
     output_.verbose(CALL_INFO, 10, 0,
                     "SimEng executable binary filepath not provided.");
     std::exit(EXIT_FAILURE);
@@ -63,21 +83,55 @@ SimEngCoreWrapper::SimEngCoreWrapper(SST::ComponentId_t id, SST::Params& params)
 
 SimEngCoreWrapper::~SimEngCoreWrapper() {}
 
+SimEngCoreWrapper::ProcessGroup& SimEngCoreWrapper::getProcessGroup(
+    const std::string& name) {
+  static std::map<std::string, ProcessGroup> groups;
+  return groups[name];
+}
+
 void SimEngCoreWrapper::setup() {
   sstMem_->setup();
   output_.verbose(CALL_INFO, 1, 0, "Memory setup complete\n");
+  if (secondary_) {
+    // Register an additional core with the kernel of the group's process
+    if (processGroup_->primary == nullptr) {
+      output_.verbose(CALL_INFO, 1, 0,
+                      "No component of the process group was provided an "
+                      "executable binary.\n");
+      std::exit(EXIT_FAILURE);
+    }
+    kernel_ = processGroup_->primary->getKernel();
+    coreId_ = kernel_->addCore();
+  }
   // Run Simulation
   std::cout << "[SimEng] Starting...\n" << std::endl;
   startTime_ = std::chrono::high_resolution_clock::now();
 }
 
 void SimEngCoreWrapper::handleMemoryEvent(StandardMem::Request* memEvent) {
+  if (clockSuspended_) resumeClock();
   memEvent->handle(handlers_);
 }
 
+void SimEngCoreWrapper::resumeClock() {
+  SST::Cycle_t nextCycle = reregisterClock(clock_, clockHandler_);
+  // Simulate the cycles skipped while suspended before the response is
+  // handled. The core issues no memory requests while blocked, so ticking it
+  // now leaves it in the same state as ticking it on each of those cycles.
+  for (SST::Cycle_t cycle = suspendedCycle_ + 1; cycle < nextCycle; cycle++) {
+    tickSimEng();
+  }
+  clockSuspended_ = false;
+}
+
 void SimEngCoreWrapper::finish() {
   output_.verbose(CALL_INFO, 1, 0,
                   "Simulation complete. Finalising stats....\n");
+  if (core_ == nullptr) {
+    std::cout << "\n[SimEng] Core " << coreId_ << " ran no threads"
+              << std::endl;
+    return;
+  }
 
   auto endTime = std::chrono::high_resolution_clock::now();
   auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
@@ -102,25 +156,33 @@ void SimEngCoreWrapper::finish() {
 
 void SimEngCoreWrapper::init(unsigned int phase) {
   sstMem_->init(phase);
-  // Init can have multiple phases, only fabricate the core once at phase 0
-  if (phase == 0) {
+  // Init can have multiple phases, only fabricate the core once at phase 0. The
+  // cores of additional components of a process group are constructed once
+  // the process has a thread for them to run
+  if (phase == 0 && !secondary_) {
     fabricateSimEngCore();
   }
 }
 
 bool SimEngCoreWrapper::clockTick(SST::Cycle_t current_cycle) {
-  // Tick the core and memory interfaces until the program has halted
-  if (!core_->hasHalted() || dataMemory_->hasPendingRequests()) {
-    // Tick the data memory.
-    dataMemory_->tick();
-
-    // Tick the core.
-    core_->tick();
-
-    // Tick the instruction memory.
-    instructionMemory_->tick();
+  // An additional core idles until the process has a thread for it to run
+  if (core_ == nullptr && !startSecondaryCore()) {
+    if (kernel_->getLiveThreadCount() > 0) return false;
+    primaryComponentOKToEndSim();
+    return true;
+  }
 
-    iterations_++;
+  // Tick the core and memory interfaces until the program has halted
+  if (!hasFinished() || dataMemory_->hasPendingRequests()) {
+    tickSimEng();
+
+    // Unregister the clock while the core is blocked on memory, until the
+    // next memory response arrives
+    if (suspendClockOnMemoryStall_ && core_->isWaitingOnMemory()) {
+      clockSuspended_ = true;
+      suspendedCycle_ = current_cycle;
+      return true;
+    }
 
     return false;
   } else {
@@ -129,6 +191,45 @@ bool SimEngCoreWrapper::clockTick(SST::Cycle_t current_cycle) {
     return true;
   }
 }
+
+bool SimEngCoreWrapper::hasFinished() const {
+  // Cores of a process group still running a thread stop once the process
+  // exits
+  return core_->hasHalted() ||
+         (processGroup_ != nullptr && kernel_->getLiveThreadCount() == 0);
+}
+
+bool SimEngCoreWrapper::startSecondaryCore() {
+  kernel_->setCurrentCore(coreId_);
+  if (kernel_->resumeThread() == nullptr) return false;
+
+  coreInstance_ =
+      std::make_unique<simeng::CoreInstance>(*processGroup_->primary, coreId_);
+  coreInstance_->setL1DataMemory(dataMemory_);
+  coreInstance_->createCore();
+  core_ = coreInstance_->getCore();
+  instructionMemory_ = coreInstance_->getInstructionMemory();
+  output_.verbose(CALL_INFO, 1, 0, "SimEng core %u started\n",
+                  unsigned(coreId_));
+  return true;
+}
+
+void SimEngCoreWrapper::tickSimEng() {
+  // Tick the data memory.
+  dataMemory_->tick();
+
+  // Tick the core.
+  core_->tick();
+
+  // Send the memory requests made by the core this cycle to SST.
+  dataMemory_->sendPendingRequests();
+
+  // Tick the instruction memory.
+  instructionMemory_->tick();
+
+  iterations_++;
+}
+
 std::string SimEngCoreWrapper::trimSpaces(std::string strArgs) {
   int trailingEnd = -1;
   int leadingEnd = -1;
@@ -303,6 +404,18 @@ void SimEngCoreWrapper::fabricateSimEngCore() {
   // Get remaining simulation objects needed to forward simulation
   core_ = coreInstance_->getCore();
   instructionMemory_ = coreInstance_->getInstructionMemory();
+  kernel_ = coreInstance_->getKernel();
+
+  // Make the process available to the other components of its group
+  if (processGroup_ != nullptr) {
+    if (processGroup_->primary != nullptr) {
+      output_.verbose(CALL_INFO, 1, 0,
+                      "Multiple components of the process group were provided "
+                      "a workload.\n");
+      std::exit(EXIT_FAILURE);
+    }
+    processGroup_->primary = coreInstance_.get();
+  }
 
   // This check ensures that SST has enough memory to store the entire
   // processImage constructed by SimEng.
@@ -5,6 +5,7 @@
 
 #include "SimEngMemInterface.hh"
 
+#include <algorithm>
 #include <iostream>
 
 using namespace SST::SSTSimEng;
@@ -31,19 +32,17 @@ void SimEngMemInterface::sendProcessImageToSST(char* image, uint64_t size) {
   return;
 };
 
-template <typename T,
-          typename std::enable_if<std::is_base_of<
-              SimEngMemInterface::SimEngMemoryRequest, T>::value>::type*>
-std::vector<StandardMem::Request*> SimEngMemInterface::makeSSTRequests(
-    T* aggrReq, uint64_t addrStart, uint64_t addrEnd, uint64_t size) {
+template <typename F>
+void SimEngMemInterface::forEachCacheLineFragment(uint64_t addrStart,
+                                                  uint64_t size, F fn) const {
   /*
-      Here we check if the memory request spans multiple cache lines.
-      i.e from the start address to the end of the cache line there isn't
-      enough space to store data or the data to read continues to succeeding
-      cache lines. To handle this case the request addresses are divided as
-      follows:
+      Here we divide the memory request into the portions falling within each
+      cache line it spans. i.e from the start address to the end of the cache
+      line there may not be enough space to store data or the data to read may
+      continue to succeeding cache lines. To handle this case the request
+      addresses are divided as follows:
           1) addrStart to end of first cache-line.
-          2) Start of second cache-line to addrEnd.
+          2) Start of second cache-line to addrEnd, one cache line at a time.
       Note: addrEnd can be multiple cache-lines ahead of addrStart
 
       |   cache-line 1   |   cache-line 2   |
@@ -56,97 +55,76 @@ std::vector<StandardMem::Request*> SimEngMemInterface::makeSSTRequests(
       |             Request size            |
       |------------------|------------------|
   */
-  if (requestSpansMultipleCacheLines(addrStart, addrEnd)) {
-    std::vector<StandardMem::Request*> reqs;
-    uint64_t cacheLineEndAddr =
-        nearestCacheLineEnd(addrStart) * cacheLineWidth_;
-    uint64_t firstFragmentSize = cacheLineEndAddr - addrStart;
-    uint64_t secondFragmentSize = size - firstFragmentSize;
-    std::vector<StandardMem::Request*> rvec1 =
-        splitAggregatedRequest(aggrReq, addrStart, firstFragmentSize);
-    std::vector<StandardMem::Request*> rvec2 =
-        splitAggregatedRequest(aggrReq, cacheLineEndAddr, secondFragmentSize);
-    reqs.insert(reqs.end(), rvec1.begin(), rvec1.end());
-    reqs.insert(reqs.end(), rvec2.begin(), rvec2.end());
-    return reqs;
+  uint64_t offset = 0;
+  while (offset < size) {
+    uint64_t address = addrStart + offset;
+    uint64_t cacheLineEndAddr = nearestCacheLineEnd(address) * cacheLineWidth_;
+    uint64_t fragmentSize = std::min(cacheLineEndAddr - address, size - offset);
+    fn(address, fragmentSize, offset);
+    offset += fragmentSize;
   }
-  return splitAggregatedRequest(aggrReq, addrStart, size);
 }
 
-std::vector<StandardMem::Request*> SimEngMemInterface::splitAggregatedRequest(
-    AggregateWriteRequest* aggrReq, uint64_t addrStart, uint64_t size) {
-  std::vector<StandardMem::Request*> requests;
-  uint64_t dataIndex = 0;
-  // Determine the number of cache-lines needed to store the data in the write
-  // request
-  int numCacheLinesNeeded = getNumCacheLinesNeeded(size);
-  /*
-      This check here increments the data index to a value indexing the portion
-     of data which succeeds the portion data already copied incase the request
-     spans multiple cache-lines. In reference to the diagram above, this check
-     will succeed only for cache-line 2.
-  */
-  if (addrStart > aggrReq->target.address) {
-    dataIndex += addrStart - aggrReq->target.address;
+SimEngMemInterface::CoalescedRequest* SimEngMemInterface::findPendingRequest(
+    uint64_t address) const {
+  uint64_t cacheLine = address / cacheLineWidth_;
+  // Few requests are made each cycle, so search from the most recent
+  for (auto itr = pendingRequests_.rbegin(); itr != pendingRequests_.rend();
+       itr++) {
+    if ((*itr)->address / cacheLineWidth_ == cacheLine) return *itr;
   }
-  // Loop used to divide a write request from SimEng based on cache-line size.
-  for (int x = 0; x < numCacheLinesNeeded; x++) {
-    uint64_t currReqSize = size;
-    if (size > cacheLineWidth_) {
-      size -= cacheLineWidth_;
-      currReqSize = cacheLineWidth_;
-    }
-    // SST write requests accept uint8_t vectors as data.
-    std::vector<uint8_t> payload;
-    payload.resize(currReqSize);
-
-    // Fill the payload vector currReqSize number of bytes starting
-    // and inclusive of the dataIndex.
-    const char* data = aggrReq->data.getAsVector<char>();
-    memcpy((void*)&payload[0], &(data[dataIndex]), currReqSize);
-    StandardMem::Request* writeReq =
-        new StandardMem::Write(addrStart, currReqSize, payload);
+  return nullptr;
+}
 
-    dataIndex += currReqSize;
-    addrStart += currReqSize;
-    requests.push_back(writeReq);
+void SimEngMemInterface::queueReadFragment(AggregateReadRequest* aggrReq,
+                                           uint64_t address, uint64_t size,
+                                           uint64_t offset) {
+  CoalescedRequest* request = findPendingRequest(address);
+  if (request != nullptr && !request->isWrite) {
+    // Widen the pending read to also cover this fragment
+    uint64_t end = std::max(request->address + request->size, address + size);
+    request->address = std::min(request->address, address);
+    request->size = end - request->address;
+  } else {
+    request = coalescedRequestPool_.acquire();
+    request->isWrite = false;
+    request->address = address;
+    request->size = size;
+    request->fragments.clear();
+    pendingRequests_.push_back(request);
   }
-  return requests;
+  request->fragments.push_back({aggrReq, address, size, offset});
+  // Increase the aggregate count to denote the number of fragments a read
+  // request from SimEng was split into.
+  aggrReq->aggregateCount_++;
 }
 
-std::vector<StandardMem::Request*> SimEngMemInterface::splitAggregatedRequest(
-    AggregateReadRequest* aggrReq, uint64_t addrStart, uint64_t size) {
-  std::vector<StandardMem::Request*> requests;
-  // Get the number of cache-lines needed to read the data requested by the read
-  // request.
-  int numCacheLinesNeeded = getNumCacheLinesNeeded(size);
-
-  // Loop used to divide a read request from SimEng based on cache-line size.
-  for (int x = 0; x < numCacheLinesNeeded; x++) {
-    uint64_t currReqSize = size;
-    if (size > cacheLineWidth_) {
-      size -= cacheLineWidth_;
-      currReqSize = cacheLineWidth_;
+void SimEngMemInterface::queueWriteFragment(uint64_t address, uint64_t size,
+                                            const uint8_t* data) {
+  CoalescedRequest* request = findPendingRequest(address);
+  // Only merge writes whose ranges touch or overlap, such that the merged
+  // write doesn't cover any bytes neither wrote
+  if (request != nullptr && request->isWrite &&
+      address <= request->address + request->size &&
+      request->address <= address + size) {
+    uint64_t start = std::min(request->address, address);
+    uint64_t end = std::max(request->address + request->size, address + size);
+    if (start < request->address) {
+      request->data.insert(request->data.begin(), request->address - start, 0);
     }
-
-    StandardMem::Request* readReq =
-        new StandardMem::Read(addrStart, currReqSize);
-
-    // Increase the aggregate count to denote the number SST requests a read
-    // request from SimEng was split into.
-    aggrReq->aggregateCount_++;
-    addrStart += currReqSize;
-    requests.push_back(readReq);
-    /*
-    Insert a key-value pair of SST request id and AggregatedReadRequest
-    reference in the aggregation map. These key-value pairs will later be
-    used to store read response data recieved from SST. This models a
-    many-to-one relation between multiple SST requests and a SimEng read
-    request.
-    */
-    aggregationMap_.insert({readReq->getID(), aggrReq});
+    request->data.resize(end - start);
+    request->address = start;
+    request->size = end - start;
+  } else {
+    request = coalescedRequestPool_.acquire();
+    request->isWrite = true;
+    request->address = address;
+    request->size = size;
+    request->data.resize(size);
+    pendingRequests_.push_back(request);
   }
-  return requests;
+  // Later writes take precedence over any earlier write to the same bytes
+  memcpy(&request->data[address - request->address], data, size);
 }
 
 void SimEngMemInterface::requestRead(const memory::MemoryAccessTarget& target,
@@ -166,9 +144,16 @@ void SimEngMemInterface::requestRead(const memory::MemoryAccessTarget& target,
     return;
   }
 
-  AggregateReadRequest* aggrReq = new AggregateReadRequest(target, requestId);
-  std::vector<StandardMem::Request*> requests =
-      makeSSTRequests<AggregateReadRequest>(aggrReq, addrStart, addrEnd, size);
+  AggregateReadRequest* aggrReq = readRequestPool_.acquire();
+  aggrReq->target = target;
+  aggrReq->id_ = requestId;
+  aggrReq->data_.resize(size);
+  aggrReq->aggregateCount_ = 0;
+  forEachCacheLineFragment(
+      addrStart, size,
+      [&](uint64_t address, uint64_t fragmentSize, uint64_t offset) {
+        queueReadFragment(aggrReq, address, fragmentSize, offset);
+      });
   // SST output data parsed by the testing framework.
   // Format:
   // [SSTSimEng:SSTDebug] MemRead-read-<type=request|response>-<request ID>
@@ -176,27 +161,41 @@ void SimEngMemInterface::requestRead(const memory::MemoryAccessTarget& target,
   if (debug_) {
     std::cout << "[SSTSimEng:SSTDebug] MemRead"
               << "-read-request-" << requestId << "-cycle-" << tickCounter_
-              << "-split-" << requests.size() << std::endl;
-  }
-  for (StandardMem::Request* req : requests) {
-    sstMem_->send(req);
+              << "-split-" << aggrReq->aggregateCount_ << std::endl;
   }
 }
 
 void SimEngMemInterface::requestWrite(const memory::MemoryAccessTarget& target,
                                       const RegisterValue& data) {
-  uint64_t addrStart = target.address;
-  uint64_t size = unsigned(target.size);
-  uint64_t addrEnd = addrStart + size - 1;
-
-  AggregateWriteRequest* aggrReq = new AggregateWriteRequest(target, data);
-  std::vector<StandardMem::Request*> requests =
-      makeSSTRequests<AggregateWriteRequest>(aggrReq, addrStart, addrEnd, size);
+  const uint8_t* bytes = data.getAsVector<uint8_t>();
+  forEachCacheLineFragment(
+      target.address, unsigned(target.size),
+      [&](uint64_t address, uint64_t fragmentSize, uint64_t offset) {
+        queueWriteFragment(address, fragmentSize, bytes + offset);
+      });
+}
 
-  for (StandardMem::Request* req : requests) {
-    sstMem_->send(req);
+void SimEngMemInterface::sendPendingRequests() {
+  for (CoalescedRequest* request : pendingRequests_) {
+    if (request->isWrite) {
+      sstMem_->send(
+          new StandardMem::Write(request->address, request->size,
+                                 request->data));
+      coalescedRequestPool_.release(request);
+      continue;
+    }
+    StandardMem::Request* readReq =
+        new StandardMem::Read(request->address, request->size);
+    /*
+    Insert a key-value pair of SST request id and CoalescedRequest reference in
+    the aggregation map. These key-value pairs will later be used to store read
+    response data recieved from SST into each SimEng read request the
+    CoalescedRequest serves.
+    */
+    aggregationMap_.insert({readReq->getID(), request});
+    sstMem_->send(readReq);
   }
-  delete aggrReq;
+  pendingRequests_.clear();
 }
 
 void SimEngMemInterface::tick() { tickCounter_++; }
@@ -206,7 +205,7 @@ void SimEngMemInterface::clearCompletedReads() {
 }
 
 bool SimEngMemInterface::hasPendingRequests() const {
-  return aggregationMap_.size() > 0;
+  return pendingRequests_.size() > 0 || aggregationMap_.size() > 0;
 };
 
 const span<memory::MemoryReadResult> SimEngMemInterface::getCompletedReads()
@@ -215,44 +214,50 @@ const span<memory::MemoryReadResult> SimEngMemInterface::getCompletedReads()
           completedReadRequests_.size()};
 };
 
+void SimEngMemInterface::handleReadResponse(CoalescedRequest* request,
+                                            const std::vector<uint8_t>& data) {
+  for (const ReadFragment& fragment : request->fragments) {
+    AggregateReadRequest* aggrReq = fragment.aggrReq;
+    memcpy(&aggrReq->data_[fragment.offset],
+           &data[fragment.address - request->address], fragment.size);
+    /*
+        Decrement aggregateCount as we keep on recieving responses from SST.
+        If all responses have been recieved send the data back to SimEng.
+    */
+    if (--aggrReq->aggregateCount_ <= 0) {
+      aggregatedReadResponses(aggrReq);
+    }
+  }
+  coalescedRequestPool_.release(request);
+}
+
 void SimEngMemInterface::aggregatedReadResponses(
     AggregateReadRequest* aggrReq) {
   if (aggrReq->aggregateCount_ != 0) return;
-  std::vector<uint8_t> mergedData;
-  // Loop through the ordered map and merge the data in order inside the
-  // mergedData vector. Also remove entries from the aggregation_map as we loop
-  // through each SST Request id.
-  for (auto itr = aggrReq->responseMap_.begin();
-       itr != aggrReq->responseMap_.end(); itr++) {
-    mergedData.insert(mergedData.end(), itr->second.begin(), itr->second.end());
-    aggregationMap_.erase(itr->first);
-  }
-  // Send the completed read request back to SimEng via the
-  // completed_read_requests queue.
-  uint64_t resp = 0;
-  for (int x = mergedData.size() - 1; x >= 0; x--) {
-    resp = (resp << 8) | mergedData[x];
-  }
   // SST output data parsed by the testing framework.
   // Format:
   // [SSTSimEng:SSTDebug] MemRead-read-<type=request|response>-<request ID>
   // -cycle-<cycle count>-data-<value>
   uint64_t id = aggrReq->id_;
   if (debug_) {
+    uint64_t resp = 0;
+    for (int x = aggrReq->data_.size() - 1; x >= 0; x--) {
+      resp = (resp << 8) | aggrReq->data_[x];
+    }
     std::cout << "[SSTSimEng:SSTDebug] MemRead"
               << "-read-response-" << id << "-cycle-" << tickCounter_
               << "-data-" << resp << std::endl;
   }
 
-  const char* char_data = reinterpret_cast<const char*>(&mergedData[0]);
+  // Send the completed read request back to SimEng via the
+  // completed_read_requests queue.
+  const char* char_data = reinterpret_cast<const char*>(&aggrReq->data_[0]);
   completedReadRequests_.push_back(
       {aggrReq->target,
        RegisterValue(char_data, uint16_t(unsigned(aggrReq->target.size))),
        aggrReq->id_});
 
-  // Cleanup
-  aggrReq->responseMap_.clear();
-  delete aggrReq;
+  readRequestPool_.release(aggrReq);
 }
 
 void SimEngMemInterface::SimEngMemHandlers::handle(
@@ -262,48 +267,23 @@ void SimEngMemInterface::SimEngMemHandlers::handle(
 
 void SimEngMemInterface::SimEngMemHandlers::handle(StandardMem::ReadResp* rsp) {
   uint64_t id = rsp->getID();
-  auto data = rsp->data;
-  delete rsp;
 
   // Upon recieving a response from SST the aggregation_map is used to retrieve
-  // the AggregatedReadRequest the recieved SST response is a part of.
+  // the CoalescedRequest the recieved SST response was sent for.
   auto itr = memInterface_.aggregationMap_.find(id);
-  if (itr == memInterface_.aggregationMap_.end()) return;
-  /*
-      After succesful retrieval of AggregatedReadRequest from aggregation_map
-     the response data is stored inside the AggregatedReadRequest in an ordered
-     map. It is neccesary to maintain order in which the orginal read request
-     from SimEng was split into otherwise garbage values will be obtained upon
-     merging. An ordered map is used here because SST::StandardMem::Request ids
-     are generated using an atomic incrementing couter. Reference -
-     "interfaces/stdMem.(hh/cc)" (SST-Core)
-  */
-  SimEngMemInterface::AggregateReadRequest* aggrReq = itr->second;
-  aggrReq->responseMap_.insert({id, data});
-  /*
-      Decrement aggregateCount as we keep on recieving responses from SST.
-      If all responses have been recieved aggregate all responses and send
-      data back to SimEng.
-  */
-  if (--aggrReq->aggregateCount_ <= 0) {
-    memInterface_.aggregatedReadResponses(aggrReq);
+  if (itr == memInterface_.aggregationMap_.end()) {
+    delete rsp;
+    return;
   }
+  SimEngMemInterface::CoalescedRequest* request = itr->second;
+  memInterface_.aggregationMap_.erase(itr);
+  memInterface_.handleReadResponse(request, rsp->data);
+  delete rsp;
 }
 
-int SimEngMemInterface::getNumCacheLinesNeeded(uint64_t size) const {
-  if (size < cacheLineWidth_) return 1;
-  if (size % cacheLineWidth_ == 0) return size / cacheLineWidth_;
-  return (size / cacheLineWidth_) + 1;
-}
 bool SimEngMemInterface::unsignedOverflow_(uint64_t a, uint64_t b) const {
   return (a + b) < a || (a + b) < b;
 };
-bool SimEngMemInterface::requestSpansMultipleCacheLines(
-    uint64_t addrStart, uint64_t addrEnd) const {
-  uint64_t lineDiff =
-      (addrEnd / cacheLineWidth_) - (addrStart / cacheLineWidth_);
-  return lineDiff > 0;
-};
 uint64_t SimEngMemInterface::nearestCacheLineEnd(uint64_t addrStart) const {
   return (addrStart / cacheLineWidth_) + 1;
-};
\ No newline at end of file
+};
@@ -72,7 +72,9 @@ class SimEngCoreWrapper : public SST::Component {
   /**
    * The clockTick is a method present in all SST::Components. This fuction
    * is called everytime the SST clock ticks. The current clock cycle is passed
-   * as an argument by SST. The SimEng core ticks in this method.
+   * as an argument by SST. The SimEng core ticks in this method. Returns true
+   * to unregister the clock, either once the simulation has finished or, if
+   * enabled, while the core is blocked on memory.
    */
   bool clockTick(SST::Cycle_t currentCycle);
 
@@ -80,7 +82,8 @@ class SimEngCoreWrapper : public SST::Component {
    * This handle event method is registered to StandardMem interface. This
    * method is called everytime a memory request is forwarded by the interface.
    * This function acts as a callback and invokes SimEngMemHandler on the memory
-   * requests.
+   * requests. If the clock was unregistered while the core was blocked on
+   * memory, it is re-registered before the request is handled.
    */
   void handleMemoryEvent(StandardMem::Request* memEvent);
 
@@ -134,7 +137,19 @@ class SimEngCoreWrapper : public SST::Component {
       {"debug",
        "Value which enables output statistics that can be parsed by the "
        "testing framework. (boolean)",
-       "false"})
+       "false"},
+      {"suspend_clock_on_memory_stall",
+       "Value which enables unregistering the SST clock while the SimEng core "
+       "is blocked on memory. The cycles skipped are simulated once the next "
+       "memory response arrives. (boolean)",
+       "false"},
+      {"process_group",
+       "Value which names a group of components simulating the cores of a "
+       "single process. The one component of the group given an executable "
+       "creates the process; the threads it spawns are run by any component "
+       "of the group without one. All components of a group must be in the "
+       "same SST rank. (string)",
+       ""})
 
  private:
   /** Method used to assemble SimEng core. */
@@ -154,6 +169,36 @@ class SimEngCoreWrapper : public SST::Component {
   /** Initialises heap data specified by the testing framework. */
   void initialiseHeapData();
 
+  /** Tick the core and memory interfaces for a single cycle. */
+  void tickSimEng();
+
+  /** Re-register the clock unregistered while the core was blocked on memory,
+   * first simulating the cycles skipped in the meantime. */
+  void resumeClock();
+
+  /** Whether the simulated core has finished executing, either by halting or
+   * by the process it belongs to exiting. */
+  bool hasFinished() const;
+
+  /** Construct the core of a component without an executable, should the
+   * process of its group have a thread for it to run. Returns true if the
+   * core was constructed. */
+  bool startSecondaryCore();
+
+  /**
+   * The components simulating the cores of a single process. The kernel of the
+   * process, and the global pool RegisterValues are allocated from, are shared
+   * between the cores without synchronisation, so a simulation containing a
+   * process group must run in a single SST rank with a single thread.
+   */
+  struct ProcessGroup {
+    /** The CoreInstance of the component which created the process. */
+    simeng::CoreInstance* primary = nullptr;
+  };
+
+  /** Retrieve the process group named `name`, creating it if needed. */
+  static ProcessGroup& getProcessGroup(const std::string& name);
+
   // SST properties
   /**
    * SST defined output class used to output information to standard output.
@@ -169,6 +214,10 @@ class SimEngCoreWrapper : public SST::Component {
    */
   TimeConverter* clock_;
 
+  /** Handler registered to `clock_`, retained to re-register the clock after
+   * it is unregistered while the core is blocked on memory. */
+  SST::Clock::HandlerBase* clockHandler_;
+
   /**
    * SST::Interfaces::StandardMem interface responsible for converting
    * SST::StandardMem::Request(s) into SST memory events to be passed
@@ -230,6 +279,28 @@ class SimEngCoreWrapper : public SST::Component {
   /** Variable to enable parseable print debug statements in test mode. */
   bool debug_ = false;
 
+  /** Whether to unregister the clock while the core is blocked on memory. */
+  bool suspendClockOnMemoryStall_ = false;
+
+  /** Whether the clock is currently unregistered. */
+  bool clockSuspended_ = false;
+
+  /** The process group this component belongs to, if any. */
+  ProcessGroup* processGroup_ = nullptr;
+
+  /** Whether this component runs threads of a process created by another
+   * component of its process group. */
+  bool secondary_ = false;
+
+  /** The kernel of the process simulated, once the core has been set up. */
+  std::shared_ptr<simeng::kernel::Linux> kernel_;
+
+  /** The ID of this component's core with the kernel. */
+  uint16_t coreId_ = 0;
+
+  /** The last cycle ticked before the clock was unregistered. */
+  SST::Cycle_t suspendedCycle_ = 0;
+
   /** Path to A64fx model config. */
   const std::string a64fxConfigPath_ =
       std::string(SIMENG_BUILD_DIR) +
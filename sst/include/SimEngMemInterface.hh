@@ -11,9 +11,10 @@
 #include <iomanip>
 #include <iostream>
 #include <map>
+#include <memory>
 #include <set>
 #include <string>
-#include <type_traits>
+#include <unordered_map>
 #include <vector>
 
 #include "simeng/memory/MemoryInterface.hh"
@@ -36,15 +37,17 @@ class SimEngMemInterface : public memory::MemoryInterface {
   void sendProcessImageToSST(char* image, uint64_t size);
 
   /**
-   * Construct an AggregatedReadRequest and use it to generate
-   * SST::StandardMem::Read request(s). These request(s) are then sent to SST.
+   * Construct an AggregateReadRequest and split it into the cache-line
+   * fragments it spans. These fragments are coalesced with any other requests
+   * made this cycle and sent to SST by `sendPendingRequests`.
    */
   void requestRead(const memory::MemoryAccessTarget& target,
                    uint64_t requestId = 0);
 
   /**
-   * Construct an AggregatedWriteRequest and use it to generate
-   * SST::StandardMem::Write request(s). These request(s) are then sent to SST.
+   * Split a write into the cache-line fragments it spans. These fragments are
+   * coalesced with any other requests made this cycle and sent to SST by
+   * `sendPendingRequests`.
    */
   void requestWrite(const memory::MemoryAccessTarget& target,
                     const RegisterValue& data);
@@ -65,6 +68,12 @@ class SimEngMemInterface : public memory::MemoryInterface {
    */
   void tick();
 
+  /**
+   * Send the requests coalesced this cycle to SST, in the order they were
+   * made. Must be called once the core has ticked.
+   */
+  void sendPendingRequests();
+
   /**
    * An instance of `SimEngMemHandlers` is registered to an instance of
    * SST::StandardMem and is used to handle Read and Write response. The same
@@ -100,62 +109,87 @@ class SimEngMemInterface : public memory::MemoryInterface {
   };
 
   /**
-   * This struct represents a memory request from SimEng. It is used as base
-   * struct for AggregateWriteRequest and AggregateReadRequest.
+   * Struct AggregateReadRequest is used to store information regarding the
+   * cache-line fragments a read request from SimEng is split into. This
+   * happens if the request spans multiple cache lines. These structs are also
+   * used to represent SimEng read requests which aren't split for ease of
+   * implementation.
    */
-  struct SimEngMemoryRequest {
+  struct AggregateReadRequest {
     /** memory::MemoryAccessTarget from SimEng memory instruction. */
-    const memory::MemoryAccessTarget target;
+    memory::MemoryAccessTarget target;
+    /** Unique identifier of each AggregateReadRequest copied from SimEng read
+     * request. */
+    uint64_t id_ = 0;
+    /** The data read so far, filled in by each fragment as its response is
+     * recieved. */
+    std::vector<uint8_t> data_;
+    /** Number of fragments still awaiting a response from SST. */
+    int aggregateCount_ = 0;
+  };
 
-    SimEngMemoryRequest() : target(memory::MemoryAccessTarget()){};
-    SimEngMemoryRequest(const memory::MemoryAccessTarget& target)
-        : target(target){};
+  /** The portion of a SimEng read request served by a coalesced SST read. */
+  struct ReadFragment {
+    /** The SimEng read request this fragment belongs to. */
+    AggregateReadRequest* aggrReq;
+    /** The address of the fragment. */
+    uint64_t address;
+    /** The size of the fragment in bytes. */
+    uint64_t size;
+    /** The offset of the fragment within the SimEng read request's data. */
+    uint64_t offset;
   };
 
   /**
-   * Struct AggregatedWriteRequest is used to store information regarding
-   * the multiple SST::StandardMem::Request (Write) a memory request from SimEng
-   * is split into. This happens if its size is greater than the cache line
-   * width. These structs are also used to represent SimEng write requests which
-   * aren't split for ease of implementation.
+   * Struct CoalescedRequest represents a single SST::StandardMem::Request,
+   * covering the contiguous range of one cache line accessed by one or more
+   * SimEng requests in the same cycle.
    */
-  struct AggregateWriteRequest : public SimEngMemoryRequest {
-    /** RegisterValue (write data) from SimEng memory instruction. */
-    const RegisterValue data;
-
-    AggregateWriteRequest() : SimEngMemoryRequest(), data(RegisterValue()){};
-    AggregateWriteRequest(const memory::MemoryAccessTarget& target,
-                          const RegisterValue& data)
-        : SimEngMemoryRequest(target), data(data){};
+  struct CoalescedRequest {
+    /** Whether the request is a write rather than a read. */
+    bool isWrite = false;
+    /** The start address of the range covered. */
+    uint64_t address = 0;
+    /** The size of the range covered in bytes. */
+    uint64_t size = 0;
+    /** The data to write, for a write request. */
+    std::vector<uint8_t> data;
+    /** The fragments of SimEng read requests served, for a read request. */
+    std::vector<ReadFragment> fragments;
   };
 
+ private:
   /**
-   * Struct AggregatedReadRequest is used to store information regarding
-   * the multiple SST::StandardMem::Request (Read) a memory request from SimEng
-   * is split into. This happens if its size is greater than the cache line
-   * width. These structs are also used to represent SimEng read requests which
-   * aren't split for ease of implementation.
+   * A pool of reusable objects. Objects are owned by the pool for its entire
+   * lifetime, such that any containers they hold keep their capacity between
+   * uses and requests in steady state do not allocate.
    */
-  struct AggregateReadRequest : public SimEngMemoryRequest {
-    /** Unique identifier of each AggregatedReadRequest copied from SimEng read
-     * request. */
-    const uint64_t id_;
-    /**
-     * This response map is used to store all responses of SST read request,
-     * this aggregated read request was split into. An ordered map is used to
-     * record and maintain the order to split responses.
-     */
-    std::map<uint64_t, std::vector<uint8_t>> responseMap_;
-    /** Total number of SST request the SimEng memory request was split into. */
-    int aggregateCount_ = 0;
-
-    AggregateReadRequest() : SimEngMemoryRequest(), id_(0){};
-    AggregateReadRequest(const memory::MemoryAccessTarget& target,
-                         const uint64_t id)
-        : SimEngMemoryRequest(target), id_(id) {}
+  template <typename T>
+  class RequestPool {
+   public:
+    /** Retrieve an unused object. Its contents are those left by its previous
+     * user. */
+    T* acquire() {
+      if (free_.empty()) {
+        objects_.push_back(std::make_unique<T>());
+        return objects_.back().get();
+      }
+      T* object = free_.back();
+      free_.pop_back();
+      return object;
+    }
+
+    /** Return `object` to the pool for reuse. */
+    void release(T* object) { free_.push_back(object); }
+
+   private:
+    /** All objects allocated by the pool. */
+    std::vector<std::unique_ptr<T>> objects_;
+
+    /** The objects not currently in use. */
+    std::vector<T*> free_;
   };
 
- private:
   /**
    * SST::Interfaces::StandardMem interface responsible for converting
    * SST::StandardMem::Request(s) into SST memory events to be passed
@@ -176,60 +210,65 @@ class SimEngMemInterface : public memory::MemoryInterface {
   std::vector<memory::MemoryReadResult> completedReadRequests_;
 
   /**
-   * This map is used to store unique ids of SST::StandardMem::Read requests and
-   * their corresponding AggregateReadRequest as key-value pairs (In some cases
-   * SimEngMemoryRequest has to be divided into multiple
-   * SST::StandardMem::Request(s) if the SimEngMemoryRequest size > cache line
-   * width). That is, the unique ids of multiple read requests and their
-   * corresponding aggregatedReadRequest are stored in a many-to-one fashion.
-   * An entry from this map is removed when a response for
-   * SST::StandardMem::Read request is recieved and recorded. The response holds
-   * the same unique id as the request. No such key-value pairs are maintained
-   * for AggregatedWriteRequest(s) even if they are split into multiple
-   * SST::StandardMem::Write requests as their responses do not need to be
-   * aggregated.
+   * The requests made this cycle which are yet to be sent to SST, in the order
+   * they were made. A fragment is merged into the most recent pending request
+   * to the same cache line if both are reads, or if both are writes and their
+   * ranges are contiguous, such that the order of accesses to each cache line
+   * is preserved.
    */
-  std::unordered_map<uint64_t, AggregateReadRequest*> aggregationMap_;
-
-  /** This method only accepts structs derived from the SimEngMemoryRequest
-   * struct as the value for aggrReq. */
-  template <typename T, typename std::enable_if<std::is_base_of<
-                            SimEngMemoryRequest, T>::value>::type* = nullptr>
-  std::vector<StandardMem::Request*> makeSSTRequests(T* aggrReq,
-                                                     uint64_t addrStart,
-                                                     uint64_t addrEnd,
-                                                     uint64_t size);
-
-  /** The overloaded instance of splitAggregatedRequest is used to split an
-   * AggregatedWriteRequest into multiple SST write requests.
-   */
-  std::vector<StandardMem::Request*> splitAggregatedRequest(
-      AggregateWriteRequest* aggrReq, uint64_t addrStart, uint64_t size);
+  std::vector<CoalescedRequest*> pendingRequests_;
 
-  /** The overloaded instance of splitAggregatedRequest is used to split an
-   * AggregatedReadRequest into multiple SST read requests.
+  /**
+   * This map is used to store unique ids of SST::StandardMem::Read requests and
+   * the CoalescedRequest they were sent for as key-value pairs. Each
+   * CoalescedRequest may in turn serve fragments of several
+   * AggregateReadRequest(s), and an AggregateReadRequest may be split across
+   * several CoalescedRequest(s) if it spans multiple cache lines. An entry from
+   * this map is removed when a response for the SST::StandardMem::Read request
+   * is recieved and recorded. The response holds the same unique id as the
+   * request. No such key-value pairs are maintained for writes as their
+   * responses do not need to be aggregated.
    */
-  std::vector<StandardMem::Request*> splitAggregatedRequest(
-      AggregateReadRequest* aggrReq, uint64_t addrStart, uint64_t size);
+  std::unordered_map<uint64_t, CoalescedRequest*> aggregationMap_;
 
-  /** This method is used to aggregate responses from multiple read request into
-   * one response. */
-  void aggregatedReadResponses(AggregateReadRequest* aggrReq);
+  /** Pool of AggregateReadRequest(s). */
+  RequestPool<AggregateReadRequest> readRequestPool_;
 
-  /** Get the number of cache lines needed incase the size of a memory request
-   * is larger than cache line width.
-   */
-  int getNumCacheLinesNeeded(uint64_t size) const;
-  bool unsignedOverflow_(uint64_t a, uint64_t b) const;
+  /** Pool of CoalescedRequest(s). */
+  RequestPool<CoalescedRequest> coalescedRequestPool_;
 
   /**
-   * Check to see if a request spans multiple cache lines. This method
-   * identifies the case when the start and end address of the request do not
-   * lie on the same cache line. This can even happen if the size of the memory
-   * request is less than cache line width.
+   * Split the access of `size` bytes starting at `addrStart` into the
+   * fragments falling within each cache line it spans, calling
+   * `fn(address, size, offset)` for each, where `offset` is the position of
+   * the fragment within the access.
    */
-  bool requestSpansMultipleCacheLines(uint64_t addrStart,
-                                      uint64_t addrEnd) const;
+  template <typename F>
+  void forEachCacheLineFragment(uint64_t addrStart, uint64_t size, F fn) const;
+
+  /** Add a fragment of a SimEng read request to the pending requests. */
+  void queueReadFragment(AggregateReadRequest* aggrReq, uint64_t address,
+                         uint64_t size, uint64_t offset);
+
+  /** Add a fragment of a SimEng write request, holding `size` bytes of `data`,
+   * to the pending requests. */
+  void queueWriteFragment(uint64_t address, uint64_t size,
+                          const uint8_t* data);
+
+  /** Find the most recent pending request to the cache line holding
+   * `address`, returning nullptr if there is none. */
+  CoalescedRequest* findPendingRequest(uint64_t address) const;
+
+  /** Record the response data for each fragment of a coalesced read, sending
+   * any SimEng read requests which are now complete back to SimEng. */
+  void handleReadResponse(CoalescedRequest* request,
+                          const std::vector<uint8_t>& data);
+
+  /** This method is used to send a SimEng read request, once responses for all
+   * of its fragments have been recieved, back to SimEng. */
+  void aggregatedReadResponses(AggregateReadRequest* aggrReq);
+
+  bool unsignedOverflow_(uint64_t a, uint64_t b) const;
 
   /**
    * This method is used to find the end address of the cache line specified by
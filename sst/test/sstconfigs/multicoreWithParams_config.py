@@ -0,0 +1,118 @@
+import sst
+import sys
+import os
+
+DEBUG_L1 = 0
+DEBUG_MEM = 0
+DEBUG_LEVEL = 10
+
+# The number of SimEng cores simulating the process. The first core creates the
+# process; the threads it spawns are run by the remaining cores. As the cores
+# share a kernel and the RegisterValue pool, SST runs with a single thread.
+NUM_CORES = 4
+
+def split(param: str) -> list[str]:
+    return param.split("=")
+
+def parseParams(params: list[str]):
+    out = {
+        "withSrc": False,
+        "source": "",
+        "clw": 8,
+        "heap": "",
+        "model": "",
+        "args": "",
+        "execBin": ""
+    }
+    for param in params:
+        key, value = split(param)
+        if (key == "withSrc"):
+            out[key] = value == "True"
+        else:
+            out[key] = value
+    return out
+
+params = parseParams(sys.argv[1:])
+
+sst.setProgramOption("num-threads", "1")
+
+# Define the shared L2 cache, the bus connecting it to the private L1 caches,
+# and main memory
+l2cache = sst.Component("l2cache.msi.inclus", "memHierarchy.Cache")
+l2cache.addParams({
+    "access_latency_cycles" : "10",
+    "cache_frequency" : "1.8Ghz",
+    "replacement_policy" : "lru",
+    "coherence_protocol" : "MSI",
+    "associativity" : "8",
+    "cache_line_size" : params["clw"],
+    "cache_size" : "64KiB",
+    "debug_level" : DEBUG_LEVEL,
+    "debug": "0"
+})
+bus = sst.Component("bus", "memHierarchy.Bus")
+bus.addParams({
+    "bus_frequency" : "1.8Ghz",
+})
+
+memctrl = sst.Component("memory", "memHierarchy.MemController")
+memctrl.addParams({
+    "clock" : "1.8GHz",
+    "request_width" : "64",
+    "debug" : DEBUG_MEM,
+    "debug_level" : DEBUG_LEVEL,
+    "addr_range_end" : 2*1024*1024*1024-1,
+})
+
+memory = memctrl.setSubComponent("backend", "memHierarchy.simpleMem")
+memory.addParams({
+      "access_time" : "0ps",
+      "mem_size" : "2GiB",
+      "request_width": "64"
+})
+
+# Define each core and its private L1 cache
+for core in range(NUM_CORES):
+    cpu = sst.Component("core%d" % core, "sstsimeng.simengcore")
+    cpu.addParams({
+        "simeng_config_path": params["model"],
+        "executable_path": "",
+        "executable_args": "",
+        "clock" : "1.8GHz",
+        "max_addr_memory": 2*1024*1024*1024-1,
+        "cache_line_width": params["clw"],
+        # Only the first core of the process group is given the workload
+        "source": params["source"] if core == 0 else "",
+        "assemble_with_source": params["withSrc"] if core == 0 else False,
+        "heap": params["heap"] if core == 0 else "",
+        "debug": False,
+        "process_group": "process0"
+    })
+
+    iface = cpu.setSubComponent("memory", "memHierarchy.standardInterface")
+
+    l1cache = sst.Component("l1cache%d.msi" % core, "memHierarchy.Cache")
+    l1cache.addParams({
+          "access_latency_cycles" : "2",
+          "cache_frequency" : "1.8Ghz",
+          "replacement_policy" : "nmru",
+          "coherence_protocol" : "MSI",
+          "associativity" : "4",
+          "cache_line_size" : params["clw"],
+          "debug" : DEBUG_L1,
+        "debug_level" : DEBUG_LEVEL,
+          "verbose": "2",
+          "L1" : "1",
+          "cache_size" : "64KiB"
+    })
+
+    link_cpu_l1cache = sst.Link("link_cpu%d_l1cache_link" % core)
+    link_cpu_l1cache.connect( (iface, "port", "10ps"), (l1cache, "high_network_0", "10ps") )
+    link_l1cache_bus = sst.Link("link_l1cache%d_bus_link" % core)
+    link_l1cache_bus.connect( (l1cache, "low_network_0", "100ps"), (bus, "high_network_%d" % core, "100ps") )
+
+# Define the remaining simulation links
+link_bus_l2cache = sst.Link("link_bus_l2cache_link")
+link_bus_l2cache.connect( (bus, "low_network_0", "100ps"), (l2cache, "high_network_0", "100ps") )
+link_mem_bus = sst.Link("link_mem_bus_link")
+link_mem_bus.connect( (l2cache, "low_network_0", "100ps"), (memctrl, "direct_link", "100ps") )
@@ -0,0 +1,65 @@
+#include "sstsimengtest.hh"
+
+TEST_GROUP(TG5, "SSTSimEng_runs_a_process_across_several_cores",
+           "multicoreWithParams_config.py", "withSrc=True",
+           R"(source= mov x1, #1 )");
+
+// Each of the four cores repeatedly loads a full SVE vector while the others do
+// the same, such that the responses to several cores are in flight at once.
+// Every load is checked against the expected lanes, and any mismatch ends the
+// process with exit code 1.
+TEST_CASE(TG5, "concurrent_sve_loads_from_several_cores", "withSrc=True",
+          R"(source=
+    # Get heap address
+    mov x0, 0
+    mov x8, 214
+    svc #0
+    mov x19, x0
+
+    # Start a thread for each of the other cores, with CLONE_VM,
+    # CLONE_SIGHAND and CLONE_THREAD set
+    mov x20, #3
+    spawn:
+    movz x0, #0x0900
+    movk x0, #0x1, lsl #16
+    mov x1, #0
+    mov x2, #0
+    mov x3, #0
+    mov x4, #0
+    mov x8, #220
+    svc #0
+    cbz x0, worker
+    subs x20, x20, #1
+    b.ne spawn
+
+    # Load the vector held on the heap, comparing it to the lanes 1, 2, 3...
+    worker:
+    ptrue p0.d
+    index z1.d, #1, #1
+    mov x21, #64
+    loop:
+    ld1d {z0.d}, p0/z, [x19]
+    cmpne p1.d, p0/z, z0.d, z1.d
+    b.ne fail
+    subs x21, x21, #1
+    b.ne loop
+
+    # Exit the thread
+    mov x0, #0
+    mov x8, #93
+    svc #0
+
+    fail:
+    mov x0, #1
+    mov x8, #94
+    svc #0
+    )",
+          "heap=1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,"
+          "25,26,27,28,29,30,31,32") {
+  EXPECT_NE(capturedStdout.find("terminating with exit code 0"),
+            std::string::npos);
+  EXPECT_EQ(capturedStdout.find("terminating with exit code 1"),
+            std::string::npos);
+  // Every core ran one of the process' threads
+  EXPECT_EQ(capturedStdout.find("ran no threads"), std::string::npos);
+}
@@ -41,17 +41,22 @@ TEST(ConfigTest, Default) {
   std::string expectedValues =
       "Core:\n  ISA: AArch64\n  'Simulation-Mode': emulation\n  "
       "'Clock-Frequency-GHz': 1\n  'Timer-Frequency-MHz': 100\n  "
-      "'Micro-Operations': 0\n  'Vector-Length': 128\n  "
-      "'Streaming-Vector-Length': 128\nFetch:\n  'Fetch-Block-Size': 32\n  "
+      "'Micro-Operations': 0\n  'Decode-Cache-Path': ''\n  "
+      "'Vector-Length': 128\n  "
+      "'Streaming-Vector-Length': 128\n  'Table-Decoder': 0\nFetch:\n  "
+      "'Fetch-Block-Size': 32\n  "
       "'Loop-Buffer-Size': 32\n  'Loop-Detection-Threshold': "
       "5\n'Process-Image':\n  'Heap-Size': 100000\n  'Stack-Size': "
       "100000\n'Register-Set':\n  'GeneralPurpose-Count': 38\n  "
       "'FloatingPoint/SVE-Count': 38\n  'Predicate-Count': 17\n  "
       "'Conditional-Count': 1\n  'Matrix-Count': 1\n'Pipeline-Widths':\n  "
       "Commit: 1\n  FrontEnd: 1\n  'LSQ-Completion': 1\n'Queue-Sizes':\n  ROB: "
-      "32\n  Load: 16\n  Store: 16\n'Branch-Predictor':\n  Type: Perceptron\n  "
-      "'BTB-Tag-Bits': 8\n  'Global-History-Length': 8\n  'RAS-entries': "
-      "8\n'L1-Data-Memory':\n  'Interface-Type': "
+      "32\n  Load: 16\n  Store: 16\n  'Rename-Checkpoints': "
+      "8\n'Branch-Predictor':\n  Type: Perceptron\n  'BTB-Tag-Bits': 8\n  "
+      "'Global-History-Length': 8\n  'RAS-entries': "
+      "8\n'Memory-Dependence-Predictor':\n  Type: None\n  'SSIT-Size': "
+      "1024\n  'LFST-Size': 128\n  'Clear-Interval': 1000000\n"
+      "'L1-Data-Memory':\n  'Interface-Type': "
       "Flat\n'L1-Instruction-Memory':\n  'Interface-Type': "
       "Flat\n'LSQ-L1-Interface':\n  'Access-Latency': 4\n  Exclusive: 0\n  "
       "'Load-Bandwidth': 32\n  'Store-Bandwidth': 32\n  "
@@ -71,7 +76,9 @@ TEST(ConfigTest, Default) {
       "/specialFiles/\n  'Core-Count': 1\n  'Socket-Count': 1\n  SMT: 1\n  "
       "BogoMIPS: 0\n  Features: ''\n  'CPU-Implementer': 0x0\n  "
       "'CPU-Architecture': 0\n  'CPU-Variant': 0x0\n  'CPU-Part': 0x0\n  "
-      "'CPU-Revision': 0\n  'Package-Count': 1\n";
+      "'CPU-Revision': 0\n  'Package-Count': 1\n'Commit-Trace':\n  Path: "
+      "''\n  Format: Binary\n  'Start-Cycle': 0\n  'End-Cycle': 0\n  "
+      "'Start-Instruction': 0\n  'Instruction-Count': 0\n";
   EXPECT_EQ(emittedConfig, expectedValues);
 
   // Generate default for rv64 ISA
@@ -97,15 +104,19 @@ TEST(ConfigTest, Default) {
   expectedValues =
       "Core:\n  ISA: rv64\n  Compressed: 0\n  'Simulation-Mode': emulation\n  "
       "'Clock-Frequency-GHz': 1\n  'Timer-Frequency-MHz': 100\n  "
-      "'Micro-Operations': 0\nFetch:\n  'Fetch-Block-Size': 32\n  "
+      "'Micro-Operations': 0\n  'Decode-Cache-Path': ''\nFetch:\n  "
+      "'Fetch-Block-Size': 32\n  "
       "'Loop-Buffer-Size': 32\n  'Loop-Detection-Threshold': "
       "5\n'Process-Image':\n  'Heap-Size': 100000\n  'Stack-Size': "
       "100000\n'Register-Set':\n  'GeneralPurpose-Count': 38\n  "
       "'FloatingPoint-Count': 38\n'Pipeline-Widths':\n  Commit: 1\n  FrontEnd: "
       "1\n  'LSQ-Completion': 1\n'Queue-Sizes':\n  ROB: 32\n  Load: 16\n  "
-      "Store: 16\n'Branch-Predictor':\n  Type: Perceptron\n  'BTB-Tag-Bits': "
+      "Store: 16\n  'Rename-Checkpoints': 8\n'Branch-Predictor':\n  Type: "
+      "Perceptron\n  'BTB-Tag-Bits': "
       "8\n  'Global-History-Length': 8\n  'RAS-entries': "
-      "8\n'L1-Data-Memory':\n  'Interface-Type': "
+      "8\n'Memory-Dependence-Predictor':\n  Type: None\n  'SSIT-Size': "
+      "1024\n  'LFST-Size': 128\n  'Clear-Interval': 1000000\n"
+      "'L1-Data-Memory':\n  'Interface-Type': "
       "Flat\n'L1-Instruction-Memory':\n  'Interface-Type': "
       "Flat\n'LSQ-L1-Interface':\n  'Access-Latency': 4\n  Exclusive: 0\n  "
       "'Load-Bandwidth': 32\n  'Store-Bandwidth': 32\n  "
@@ -125,7 +136,9 @@ TEST(ConfigTest, Default) {
       "/specialFiles/\n  'Core-Count': 1\n  'Socket-Count': 1\n  SMT: 1\n  "
       "BogoMIPS: 0\n  Features: ''\n  'CPU-Implementer': 0x0\n  "
       "'CPU-Architecture': 0\n  'CPU-Variant': 0x0\n  'CPU-Part': 0x0\n  "
-      "'CPU-Revision': 0\n  'Package-Count': 1\n";
+      "'CPU-Revision': 0\n  'Package-Count': 1\n'Commit-Trace':\n  Path: "
+      "''\n  Format: Binary\n  'Start-Cycle': 0\n  'End-Cycle': 0\n  "
+      "'Start-Instruction': 0\n  'Instruction-Count': 0\n";
   EXPECT_EQ(emittedConfig, expectedValues);
 }
 
@@ -169,6 +182,24 @@ TEST(ConfigTest, AddConfigValues) {
   EXPECT_EQ(config["Execution-Units"].num_children(), 2);
 }
 
+// Test that a previously validated config can be re-applied
+TEST(ConfigTest, SetValidatedConfig) {
+  simeng::config::SimInfo::generateDefault(simeng::config::ISA::AArch64, true);
+  simeng::config::SimInfo::addToConfig("{Core: {Simulation-Mode: outoforder}}");
+  ryml::Tree outoforderConfig = *simeng::config::SimInfo::getConfig().tree();
+
+  simeng::config::SimInfo::generateDefault(simeng::config::ISA::RV64, true);
+  EXPECT_EQ(simeng::config::SimInfo::getISA(), simeng::config::ISA::RV64);
+
+  simeng::config::SimInfo::setValidatedConfig(outoforderConfig);
+  EXPECT_EQ(simeng::config::SimInfo::getISA(), simeng::config::ISA::AArch64);
+  EXPECT_EQ(simeng::config::SimInfo::getSimMode(),
+            simeng::config::SimulationMode::Outoforder);
+  EXPECT_EQ(simeng::config::SimInfo::getConfig()["Core"]["Simulation-Mode"]
+                .as<std::string>(),
+            "outoforder");
+}
+
 // Test that adding an invalid entry fails the config validation
 TEST(ConfigTest, FailedExpectation) {
   simeng::config::SimInfo::generateDefault(simeng::config::ISA::AArch64, true);
@@ -1,5 +1,6 @@
 #include "RegressionTest.hh"
 
+#include <chrono>
 #include <string>
 
 #include "simeng/GenericPredictor.hh"
@@ -13,7 +14,11 @@
 #include "simeng/models/inorder/Core.hh"
 #include "simeng/models/outoforder/Core.hh"
 
-RegressionTest::~RegressionTest() { delete[] code_; }
+std::unordered_map<std::string, std::vector<uint8_t>>
+    RegressionTest::programCache_;
+std::unordered_map<std::string, ryml::Tree> RegressionTest::configCache_;
+
+RegressionTest::~RegressionTest() {}
 
 void RegressionTest::TearDown() {
   if (!programFinished_) {
@@ -33,12 +38,8 @@ void RegressionTest::run(const char* source, const char* triple,
   assemble(source, triple, extensions);
   if (HasFatalFailure()) return;
 
-  // Generate the predefined model config
-  generateConfig();
-
-  // Due to SimInfo being static, we need to ensure the config values/options
-  // stored are up-to-date with the latest generated config file
-  simeng::config::SimInfo::reBuild();
+  // Apply the predefined model config
+  applyConfig();
 
   // Create a linux process from the assembled code block.
   // Memory allocation for process images also takes place
@@ -49,7 +50,7 @@ void RegressionTest::run(const char* source, const char* triple,
   // The created process image can be accessed via a shared_ptr
   // returned by the getProcessImage method.
   process_ = std::make_unique<simeng::kernel::LinuxProcess>(
-      simeng::span(reinterpret_cast<const uint8_t*>(code_), codeSize_));
+      simeng::span(code_->data(), code_->size()));
 
   ASSERT_TRUE(process_->isValid());
   uint64_t entryPoint = process_->getEntryPoint();
@@ -81,6 +82,7 @@ void RegressionTest::run(const char* source, const char* triple,
       simeng::config::SimInfo::getConfig()["CPU-Info"]["Special-File-Dir-Path"]
           .as<std::string>());
   kernel.createProcess(*process_);
+  kernel.setProcessMemory(processMemory_, processMemorySize_);
 
   // Populate the heap with initial data (specified by the test being run).
   ASSERT_LT(process_->getHeapStart() + initialHeapData_.size(),
@@ -110,7 +112,7 @@ void RegressionTest::run(const char* source, const char* triple,
   switch (std::get<0>(GetParam())) {
     case EMULATION:
       core_ = std::make_unique<simeng::models::emulation::Core>(
-          instructionMemory, *flatDataMemory, entryPoint, processMemorySize_,
+          processMemory_, *flatDataMemory, entryPoint, processMemorySize_,
           *architecture_);
       dataMemory = std::move(flatDataMemory);
       break;
@@ -129,6 +131,7 @@ void RegressionTest::run(const char* source, const char* triple,
   }
 
   // Run the core model until the program is complete
+  auto startTime = std::chrono::steady_clock::now();
   while (!core_->hasHalted() || dataMemory->hasPendingRequests()) {
     ASSERT_LT(numTicks_, maxTicks_) << "Maximum tick count exceeded.";
     core_->tick();
@@ -136,6 +139,12 @@ void RegressionTest::run(const char* source, const char* triple,
     dataMemory->tick();
     numTicks_++;
   }
+  auto simulationTime = std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::steady_clock::now() - startTime);
+
+  // Record per-test simulation statistics in the test report
+  RecordProperty("ticks", std::to_string(numTicks_));
+  RecordProperty("simulation_ms", std::to_string(simulationTime.count()));
 
   stdout_ = testing::internal::GetCapturedStdout();
   std::cout << stdout_;
@@ -143,8 +152,35 @@ void RegressionTest::run(const char* source, const char* triple,
   programFinished_ = true;
 }
 
+void RegressionTest::applyConfig() const {
+  std::string key = std::to_string(std::get<0>(GetParam())) + ":" +
+                    std::get<1>(GetParam());
+  auto iter = configCache_.find(key);
+  if (iter != configCache_.end()) {
+    simeng::config::SimInfo::setValidatedConfig(iter->second);
+    return;
+  }
+
+  // Generate the predefined model config
+  generateConfig();
+
+  // Due to SimInfo being static, we need to ensure the config values/options
+  // stored are up-to-date with the latest generated config file
+  simeng::config::SimInfo::reBuild();
+
+  configCache_.emplace(key, *simeng::config::SimInfo::getConfig().tree());
+}
+
 void RegressionTest::assemble(const char* source, const char* triple,
                               const char* extensions) {
+  // Reuse the flat binary of any previous test with the same source
+  std::string key = std::string(triple) + ":" + extensions + ":" + source;
+  auto iter = programCache_.find(key);
+  if (iter != programCache_.end()) {
+    code_ = &iter->second;
+    return;
+  }
+
   // Get LLVM target
   std::string errStr;
   const llvm::Target* target =
@@ -264,8 +300,8 @@ void RegressionTest::assemble(const char* source, const char* triple,
   llvm::ArrayRef<uint8_t> textData = *textDataOrErr;
 
   // Make copy of .text section data
-  codeSize_ = textData.size();
-  if (code_) delete[] code_;
-  code_ = new uint8_t[codeSize_];
-  std::copy(textData.begin(), textData.end(), code_);
+  code_ = &programCache_
+               .emplace(key, std::vector<uint8_t>(textData.begin(),
+                                                  textData.end()))
+               .first->second;
 }
@@ -2,6 +2,7 @@
 
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "gtest/gtest.h"
@@ -60,6 +61,12 @@ enum CoreType { EMULATION, INORDER, OUTOFORDER };
  * resulting flat binary through an instance of the target core model. Helper
  * methods are provided to query the state of the core and memory after
  * execution has completed.
+ *
+ * Assembled binaries and generated configs are cached for the lifetime of the
+ * test process, such that the many tests sharing a source (across core types
+ * and vector lengths) or a parameter only assemble and validate them once. The
+ * number of ticks and the wall-clock time taken to simulate each test are
+ * recorded as test properties, and so are included in any XML/JSON report.
  */
 class RegressionTest
     : public ::testing::TestWithParam<std::tuple<CoreType, std::string>> {
@@ -68,7 +75,9 @@ class RegressionTest
 
   virtual void TearDown() override;
 
-  /** Generate a default YAML-formatted configuration. */
+  /** Generate a default YAML-formatted configuration. The configuration must
+   * be fully determined by the test parameter, as it is cached per parameter.
+   */
   virtual void generateConfig() const = 0;
 
   /** Run the assembly in `source`, building it for the target `triple` and ISA
@@ -137,12 +146,21 @@ class RegressionTest
 
  private:
   /** Assemble test source to a flat binary for the given triple and ISA
-   * extensions. */
+   * extensions, reusing the binary of any previous test with the same source.
+   */
   void assemble(const char* source, const char* triple, const char* extensions);
 
+  /** Apply the configuration for the current test parameter, generating it
+   * only if it hasn't been used by a previous test. */
+  void applyConfig() const;
+
   /** The flat binary produced by assembling the test source. */
-  uint8_t* code_ = nullptr;
+  const std::vector<uint8_t>* code_ = nullptr;
+
+  /** The flat binaries assembled so far, keyed by triple, ISA extensions and
+   * source. */
+  static std::unordered_map<std::string, std::vector<uint8_t>> programCache_;
 
-  /** The size of the assembled flat binary in bytes. */
-  size_t codeSize_ = 0;
+  /** The validated configs generated so far, keyed by test parameter. */
+  static std::unordered_map<std::string, ryml::Tree> configCache_;
 };
@@ -1,3 +1,4 @@
+#include <errno.h>
 #include <fcntl.h>
 #include <stdlib.h>
 #include <sys/stat.h>
@@ -941,7 +942,110 @@ TEST_P(Syscall, set_tid_address) {
   EXPECT_EQ(getGeneralRegister<int64_t>(21), 0);
 }
 
-// TODO: write futex test
+TEST_P(Syscall, futex) {
+  // Reserve 4 bytes for the futex word
+  initialHeapData_.resize(4);
+  RUN_AARCH64(R"(
+    # Get heap address
+    mov x0, 0
+    mov x8, 214
+    svc #0
+    mov x20, x0
+
+    # futex(uaddr=x20, op=FUTEX_WAIT_PRIVATE, val=1, timeout=NULL)
+    mov x0, x20
+    mov x1, #128
+    mov x2, #1
+    mov x3, #0
+    mov x8, #98
+    svc #0
+    mov x21, x0
+
+    # futex(uaddr=x20, op=FUTEX_WAKE_PRIVATE, val=1)
+    mov x0, x20
+    mov x1, #129
+    mov x2, #1
+    mov x8, #98
+    svc #0
+    mov x22, x0
+
+    # futex(uaddr=x20, op=FUTEX_WAIT_PRIVATE, val=0, timeout=x20)
+    mov x0, x20
+    mov x1, #128
+    mov x2, #0
+    mov x3, x20
+    mov x8, #98
+    svc #0
+    mov x23, x0
+  )");
+  // The futex word doesn't hold the expected value
+  EXPECT_EQ(getGeneralRegister<int64_t>(21), -EAGAIN);
+  // No threads are waiting to be woken
+  EXPECT_EQ(getGeneralRegister<int64_t>(22), 0);
+  // No other thread is able to wake the waiter
+  EXPECT_EQ(getGeneralRegister<int64_t>(23), -ETIMEDOUT);
+}
+
+TEST_P(Syscall, clone) {
+  // Reserve 1024 bytes for the child thread's ID, its results and its stack
+  initialHeapData_.resize(1024);
+  RUN_AARCH64(R"(
+    # Get heap address
+    mov x0, 0
+    mov x8, 214
+    svc #0
+    mov x20, x0
+
+    # clone(flags=CLONE_VM|CLONE_FS|CLONE_FILES|CLONE_SIGHAND|CLONE_THREAD|
+    #       CLONE_SYSVSEM|CLONE_PARENT_SETTID|CLONE_CHILD_CLEARTID,
+    #       stack=x20+1024, ptid=x20, tls=0, ctid=x20)
+    mov x0, #0x0F00
+    movk x0, #0x35, lsl #16
+    add x1, x20, #1024
+    mov x2, x20
+    mov x3, #0
+    mov x4, x20
+    mov x8, #220
+    svc #0
+    cbz x0, .child
+    mov x21, x0
+
+    # Wait for the child to exit, clearing its thread ID
+    .wait:
+    ldr w2, [x20]
+    cbz w2, .done
+    # futex(uaddr=x20, op=FUTEX_WAIT, val=w2, timeout=NULL)
+    mov x0, x20
+    mov x1, #0
+    mov x3, #0
+    mov x8, #98
+    svc #0
+    b .wait
+
+    .child:
+    # Record the child's thread ID and stack pointer
+    mov x8, #178
+    svc #0
+    str x0, [x20, #8]
+    mov x0, sp
+    str x0, [x20, #16]
+    # exit(0)
+    mov x0, #0
+    mov x8, #93
+    svc #0
+
+    .done:
+    ldr x22, [x20, #8]
+    ldr x23, [x20, #16]
+  )");
+  EXPECT_EQ(getGeneralRegister<int64_t>(21), 1);
+  EXPECT_EQ(getGeneralRegister<int64_t>(22), 1);
+  EXPECT_EQ(getGeneralRegister<uint64_t>(23), process_->getHeapStart() + 1024);
+  EXPECT_EQ(getMemoryValue<uint32_t>(process_->getHeapStart()), 0);
+  // The main thread is still running
+  EXPECT_EQ(getGeneralRegister<uint64_t>(20), process_->getHeapStart());
+}
+
 // TODO: write set_robust_list test
 
 TEST_P(Syscall, clock_gettime) {
@@ -1527,6 +1631,80 @@ TEST_P(Syscall, mmap) {
   EXPECT_EQ(getGeneralRegister<int64_t>(15), process_->getMmapStart() + 8192);
 }
 
+// Test mapping a file into memory, checking its contents are visible through
+// the mapping (tests openat, mmap, and close syscalls)
+TEST_P(Syscall, file_mmap) {
+  const char filepath[] = SIMENG_AARCH64_TEST_ROOT "/data/input.txt";
+
+  // Copy filepath to heap
+  initialHeapData_.resize(strlen(filepath) + 1);
+  memcpy(initialHeapData_.data(), filepath, strlen(filepath) + 1);
+
+  RUN_AARCH64(R"(
+    # Get heap address
+    mov x0, 0
+    mov x8, 214
+    svc #0
+    mov x20, x0
+
+    # <input> = openat(AT_FDCWD, filepath, O_RDONLY, S_IRUSR)
+    mov x0, -100
+    mov x1, x20
+    mov x2, 0x0000
+    mov x3, 400
+    mov x8, #56
+    svc #0
+    mov x21, x0
+
+    # mmap(addr=NULL, length=32, prot=1, flags=2, fd=<input>, offset=0)
+    mov x0, #0
+    mov x1, #32
+    mov x2, #1
+    mov x3, #2
+    mov x4, x21
+    mov x5, #0
+    mov x8, #222
+    svc #0
+    mov x22, x0
+
+    # Load the first and last letters through the mapping
+    ldrb w23, [x22]
+    ldrb w24, [x22, #25]
+
+    # mmap(addr=NULL, length=32, prot=1, flags=2, fd=<input>, offset=1)
+    mov x0, #0
+    mov x1, #32
+    mov x2, #1
+    mov x3, #2
+    mov x4, x21
+    mov x5, #1
+    mov x8, #222
+    svc #0
+    mov x25, x0
+
+    # close(fd=<input>)
+    mov x0, x21
+    mov x8, #57
+    svc #0
+  )");
+  EXPECT_EQ(getGeneralRegister<uint64_t>(22), process_->getMmapStart());
+  EXPECT_EQ(getGeneralRegister<uint64_t>(23), 'A');
+  EXPECT_EQ(getGeneralRegister<uint64_t>(24), 'Z');
+  // An offset which isn't a multiple of the page size is rejected
+  EXPECT_EQ(getGeneralRegister<int64_t>(25), -1);
+
+  // Check the whole file is present in the mapping, and that the remainder of
+  // the mapping is zeroed
+  const char refMapped[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+  char* dataMapped = processMemory_ + process_->getMmapStart();
+  for (size_t i = 0; i < strlen(refMapped); i++) {
+    EXPECT_EQ(dataMapped[i], refMapped[i]) << "at index i=" << i << '\n';
+  }
+  for (size_t i = sizeof(refMapped); i < 32; i++) {
+    EXPECT_EQ(dataMapped[i], 0) << "at index i=" << i << '\n';
+  }
+}
+
 TEST_P(Syscall, getrandom) {
   initialHeapData_.resize(24);
   memset(initialHeapData_.data(), -1, 16);
@@ -1,3 +1,4 @@
+#include <errno.h>
 #include <fcntl.h>
 #include <stdlib.h>
 #include <sys/stat.h>
@@ -966,7 +967,108 @@ TEST_P(Syscall, set_tid_address) {
   EXPECT_EQ(getGeneralRegister<int64_t>(6), 0);
 }
 
-// TODO: write futex test
+TEST_P(Syscall, futex) {
+  // Reserve 4 bytes for the futex word
+  initialHeapData_.resize(4);
+  RUN_RISCV(R"(
+    # Get heap address
+    li a0, 0
+    li a7, 214
+    ecall
+    mv t0, a0
+
+    # futex(uaddr=t0, op=FUTEX_WAIT_PRIVATE, val=1, timeout=NULL)
+    mv a0, t0
+    li a1, 128
+    li a2, 1
+    li a3, 0
+    li a7, 98
+    ecall
+    mv t1, a0
+
+    # futex(uaddr=t0, op=FUTEX_WAKE_PRIVATE, val=1)
+    mv a0, t0
+    li a1, 129
+    li a2, 1
+    li a7, 98
+    ecall
+    mv t2, a0
+
+    # futex(uaddr=t0, op=FUTEX_WAIT_PRIVATE, val=0, timeout=t0)
+    mv a0, t0
+    li a1, 128
+    li a2, 0
+    mv a3, t0
+    li a7, 98
+    ecall
+    mv t3, a0
+  )");
+  // The futex word doesn't hold the expected value
+  EXPECT_EQ(getGeneralRegister<int64_t>(6), -EAGAIN);
+  // No threads are waiting to be woken
+  EXPECT_EQ(getGeneralRegister<int64_t>(7), 0);
+  // No other thread is able to wake the waiter
+  EXPECT_EQ(getGeneralRegister<int64_t>(28), -ETIMEDOUT);
+}
+
+TEST_P(Syscall, clone) {
+  // Reserve 1024 bytes for the child thread's ID, its results and its stack
+  initialHeapData_.resize(1024);
+  RUN_RISCV(R"(
+    # Get heap address
+    li a0, 0
+    li a7, 214
+    ecall
+    mv t0, a0
+
+    # clone(flags=CLONE_VM|CLONE_FS|CLONE_FILES|CLONE_SIGHAND|CLONE_THREAD|
+    #       CLONE_SYSVSEM|CLONE_PARENT_SETTID|CLONE_CHILD_CLEARTID,
+    #       stack=t0+1024, ptid=t0, tls=0, ctid=t0)
+    li a0, 0x350F00
+    addi a1, t0, 1024
+    mv a2, t0
+    li a3, 0
+    mv a4, t0
+    li a7, 220
+    ecall
+    beqz a0, child
+    mv t1, a0
+
+    # Wait for the child to exit, clearing its thread ID
+    wait:
+    lw a2, 0(t0)
+    beqz a2, done
+    # futex(uaddr=t0, op=FUTEX_WAIT, val=a2, timeout=NULL)
+    mv a0, t0
+    li a1, 0
+    li a3, 0
+    li a7, 98
+    ecall
+    j wait
+
+    child:
+    # Record the child's thread ID and stack pointer
+    li a7, 178
+    ecall
+    sd a0, 8(t0)
+    sd sp, 16(t0)
+    # exit(0)
+    li a0, 0
+    li a7, 93
+    ecall
+
+    done:
+    ld t2, 8(t0)
+    ld t3, 16(t0)
+  )");
+  EXPECT_EQ(getGeneralRegister<int64_t>(6), 1);
+  EXPECT_EQ(getGeneralRegister<int64_t>(7), 1);
+  EXPECT_EQ(getGeneralRegister<uint64_t>(28), process_->getHeapStart() + 1024);
+  EXPECT_EQ(getMemoryValue<uint32_t>(process_->getHeapStart()), 0);
+  // The main thread is still running
+  EXPECT_EQ(getGeneralRegister<uint64_t>(5), process_->getHeapStart());
+}
+
 // TODO: write set_robust_list test
 
 TEST_P(Syscall, clock_gettime) {
@@ -1562,6 +1664,80 @@ TEST_P(Syscall, mmap) {
   EXPECT_EQ(getGeneralRegister<int64_t>(31), process_->getMmapStart() + 8192);
 }
 
+// Test mapping a file into memory, checking its contents are visible through
+// the mapping (tests openat, mmap, and close syscalls)
+TEST_P(Syscall, file_mmap) {
+  const char filepath[] = SIMENG_RISCV_TEST_ROOT "/data/input.txt";
+
+  // Copy filepath to heap
+  initialHeapData_.resize(strlen(filepath) + 1);
+  memcpy(initialHeapData_.data(), filepath, strlen(filepath) + 1);
+
+  RUN_RISCV(R"(
+    # Get heap address
+    li a0, 0
+    li a7, 214
+    ecall
+    mv t0, a0
+
+    # <input> = openat(AT_FDCWD, filepath, O_RDONLY, S_IRUSR)
+    li a0, -100
+    mv a1, t0
+    li a2, 0x0000
+    li a3, 400
+    li a7, 56
+    ecall
+    mv t1, a0
+
+    # mmap(addr=NULL, length=32, prot=1, flags=2, fd=<input>, offset=0)
+    li a0, 0
+    li a1, 32
+    li a2, 1
+    li a3, 2
+    mv a4, t1
+    li a5, 0
+    li a7, 222
+    ecall
+    mv t2, a0
+
+    # Load the first and last letters through the mapping
+    lbu t3, 0(t2)
+    lbu t4, 25(t2)
+
+    # mmap(addr=NULL, length=32, prot=1, flags=2, fd=<input>, offset=1)
+    li a0, 0
+    li a1, 32
+    li a2, 1
+    li a3, 2
+    mv a4, t1
+    li a5, 1
+    li a7, 222
+    ecall
+    mv t5, a0
+
+    # close(fd=<input>)
+    mv a0, t1
+    li a7, 57
+    ecall
+  )");
+  EXPECT_EQ(getGeneralRegister<uint64_t>(7), process_->getMmapStart());
+  EXPECT_EQ(getGeneralRegister<uint64_t>(28), 'A');
+  EXPECT_EQ(getGeneralRegister<uint64_t>(29), 'Z');
+  // An offset which isn't a multiple of the page size is rejected
+  EXPECT_EQ(getGeneralRegister<int64_t>(30), -1);
+
+  // Check the whole file is present in the mapping, and that the remainder of
+  // the mapping is zeroed
+  const char refMapped[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+  char* dataMapped = processMemory_ + process_->getMmapStart();
+  for (size_t i = 0; i < strlen(refMapped); i++) {
+    EXPECT_EQ(dataMapped[i], refMapped[i]) << "at index i=" << i << '\n';
+  }
+  for (size_t i = sizeof(refMapped); i < 32; i++) {
+    EXPECT_EQ(dataMapped[i], 0) << "at index i=" << i << '\n';
+  }
+}
+
 TEST_P(Syscall, getrandom) {
   initialHeapData_.resize(24);
   memset(initialHeapData_.data(), -1, 16);
@@ -0,0 +1,96 @@
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include "gtest/gtest.h"
+#include "simeng/arch/DecodeCache.hh"
+
+namespace {
+
+class DecodeCacheTest : public testing::Test {
+ public:
+  DecodeCacheTest()
+      : path_("/tmp/simeng-decode-cache-test." + std::to_string(getpid())) {}
+
+  ~DecodeCacheTest() { std::remove(path_.c_str()); }
+
+ protected:
+  /** Populate `insn` and `detail` with a recognisable disassembly. */
+  void makeDisassembly(cs_insn& insn, cs_detail& detail, unsigned int id) {
+    std::memset(&insn, 0, sizeof(cs_insn));
+    std::memset(&detail, 0, sizeof(cs_detail));
+    insn.id = id;
+    insn.size = 4;
+    std::strcpy(insn.mnemonic, "add");
+    insn.detail = &detail;
+  }
+
+  std::string path_;
+};
+
+// Tests that an empty path disables the cache
+TEST_F(DecodeCacheTest, Disabled) {
+  simeng::arch::DecodeCache cache("", "AArch64");
+  EXPECT_FALSE(cache.isEnabled());
+
+  cs_insn insn;
+  cs_detail detail;
+  makeDisassembly(insn, detail, 1);
+  cache.insert(0x8b020020, insn, detail, true);
+
+  bool success;
+  EXPECT_FALSE(cache.lookup(0x8b020020, insn, detail, success));
+}
+
+// Tests that inserted disassemblies are available to a later cache opened from
+// the same file
+TEST_F(DecodeCacheTest, Persisted) {
+  {
+    simeng::arch::DecodeCache cache(path_, "AArch64");
+    EXPECT_TRUE(cache.isEnabled());
+
+    cs_insn insn;
+    cs_detail detail;
+    makeDisassembly(insn, detail, 12);
+    cache.insert(0x8b020020, insn, detail, true);
+    makeDisassembly(insn, detail, 0);
+    cache.insert(0xffffffff, insn, detail, false);
+  }
+
+  simeng::arch::DecodeCache cache(path_, "AArch64");
+  cs_insn insn;
+  cs_detail detail;
+  bool success;
+  ASSERT_TRUE(cache.lookup(0x8b020020, insn, detail, success));
+  EXPECT_TRUE(success);
+  EXPECT_EQ(insn.id, 12);
+  EXPECT_EQ(insn.size, 4);
+  EXPECT_STREQ(insn.mnemonic, "add");
+  EXPECT_EQ(insn.detail, &detail);
+
+  ASSERT_TRUE(cache.lookup(0xffffffff, insn, detail, success));
+  EXPECT_FALSE(success);
+
+  EXPECT_FALSE(cache.lookup(0x8b030020, insn, detail, success));
+}
+
+// Tests that a cache file written for a different ISA variant is ignored
+TEST_F(DecodeCacheTest, MismatchedKey) {
+  {
+    simeng::arch::DecodeCache cache(path_, "RV64GC");
+    cs_insn insn;
+    cs_detail detail;
+    makeDisassembly(insn, detail, 12);
+    cache.insert(0x00b50533, insn, detail, true);
+  }
+
+  simeng::arch::DecodeCache cache(path_, "RV64G");
+  cs_insn insn;
+  cs_detail detail;
+  bool success;
+  EXPECT_FALSE(cache.lookup(0x00b50533, insn, detail, success));
+}
+
+}  // namespace
@@ -1,3 +1,12 @@
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
 #include "gmock/gmock.h"
 #include "simeng/Elf.hh"
 #include "simeng/version.hh"
@@ -10,7 +19,11 @@ namespace simeng {
 
 class ElfTest : public testing::Test {
  public:
-  ElfTest() {}
+  ElfTest()
+      : syntheticElfPath_("/tmp/simeng-elf-test." + std::to_string(getpid())) {
+  }
+
+  ~ElfTest() { std::remove(syntheticElfPath_.c_str()); }
 
  protected:
   const std::string knownElfFilePath =
@@ -22,12 +35,69 @@ class ElfTest : public testing::Test {
   const uint64_t known_phdrTableAddress = 4194368;
   const uint64_t known_processImageSize = 5040480;
 
-  char* unwrappedProcImgPtr;
+  /** Allocate a zero-filled, page-aligned image of `size` bytes. */
+  char* allocateImage(uint64_t size) {
+    return static_cast<char*>(mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+  }
+
+  /** The value of the byte at `offset` in a synthetic ELF file. Never zero,
+   * such that zero-filled memory is distinguishable from file contents. */
+  static char syntheticByte(uint64_t offset) { return 1 + offset % 251; }
+
+  /** Write a synthetic 64-bit ELF file of `size` bytes, with the program
+   * headers `phdrs` following its header. Every other byte is given by
+   * `syntheticByte`. Returns the file's contents. */
+  std::vector<char> writeSyntheticElf(
+      const std::vector<std::vector<uint64_t>>& phdrs, uint64_t size) {
+    std::vector<char> contents(size);
+    for (uint64_t i = 0; i < size; i++) contents[i] = syntheticByte(i);
+
+    // The ELF header, of which only the fields SimEng reads are populated
+    const uint64_t e_phoff = 64;
+    const uint16_t e_phentsize = 56;
+    const uint16_t e_phnum = phdrs.size();
+    const char ident[5] = {0x7f, 'E', 'L', 'F', ElfBitFormat::Format64};
+    put(contents, 0, ident);
+    put(contents, 0x18, uint64_t(0x400000));
+    put(contents, 0x20, e_phoff);
+    put(contents, 0x36, e_phentsize);
+    put(contents, 0x38, e_phnum);
+
+    // Each program header holds {p_type, p_offset, p_vaddr, p_filesz,
+    // p_memsz}, and is truncated with the file
+    for (size_t i = 0; i < phdrs.size(); i++) {
+      const uint64_t offset = e_phoff + i * e_phentsize;
+      put(contents, offset, uint32_t(phdrs[i][0]));
+      put(contents, offset + 8, phdrs[i][1]);
+      put(contents, offset + 16, phdrs[i][2]);
+      put(contents, offset + 24, phdrs[i][2]);
+      put(contents, offset + 32, phdrs[i][3]);
+      put(contents, offset + 40, phdrs[i][4]);
+    }
+
+    std::ofstream(syntheticElfPath_, std::ios::binary)
+        .write(contents.data(), size);
+    return contents;
+  }
+
+  /** The path of the synthetic ELF file written by `writeSyntheticElf`. */
+  std::string syntheticElfPath_;
+
+ private:
+  /** Write `value` to `contents` at `offset`, if it fits. */
+  template <typename T>
+  static void put(std::vector<char>& contents, uint64_t offset,
+                  const T& value) {
+    if (offset + sizeof(T) <= contents.size()) {
+      std::memcpy(contents.data() + offset, &value, sizeof(T));
+    }
+  }
 };
 
 // Test that a valid ELF file can be created
 TEST_F(ElfTest, validElf) {
-  Elf elf(knownElfFilePath, &unwrappedProcImgPtr);
+  Elf elf(knownElfFilePath);
 
   EXPECT_TRUE(elf.isValid());
   EXPECT_EQ(elf.getEntryPoint(), known_entryPoint);
@@ -39,15 +109,14 @@ TEST_F(ElfTest, validElf) {
 
 // Test that wrong filepath results in invalid ELF
 TEST_F(ElfTest, invalidElf) {
-  Elf elf(SIMENG_SOURCE_DIR "/test/bogus_file_path___--__--__",
-          &unwrappedProcImgPtr);
+  Elf elf(SIMENG_SOURCE_DIR "/test/bogus_file_path___--__--__");
   EXPECT_FALSE(elf.isValid());
 }
 
 // Test that non-ELF file is not accepted
 TEST_F(ElfTest, nonElf) {
   testing::internal::CaptureStderr();
-  Elf elf(SIMENG_SOURCE_DIR "/test/unit/ElfTest.cc", &unwrappedProcImgPtr);
+  Elf elf(SIMENG_SOURCE_DIR "/test/unit/ElfTest.cc");
   EXPECT_FALSE(elf.isValid());
   EXPECT_THAT(testing::internal::GetCapturedStderr(),
               HasSubstr("[SimEng:Elf] Elf magic does not match"));
@@ -56,12 +125,100 @@ TEST_F(ElfTest, nonElf) {
 // Check that 32-bit ELF is not accepted
 TEST_F(ElfTest, format32Elf) {
   testing::internal::CaptureStderr();
-  Elf elf(SIMENG_SOURCE_DIR "/test/unit/data/stream.rv32ima.elf",
-          &unwrappedProcImgPtr);
+  Elf elf(SIMENG_SOURCE_DIR "/test/unit/data/stream.rv32ima.elf");
   EXPECT_FALSE(elf.isValid());
   EXPECT_THAT(
       testing::internal::GetCapturedStderr(),
       HasSubstr("[SimEng:Elf] Unsupported architecture detected in Elf"));
 }
 
-}  // namespace simeng
\ No newline at end of file
+// Test that the loadable segments are loaded with the file's contents, and
+// that images loaded from the same file don't share writes
+TEST_F(ElfTest, loadSegments) {
+  Elf elf(knownElfFilePath);
+  ASSERT_TRUE(elf.isValid());
+
+  std::ifstream file(knownElfFilePath, std::ios::binary);
+  std::vector<char> contents((std::istreambuf_iterator<char>(file)),
+                             std::istreambuf_iterator<char>());
+
+  const uint64_t size = elf.getProcessImageSize();
+  char* image = allocateImage(size);
+  char* otherImage = allocateImage(size);
+  elf.loadSegments(image);
+  elf.loadSegments(otherImage);
+
+  // The entry point lies in the first loadable segment, at the same offset
+  // from the program headers as in the file
+  const uint64_t entryOffset = known_entryPoint - known_phdrTableAddress;
+  uint64_t phoff = 0;
+  std::memcpy(&phoff, contents.data() + 0x20, sizeof(phoff));
+  EXPECT_EQ(std::memcmp(image + known_entryPoint,
+                        contents.data() + phoff + entryOffset, 64),
+            0);
+  EXPECT_EQ(std::memcmp(image + known_phdrTableAddress,
+                        contents.data() + phoff,
+                        known_e_phentsize * known_e_phnum),
+            0);
+
+  image[known_entryPoint] = ~image[known_entryPoint];
+  EXPECT_NE(image[known_entryPoint], otherImage[known_entryPoint]);
+  EXPECT_EQ(otherImage[known_entryPoint], contents[phoff + entryOffset]);
+
+  munmap(image, size);
+  munmap(otherImage, size);
+}
+
+// Test that program headers extending past the end of the file, or
+// describing segments which do, are rejected
+TEST_F(ElfTest, truncatedProgramHeader) {
+  // The second program header is cut short by the end of the file
+  writeSyntheticElf({{1, 0, 0, 64, 64}, {1, 0, 0, 64, 64}}, 64 + 56 + 20);
+  testing::internal::CaptureStderr();
+  Elf truncatedHeader(syntheticElfPath_);
+  EXPECT_FALSE(truncatedHeader.isValid());
+  EXPECT_THAT(testing::internal::GetCapturedStderr(),
+              HasSubstr("[SimEng:Elf] Elf program header 1 is truncated"));
+
+  // The segment's file contents extend past the end of the file
+  writeSyntheticElf({{1, 0, 0, 4096, 4096}}, 1024);
+  testing::internal::CaptureStderr();
+  Elf truncatedSegment(syntheticElfPath_);
+  EXPECT_FALSE(truncatedSegment.isValid());
+  EXPECT_THAT(testing::internal::GetCapturedStderr(),
+              HasSubstr("[SimEng:Elf] Elf program header 0 is truncated"));
+}
+
+// Test that a segment which starts and ends part-way through a page is loaded
+// exactly: the partial pages at either end are copied without disturbing the
+// rest of their page, and the remainder of the segment beyond its file
+// contents (.bss) is zero-filled, even though the file continues past it
+TEST_F(ElfTest, loadPartialPagesAndBss) {
+  const uint64_t page = sysconf(_SC_PAGESIZE);
+  const uint64_t offset = 100;
+  const uint64_t vaddr = 16 * page + offset;
+  const uint64_t filesz = 3 * page + 200;
+  const uint64_t memsz = filesz + 2 * page;
+  std::vector<char> contents =
+      writeSyntheticElf({{1, offset, vaddr, filesz, memsz}}, 6 * page);
+
+  Elf elf(syntheticElfPath_);
+  ASSERT_TRUE(elf.isValid());
+  ASSERT_EQ(elf.getProcessImageSize(), vaddr + memsz);
+
+  const uint64_t size = elf.getProcessImageSize();
+  char* image = allocateImage(size);
+  // Data already in the image on the segment's first page
+  image[vaddr - 1] = 0x5a;
+  elf.loadSegments(image);
+
+  EXPECT_EQ(image[vaddr - 1], 0x5a);
+  EXPECT_EQ(std::memcmp(image + vaddr, contents.data() + offset, filesz), 0);
+  for (uint64_t address = vaddr + filesz; address < size; address++) {
+    ASSERT_EQ(image[address], 0) << "at address " << address;
+  }
+
+  munmap(image, size);
+}
+
+}  // namespace simeng
@@ -35,13 +35,17 @@ class MockInstruction : public Instruction {
   MOCK_CONST_METHOD0(isLoad, bool());
   MOCK_CONST_METHOD0(isBranch, bool());
   MOCK_CONST_METHOD0(getGroup, uint16_t());
+  MOCK_CONST_METHOD0(getOpcode, uint32_t());
+  MOCK_CONST_METHOD0(getDisassembly, std::string());
 
   MOCK_CONST_METHOD0(getLSQLatency, uint16_t());
 
-  MOCK_METHOD0(getSupportedPorts, const std::vector<uint16_t>&());
+  MOCK_METHOD0(getSupportedPorts, PortMask());
 
   MOCK_METHOD1(setExecutionInfo, void(const ExecutionInfo& info));
 
+  MOCK_CONST_METHOD0(clone, std::shared_ptr<Instruction>());
+
   void setBranchResults(bool wasTaken, uint64_t targetAddress) {
     branchTaken_ = wasTaken;
     branchAddress_ = targetAddress;
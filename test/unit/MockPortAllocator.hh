@@ -9,7 +9,7 @@ namespace pipeline {
 /** Mock implementation of the `PortAllocator` interface. */
 class MockPortAllocator : public pipeline::PortAllocator {
  public:
-  MOCK_METHOD1(allocate, uint16_t(const std::vector<uint16_t>& ports));
+  MOCK_METHOD1(allocate, uint16_t(PortMask ports));
   MOCK_METHOD1(issued, void(uint16_t port));
   MOCK_METHOD1(deallocate, void(uint16_t port));
   MOCK_METHOD1(setRSSizeGetter,
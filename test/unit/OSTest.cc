@@ -1,3 +1,11 @@
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
 #include "ConfigInit.hh"
 #include "gtest/gtest.h"
 #include "simeng/kernel/Linux.hh"
@@ -44,9 +52,10 @@ class OSTest : public testing::Test {
   };
 };
 
-// These tests verify the functionality of both the `createProcess()` and
-// `getInitialStackPointer()` functions. All other functions for this class are
-// syscalls and are tested in the Regression suite.
+// These tests verify the functionality of the `createProcess()`,
+// `getInitialStackPointer()`, and `populateMapping()` functions. All other
+// functions for this class are syscalls and are tested in the Regression
+// suite.
 TEST_F(OSTest, processElf_stackPointer) {
   os.createProcess(proc_elf);
   // cmdLine[0] length will change depending on the host system so final stack
@@ -89,7 +98,56 @@ TEST_F(OSTest, processHex_stackPointer) {
   EXPECT_EQ(os.getInitialStackPointer(), proc_hex.getInitialStackPointer());
 }
 
-// createProcess
-// getInitialStackPointer
+// Test that a file-backed mapping is populated through the state change
+// without access to the process memory, and in place with it, and that
+// writes to the mapping don't reach the file in either case
+TEST_F(OSTest, populateMapping) {
+  os.createProcess(proc_hex);
+  char* image = proc_hex.getProcessImage().get();
+
+  // A file two and a half host pages long, mapped with a length of four pages
+  const uint64_t page = sysconf(_SC_PAGESIZE);
+  const std::string path = "/tmp/simeng-os-test." + std::to_string(getpid());
+  std::vector<char> contents(2 * page + page / 2);
+  for (size_t i = 0; i < contents.size(); i++) contents[i] = 1 + i % 251;
+  std::ofstream(path, std::ios::binary).write(contents.data(), contents.size());
+  const int64_t fd = os.openat(-100, path, O_RDONLY, 0);
+  ASSERT_GE(fd, 0);
+  const uint64_t length = 4 * page;
+  const uint64_t address = os.mmap(0, length, PROT_READ, MAP_PRIVATE, fd, 0);
+  ASSERT_NE(address, 0);
+
+  // Without the process memory, the contents are written in 128-byte chunks
+  arch::ProcessStateChange change;
+  ASSERT_TRUE(os.populateMapping(address, length, fd, 0, change));
+  ASSERT_EQ(change.memoryAddresses.size(), length / 128);
+  for (size_t i = 0; i < change.memoryAddresses.size(); i++) {
+    EXPECT_EQ(change.memoryAddresses[i].address, address + 128 * i);
+    EXPECT_EQ(change.memoryAddresses[i].size, 128);
+    const char* data = change.memoryAddressValues[i].getAsVector<char>();
+    for (uint64_t j = 0; j < 128; j++) {
+      const uint64_t offset = 128 * i + j;
+      ASSERT_EQ(data[j], offset < contents.size() ? contents[offset] : 0);
+    }
+  }
+
+  // With the process memory, the mapping is populated in place, overwriting
+  // anything previously held there
+  std::memset(image + address, 0x5a, length);
+  os.setProcessMemory(image, proc_hex.getProcessImageSize());
+  arch::ProcessStateChange inPlace;
+  ASSERT_TRUE(os.populateMapping(address, length, fd, 0, inPlace));
+  EXPECT_TRUE(inPlace.memoryAddresses.empty());
+  EXPECT_EQ(std::memcmp(image + address, contents.data(), contents.size()), 0);
+  for (uint64_t offset = contents.size(); offset < length; offset++) {
+    ASSERT_EQ(image[address + offset], 0);
+  }
+
+  image[address] = ~image[address];
+  std::ifstream file(path, std::ios::binary);
+  EXPECT_EQ(file.get(), contents[0]);
+
+  std::remove(path.c_str());
+}
 
 }  // namespace simeng
@@ -62,4 +62,55 @@ TEST(RegisterValueTest, Array) {
   EXPECT_EQ(ptr[2], 0);
   EXPECT_EQ(ptr[3], 0);
 }
+
+// Tests that copies of a wide value share its data rather than allocating
+TEST(RegisterValueTest, WideCopy) {
+  uint64_t arr[] = {1, 2};
+  simeng::RegisterValue z_reg = {arr, 256};
+  simeng::RegisterValue copy = z_reg;
+  EXPECT_EQ(copy.size(), 256);
+  EXPECT_EQ(copy.getAsVector<uint64_t>(), z_reg.getAsVector<uint64_t>());
+
+  simeng::RegisterValue assigned;
+  assigned = copy;
+  EXPECT_EQ(assigned.getAsVector<uint64_t>(), z_reg.getAsVector<uint64_t>());
+
+  // The data outlives the value it was created by
+  const uint64_t* data = z_reg.getAsVector<uint64_t>();
+  z_reg = simeng::RegisterValue(0, 8);
+  EXPECT_EQ(copy.getAsVector<uint64_t>(), data);
+  EXPECT_EQ(copy.getAsVector<uint64_t>()[1], 2);
+}
+
+// Tests that moving a wide value transfers its data, leaving the source empty
+TEST(RegisterValueTest, WideMove) {
+  uint64_t arr[] = {1, 2};
+  simeng::RegisterValue z_reg = {arr, 256};
+  const uint64_t* data = z_reg.getAsVector<uint64_t>();
+
+  simeng::RegisterValue moved = std::move(z_reg);
+  EXPECT_FALSE(z_reg);
+  EXPECT_EQ(moved.getAsVector<uint64_t>(), data);
+
+  simeng::RegisterValue assigned;
+  assigned = std::move(moved);
+  EXPECT_FALSE(moved);
+  EXPECT_EQ(assigned.getAsVector<uint64_t>(), data);
+  EXPECT_EQ(assigned.getAsVector<uint64_t>()[0], 1);
+}
+
+// Tests that the data of a wide value is returned for reuse once the last
+// value referencing it is destroyed
+TEST(RegisterValueTest, WideReuse) {
+  const uint64_t* data;
+  {
+    simeng::RegisterValue z_reg = simeng::RegisterValue(0, 256);
+    simeng::RegisterValue copy = z_reg;
+    data = z_reg.getAsVector<uint64_t>();
+  }
+  simeng::RegisterValue z_reg = simeng::RegisterValue(1, 256);
+  EXPECT_EQ(z_reg.getAsVector<uint64_t>(), data);
+  EXPECT_EQ(z_reg.getAsVector<uint64_t>()[0], 1);
+  EXPECT_EQ(z_reg.getAsVector<uint64_t>()[31], 0);
+}
 }  // namespace
@@ -0,0 +1,65 @@
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "simeng/arch/SharedDecodeCache.hh"
+
+namespace {
+
+// Tests that inserted values are found, and missing values aren't
+TEST(SharedDecodeCacheTest, FindInserted) {
+  simeng::arch::SharedDecodeCache<int> cache;
+  EXPECT_EQ(cache.find(0x8b020020), nullptr);
+
+  const int& value = cache.insert(0x8b020020, 12);
+  EXPECT_EQ(value, 12);
+  ASSERT_NE(cache.find(0x8b020020), nullptr);
+  EXPECT_EQ(cache.find(0x8b020020), &value);
+  EXPECT_EQ(cache.find(0x8b030020), nullptr);
+  EXPECT_EQ(cache.size(), 1);
+}
+
+// Tests that inserting an already cached encoding keeps the existing value
+TEST(SharedDecodeCacheTest, FirstInsertWins) {
+  simeng::arch::SharedDecodeCache<int> cache;
+  const int& first = cache.insert(0x8b020020, 12);
+  const int& second = cache.insert(0x8b020020, 13);
+  EXPECT_EQ(&first, &second);
+  EXPECT_EQ(second, 12);
+  EXPECT_EQ(cache.size(), 1);
+}
+
+// Tests that concurrent lookups and insertions from several threads agree on a
+// single value per encoding
+TEST(SharedDecodeCacheTest, Concurrent) {
+  constexpr int threadCount = 4;
+  constexpr uint32_t encodingCount = 4096;
+  simeng::arch::SharedDecodeCache<uint32_t> cache;
+  std::vector<std::vector<const uint32_t*>> seen(
+      threadCount, std::vector<const uint32_t*>(encodingCount));
+  std::atomic<int> mismatches(0);
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < threadCount; t++) {
+    threads.emplace_back([&, t]() {
+      for (uint32_t i = 0; i < encodingCount; i++) {
+        const uint32_t* value = cache.find(i);
+        if (value == nullptr) value = &cache.insert(i, i + t * encodingCount);
+        if (*value % encodingCount != i) mismatches++;
+        seen[t][i] = value;
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  EXPECT_EQ(mismatches, 0);
+  EXPECT_EQ(cache.size(), encodingCount);
+  for (uint32_t i = 0; i < encodingCount; i++) {
+    for (int t = 1; t < threadCount; t++) {
+      EXPECT_EQ(seen[t][i], seen[0][i]);
+    }
+  }
+}
+
+}  // namespace
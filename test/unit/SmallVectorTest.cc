@@ -0,0 +1,108 @@
+#include <cstdint>
+#include <utility>
+
+#include "gtest/gtest.h"
+#include "simeng/RegisterValue.hh"
+#include "simeng/SmallVector.hh"
+
+namespace {
+
+// Tests that elements are held inline until the inline capacity is exceeded
+TEST(SmallVectorTest, InlineUntilFull) {
+  simeng::SmallVector<uint64_t, 4> vec;
+  EXPECT_TRUE(vec.empty());
+  EXPECT_EQ(vec.capacity(), 4);
+
+  for (uint64_t i = 0; i < 4; i++) vec.push_back(i);
+  EXPECT_TRUE(vec.isInline());
+  EXPECT_EQ(vec.size(), 4);
+
+  vec.push_back(4);
+  EXPECT_FALSE(vec.isInline());
+  ASSERT_EQ(vec.size(), 5);
+  for (uint64_t i = 0; i < 5; i++) EXPECT_EQ(vec[i], i);
+}
+
+// Tests that reserving within the inline capacity doesn't leave it
+TEST(SmallVectorTest, Reserve) {
+  simeng::SmallVector<uint64_t, 4> vec;
+  vec.reserve(4);
+  EXPECT_TRUE(vec.isInline());
+
+  vec.push_back(7);
+  vec.reserve(16);
+  EXPECT_FALSE(vec.isInline());
+  EXPECT_GE(vec.capacity(), 16);
+  ASSERT_EQ(vec.size(), 1);
+  EXPECT_EQ(vec[0], 7);
+}
+
+// Tests that resizing value-initialises new elements and destroys removed ones
+TEST(SmallVectorTest, Resize) {
+  simeng::SmallVector<simeng::RegisterValue, 2> vec;
+  vec.resize(3);
+  ASSERT_EQ(vec.size(), 3);
+  for (const auto& value : vec) EXPECT_FALSE(value);
+
+  vec[1] = simeng::RegisterValue(static_cast<uint32_t>(42));
+  vec.resize(2);
+  ASSERT_EQ(vec.size(), 2);
+  EXPECT_EQ(vec[1].get<uint32_t>(), 42);
+
+  vec.clear();
+  EXPECT_TRUE(vec.empty());
+}
+
+// Tests construction from and assignment of an initializer list
+TEST(SmallVectorTest, InitializerList) {
+  simeng::SmallVector<std::pair<uint64_t, uint16_t>, 2> vec = {{0x10, 8}};
+  ASSERT_EQ(vec.size(), 1);
+  EXPECT_EQ(vec[0].first, 0x10);
+  EXPECT_EQ(vec[0].second, 8);
+
+  vec = {{0x20, 4}, {0x30, 2}, {0x40, 1}};
+  ASSERT_EQ(vec.size(), 3);
+  EXPECT_EQ(vec.back().first, 0x40);
+}
+
+// Tests that copies are independent, and that moves take over a heap
+// allocation but move inline elements individually
+TEST(SmallVectorTest, CopyAndMove) {
+  simeng::SmallVector<simeng::RegisterValue, 2> inlineVec;
+  inlineVec.push_back(simeng::RegisterValue(static_cast<uint64_t>(1)));
+
+  auto copy = inlineVec;
+  copy[0] = simeng::RegisterValue(static_cast<uint64_t>(2));
+  EXPECT_EQ(inlineVec[0].get<uint64_t>(), 1);
+
+  auto moved = std::move(inlineVec);
+  EXPECT_TRUE(moved.isInline());
+  ASSERT_EQ(moved.size(), 1);
+  EXPECT_EQ(moved[0].get<uint64_t>(), 1);
+
+  simeng::SmallVector<simeng::RegisterValue, 2> heapVec;
+  for (uint64_t i = 0; i < 3; i++)
+    heapVec.push_back(simeng::RegisterValue(i));
+  const simeng::RegisterValue* heapData = heapVec.data();
+
+  moved = std::move(heapVec);
+  EXPECT_EQ(moved.data(), heapData);
+  ASSERT_EQ(moved.size(), 3);
+  EXPECT_EQ(moved[2].get<uint64_t>(), 2);
+
+  copy = moved;
+  ASSERT_EQ(copy.size(), 3);
+  EXPECT_NE(copy.data(), moved.data());
+  EXPECT_EQ(copy[1].get<uint64_t>(), 1);
+}
+
+// Tests that appending a copy of an existing element survives growth
+TEST(SmallVectorTest, PushBackOwnElement) {
+  simeng::SmallVector<simeng::RegisterValue, 1> vec;
+  vec.push_back(simeng::RegisterValue(static_cast<uint64_t>(9)));
+  vec.push_back(vec[0]);
+  ASSERT_EQ(vec.size(), 2);
+  EXPECT_EQ(vec[1].get<uint64_t>(), 9);
+}
+
+}  // namespace
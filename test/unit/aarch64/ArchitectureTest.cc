@@ -229,8 +229,7 @@ TEST_F(AArch64ArchitectureTest, getExecutionInfo) {
   // Latencies and Port numbers from a64fx.yaml
   EXPECT_EQ(info.latency, 98);
   EXPECT_EQ(info.stallCycles, 98);
-  std::vector<uint16_t> ports = {0};
-  EXPECT_EQ(info.ports, ports);
+  EXPECT_EQ(info.ports, portBit(0));
 }
 
 TEST_F(AArch64ArchitectureTest, get_set_SVCRVal) {
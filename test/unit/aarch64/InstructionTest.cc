@@ -1,7 +1,11 @@
+#include <chrono>
+#include <iostream>
+
 #include "../ConfigInit.hh"
 #include "arch/aarch64/InstructionMetadata.hh"
 #include "gmock/gmock.h"
 #include "simeng/arch/aarch64/Instruction.hh"
+#include "simeng/arch/aarch64/helpers/sve.hh"
 #include "simeng/version.hh"
 
 namespace simeng {
@@ -99,7 +103,7 @@ TEST_F(AArch64InstructionTest, validInsn) {
   std::vector<Register> srcRegs = {{RegisterType::PREDICATE, 0},
                                    {RegisterType::VECTOR, 1},
                                    {RegisterType::VECTOR, 0}};
-  const std::vector<uint16_t> ports = {1, 2, 3};
+  const PortMask ports = toPortMask({1, 2, 3});
   insn.setExecutionInfo({3, 4, ports});
   insn.setInstructionAddress(0x48);
   insn.setInstructionId(11);
@@ -162,7 +166,7 @@ TEST_F(AArch64InstructionTest, invalidInsn_1) {
   // Define instruction's registers
   std::vector<Register> destRegs = {};
   std::vector<Register> srcRegs = {};
-  const std::vector<uint16_t> ports = {};
+  const PortMask ports = 0;
   insn.setExecutionInfo({1, 1, ports});
   insn.setInstructionAddress(0x44);
   insn.setInstructionId(13);
@@ -228,7 +232,7 @@ TEST_F(AArch64InstructionTest, invalidInsn_2) {
   // Define instruction's registers
   std::vector<Register> destRegs = {};
   std::vector<Register> srcRegs = {};
-  const std::vector<uint16_t> ports = {};
+  const PortMask ports = 0;
   insn.setExecutionInfo({1, 1, ports});
   insn.setInstructionAddress(0x43);
   insn.setInstructionId(15);
@@ -627,6 +631,91 @@ TEST_F(AArch64InstructionTest, setters) {
   EXPECT_TRUE(insn.isWaitingCommit());
 }
 
+// Measure the cost of executing decoded instructions, as every core model does
+// once an instruction's operands are available. Each iteration copies the
+// decoded instruction first, as predecode does. Disabled by default; run with
+// `--gtest_also_run_disabled_tests --gtest_filter=*Benchmark*`
+class AArch64InstructionBenchmark : public AArch64InstructionTest {};
+
+TEST_F(AArch64InstructionBenchmark, DISABLED_Execute) {
+  const uint64_t iterations = 10000000;
+  // Insns are `fdivr z1.s, p0/m, z1.s, z0.s` and `cbz x2, #0x28`
+  const Instruction fdivr(arch, *fdivMetadata.get(), MicroOpInfo());
+  const Instruction cbz(arch, *cbzMetadata.get(), MicroOpInfo());
+  RegisterValue vec = {0xABBACAFE01234567, 256};
+  uint64_t pred_vals[4] = {0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF};
+  RegisterValue pred = {pred_vals, 32};
+  RegisterValue zero = RegisterValue(0, 8);
+  uint64_t taken = 0;
+
+  auto start = std::chrono::steady_clock::now();
+  for (uint64_t i = 0; i < iterations; i++) {
+    Instruction div = fdivr;
+    div.supplyOperand(0, pred);
+    div.supplyOperand(1, vec);
+    div.supplyOperand(2, vec);
+    div.execute();
+
+    Instruction branch = cbz;
+    branch.supplyOperand(0, zero);
+    branch.execute();
+    taken += branch.wasBranchTaken();
+  }
+  std::chrono::duration<double, std::nano> elapsed =
+      std::chrono::steady_clock::now() - start;
+
+  EXPECT_EQ(taken, iterations);
+  std::cout << "[SimEng:AArch64InstructionBenchmark] execute: "
+            << elapsed.count() / (iterations * 2) << " ns/instruction"
+            << std::endl;
+}
+
+// Measure the pool allocations made by SVE helpers, and the time they take,
+// producing vector results at the maximum vector length. Each result replaces
+// the previous one, as the destination of a re-executed instruction would.
+// Disabled by default; run with
+// `--gtest_also_run_disabled_tests --gtest_filter=*Benchmark*`
+TEST(AArch64SveHelperBenchmark, DISABLED_PoolAllocations) {
+  const uint64_t iterations = 10000000;
+  const uint16_t VL_bits = 2048;
+  uint64_t pred_vals[4] = {~0ull, ~0ull, ~0ull, ~0ull};
+  double vec_vals[32];
+  for (int i = 0; i < 32; i++) vec_vals[i] = 1.5 + i;
+  srcValContainer sources;
+  sources[0] = RegisterValue(vec_vals, 256);
+  sources[1] = RegisterValue(vec_vals, 256);
+  srcValContainer predicated;
+  predicated[0] = RegisterValue(pred_vals, 32);
+  predicated[1] = sources[0];
+  predicated[2] = sources[1];
+
+  auto measure = [&](const char* name, auto helper) {
+    RegisterValue result;
+    const uint64_t allocations = pool.getAllocationCount();
+    auto start = std::chrono::steady_clock::now();
+    for (uint64_t i = 0; i < iterations; i++) {
+      result = helper();
+    }
+    std::chrono::duration<double, std::nano> elapsed =
+        std::chrono::steady_clock::now() - start;
+
+    EXPECT_EQ(result.size(), 256);
+    std::cout << "[SimEng:AArch64SveHelperBenchmark] " << name << ": "
+              << double(pool.getAllocationCount() - allocations) / iterations
+              << " pool allocations/call, " << elapsed.count() / iterations
+              << " ns/call" << std::endl;
+  };
+
+  measure("sveAdd_3ops<uint64_t>",
+          [&] { return sveAdd_3ops<uint64_t>(sources, VL_bits); });
+  measure("sveFmul_3ops<double>",
+          [&] { return sveFmul_3ops<double>(sources, VL_bits); });
+  measure("sveSel_zpzz<double>",
+          [&] { return sveSel_zpzz<double>(predicated, VL_bits); });
+  measure("sveFDivPredicated<double>",
+          [&] { return sveFDivPredicated<double>(predicated, VL_bits); });
+}
+
 }  // namespace aarch64
 }  // namespace arch
-}  // namespace simeng
\ No newline at end of file
+}  // namespace simeng
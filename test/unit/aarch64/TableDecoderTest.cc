@@ -0,0 +1,274 @@
+#include <algorithm>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+
+#include "arch/aarch64/InstructionMetadata.hh"
+#include "gmock/gmock.h"
+#include "simeng/arch/aarch64/TableDecoder.hh"
+
+namespace simeng {
+namespace arch {
+namespace aarch64 {
+
+class AArch64TableDecoderTest : public testing::Test {
+ public:
+  AArch64TableDecoderTest() {
+    cs_open(CS_ARCH_ARM64, CS_MODE_ARM, &capstoneHandle);
+    cs_option(capstoneHandle, CS_OPT_DETAIL, CS_OPT_ON);
+  }
+
+  ~AArch64TableDecoderTest() { cs_close(&capstoneHandle); }
+
+ protected:
+  /** Decode `encoding` using the decode table, and construct metadata from
+   * the result. */
+  InstructionMetadata decode(uint32_t encoding) {
+    cs_insn rawInsn;
+    cs_detail rawDetail;
+    EXPECT_TRUE(TableDecoder::decode(encoding, rawInsn, rawDetail));
+    EXPECT_EQ(rawInsn.detail, &rawDetail);
+    return InstructionMetadata(rawInsn);
+  }
+
+  /** Decode `encoding` using Capstone, and construct metadata from the
+   * result. */
+  InstructionMetadata disassemble(uint32_t encoding) {
+    cs_insn rawInsn;
+    cs_detail rawDetail;
+    rawInsn.detail = &rawDetail;
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&encoding);
+    size_t size = 4;
+    uint64_t address = 0;
+    EXPECT_TRUE(
+        cs_disasm_iter(capstoneHandle, &bytes, &size, &address, &rawInsn));
+    return InstructionMetadata(rawInsn);
+  }
+
+  /** Check that the metadata decoded for `encoding` by the decode table
+   * matches that produced by Capstone, in each field used to build an
+   * `Instruction`. */
+  void compareWithCapstone(uint32_t encoding) {
+    std::ostringstream trace;
+    trace << "encoding 0x" << std::hex << std::setw(8) << std::setfill('0')
+          << encoding;
+    SCOPED_TRACE(trace.str());
+
+    InstructionMetadata table = decode(encoding);
+    InstructionMetadata capstone = disassemble(encoding);
+
+    EXPECT_EQ(table.opcode, capstone.opcode);
+    EXPECT_EQ(table.id, capstone.id);
+    EXPECT_EQ(table.cc, capstone.cc);
+    EXPECT_EQ(table.setsFlags, capstone.setsFlags);
+    EXPECT_EQ(table.writeback, capstone.writeback);
+    EXPECT_EQ(table.getMetadataExceptionEncountered(),
+              capstone.getMetadataExceptionEncountered());
+
+    // Branches are identified by membership of the jump group
+    auto isJump = [](const InstructionMetadata& metadata) {
+      return std::count(metadata.groups, metadata.groups + metadata.groupCount,
+                        ARM64_GRP_JUMP) > 0;
+    };
+    EXPECT_EQ(isJump(table), isJump(capstone));
+
+    EXPECT_EQ(std::vector<uint16_t>(
+                  table.implicitSources,
+                  table.implicitSources + table.implicitSourceCount),
+              std::vector<uint16_t>(
+                  capstone.implicitSources,
+                  capstone.implicitSources + capstone.implicitSourceCount));
+    EXPECT_EQ(
+        std::vector<uint16_t>(
+            table.implicitDestinations,
+            table.implicitDestinations + table.implicitDestinationCount),
+        std::vector<uint16_t>(
+            capstone.implicitDestinations,
+            capstone.implicitDestinations + capstone.implicitDestinationCount));
+
+    ASSERT_EQ(table.operandCount, capstone.operandCount);
+    for (size_t i = 0; i < table.operandCount; i++) {
+      const cs_arm64_op& expected = capstone.operands[i];
+      const cs_arm64_op& actual = table.operands[i];
+      SCOPED_TRACE("operand " + std::to_string(i));
+      ASSERT_EQ(actual.type, expected.type);
+      EXPECT_EQ(actual.access, expected.access);
+      EXPECT_EQ(actual.vector_index, expected.vector_index);
+      EXPECT_EQ(actual.shift.type, expected.shift.type);
+      EXPECT_EQ(actual.shift.value, expected.shift.value);
+      switch (expected.type) {
+        case ARM64_OP_REG:
+          EXPECT_EQ(actual.reg, expected.reg);
+          break;
+        case ARM64_OP_IMM:
+          EXPECT_EQ(actual.imm, expected.imm);
+          break;
+        case ARM64_OP_MEM:
+          EXPECT_EQ(actual.mem.base, expected.mem.base);
+          EXPECT_EQ(actual.mem.index, expected.mem.index);
+          EXPECT_EQ(actual.mem.disp, expected.mem.disp);
+          break;
+        default:
+          break;
+      }
+    }
+  }
+
+  /** Compare the table and Capstone decodings of the encodings covered by
+   * each pattern of the decode table, stopping at the first mismatch.
+   * Patterns covering more than `limit` encodings are sampled, visiting
+   * `limit` distinct encodings spread across all of the pattern's free bits.
+   */
+  void compareCoveredEncodings(uint64_t limit) {
+    for (const auto& pattern : TableDecoder::getPatterns()) {
+      std::vector<uint8_t> freeBits;
+      for (uint8_t bit = 0; bit < 32; bit++) {
+        if (!((pattern.mask >> bit) & 1)) freeBits.push_back(bit);
+      }
+      uint64_t count = uint64_t(1) << freeBits.size();
+
+      // An odd stride through the 2^n combinations of free bits visits each
+      // at most once
+      uint64_t stride =
+          count > limit ? (0x9E3779B97F4A7C15 & (count - 1)) | 1 : 1;
+      uint64_t index = 0;
+      for (uint64_t i = 0; i < std::min(count, limit); i++) {
+        uint32_t encoding = pattern.value;
+        for (size_t bit = 0; bit < freeBits.size(); bit++) {
+          if ((index >> bit) & 1) encoding |= uint32_t(1) << freeBits[bit];
+        }
+        compareWithCapstone(encoding);
+        if (HasFailure()) return;
+        index = (index + stride) & (count - 1);
+      }
+    }
+  }
+
+  csh capstoneHandle;
+};
+
+// add x0, x1, #1, lsl #12
+TEST_F(AArch64TableDecoderTest, addImmediate) {
+  InstructionMetadata metadata = decode(0x91400420);
+  EXPECT_EQ(metadata.opcode, Opcode::AArch64_ADDXri);
+  EXPECT_EQ(metadata.encoding[0], 0x20);
+  EXPECT_EQ(metadata.encoding[3], 0x91);
+  EXPECT_EQ(metadata.implicitDestinationCount, 0);
+  ASSERT_EQ(metadata.operandCount, 3);
+  EXPECT_EQ(metadata.operands[0].type, ARM64_OP_REG);
+  EXPECT_EQ(metadata.operands[0].reg, ARM64_REG_X0);
+  EXPECT_EQ(metadata.operands[0].access, CS_AC_WRITE);
+  EXPECT_EQ(metadata.operands[1].reg, ARM64_REG_X1);
+  EXPECT_EQ(metadata.operands[1].access, CS_AC_READ);
+  EXPECT_EQ(metadata.operands[2].type, ARM64_OP_IMM);
+  EXPECT_EQ(metadata.operands[2].imm, 1);
+  EXPECT_EQ(metadata.operands[2].shift.type, ARM64_SFT_LSL);
+  EXPECT_EQ(metadata.operands[2].shift.value, 12);
+}
+
+// cmp x0, #1 is decoded as subs xzr, x0, #1
+TEST_F(AArch64TableDecoderTest, compareImmediate) {
+  InstructionMetadata metadata = decode(0xf100041f);
+  EXPECT_EQ(metadata.opcode, Opcode::AArch64_SUBSXri);
+  ASSERT_EQ(metadata.implicitDestinationCount, 1);
+  EXPECT_EQ(metadata.implicitDestinations[0], ARM64_REG_NZCV);
+  ASSERT_EQ(metadata.operandCount, 3);
+  EXPECT_EQ(metadata.operands[0].reg, ARM64_REG_XZR);
+  EXPECT_EQ(metadata.operands[0].access, CS_AC_WRITE);
+  EXPECT_EQ(metadata.operands[1].reg, ARM64_REG_X0);
+  EXPECT_EQ(metadata.operands[2].imm, 1);
+}
+
+// mov x0, #0x10000 is decoded as movz, with the shift folded into the
+// immediate
+TEST_F(AArch64TableDecoderTest, moveWide) {
+  InstructionMetadata metadata = decode(0xd2a00020);
+  EXPECT_EQ(metadata.opcode, Opcode::AArch64_MOVZXi);
+  ASSERT_EQ(metadata.operandCount, 2);
+  EXPECT_EQ(metadata.operands[0].reg, ARM64_REG_X0);
+  EXPECT_EQ(metadata.operands[0].access, CS_AC_WRITE);
+  EXPECT_EQ(metadata.operands[1].imm, 0x10000);
+  EXPECT_EQ(metadata.operands[1].shift.value, 0);
+}
+
+// b.ne #-8
+TEST_F(AArch64TableDecoderTest, conditionalBranch) {
+  InstructionMetadata metadata = decode(0x54ffffc1);
+  EXPECT_EQ(metadata.opcode, Opcode::AArch64_Bcc);
+  EXPECT_EQ(metadata.cc, 1);
+  ASSERT_EQ(metadata.implicitSourceCount, 1);
+  EXPECT_EQ(metadata.implicitSources[0], ARM64_REG_NZCV);
+  ASSERT_EQ(metadata.groupCount, 1);
+  EXPECT_EQ(metadata.groups[0], ARM64_GRP_JUMP);
+  ASSERT_EQ(metadata.operandCount, 1);
+  EXPECT_EQ(metadata.operands[0].imm, -8);
+}
+
+// bl #0x40
+TEST_F(AArch64TableDecoderTest, branchWithLink) {
+  InstructionMetadata metadata = decode(0x94000010);
+  EXPECT_EQ(metadata.opcode, Opcode::AArch64_BL);
+  ASSERT_EQ(metadata.implicitDestinationCount, 1);
+  EXPECT_EQ(metadata.implicitDestinations[0], ARM64_REG_X30);
+  ASSERT_EQ(metadata.operandCount, 1);
+  EXPECT_EQ(metadata.operands[0].imm, 0x40);
+}
+
+// ret
+TEST_F(AArch64TableDecoderTest, ret) {
+  InstructionMetadata metadata = decode(0xd65f03c0);
+  EXPECT_EQ(metadata.opcode, Opcode::AArch64_RET);
+  ASSERT_EQ(metadata.groupCount, 1);
+  EXPECT_EQ(metadata.groups[0], ARM64_GRP_JUMP);
+  ASSERT_EQ(metadata.operandCount, 1);
+  EXPECT_EQ(metadata.operands[0].reg, ARM64_REG_X30);
+  EXPECT_EQ(metadata.operands[0].access, CS_AC_READ);
+}
+
+// ldr x0, [sp, #16] and str w0, [x1, #4]
+TEST_F(AArch64TableDecoderTest, loadStore) {
+  InstructionMetadata load = decode(0xf9400be0);
+  EXPECT_EQ(load.opcode, Opcode::AArch64_LDRXui);
+  ASSERT_EQ(load.operandCount, 2);
+  EXPECT_EQ(load.operands[0].reg, ARM64_REG_X0);
+  EXPECT_EQ(load.operands[0].access, CS_AC_WRITE);
+  EXPECT_EQ(load.operands[1].type, ARM64_OP_MEM);
+  EXPECT_EQ(load.operands[1].mem.base, ARM64_REG_SP);
+  EXPECT_EQ(load.operands[1].mem.index, ARM64_REG_INVALID);
+  EXPECT_EQ(load.operands[1].mem.disp, 16);
+
+  InstructionMetadata store = decode(0xb9000420);
+  EXPECT_EQ(store.opcode, Opcode::AArch64_STRWui);
+  ASSERT_EQ(store.operandCount, 2);
+  EXPECT_EQ(store.operands[0].reg, ARM64_REG_W0);
+  EXPECT_EQ(store.operands[0].access, CS_AC_READ);
+  EXPECT_EQ(store.operands[1].mem.base, ARM64_REG_X1);
+  EXPECT_EQ(store.operands[1].mem.disp, 4);
+}
+
+// Encodings absent from the decode table are left to Capstone
+TEST_F(AArch64TableDecoderTest, notCovered) {
+  cs_insn rawInsn;
+  cs_detail rawDetail;
+  // add x0, x1, x2
+  EXPECT_FALSE(TableDecoder::decode(0x8b020020, rawInsn, rawDetail));
+  // movz w0, #0, lsl #32 is unallocated
+  EXPECT_FALSE(TableDecoder::decode(0x52c00000, rawInsn, rawDetail));
+}
+
+// Decodes a sample of 4096 of the encodings covered by each decode table
+// entry through both the table and Capstone, comparing the metadata produced
+TEST_F(AArch64TableDecoderTest, matchesCapstone) {
+  compareCoveredEncodings(4096);
+}
+
+// Compares every encoding covered by the decode table, around 300 million in
+// total. Too slow to run by default; enable with
+// --gtest_also_run_disabled_tests after modifying the table
+TEST_F(AArch64TableDecoderTest, DISABLED_matchesCapstoneExhaustive) {
+  compareCoveredEncodings(UINT64_MAX);
+}
+
+}  // namespace aarch64
+}  // namespace arch
+}  // namespace simeng
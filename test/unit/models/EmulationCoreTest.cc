@@ -0,0 +1,292 @@
+#include <cstring>
+
+#include "../ConfigInit.hh"
+#include "../MockArchitecture.hh"
+#include "../MockInstruction.hh"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "simeng/memory/FlatMemoryInterface.hh"
+#include "simeng/models/emulation/Core.hh"
+
+namespace simeng {
+namespace models {
+namespace emulation {
+
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+/** An exception handler which immediately completes with a fixed result. */
+class FixedExceptionHandler : public arch::ExceptionHandler {
+ public:
+  FixedExceptionHandler(arch::ExceptionResult result)
+      : result_(std::move(result)) {}
+  bool tick() override { return true; }
+  const arch::ExceptionResult& getResult() const override { return result_; }
+
+ private:
+  arch::ExceptionResult result_;
+};
+
+/** The operation performed by a test program instruction. */
+enum class Operation {
+  /** Write `source + immediate` to `destination`. */
+  Add,
+  /** Branch to `immediate` if `source` is non-zero. */
+  Branch,
+  /** Write the 4-byte encoding `value` to address `immediate`. */
+  Store,
+  /** Raise an exception during execution, whose handler resumes at the next
+   * instruction after writing the 4-byte encoding `value` to address
+   * `immediate`. */
+  Syscall,
+  /** End the program, by raising an exception. */
+  Halt
+};
+
+/** An instruction of a test program. Each is encoded in the process image as
+ * its 4-byte index within the program. */
+struct ProgramEntry {
+  Operation operation;
+  Register destination = {0, 0};
+  Register source = {0, 0};
+  int64_t immediate = 0;
+  uint32_t value = 0;
+};
+
+/** The state of an in-flight uop of the test program. */
+struct UopState {
+  RegisterValue operand;
+  std::vector<RegisterValue> results;
+  std::vector<memory::MemoryAccessTarget> addresses;
+  std::vector<RegisterValue> data;
+};
+
+// Runs short programs through the emulation core, decoding each 4-byte word
+// of the process image as an index into `program`
+class EmulationCoreTest : public testing::Test {
+ public:
+  EmulationCoreTest()
+      : configInit(config::ISA::AArch64,
+                   "{Core: {Simulation-Mode: emulation}}"),
+        image(8192, 0),
+        dataMemory(image.data(), image.size()),
+        os(config::SimInfo::getConfig()["CPU-Info"]["Special-File-Dir-Path"]
+               .as<std::string>()),
+        arch(os) {
+    ON_CALL(arch, predecode(_, _, _, _))
+        .WillByDefault(Invoke([this](const uint8_t* ptr, uint16_t bytes,
+                                     uint64_t address, MacroOp& output) {
+          predecodes++;
+          uint32_t index;
+          std::memcpy(&index, ptr, 4);
+          output.resize(1);
+          output[0] = createUop(index, address);
+          return uint8_t(4);
+        }));
+    ON_CALL(arch, handleException(_, _, _))
+        .WillByDefault(Invoke([this](auto instruction, auto& core,
+                                     auto& memory) {
+          uint64_t address = instruction->getInstructionAddress();
+          const auto& entry = program[address / 4];
+          if (entry.operation != Operation::Syscall) {
+            return std::make_shared<FixedExceptionHandler>(
+                arch::ExceptionResult{true, 0, {}});
+          }
+          arch::ProcessStateChange change = {
+              arch::ChangeType::REPLACEMENT, {}, {},
+              {{static_cast<uint64_t>(entry.immediate), 4}},
+              {RegisterValue(entry.value, 4)}};
+          return std::make_shared<FixedExceptionHandler>(
+              arch::ExceptionResult{false, address + 4, change});
+        }));
+  }
+
+ protected:
+  /** Encode `program` into the process image and run it until the core
+   * halts. */
+  void run() {
+    for (uint32_t i = 0; i < program.size(); i++) {
+      std::memcpy(image.data() + i * 4, &i, 4);
+    }
+    Core core(image.data(), dataMemory, 0, image.size(), arch);
+    ticks = 0;
+    while (!core.hasHalted() && ticks < 1000) {
+      core.tick();
+      ticks++;
+    }
+    EXPECT_TRUE(core.hasHalted());
+    cycles = std::stoull(core.getStats()["cycles"]);
+    retired = core.getInstructionsRetiredCount();
+    result = core.getArchitecturalRegisterFileSet().get(r2).get<uint64_t>();
+  }
+
+  /** Create a mock of the program instruction `index`, held at `address`. Its
+   * clones are fresh mocks of the same instruction. */
+  std::shared_ptr<Instruction> createUop(uint32_t index, uint64_t address) {
+    const auto& entry = program[index];
+    auto uop = std::make_shared<NiceMock<MockInstruction>>();
+    auto state = std::make_shared<UopState>();
+    uop->setInstructionAddress(address);
+    uop->setExceptionEncountered(entry.operation == Operation::Halt);
+
+    MockInstruction* mock = uop.get();
+    ON_CALL(*uop, clone()).WillByDefault(Invoke([this, index, address]() {
+      return createUop(index, address);
+    }));
+    ON_CALL(*uop, getSourceRegisters())
+        .WillByDefault(Return(span<Register>(
+            const_cast<Register*>(&entry.source), 1)));
+    ON_CALL(*uop, supplyOperand(_, _))
+        .WillByDefault(Invoke([state](uint16_t i, const RegisterValue& value) {
+          state->operand = value;
+        }));
+    ON_CALL(*uop, getDestinationRegisters())
+        .WillByDefault(Return(span<Register>(
+            const_cast<Register*>(&entry.destination), 1)));
+    ON_CALL(*uop, getResults()).WillByDefault(Invoke([state]() {
+      return span<RegisterValue>(state->results.data(), state->results.size());
+    }));
+    ON_CALL(*uop, isBranch())
+        .WillByDefault(Return(entry.operation == Operation::Branch));
+    ON_CALL(*uop, isStoreAddress())
+        .WillByDefault(Return(entry.operation == Operation::Store));
+    ON_CALL(*uop, isStoreData())
+        .WillByDefault(Return(entry.operation == Operation::Store));
+    ON_CALL(*uop, generateAddresses()).WillByDefault(Invoke([state, &entry]() {
+      state->addresses = {{static_cast<uint64_t>(entry.immediate), 4}};
+      return span<const memory::MemoryAccessTarget>(state->addresses.data(),
+                                                    state->addresses.size());
+    }));
+    ON_CALL(*uop, getData()).WillByDefault(Invoke([state]() {
+      return span<const RegisterValue>(state->data.data(), state->data.size());
+    }));
+    ON_CALL(*uop, execute())
+        .WillByDefault(Invoke([state, &entry, mock, address]() {
+          uint64_t operand = state->operand.get<uint64_t>();
+          switch (entry.operation) {
+            case Operation::Add:
+              state->results = {RegisterValue(operand + entry.immediate, 8)};
+              break;
+            case Operation::Branch:
+              mock->setBranchResults(
+                  operand != 0, operand != 0 ? entry.immediate : address + 4);
+              break;
+            case Operation::Store:
+              state->data = {RegisterValue(entry.value, 4)};
+              break;
+            case Operation::Syscall:
+              mock->setExceptionEncountered(true);
+              break;
+            default:
+              break;
+          }
+          mock->setExecuted(true);
+        }));
+    return uop;
+  }
+
+  ConfigInit configInit;
+
+  std::vector<char> image;
+  memory::FlatMemoryInterface dataMemory;
+
+  kernel::Linux os;
+  NiceMock<MockArchitecture> arch;
+
+  std::vector<ProgramEntry> program;
+  uint64_t predecodes = 0;
+  uint64_t ticks = 0;
+  uint64_t cycles = 0;
+  uint64_t retired = 0;
+  /** The final value of r2. */
+  uint64_t result = 0;
+
+  const Register r0 = {0, 0};
+  const Register r1 = {0, 1};
+  const Register r2 = {0, 2};
+  const Register r5 = {0, 5};
+};
+
+// Tests that each basic block is predecoded only on its first execution
+TEST_F(EmulationCoreTest, BlocksDecodedOnce) {
+  program = {
+      {Operation::Add, r1, r0, 3},         // 0: r1 = 3
+      {Operation::Add, r5, r0, 1},         // 4: r5 = 1
+      {Operation::Branch, r0, r5, 12},     // 8: b 12
+      {Operation::Add, r2, r2, 1},         // 12: r2++
+      {Operation::Add, r1, r1, -1},        // 16: r1--
+      {Operation::Branch, r0, r1, 12},     // 20: bnz r1, 12
+      {Operation::Halt}};                  // 24
+  run();
+
+  EXPECT_EQ(retired, 12);
+  EXPECT_EQ(result, 3);
+  // The loop body of three instructions is decoded once, not three times
+  EXPECT_EQ(predecodes, 7);
+  // Each tick executes one block, while a cycle passes for every instruction,
+  // including the one halting the program
+  EXPECT_EQ(ticks, 5);
+  EXPECT_EQ(cycles, 13);
+}
+
+// Tests that a store over a cached block discards it, such that the modified
+// code is decoded and executed when the block is next reached
+TEST_F(EmulationCoreTest, StoreToCodeInvalidatesBlocks) {
+  program = {
+      {Operation::Add, r1, r0, 1},         // 0: r1 = 1
+      {Operation::Add, r5, r0, 1},         // 4: r5 = 1
+      {Operation::Branch, r0, r5, 12},     // 8: b 12
+      {Operation::Add, r2, r2, 1},         // 12: r2++, replaced by entry 10
+      {Operation::Branch, r0, r1, 28},     // 16: bnz r1, 28
+      {Operation::Halt},                   // 20
+      {Operation::Halt},                   // 24
+      {Operation::Store, r0, r0, 12, 10},  // 28: replace 12 with entry 10
+      {Operation::Add, r1, r0, 0},         // 32: r1 = 0
+      {Operation::Branch, r0, r5, 12},     // 36: b 12
+      {Operation::Add, r2, r2, 10}};       // 40: r2 += 10
+  run();
+
+  EXPECT_EQ(retired, 10);
+  EXPECT_EQ(result, 11);
+}
+
+// Tests that an exception handler only discards the cached blocks if its
+// memory updates write to a page holding one of them
+TEST_F(EmulationCoreTest, ExceptionHandlerWritesToData) {
+  program = {
+      {Operation::Add, r1, r0, 3},            // 0: r1 = 3
+      {Operation::Add, r2, r2, 1},            // 4: r2++
+      {Operation::Syscall, r0, r0, 4096, 7},  // 8: write to a data page
+      {Operation::Add, r1, r1, -1},           // 12: r1--
+      {Operation::Branch, r0, r1, 4},         // 16: bnz r1, 4
+      {Operation::Halt}};                     // 20
+  run();
+
+  EXPECT_EQ(result, 3);
+  // The blocks starting at 0, 4 and 20 are each decoded once
+  EXPECT_EQ(predecodes, 10);
+}
+
+// Tests that an exception handler writing over a cached block discards it,
+// such that the modified code is executed when the block is next reached
+TEST_F(EmulationCoreTest, ExceptionHandlerWritesToCode) {
+  program = {
+      {Operation::Add, r1, r0, 2},          // 0: r1 = 2
+      {Operation::Add, r5, r0, 1},          // 4: r5 = 1
+      {Operation::Branch, r0, r5, 12},      // 8: b 12
+      {Operation::Add, r2, r2, 1},          // 12: r2++, replaced by entry 8
+      {Operation::Syscall, r0, r0, 12, 8},  // 16: replace 12 with entry 8
+      {Operation::Add, r1, r1, -1},         // 20: r1--
+      {Operation::Branch, r0, r1, 12},      // 24: bnz r1, 12
+      {Operation::Halt},                    // 28
+      {Operation::Add, r2, r2, 10}};        // 32: r2 += 10
+  run();
+
+  EXPECT_EQ(result, 11);
+}
+
+}  // namespace emulation
+}  // namespace models
+}  // namespace simeng
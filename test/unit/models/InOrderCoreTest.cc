@@ -0,0 +1,279 @@
+#include "../ConfigInit.hh"
+#include "../MockArchitecture.hh"
+#include "../MockBranchPredictor.hh"
+#include "../MockInstruction.hh"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "simeng/memory/FlatMemoryInterface.hh"
+#include "simeng/models/inorder/Core.hh"
+
+namespace simeng {
+namespace models {
+namespace inorder {
+
+using ::testing::_;
+using ::testing::Invoke;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+/** An exception handler which halts the core, used to end each program. */
+class HaltingExceptionHandler : public arch::ExceptionHandler {
+ public:
+  bool tick() override { return true; }
+  const arch::ExceptionResult& getResult() const override { return result_; }
+
+ private:
+  arch::ExceptionResult result_ = {true, 0, {}};
+};
+
+/** An instruction of a test program, and a record of its execution. */
+struct ProgramEntry {
+  /** The registers read. */
+  std::vector<Register> sources;
+  /** The registers written. */
+  std::vector<Register> destinations;
+  /** The values written to `destinations`. */
+  std::vector<RegisterValue> results;
+  /** The number of cycles taken to execute. */
+  uint16_t latency = 1;
+  /** Whether the instruction is a load. */
+  bool load = false;
+  /** The memory read by a load. */
+  std::vector<memory::MemoryAccessTarget> addresses = {{0x100, 8}};
+  /** Whether the instruction ends the program, by raising an exception. */
+  bool halt = false;
+
+  /** The source operand values read from the register file. */
+  std::vector<uint64_t> operands;
+  /** The cycle on which the instruction executed, or 0 if it hasn't. */
+  uint64_t executeCycle = 0;
+};
+
+// Runs short programs through the in-order core, with `GetParam()` as the
+// front-end width and four pipelined ports able to execute any instruction
+class InOrderCoreTest : public testing::TestWithParam<uint16_t> {
+ public:
+  InOrderCoreTest()
+      : configInit(config::ISA::AArch64,
+                   "{Core: {Simulation-Mode: inorderpipelined}, "
+                   "Pipeline-Widths: {FrontEnd: " +
+                       std::to_string(GetParam()) + R"YAML(},
+  Fetch: {Fetch-Block-Size: 32},
+  Ports: {
+    '0': {Portname: Port 0, Instruction-Group-Support: [INT, LOAD]},
+    '1': {Portname: Port 1, Instruction-Group-Support: [INT, LOAD]},
+    '2': {Portname: Port 2, Instruction-Group-Support: [INT, LOAD]},
+    '3': {Portname: Port 3, Instruction-Group-Support: [INT, LOAD]}
+  },
+  Reservation-Stations: {
+    '0': {Size: 60, Dispatch-Rate: 4, Ports: [Port 0, Port 1, Port 2, Port 3]}
+  },
+  Execution-Units: {
+    '0': {Pipelined: True},
+    '1': {Pipelined: True},
+    '2': {Pipelined: True},
+    '3': {Pipelined: True}
+  }
+  })YAML"),
+        code(1024, 0),
+        data(1024, 0),
+        instructionMemory(code.data(), code.size()),
+        dataMemory(data.data(), data.size()),
+        os(config::SimInfo::getConfig()["CPU-Info"]["Special-File-Dir-Path"]
+               .as<std::string>()),
+        arch(os) {
+    ON_CALL(arch, getMaxInstructionSize()).WillByDefault(Return(4));
+    ON_CALL(arch, getMinInstructionSize()).WillByDefault(Return(4));
+    ON_CALL(arch, predecode(_, _, _, _))
+        .WillByDefault(Invoke([this](const uint8_t* ptr, uint16_t bytes,
+                                     uint64_t address, MacroOp& output) {
+          if (bytes < 4) return uint8_t(0);
+          output.resize(1);
+          output[0] = createUop(address);
+          return uint8_t(4);
+        }));
+    ON_CALL(arch, handleException(_, _, _))
+        .WillByDefault(Invoke([](auto instruction, auto& core, auto& memory) {
+          return std::make_shared<HaltingExceptionHandler>();
+        }));
+  }
+
+ protected:
+  /** Append an instruction writing `result` to `destination` from
+   * `sources`, returning its index. */
+  size_t add(Register destination, std::vector<Register> sources,
+             uint64_t result, uint16_t latency = 1) {
+    ProgramEntry entry;
+    entry.sources = sources;
+    entry.destinations = {destination};
+    entry.results = {RegisterValue(result, 8)};
+    entry.latency = latency;
+    program.push_back(entry);
+    return program.size() - 1;
+  }
+
+  /** Append a load of `result` into `destination`, returning its index. */
+  size_t load(Register destination, uint64_t result, uint16_t latency = 1) {
+    size_t index = add(destination, {}, result, latency);
+    program[index].load = true;
+    return index;
+  }
+
+  /** Run the program until the core halts, returning its statistics. */
+  std::map<std::string, std::string> run() {
+    ProgramEntry halt;
+    halt.halt = true;
+    program.push_back(halt);
+
+    Core core(instructionMemory, dataMemory, code.size(), 0, arch, predictor);
+    core_ = &core;
+    uint64_t ticks = 0;
+    while (!core.hasHalted() && ticks < 1000) {
+      core.tick();
+      ticks++;
+    }
+    EXPECT_TRUE(core.hasHalted());
+    retired = core.getInstructionsRetiredCount();
+    core_ = nullptr;
+    return core.getStats();
+  }
+
+  /** Create a mock of the program instruction at `address`. Instructions
+   * fetched beyond the end of the program halt. */
+  std::shared_ptr<Instruction> createUop(uint64_t address) {
+    size_t index = std::min<size_t>(address / 4, program.size() - 1);
+    auto& entry = program[index];
+    auto uop = std::make_shared<NiceMock<MockInstruction>>();
+    uop->setInstructionAddress(address);
+    uop->setInstructionId(nextId);
+    uop->setSequenceId(nextId++);
+    uop->setLatency(entry.latency);
+    uop->setExceptionEncountered(entry.halt);
+
+    MockInstruction* mock = uop.get();
+    ON_CALL(*uop, getSourceRegisters())
+        .WillByDefault(Return(
+            span<Register>(entry.sources.data(), entry.sources.size())));
+    ON_CALL(*uop, getDestinationRegisters())
+        .WillByDefault(Return(span<Register>(entry.destinations.data(),
+                                             entry.destinations.size())));
+    ON_CALL(*uop, getResults())
+        .WillByDefault(Return(
+            span<RegisterValue>(entry.results.data(), entry.results.size())));
+    ON_CALL(*uop, supplyOperand(_, _))
+        .WillByDefault(Invoke([&entry](uint16_t i, const RegisterValue& value) {
+          entry.operands.push_back(value.get<uint64_t>());
+        }));
+    ON_CALL(*uop, canExecute()).WillByDefault(Return(true));
+    ON_CALL(*uop, execute()).WillByDefault(Invoke([this, &entry, mock]() {
+      entry.executeCycle = std::stoull(core_->getStats()["cycles"]);
+      mock->setExecuted(true);
+    }));
+    ON_CALL(*uop, isLoad()).WillByDefault(Return(entry.load));
+    ON_CALL(*uop, generateAddresses())
+        .WillByDefault(Return(span<const memory::MemoryAccessTarget>(
+            entry.addresses.data(), entry.addresses.size())));
+    ON_CALL(*uop, getGeneratedAddresses())
+        .WillByDefault(Return(span<const memory::MemoryAccessTarget>(
+            entry.addresses.data(), entry.addresses.size())));
+    ON_CALL(*uop, hasAllData()).WillByDefault(Return(true));
+    ON_CALL(*uop, getSupportedPorts())
+        .WillByDefault(Return(toPortMask({0, 1, 2, 3})));
+    return uop;
+  }
+
+  ConfigInit configInit;
+
+  std::vector<char> code;
+  std::vector<char> data;
+  memory::FlatMemoryInterface instructionMemory;
+  memory::FlatMemoryInterface dataMemory;
+
+  kernel::Linux os;
+  NiceMock<MockArchitecture> arch;
+  NiceMock<MockBranchPredictor> predictor;
+
+  std::vector<ProgramEntry> program;
+  uint64_t nextId = 0;
+  uint64_t retired = 0;
+
+  /** The core running the program, while it runs. */
+  Core* core_ = nullptr;
+
+  const Register r1 = {0, 1};
+  const Register r2 = {0, 2};
+  const Register r3 = {0, 3};
+};
+
+// Tests that independent instructions issue at the front-end width each cycle
+TEST_P(InOrderCoreTest, MultiIssue) {
+  const uint16_t width = GetParam();
+  const uint64_t count = 48;
+  for (uint64_t i = 0; i < count; i++) {
+    add({0, static_cast<uint16_t>(1 + i % 8)}, {}, i);
+  }
+  auto stats = run();
+
+  EXPECT_EQ(retired, count);
+  // Fetch, decode, issue and execute fill over the first cycles, after which
+  // `width` instructions execute each cycle
+  EXPECT_EQ(program[count - 1].executeCycle - program[0].executeCycle,
+            (count - 1) / width);
+  for (uint64_t i = 0; i < count; i++) {
+    EXPECT_EQ(program[i].executeCycle, program[0].executeCycle + i / width);
+  }
+  EXPECT_EQ(stats["issue.multiIssueCycles"],
+            std::to_string(width > 1 ? count / width : 0));
+  EXPECT_EQ(stats["issue.dependencyStalls"], "0");
+  EXPECT_EQ(stats["issue.loadUseStalls"], "0");
+}
+
+// Tests that an instruction waits in issue for a source operand to be produced
+// by a multi-cycle instruction, holding back younger instructions, and reads
+// the value produced
+TEST_P(InOrderCoreTest, ReadAfterWriteHazard) {
+  const uint16_t latency = 4;
+  size_t producer = add(r1, {}, 7, latency);
+  size_t consumer = add(r2, {r1}, 8);
+  size_t independent = add(r3, {}, 9);
+  auto stats = run();
+
+  EXPECT_EQ(retired, 3);
+  // Issued once the producer has executed, reading its result as written back
+  // at the start of the next cycle
+  EXPECT_EQ(program[consumer].executeCycle,
+            program[producer].executeCycle + 1);
+  EXPECT_EQ(program[consumer].operands, std::vector<uint64_t>({7}));
+  // Issued in program order, despite having no dependencies
+  EXPECT_GE(program[independent].executeCycle,
+            program[consumer].executeCycle);
+  // Stalled until the producer executes; from the producer's own issue cycle
+  // if both reach issue together
+  const uint16_t stalls = GetParam() > 1 ? latency : latency - 1;
+  EXPECT_EQ(stats["issue.dependencyStalls"], std::to_string(stalls));
+  EXPECT_EQ(stats["issue.loadUseStalls"], "0");
+}
+
+// Tests that stalls on the result of a load are counted as load-use stalls,
+// separately to those on other instructions
+TEST_P(InOrderCoreTest, LoadUseStall) {
+  const uint16_t latency = 3;
+  size_t producer = load(r1, 42, latency);
+  size_t consumer = add(r2, {r1}, 8);
+  auto stats = run();
+
+  EXPECT_EQ(retired, 2);
+  EXPECT_EQ(program[consumer].executeCycle,
+            program[producer].executeCycle + 1);
+  EXPECT_EQ(program[consumer].operands, std::vector<uint64_t>({42}));
+  const uint16_t stalls = GetParam() > 1 ? latency : latency - 1;
+  EXPECT_EQ(stats["issue.loadUseStalls"], std::to_string(stalls));
+  EXPECT_EQ(stats["issue.dependencyStalls"], "0");
+}
+
+INSTANTIATE_TEST_SUITE_P(InOrderCoreTests, InOrderCoreTest,
+                         ::testing::Values(1, 2, 4));
+
+}  // namespace inorder
+}  // namespace models
+}  // namespace simeng
@@ -1,3 +1,5 @@
+#include <random>
+
 #include "gtest/gtest.h"
 #include "simeng/pipeline/BalancedPortAllocator.hh"
 
@@ -8,22 +10,22 @@ namespace pipeline {
 TEST(BalancedPortAllocatorTest, Allocate) {
   std::vector<std::vector<uint16_t>> arrangement = {{0}};
   auto simple = BalancedPortAllocator(arrangement);
-  EXPECT_EQ(simple.allocate({0}), 0);
+  EXPECT_EQ(simple.allocate(toPortMask({0})), 0);
 }
 
 // Tests that the balanced port allocator selects the correct port when there's
 // multiple ports
 TEST(BalancedPortAllocatorTest, AllocateLimited) {
   auto limited = BalancedPortAllocator({{0}, {1}, {2}});
-  EXPECT_EQ(limited.allocate({1}), 1);
+  EXPECT_EQ(limited.allocate(toPortMask({1})), 1);
 }
 
 // Tests that the balanced port allocator will balance across two equal ports
 // when allocated in sequence
 TEST(BalancedPortAllocatorTest, BalanceEven) {
   auto portAllocator = BalancedPortAllocator({{0}, {1}});
-  auto first = portAllocator.allocate({0, 1});
-  auto second = portAllocator.allocate({0, 1});
+  auto first = portAllocator.allocate(toPortMask({0, 1}));
+  auto second = portAllocator.allocate(toPortMask({0, 1}));
   EXPECT_NE(first, second);
 }
 
@@ -32,11 +34,11 @@ TEST(BalancedPortAllocatorTest, BalanceEven) {
 TEST(BalancedPortAllocatorTest, BalanceUneven) {
   auto portAllocator = BalancedPortAllocator({{0}, {1}});
   // Allocate for port 0 twice
-  EXPECT_EQ(portAllocator.allocate({0}), 0);
-  EXPECT_EQ(portAllocator.allocate({0}), 0);
+  EXPECT_EQ(portAllocator.allocate(toPortMask({0})), 0);
+  EXPECT_EQ(portAllocator.allocate(toPortMask({0})), 0);
 
   // Port 0 and 1 allocation should go to port 1 to be balanced
-  EXPECT_EQ(portAllocator.allocate({0, 1}), 1);
+  EXPECT_EQ(portAllocator.allocate(toPortMask({0, 1})), 1);
 }
 
 // Tests that the balanced port allocator will take deallocations into account
@@ -44,11 +46,11 @@ TEST(BalancedPortAllocatorTest, BalanceUneven) {
 TEST(BalancedPortAllocatorTest, Deallocate) {
   auto portAllocator = BalancedPortAllocator({{0, 1}, {0, 2}});
   // Allocate to port 0 twice
-  EXPECT_EQ(portAllocator.allocate({0}), 0);
-  EXPECT_EQ(portAllocator.allocate({0}), 0);
+  EXPECT_EQ(portAllocator.allocate(toPortMask({0})), 0);
+  EXPECT_EQ(portAllocator.allocate(toPortMask({0})), 0);
 
   // Port 1 allocation
-  EXPECT_EQ(portAllocator.allocate({1}), 1);
+  EXPECT_EQ(portAllocator.allocate(toPortMask({1})), 1);
 
   // Deallocate twice from port 0
   portAllocator.deallocate(0);
@@ -56,7 +58,7 @@ TEST(BalancedPortAllocatorTest, Deallocate) {
 
   // Next allocation should go to port 0, rather than port 1, if deallocation
   // was respected
-  EXPECT_EQ(portAllocator.allocate({0, 1}), 0);
+  EXPECT_EQ(portAllocator.allocate(toPortMask({0, 1})), 0);
 }
 
 // Tests correct allocation when multiple ports support an instruction
@@ -65,10 +67,64 @@ TEST(BalancedPortAllocatorTest, MultipleSupportedPorts) {
       BalancedPortAllocator({{0}, {1}, {2}, {3}, {4}, {5}, {6}, {7}, {8}, {9}});
 
   // Ensure multi-port support is correctly balanced
+  const PortMask ports = toPortMask({0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
   for (int i = 0; i < 10; i++) {
-    EXPECT_EQ(portAllocator.allocate({0, 1, 2, 3, 4, 5, 6, 7, 8, 9}), i);
+    EXPECT_EQ(portAllocator.allocate(ports), i);
   }
 }
 
+// Tests that allocation decisions match a linear scan over per-port weights,
+// choosing the first lowest-weighted port in ascending order, across a random
+// sequence of allocations and issues
+TEST(BalancedPortAllocatorTest, MatchesLinearScan) {
+  const uint16_t numPorts = 12;
+  auto portAllocator = BalancedPortAllocator(
+      std::vector<std::vector<uint16_t>>(numPorts, std::vector<uint16_t>{0}));
+  std::vector<uint16_t> weights(numPorts, 0);
+  std::vector<uint16_t> allocated;
+
+  std::mt19937 rng(2024);
+  for (int i = 0; i < 20000; i++) {
+    if (!allocated.empty() && rng() % 2) {
+      // Issue a previously allocated uop
+      size_t index = rng() % allocated.size();
+      uint16_t port = allocated[index];
+      allocated[index] = allocated.back();
+      allocated.pop_back();
+      portAllocator.issued(port);
+      weights[port]--;
+      continue;
+    }
+
+    std::vector<uint16_t> ports;
+    for (uint16_t port = 0; port < numPorts; port++) {
+      if (rng() % 3 == 0) ports.push_back(port);
+    }
+    if (ports.empty()) ports.push_back(rng() % numPorts);
+
+    uint16_t expected = ports[0];
+    for (uint16_t port : ports) {
+      if (weights[port] < weights[expected]) expected = port;
+    }
+    weights[expected]++;
+    allocated.push_back(expected);
+
+    ASSERT_EQ(portAllocator.allocate(toPortMask(ports)), expected);
+  }
+}
+
+// Tests the PortMask helpers used to represent sets of ports
+TEST(BalancedPortAllocatorTest, PortMask) {
+  const PortMask mask = toPortMask({7, 2, 40});
+  EXPECT_EQ(mask, portBit(2) | portBit(7) | portBit(40));
+  EXPECT_EQ(portCount(mask), 3);
+  EXPECT_EQ(lowestPort(mask), 2);
+  EXPECT_EQ(lowestPort(portBit(MAX_PORTS - 1)), MAX_PORTS - 1);
+
+  std::vector<uint16_t> visited;
+  forEachPort(mask, [&](uint16_t port) { visited.push_back(port); });
+  EXPECT_EQ(visited, std::vector<uint16_t>({2, 7, 40}));
+}
+
 }  // namespace pipeline
 }  // namespace simeng
@@ -0,0 +1,191 @@
+#include <unistd.h>
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "../MockInstruction.hh"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "simeng/pipeline/CommitTrace.hh"
+
+using ::testing::Return;
+
+namespace simeng {
+namespace pipeline {
+
+class PipelineCommitTraceTest : public testing::Test {
+ public:
+  PipelineCommitTraceTest()
+      : path_("/tmp/simeng-commit-trace-test." + std::to_string(getpid())) {}
+
+  ~PipelineCommitTraceTest() { std::remove(path_.c_str()); }
+
+ protected:
+  /** Configure `uop` to report the supplied operands and memory accesses. */
+  void prepare(MockInstruction& uop, uint64_t sequenceId, uint64_t address,
+               uint32_t opcode, std::vector<Register>& sources,
+               std::vector<Register>& destinations,
+               std::vector<memory::MemoryAccessTarget>& accesses) {
+    uop.setSequenceId(sequenceId);
+    uop.setInstructionId(sequenceId);
+    uop.setInstructionAddress(address);
+    ON_CALL(uop, getOpcode()).WillByDefault(Return(opcode));
+    ON_CALL(uop, getSourceRegisters())
+        .WillByDefault(Return(span<Register>(sources.data(), sources.size())));
+    ON_CALL(uop, getDestinationRegisters())
+        .WillByDefault(
+            Return(span<Register>(destinations.data(), destinations.size())));
+    ON_CALL(uop, getGeneratedAddresses())
+        .WillByDefault(Return(span<const memory::MemoryAccessTarget>(
+            accesses.data(), accesses.size())));
+  }
+
+  std::string path_;
+};
+
+// Tests that committed micro-operations are read back as they were recorded
+TEST_F(PipelineCommitTraceTest, RoundTrip) {
+  std::vector<Register> loadSources = {{0, 4}, {0, 9}};
+  std::vector<Register> loadDestinations = {{1, 60}};
+  std::vector<memory::MemoryAccessTarget> loadAccesses = {{0x8000, 8},
+                                                          {0x7ff0, 16}};
+  ::testing::NiceMock<MockInstruction> load;
+  prepare(load, 5, 0x400100, 123, loadSources, loadDestinations,
+          loadAccesses);
+  load.setFetchCycle(10);
+  load.setDecodeCycle(11);
+  load.setRenameCycle(12);
+  load.setIssueCycle(14);
+  load.setCompleteCycle(18);
+
+  // A micro-operation at a lower address, which never issued
+  std::vector<Register> none;
+  std::vector<memory::MemoryAccessTarget> noAccesses;
+  ::testing::NiceMock<MockInstruction> faulting;
+  prepare(faulting, 6, 0x4000f0, 7, none, none, noAccesses);
+  faulting.setFetchCycle(11);
+
+  {
+    CommitTraceWriter writer(path_);
+    ASSERT_TRUE(writer.isOpen());
+    writer.record(load, 20);
+    writer.record(faulting, 21);
+  }
+
+  CommitTraceReader reader(path_);
+  ASSERT_TRUE(reader.isValid());
+
+  CommitRecord record;
+  ASSERT_TRUE(reader.next(record));
+  EXPECT_EQ(record.sequenceId, 5);
+  EXPECT_EQ(record.instructionId, 5);
+  EXPECT_EQ(record.address, 0x400100);
+  EXPECT_EQ(record.opcode, 123);
+  EXPECT_EQ(record.fetchCycle, 10);
+  EXPECT_EQ(record.decodeCycle, 11);
+  EXPECT_EQ(record.renameCycle, 12);
+  EXPECT_EQ(record.issueCycle, 14);
+  EXPECT_EQ(record.completeCycle, 18);
+  EXPECT_EQ(record.commitCycle, 20);
+  EXPECT_EQ(record.sourceRegisters, loadSources);
+  EXPECT_EQ(record.destinationRegisters, loadDestinations);
+  ASSERT_EQ(record.memoryAccesses.size(), 2);
+  EXPECT_EQ(record.memoryAccesses[0].address, 0x8000);
+  EXPECT_EQ(record.memoryAccesses[0].size, 8);
+  EXPECT_EQ(record.memoryAccesses[1].address, 0x7ff0);
+  EXPECT_EQ(record.memoryAccesses[1].size, 16);
+
+  ASSERT_TRUE(reader.next(record));
+  EXPECT_EQ(record.sequenceId, 6);
+  EXPECT_EQ(record.address, 0x4000f0);
+  EXPECT_EQ(record.opcode, 7);
+  EXPECT_EQ(record.fetchCycle, 11);
+  EXPECT_EQ(record.decodeCycle, 0);
+  EXPECT_EQ(record.renameCycle, 0);
+  EXPECT_EQ(record.issueCycle, 0);
+  EXPECT_EQ(record.completeCycle, 0);
+  EXPECT_EQ(record.commitCycle, 21);
+  EXPECT_TRUE(record.sourceRegisters.empty());
+  EXPECT_TRUE(record.destinationRegisters.empty());
+  EXPECT_TRUE(record.memoryAccesses.empty());
+
+  EXPECT_FALSE(reader.next(record));
+}
+
+// Tests that records spanning many blocks are all written, in order
+TEST_F(PipelineCommitTraceTest, ManyBlocks) {
+  std::vector<Register> sources = {{0, 1}};
+  std::vector<Register> destinations = {{0, 2}};
+  std::vector<memory::MemoryAccessTarget> accesses;
+  ::testing::NiceMock<MockInstruction> uop;
+  prepare(uop, 0, 0, 1, sources, destinations, accesses);
+
+  const uint64_t count = 10000;
+  {
+    // Use tiny blocks, such that the writer must wait on the background thread
+    CommitTraceWriter writer(path_, 16);
+    for (uint64_t i = 0; i < count; i++) {
+      uop.setSequenceId(i);
+      uop.setInstructionAddress(0x1000 + 4 * i);
+      writer.record(uop, i + 1);
+    }
+  }
+
+  CommitTraceReader reader(path_);
+  ASSERT_TRUE(reader.isValid());
+  CommitRecord record;
+  uint64_t read = 0;
+  while (reader.next(record)) {
+    EXPECT_EQ(record.sequenceId, read);
+    EXPECT_EQ(record.address, 0x1000 + 4 * read);
+    EXPECT_EQ(record.commitCycle, read + 1);
+    read++;
+  }
+  EXPECT_EQ(read, count);
+}
+
+// Tests that files which don't hold a commit trace are rejected
+TEST_F(PipelineCommitTraceTest, InvalidFile) {
+  CommitTraceReader missing(path_);
+  EXPECT_FALSE(missing.isValid());
+
+  std::ofstream(path_) << "not a commit trace";
+  CommitTraceReader reader(path_);
+  EXPECT_FALSE(reader.isValid());
+  CommitRecord record;
+  EXPECT_FALSE(reader.next(record));
+}
+
+// Tests that a trace which can't be created is reported as not open, and
+// ignores records
+TEST_F(PipelineCommitTraceTest, UnopenableFile) {
+  CommitTraceWriter writer("/nonexistent-directory/trace");
+  EXPECT_FALSE(writer.isOpen());
+
+  ::testing::NiceMock<MockInstruction> uop;
+  writer.record(uop, 1);
+}
+
+// Tests that a failure to write the trace is reported
+TEST_F(PipelineCommitTraceTest, UnwritableFile) {
+  if (access("/dev/full", W_OK) != 0) GTEST_SKIP() << "/dev/full unavailable";
+
+  std::vector<Register> none;
+  std::vector<memory::MemoryAccessTarget> noAccesses;
+  ::testing::NiceMock<MockInstruction> uop;
+  prepare(uop, 0, 0, 1, none, none, noAccesses);
+
+  testing::internal::CaptureStderr();
+  {
+    // Writes to /dev/full always fail, as though the disk were full
+    CommitTraceWriter writer("/dev/full", 16);
+    ASSERT_TRUE(writer.isOpen());
+    for (uint64_t i = 0; i < 10000; i++) writer.record(uop, i + 1);
+  }
+  EXPECT_THAT(testing::internal::GetCapturedStderr(),
+              ::testing::HasSubstr("Could not write commit trace '/dev/full'"));
+}
+
+}  // namespace pipeline
+}  // namespace simeng
@@ -10,7 +10,6 @@ namespace simeng {
 namespace pipeline {
 
 using ::testing::Return;
-using ::testing::ReturnRef;
 
 class PipelineDispatchIssueUnitTest : public testing::Test {
  public:
@@ -19,7 +18,8 @@ class PipelineDispatchIssueUnitTest : public testing::Test {
         input(1, nullptr),
         output(config::SimInfo::getConfig()["Execution-Units"].num_children(),
                {1, nullptr}),
-        diUnit(input, output, regFile, portAlloc, physRegQuants),
+        diUnit(input, output, regFile, portAlloc, storeSetPredictor,
+               physRegQuants),
         uop(new MockInstruction),
         uopPtr(uop),
         uop2(new MockInstruction),
@@ -70,6 +70,8 @@ class PipelineDispatchIssueUnitTest : public testing::Test {
 
   MockPortAllocator portAlloc;
 
+  StoreSetPredictor storeSetPredictor;
+
   simeng::pipeline::DispatchIssueUnit diUnit;
 
   MockInstruction* uop;
@@ -122,10 +124,10 @@ TEST_F(PipelineDispatchIssueUnitTest, singleInstr) {
   // Set-up source & destination registers and ports for this instruction
   std::array<Register, 2> srcRegs = {r1, r2};
   std::array<Register, 1> destRegs = {r0};
-  const std::vector<uint16_t> suppPorts = {EAGA};
+  const PortMask suppPorts = portBit(EAGA);
 
   // All expected calls to instruction during tick()
-  EXPECT_CALL(*uop, getSupportedPorts()).WillOnce(ReturnRef(suppPorts));
+  EXPECT_CALL(*uop, getSupportedPorts()).WillOnce(Return(suppPorts));
   uop->setExceptionEncountered(false);
   EXPECT_CALL(*uop, getSourceRegisters())
       .WillOnce(Return(span<Register>(srcRegs)));
@@ -187,10 +189,10 @@ TEST_F(PipelineDispatchIssueUnitTest, singleInstr) {
 // Single instruction with exception
 TEST_F(PipelineDispatchIssueUnitTest, singleInstr_exception) {
   // Setup supported port instruction can use
-  const std::vector<uint16_t> suppPorts = {EAGA};
+  const PortMask suppPorts = portBit(EAGA);
 
   // All expected calls to instruction during tick()
-  EXPECT_CALL(*uop, getSupportedPorts()).WillOnce(ReturnRef(suppPorts));
+  EXPECT_CALL(*uop, getSupportedPorts()).WillOnce(Return(suppPorts));
   uop->setExceptionEncountered(true);
 
   input.getHeadSlots()[0] = uopPtr;
@@ -226,7 +228,7 @@ TEST_F(PipelineDispatchIssueUnitTest, singleInstr_exception) {
 // Single instruction that can't be issued in 1 cycle as RS is full
 TEST_F(PipelineDispatchIssueUnitTest, singleInstr_rsFull) {
   // Setup supported port instructions can use
-  const std::vector<uint16_t> suppPorts = {EAGA};
+  const PortMask suppPorts = portBit(EAGA);
 
   // Artificially fill Reservation station with index 2
   std::vector<std::shared_ptr<MockInstruction>> insns(refRsSizes[RS_EAGA]);
@@ -235,7 +237,7 @@ TEST_F(PipelineDispatchIssueUnitTest, singleInstr_rsFull) {
     insns[i] = std::make_shared<MockInstruction>();
     // All expected calls to instruction during tick()
     EXPECT_CALL(*insns[i].get(), getSupportedPorts())
-        .WillOnce(ReturnRef(suppPorts));
+        .WillOnce(Return(suppPorts));
     EXPECT_CALL(*insns[i].get(), getSourceRegisters())
         .WillOnce(Return(span<Register>()));
     EXPECT_CALL(*insns[i].get(), getDestinationRegisters())
@@ -267,7 +269,7 @@ TEST_F(PipelineDispatchIssueUnitTest, singleInstr_rsFull) {
 
   // Submit new instruction to same port
   // All expected calls to instruction during tick()
-  EXPECT_CALL(*uop, getSupportedPorts()).WillOnce(ReturnRef(suppPorts));
+  EXPECT_CALL(*uop, getSupportedPorts()).WillOnce(Return(suppPorts));
   // All expected calls to portAllocator during tick()
   EXPECT_CALL(portAlloc, allocate(suppPorts)).WillOnce(Return(EAGA));
   EXPECT_CALL(portAlloc, deallocate(EAGA));
@@ -297,11 +299,11 @@ TEST_F(PipelineDispatchIssueUnitTest, singleInstr_rsFull) {
 // Single instruction not issued in 1 cycle as port is stalled
 TEST_F(PipelineDispatchIssueUnitTest, singleInstr_portStall) {
   // Setup supported port instructions can use
-  const std::vector<uint16_t> suppPorts = {EAGA};
+  const PortMask suppPorts = portBit(EAGA);
 
   // Submit new instruction to a port
   // All expected calls to instruction during tick()
-  EXPECT_CALL(*uop, getSupportedPorts()).WillOnce(ReturnRef(suppPorts));
+  EXPECT_CALL(*uop, getSupportedPorts()).WillOnce(Return(suppPorts));
   uop->setExceptionEncountered(false);
   EXPECT_CALL(*uop, getSourceRegisters()).WillOnce(Return(span<Register>()));
   EXPECT_CALL(*uop, getDestinationRegisters())
@@ -365,10 +367,10 @@ TEST_F(PipelineDispatchIssueUnitTest, createdependency_raw) {
   std::array<Register, 1> destRegs_1 = {r0};
   std::array<Register, 1> srcRegs_2 = {r0};
   std::array<Register, 1> destRegs_2 = {r1};
-  const std::vector<uint16_t> suppPorts = {EAGA};
+  const PortMask suppPorts = portBit(EAGA);
 
   // All expected calls to instruction 1 during tick()
-  EXPECT_CALL(*uop, getSupportedPorts()).WillOnce(ReturnRef(suppPorts));
+  EXPECT_CALL(*uop, getSupportedPorts()).WillOnce(Return(suppPorts));
   uop->setExceptionEncountered(false);
   EXPECT_CALL(*uop, getSourceRegisters())
       .WillOnce(Return(span<Register>(srcRegs_1)));
@@ -388,7 +390,7 @@ TEST_F(PipelineDispatchIssueUnitTest, createdependency_raw) {
   output[EAGA].tick();
 
   // All expected calls to instruction 2 during tick()
-  EXPECT_CALL(*uop2, getSupportedPorts()).WillOnce(ReturnRef(suppPorts));
+  EXPECT_CALL(*uop2, getSupportedPorts()).WillOnce(Return(suppPorts));
   uop->setExceptionEncountered(false);
   EXPECT_CALL(*uop2, getSourceRegisters())
       .WillOnce(Return(span<Register>(srcRegs_2)));
@@ -459,10 +461,10 @@ TEST_F(PipelineDispatchIssueUnitTest, purgeFlushed) {
   std::array<Register, 1> destRegs_1 = {r0};
   std::array<Register, 1> srcRegs_2 = {r0};
   std::array<Register, 1> destRegs_2 = {r1};
-  const std::vector<uint16_t> suppPorts = {EAGA};
+  const PortMask suppPorts = portBit(EAGA);
 
   // All expected calls to instruction 1 during tick()
-  EXPECT_CALL(*uop, getSupportedPorts()).WillOnce(ReturnRef(suppPorts));
+  EXPECT_CALL(*uop, getSupportedPorts()).WillOnce(Return(suppPorts));
   uop->setExceptionEncountered(false);
   EXPECT_CALL(*uop, getSourceRegisters())
       .WillOnce(Return(span<Register>(srcRegs_1)));
@@ -479,7 +481,7 @@ TEST_F(PipelineDispatchIssueUnitTest, purgeFlushed) {
   EXPECT_EQ(input.getHeadSlots()[0], nullptr);
 
   // All expected calls to instruction 2 during tick()
-  EXPECT_CALL(*uop2, getSupportedPorts()).WillOnce(ReturnRef(suppPorts));
+  EXPECT_CALL(*uop2, getSupportedPorts()).WillOnce(Return(suppPorts));
   uop->setExceptionEncountered(false);
   EXPECT_CALL(*uop2, getSourceRegisters())
       .WillOnce(Return(span<Register>(srcRegs_2)));
@@ -559,6 +561,120 @@ TEST_F(PipelineDispatchIssueUnitTest, purgeFlushed) {
   EXPECT_EQ(diUnit.getRSStalls(), 0);
 }
 
+// A load predicted to depend on an earlier store is held until the store
+// issues
+TEST_F(PipelineDispatchIssueUnitTest, memoryDependence) {
+  // Create a dispatch/issue unit with the store set predictor enabled
+  config::SimInfo::addToConfig(
+      "{Memory-Dependence-Predictor: {Type: Store-Set}}");
+  StoreSetPredictor predictor;
+  DispatchIssueUnit unit(input, output, regFile, portAlloc, predictor,
+                         physRegQuants);
+  const PortMask suppPorts = portBit(EAGA);
+
+  // Set `uop` as a store and `uop2` as a later load previously found to
+  // violate it
+  uop->setInstructionAddress(0x100);
+  uop->setSequenceId(0);
+  uop2->setInstructionAddress(0x200);
+  uop2->setSequenceId(1);
+  predictor.train(0x100, 0x200);
+
+  EXPECT_CALL(*uop, getSupportedPorts()).WillOnce(Return(suppPorts));
+  EXPECT_CALL(*uop, getSourceRegisters()).WillOnce(Return(span<Register>()));
+  EXPECT_CALL(*uop, getDestinationRegisters())
+      .WillOnce(Return(span<Register>()));
+  EXPECT_CALL(*uop, isLoad()).WillRepeatedly(Return(false));
+  EXPECT_CALL(*uop, isStoreAddress()).WillRepeatedly(Return(true));
+  EXPECT_CALL(*uop2, getSupportedPorts()).WillOnce(Return(suppPorts));
+  EXPECT_CALL(*uop2, getSourceRegisters()).WillOnce(Return(span<Register>()));
+  EXPECT_CALL(*uop2, getDestinationRegisters())
+      .WillOnce(Return(span<Register>()));
+  EXPECT_CALL(*uop2, isLoad()).WillRepeatedly(Return(true));
+  EXPECT_CALL(*uop2, isStoreAddress()).WillRepeatedly(Return(false));
+  EXPECT_CALL(*uop2, canExecute()).WillRepeatedly(Return(true));
+  EXPECT_CALL(portAlloc, allocate(suppPorts)).WillRepeatedly(Return(EAGA));
+
+  // Dispatch the store, then the load
+  input.getHeadSlots()[0] = uopPtr;
+  unit.tick();
+  input.getHeadSlots()[0] = uop2Ptr;
+  unit.tick();
+  EXPECT_EQ(unit.getLoadsDelayed(), 1);
+
+  // Only the store issues, with the load released in its wake
+  EXPECT_CALL(portAlloc, issued(EAGA)).Times(2);
+  unit.issue();
+  EXPECT_EQ(output[EAGA].getTailSlots()[0].get(), uop);
+  std::vector<uint32_t> rsSizes;
+  unit.getRSSizes(rsSizes);
+  EXPECT_EQ(rsSizes[RS_EAGA], refRsSizes[RS_EAGA] - 1);
+
+  // The load issues on the following cycle
+  output[EAGA].getTailSlots()[0] = nullptr;
+  unit.issue();
+  EXPECT_EQ(output[EAGA].getTailSlots()[0].get(), uop2);
+
+  // The load being forwarded the store's data counts as an avoided violation
+  unit.loadStarted(uop2Ptr, true);
+  EXPECT_EQ(unit.getViolationsAvoided(), 1);
+  unit.loadStarted(uop2Ptr, true);
+  EXPECT_EQ(unit.getViolationsAvoided(), 1);
+}
+
+// A flushed load held on a predicted memory dependence is removed from the RS
+TEST_F(PipelineDispatchIssueUnitTest, purgeFlushedMemoryDependence) {
+  config::SimInfo::addToConfig(
+      "{Memory-Dependence-Predictor: {Type: Store-Set}}");
+  StoreSetPredictor predictor;
+  DispatchIssueUnit unit(input, output, regFile, portAlloc, predictor,
+                         physRegQuants);
+  const PortMask suppPorts = portBit(EAGA);
+
+  uop->setInstructionAddress(0x100);
+  uop->setSequenceId(0);
+  uop2->setInstructionAddress(0x200);
+  uop2->setSequenceId(1);
+  predictor.train(0x100, 0x200);
+
+  EXPECT_CALL(*uop, getSupportedPorts()).WillOnce(Return(suppPorts));
+  EXPECT_CALL(*uop, getSourceRegisters()).WillOnce(Return(span<Register>()));
+  EXPECT_CALL(*uop, getDestinationRegisters())
+      .WillOnce(Return(span<Register>()));
+  EXPECT_CALL(*uop, isLoad()).WillRepeatedly(Return(false));
+  EXPECT_CALL(*uop, isStoreAddress()).WillRepeatedly(Return(true));
+  EXPECT_CALL(*uop2, getSupportedPorts()).WillOnce(Return(suppPorts));
+  EXPECT_CALL(*uop2, getSourceRegisters()).WillOnce(Return(span<Register>()));
+  EXPECT_CALL(*uop2, getDestinationRegisters())
+      .WillOnce(Return(span<Register>()));
+  EXPECT_CALL(*uop2, isLoad()).WillRepeatedly(Return(true));
+  EXPECT_CALL(*uop2, isStoreAddress()).WillRepeatedly(Return(false));
+  EXPECT_CALL(portAlloc, allocate(suppPorts)).WillRepeatedly(Return(EAGA));
+
+  input.getHeadSlots()[0] = uopPtr;
+  unit.tick();
+  input.getHeadSlots()[0] = uop2Ptr;
+  unit.tick();
+  EXPECT_EQ(unit.getLoadsDelayed(), 1);
+
+  // Flush both instructions
+  EXPECT_CALL(portAlloc, deallocate(EAGA)).Times(2);
+  uopPtr->setFlushed();
+  uop2Ptr->setFlushed();
+  unit.purgeFlushed();
+
+  std::vector<uint32_t> rsSizes;
+  unit.getRSSizes(rsSizes);
+  EXPECT_EQ(rsSizes, refRsSizes);
+
+  // Nothing remains to be issued
+  unit.issue();
+  for (size_t i = 0; i < output.size(); i++) {
+    EXPECT_EQ(output[i].getTailSlots()[0], nullptr);
+  }
+  EXPECT_EQ(unit.getFrontendStalls(), 1);
+}
+
 // Test based on a64fx config file reservation staion configuration
 TEST_F(PipelineDispatchIssueUnitTest, getRSSizes) {
   std::vector<uint32_t> rsSizes;
@@ -25,7 +25,6 @@ class PipelineExecuteUnitTest : public testing::Test {
  public:
   PipelineExecuteUnitTest()
       : input(1, nullptr),
-        output(1, nullptr),
         executeUnit(
             input, output,
             [this](auto regs, auto values) {
@@ -44,8 +43,22 @@ class PipelineExecuteUnitTest : public testing::Test {
         thirdUopPtr(thirdUop) {}
 
  protected:
+  /** Tick the execute unit, first retiring the uops it completed the previous
+   * cycle from its output, as writeback would, and ticking the output. */
+  void tickUnit() {
+    output.clearDueEvents();
+    output.tick();
+    executeUnit.tick();
+  }
+
+  /** Retrieve the uop scheduled for writeback by the latest tick, if any. */
+  std::shared_ptr<Instruction> completed() const {
+    const auto& events = output.getEvents(1);
+    return events.empty() ? nullptr : events.back();
+  }
+
   PipelineBuffer<std::shared_ptr<Instruction>> input;
-  PipelineBuffer<std::shared_ptr<Instruction>> output;
+  TimingWheel<std::shared_ptr<Instruction>> output;
   MockBranchPredictor predictor;
   MockExecutionHandlers executionHandlers;
 
@@ -63,10 +76,10 @@ class PipelineExecuteUnitTest : public testing::Test {
 // Tests that the execution unit processes nothing if no instruction is present
 TEST_F(PipelineExecuteUnitTest, TickEmpty) {
   EXPECT_TRUE(executeUnit.isEmpty());
-  executeUnit.tick();
+  tickUnit();
 
   EXPECT_TRUE(executeUnit.isEmpty());
-  EXPECT_EQ(output.getTailSlots()[0], nullptr);
+  EXPECT_EQ(completed(), nullptr);
 }
 
 // Tests that a flushed instruction is removed from the input buffer and not
@@ -78,10 +91,10 @@ TEST_F(PipelineExecuteUnitTest, flushedInputInsn) {
   uopPtr->setFlushed();
   ON_CALL(*uop, canExecute()).WillByDefault(Return(true));
 
-  executeUnit.tick();
+  tickUnit();
 
   EXPECT_EQ(input.getHeadSlots()[0], nullptr);
-  EXPECT_EQ(output.getTailSlots()[0], nullptr);
+  EXPECT_EQ(completed(), nullptr);
   EXPECT_EQ(executeUnit.getCycles(), 0);
 }
 
@@ -108,9 +121,9 @@ TEST_F(PipelineExecuteUnitTest, Execute) {
                       ElementsAre(Property(&RegisterValue::get<uint32_t>, 1))))
       .Times(1);
 
-  executeUnit.tick();
+  tickUnit();
 
-  EXPECT_EQ(output.getTailSlots()[0].get(), uop);
+  EXPECT_EQ(completed().get(), uop);
 }
 
 TEST_F(PipelineExecuteUnitTest, ExecuteBranch) {
@@ -145,13 +158,13 @@ TEST_F(PipelineExecuteUnitTest, ExecuteBranch) {
   EXPECT_CALL(executionHandlers, forwardOperands(IsEmpty(), IsEmpty()))
       .Times(1);
 
-  executeUnit.tick();
+  tickUnit();
 
   EXPECT_EQ(uopPtr->wasBranchMispredicted(), false);
   EXPECT_EQ(uopPtr->wasBranchTaken(), taken);
 
   EXPECT_EQ(executeUnit.shouldFlush(), false);
-  EXPECT_EQ(output.getTailSlots()[0].get(), uop);
+  EXPECT_EQ(completed().get(), uop);
   EXPECT_EQ(executeUnit.getBranchExecutedCount(), 1);
   EXPECT_EQ(executeUnit.getBranchMispredictedCount(), 0);
 }
@@ -170,7 +183,7 @@ TEST_F(PipelineExecuteUnitTest, ExceptionDoesNotExecute) {
               raiseException(Property(&std::shared_ptr<Instruction>::get, uop)))
       .Times(1);
 
-  executeUnit.tick();
+  tickUnit();
 }
 
 // Test that an exception-generating execution will raise an exception
@@ -187,7 +200,7 @@ TEST_F(PipelineExecuteUnitTest, ExecutionException) {
               raiseException(Property(&std::shared_ptr<Instruction>::get, uop)))
       .Times(1);
 
-  executeUnit.tick();
+  tickUnit();
 }
 
 // Test that pipeline stalling functions correctly by stalling the unit during
@@ -202,22 +215,22 @@ TEST_F(PipelineExecuteUnitTest, PipelineStall) {
   EXPECT_CALL(*uop, execute()).Times(1);
   EXPECT_CALL(*secondUop, execute()).Times(0);
 
-  executeUnit.tick();
+  tickUnit();
   EXPECT_EQ(input.getHeadSlots()[0], nullptr);
-  EXPECT_EQ(output.getTailSlots()[0], nullptr);
+  EXPECT_EQ(completed(), nullptr);
   input.getHeadSlots()[0] = secondUopPtr;
-  executeUnit.tick();
+  tickUnit();
   EXPECT_EQ(input.getHeadSlots()[0].get(), secondUop);
-  EXPECT_EQ(output.getTailSlots()[0], nullptr);
-  executeUnit.tick();
+  EXPECT_EQ(completed(), nullptr);
+  tickUnit();
   EXPECT_EQ(input.getHeadSlots()[0].get(), secondUop);
-  EXPECT_EQ(output.getTailSlots()[0], nullptr);
-  executeUnit.tick();
+  EXPECT_EQ(completed(), nullptr);
+  tickUnit();
   EXPECT_EQ(input.getHeadSlots()[0].get(), secondUop);
-  EXPECT_EQ(output.getTailSlots()[0], nullptr);
-  executeUnit.tick();
+  EXPECT_EQ(completed(), nullptr);
+  tickUnit();
   EXPECT_EQ(input.getHeadSlots()[0], nullptr);
-  EXPECT_EQ(output.getTailSlots()[0].get(), uop);
+  EXPECT_EQ(completed().get(), uop);
 }
 
 // Test that operation stalling functions correctly by stalling similar
@@ -238,29 +251,29 @@ TEST_F(PipelineExecuteUnitTest, OperationStall) {
   EXPECT_CALL(*secondUop, execute()).Times(1);
   EXPECT_CALL(*thirdUop, execute()).Times(1);
 
-  executeUnit.tick();
+  tickUnit();
   EXPECT_EQ(input.getHeadSlots()[0], nullptr);
-  EXPECT_EQ(output.getTailSlots()[0], nullptr);
+  EXPECT_EQ(completed(), nullptr);
   input.getHeadSlots()[0] = secondUopPtr;
-  executeUnit.tick();
+  tickUnit();
   EXPECT_EQ(input.getHeadSlots()[0], nullptr);
-  EXPECT_EQ(output.getTailSlots()[0], nullptr);
+  EXPECT_EQ(completed(), nullptr);
   input.getHeadSlots()[0] = thirdUopPtr;
-  executeUnit.tick();
+  tickUnit();
   EXPECT_EQ(input.getHeadSlots()[0], nullptr);
-  EXPECT_EQ(output.getTailSlots()[0], nullptr);
-  executeUnit.tick();
+  EXPECT_EQ(completed(), nullptr);
+  tickUnit();
   EXPECT_EQ(input.getHeadSlots()[0], nullptr);
-  EXPECT_EQ(output.getTailSlots()[0], nullptr);
-  executeUnit.tick();
+  EXPECT_EQ(completed(), nullptr);
+  tickUnit();
   EXPECT_EQ(input.getHeadSlots()[0], nullptr);
-  EXPECT_EQ(output.getTailSlots()[0].get(), uop);
-  executeUnit.tick();
+  EXPECT_EQ(completed().get(), uop);
+  tickUnit();
   EXPECT_EQ(input.getHeadSlots()[0], nullptr);
-  EXPECT_EQ(output.getTailSlots()[0].get(), thirdUop);
-  executeUnit.tick();
+  EXPECT_EQ(completed().get(), thirdUop);
+  tickUnit();
   EXPECT_EQ(input.getHeadSlots()[0], nullptr);
-  EXPECT_EQ(output.getTailSlots()[0].get(), secondUop);
+  EXPECT_EQ(completed().get(), secondUop);
 }
 
 // Test that a mispredicted branch instruction is properly handled
@@ -299,13 +312,13 @@ TEST_F(PipelineExecuteUnitTest, mispredictedBranch) {
   EXPECT_CALL(executionHandlers, forwardOperands(IsEmpty(), IsEmpty()))
       .Times(1);
 
-  executeUnit.tick();
+  tickUnit();
 
   EXPECT_EQ(uopPtr->wasBranchMispredicted(), true);
   EXPECT_EQ(uopPtr->wasBranchTaken(), taken);
 
   EXPECT_EQ(executeUnit.shouldFlush(), true);
-  EXPECT_EQ(output.getTailSlots()[0].get(), uop);
+  EXPECT_EQ(completed().get(), uop);
   EXPECT_EQ(executeUnit.getBranchExecutedCount(), 1);
   EXPECT_EQ(executeUnit.getBranchMispredictedCount(), 1);
   EXPECT_EQ(executeUnit.getFlushAddress(), pc);
@@ -331,17 +344,17 @@ TEST_F(PipelineExecuteUnitTest, purgeFlushed) {
   EXPECT_CALL(*thirdUop, execute()).Times(1);
 
   // Stage all three instructions in EU pipeline
-  executeUnit.tick();
+  tickUnit();
   EXPECT_EQ(input.getHeadSlots()[0], nullptr);
-  EXPECT_EQ(output.getTailSlots()[0], nullptr);
+  EXPECT_EQ(completed(), nullptr);
   input.getHeadSlots()[0] = secondUopPtr;
-  executeUnit.tick();
+  tickUnit();
   EXPECT_EQ(input.getHeadSlots()[0], nullptr);
-  EXPECT_EQ(output.getTailSlots()[0], nullptr);
+  EXPECT_EQ(completed(), nullptr);
   input.getHeadSlots()[0] = thirdUopPtr;
-  executeUnit.tick();
+  tickUnit();
   EXPECT_EQ(input.getHeadSlots()[0], nullptr);
-  EXPECT_EQ(output.getTailSlots()[0], nullptr);
+  EXPECT_EQ(completed(), nullptr);
 
   // Flush first two instructions
   uopPtr->setFlushed();
@@ -349,9 +362,9 @@ TEST_F(PipelineExecuteUnitTest, purgeFlushed) {
   executeUnit.purgeFlushed();
 
   // Ensure non-flushed instruction progresses through the pipeline
-  executeUnit.tick();
+  tickUnit();
   EXPECT_EQ(input.getHeadSlots()[0], nullptr);
-  EXPECT_EQ(output.getTailSlots()[0].get(), thirdUop);
+  EXPECT_EQ(completed().get(), thirdUop);
   EXPECT_TRUE(executeUnit.isEmpty());
 }
 
@@ -17,6 +17,7 @@ using ::testing::AtLeast;
 using ::testing::DoAll;
 using ::testing::Field;
 using ::testing::Gt;
+using ::testing::Invoke;
 using ::testing::Lt;
 using ::testing::Ne;
 using ::testing::Return;
@@ -25,6 +26,16 @@ using ::testing::SetArgReferee;
 namespace simeng {
 namespace pipeline {
 
+/** Whether assertions are compiled in, in which case the fetch unit's
+ * assertions make additional calls to the architecture. This follows NDEBUG
+ * rather than the build type, as NDEBUG is also defined by builds other than
+ * "Release". */
+#ifdef NDEBUG
+const bool assertionsEnabled = false;
+#else
+const bool assertionsEnabled = true;
+#endif
+
 class PipelineFetchUnitTest
     : public testing::TestWithParam<std::pair<uint8_t, uint8_t>> {
  public:
@@ -323,6 +334,11 @@ TEST_P(PipelineFetchUnitTest, supplyFromLoopBuffer) {
       .WillByDefault(DoAll(SetArgReferee<3>(mOp), Return(4)));
   ON_CALL(*uop, isBranch()).WillByDefault(Return(false));
 
+  // The Loop Buffer records and supplies clones of the predecoded
+  // instructions; supply the originals to allow the output to be identified
+  ON_CALL(*uop, clone()).WillByDefault(Invoke([this]() { return uopPtr; }));
+  ON_CALL(*uop2, clone()).WillByDefault(Invoke([this]() { return uopPtr2; }));
+
   // Set the expectation from the predictor to be true so a loop body will
   // be detected
   ON_CALL(predictor, predict(_, _, _))
@@ -351,7 +367,8 @@ TEST_P(PipelineFetchUnitTest, supplyFromLoopBuffer) {
   fetchUnit.requestFromPC();
 
   // Empty output buffer and ensure the correct instructions are supplied from
-  // the Loop Buffer
+  // the Loop Buffer, without being predecoded again
+  EXPECT_CALL(isa, predecode(_, _, _, _)).Times(0);
   output.fill({});
   fetchUnit.tick();
   EXPECT_EQ(output.getTailSlots()[0], mOp);
@@ -364,11 +381,14 @@ TEST_P(PipelineFetchUnitTest, supplyFromLoopBuffer) {
   output.fill({});
   fetchUnit.tick();
   EXPECT_EQ(output.getTailSlots()[0], mOp2);
+  EXPECT_EQ(fetchUnit.getLoopBufferSupplies(), 4);
+  EXPECT_EQ(fetchUnit.getMacroOpsFetched(), 12);
 
   // Flush the Loop Buffer and ensure correct instructions are fetched from
   // memory
   fetchUnit.flushLoopBuffer();
   fetchUnit.updatePC(0x0);
+  EXPECT_CALL(isa, predecode(_, _, _, _)).Times(AtLeast(1));
   EXPECT_CALL(memory, requestRead(_, _)).Times(AtLeast(1));
   EXPECT_CALL(isa, getMaxInstructionSize()).Times(AtLeast(1));
   EXPECT_CALL(memory, getCompletedReads()).Times(AtLeast(1));
@@ -543,7 +563,7 @@ TEST_P(PipelineFetchUnitTest, invalidMinBytesAtEndOfBuffer) {
         .WillByDefault(Return(0));
 
     // getMaxInstructionSize called for second time in assertion
-    if (strcmp(SIMENG_BUILD_TYPE, "Release") == 0) {
+    if (!assertionsEnabled) {
       EXPECT_CALL(isa, getMaxInstructionSize()).Times(1);
     } else {
       EXPECT_CALL(isa, getMaxInstructionSize()).Times(2);
@@ -685,7 +705,7 @@ TEST_P(PipelineFetchUnitTest, invalidMinBytesreadsDontComplete) {
         .WillByDefault(Return(0));
 
     // getMaxInstructionSize called for second time in assertion
-    if (strcmp(SIMENG_BUILD_TYPE, "Release") == 0) {
+    if (!assertionsEnabled) {
       EXPECT_CALL(isa, getMaxInstructionSize()).Times(1);
     } else {
       EXPECT_CALL(isa, getMaxInstructionSize()).Times(2);
@@ -725,7 +745,7 @@ TEST_P(PipelineFetchUnitTest, invalidMinBytesreadsDontComplete) {
         .WillByDefault(Return(0));
 
     // getMaxInsnSize called again in assertion
-    if (strcmp(SIMENG_BUILD_TYPE, "Release") == 0) {
+    if (!assertionsEnabled) {
       EXPECT_CALL(isa, getMaxInstructionSize()).Times(1);
     } else {
       EXPECT_CALL(isa, getMaxInstructionSize()).Times(2);
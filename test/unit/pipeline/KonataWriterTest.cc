@@ -0,0 +1,191 @@
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+#include "../MockInstruction.hh"
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+#include "simeng/pipeline/KonataWriter.hh"
+
+using ::testing::Return;
+
+namespace simeng {
+namespace pipeline {
+
+class PipelineKonataWriterTest : public testing::Test {
+ public:
+  PipelineKonataWriterTest()
+      : path_("/tmp/simeng-konata-writer-test." + std::to_string(getpid())) {}
+
+  ~PipelineKonataWriterTest() { std::remove(path_.c_str()); }
+
+ protected:
+  /** Read the entire log. */
+  std::string readLog() {
+    std::ifstream file(path_);
+    std::stringstream contents;
+    contents << file.rdbuf();
+    return contents.str();
+  }
+
+  std::string path_;
+};
+
+// Tests that an empty log holds only the header
+TEST_F(PipelineKonataWriterTest, Empty) {
+  { KonataWriter writer(path_); }
+  EXPECT_EQ(readLog(), "Kanata\t0004\n");
+}
+
+// Tests that the stages of overlapping micro-operations are interleaved in
+// cycle order
+TEST_F(PipelineKonataWriterTest, Overlapping) {
+  CommitRecord first;
+  first.sequenceId = 4;
+  first.instructionId = 3;
+  first.address = 0x400100;
+  first.opcode = 12;
+  first.fetchCycle = 10;
+  first.decodeCycle = 11;
+  first.renameCycle = 12;
+  first.issueCycle = 14;
+  first.completeCycle = 15;
+  first.commitCycle = 16;
+  first.sourceRegisters = {{0, 4}};
+  first.destinationRegisters = {{1, 60}};
+  first.memoryAccesses = {{0x8000, 8}};
+
+  // A micro-operation which raised an exception, so never issued
+  CommitRecord second;
+  second.sequenceId = 5;
+  second.instructionId = 4;
+  second.address = 0x400104;
+  second.opcode = 7;
+  second.fetchCycle = 11;
+  second.decodeCycle = 12;
+  second.renameCycle = 13;
+  second.commitCycle = 16;
+
+  {
+    KonataWriter writer(path_);
+    ASSERT_TRUE(writer.isOpen());
+    writer.record(first);
+    writer.record(second);
+  }
+
+  EXPECT_EQ(readLog(),
+            "Kanata\t0004\n"
+            "C=\t10\n"
+            "I\t0\t4\t0\n"
+            "L\t0\t0\t0x400100: opcode 12\n"
+            "L\t0\t1\tSequence ID: 4, Instruction ID: 3, Sources: 0:4, "
+            "Destinations: 1:60, Memory: 0x8000(8)\n"
+            "S\t0\t0\tF\n"
+            "C\t1\n"
+            "E\t0\t0\tF\n"
+            "S\t0\t0\tDc\n"
+            "I\t1\t5\t0\n"
+            "L\t1\t0\t0x400104: opcode 7\n"
+            "L\t1\t1\tSequence ID: 5, Instruction ID: 4, Sources:, "
+            "Destinations:, Memory:\n"
+            "S\t1\t0\tF\n"
+            "C\t1\n"
+            "E\t0\t0\tDc\n"
+            "S\t0\t0\tRn\n"
+            "E\t1\t0\tF\n"
+            "S\t1\t0\tDc\n"
+            "C\t1\n"
+            "E\t1\t0\tDc\n"
+            "S\t1\t0\tRn\n"
+            "C\t1\n"
+            "E\t0\t0\tRn\n"
+            "S\t0\t0\tIs\n"
+            "C\t1\n"
+            "E\t0\t0\tIs\n"
+            "S\t0\t0\tCm\n"
+            "C\t1\n"
+            "E\t0\t0\tCm\n"
+            "R\t0\t0\t0\n"
+            "E\t1\t0\tRn\n"
+            "R\t1\t1\t0\n");
+}
+
+// Tests that a committed micro-operation is recorded with its stage cycles
+TEST_F(PipelineKonataWriterTest, Instruction) {
+  std::vector<Register> sources = {{0, 1}, {0, 2}};
+  ::testing::NiceMock<MockInstruction> uop;
+  uop.setSequenceId(9);
+  uop.setInstructionId(9);
+  uop.setInstructionAddress(0x40);
+  uop.setFetchCycle(3);
+  uop.setIssueCycle(5);
+  ON_CALL(uop, getOpcode()).WillByDefault(Return(1));
+  ON_CALL(uop, getDisassembly()).WillByDefault(Return("add x0, x1, x2"));
+  ON_CALL(uop, getSourceRegisters())
+      .WillByDefault(Return(span<Register>(sources.data(), sources.size())));
+  ON_CALL(uop, getDestinationRegisters())
+      .WillByDefault(Return(span<Register>()));
+  ON_CALL(uop, getGeneratedAddresses())
+      .WillByDefault(Return(span<const memory::MemoryAccessTarget>()));
+
+  {
+    KonataWriter writer(path_);
+    writer.record(uop, 6);
+  }
+
+  EXPECT_EQ(readLog(),
+            "Kanata\t0004\n"
+            "C=\t3\n"
+            "I\t0\t9\t0\n"
+            "L\t0\t0\t0x40: add x0, x1, x2\n"
+            "L\t0\t1\tSequence ID: 9, Instruction ID: 9, Sources: 0:1 0:2, "
+            "Destinations:, Memory:\n"
+            "S\t0\t0\tF\n"
+            "C\t2\n"
+            "E\t0\t0\tF\n"
+            "S\t0\t0\tIs\n"
+            "C\t1\n"
+            "E\t0\t0\tIs\n"
+            "R\t0\t0\t0\n");
+}
+
+// Tests that writing events as soon as no later record can precede them
+// produces the same log as holding every record until the writer is closed
+TEST_F(PipelineKonataWriterTest, Incremental) {
+  // Overlapping micro-operations, two fetched per cycle, some of which skip
+  // stages, and the last of which commit in the same cycle
+  std::vector<CommitRecord> records(40);
+  uint64_t commitCycle = 0;
+  for (uint64_t i = 0; i < records.size(); i++) {
+    CommitRecord& record = records[i];
+    record.sequenceId = i;
+    record.instructionId = i / 2;
+    record.address = 0x1000 + 4 * i;
+    record.fetchCycle = 1 + i / 2;
+    record.decodeCycle = record.fetchCycle + 1;
+    record.renameCycle = record.fetchCycle + 2 + i % 3;
+    record.issueCycle = i % 5 == 0 ? 0 : record.renameCycle + i % 4;
+    record.completeCycle = record.issueCycle == 0 ? 0 : record.issueCycle + 2;
+    commitCycle = std::max(commitCycle, record.renameCycle + 10);
+    record.commitCycle = std::min<uint64_t>(commitCycle, 25);
+  }
+
+  {
+    KonataWriter writer(path_);
+    for (const auto& record : records) writer.record(record);
+  }
+  std::string held = readLog();
+
+  {
+    KonataWriter writer(path_, 1);
+    for (const auto& record : records) writer.record(record);
+  }
+  EXPECT_EQ(readLog(), held);
+}
+
+}  // namespace pipeline
+}  // namespace simeng
@@ -7,6 +7,7 @@
 
 using ::testing::_;
 using ::testing::AtLeast;
+using ::testing::Ne;
 using ::testing::Property;
 using ::testing::Return;
 
@@ -30,8 +31,7 @@ class MockForwardOperandsHandler {
 class LoadStoreQueueTest : public ::testing::TestWithParam<bool> {
  public:
   LoadStoreQueueTest()
-      : completionSlots({{1, nullptr}}),
-        addresses({{0, 1}}),
+      : addresses({{0, 1}}),
         addressesSpan({addresses.data(), addresses.size()}),
         data({RegisterValue(static_cast<uint8_t>(1))}),
         dataSpan({data.data(), data.size()}),
@@ -65,27 +65,30 @@ class LoadStoreQueueTest : public ::testing::TestWithParam<bool> {
                           uint16_t storeBandwidth = UINT16_MAX,
                           uint16_t permittedRequests = UINT16_MAX,
                           uint16_t permittedLoads = UINT16_MAX,
-                          uint16_t permittedStores = UINT16_MAX) {
+                          uint16_t permittedStores = UINT16_MAX,
+                          bool exemptForwardedLoads = false) {
     if (GetParam()) {
       // Combined queue
       return LoadStoreQueue(
           MAX_COMBINED, dataMemory,
-          {completionSlots.data(), completionSlots.size()},
+          completions, 1,
           [this](auto registers, auto values) {
             forwardOperandsHandler.forwardOperands(registers, values);
           },
           [](auto uop) {}, exclusive, loadBandwidth, storeBandwidth,
-          permittedRequests, permittedLoads, permittedStores);
+          permittedRequests, permittedLoads, permittedStores,
+          exemptForwardedLoads);
     } else {
       // Split queue
       return LoadStoreQueue(
           MAX_LOADS, MAX_STORES, dataMemory,
-          {completionSlots.data(), completionSlots.size()},
+          completions, 1,
           [this](auto registers, auto values) {
             forwardOperandsHandler.forwardOperands(registers, values);
           },
           [](auto uop) {}, exclusive, loadBandwidth, storeBandwidth,
-          permittedRequests, permittedLoads, permittedStores);
+          permittedRequests, permittedLoads, permittedStores,
+          exemptForwardedLoads);
     }
   }
 
@@ -120,8 +123,7 @@ class LoadStoreQueueTest : public ::testing::TestWithParam<bool> {
     return queue.commitStore(storeUopPtr);
   }
 
-  std::vector<pipeline::PipelineBuffer<std::shared_ptr<Instruction>>>
-      completionSlots;
+  pipeline::TimingWheel<std::shared_ptr<Instruction>> completions;
 
   std::vector<memory::MemoryAccessTarget> addresses;
   span<const memory::MemoryAccessTarget> addressesSpan;
@@ -151,7 +153,7 @@ class LoadStoreQueueTest : public ::testing::TestWithParam<bool> {
 // Test that a split queue can be constructed correctly
 TEST_F(LoadStoreQueueTest, SplitQueue) {
   LoadStoreQueue queue = LoadStoreQueue(
-      MAX_LOADS, MAX_STORES, dataMemory, {nullptr, 0},
+      MAX_LOADS, MAX_STORES, dataMemory, completions, 0,
       [](auto registers, auto values) {}, [](auto uop) {});
 
   EXPECT_EQ(queue.isCombined(), false);
@@ -163,7 +165,7 @@ TEST_F(LoadStoreQueueTest, SplitQueue) {
 // Test that a combined queue can be constructed correctly
 TEST_F(LoadStoreQueueTest, CombinedQueue) {
   LoadStoreQueue queue = LoadStoreQueue(
-      MAX_COMBINED, dataMemory, {nullptr, 0},
+      MAX_COMBINED, dataMemory, completions, 0,
       [](auto registers, auto values) {}, [](auto uop) {});
 
   EXPECT_EQ(queue.isCombined(), true);
@@ -260,7 +262,7 @@ TEST_P(LoadStoreQueueTest, PurgeFlushedLoad) {
       .WillRepeatedly(Return(completedReads));
   queue.tick();
 
-  EXPECT_EQ(completionSlots[0].getTailSlots()[0], nullptr);
+  EXPECT_TRUE(completions.empty());
   EXPECT_EQ(queue.getLoadQueueSpace(), initialLoadSpace);
 }
 
@@ -316,7 +318,36 @@ TEST_P(LoadStoreQueueTest, Load) {
   // Tick the queue to complete the load
   queue.tick();
 
-  EXPECT_EQ(completionSlots[0].getTailSlots()[0].get(), loadUop);
+  EXPECT_EQ(completions.getEvents(1).back().get(), loadUop);
+}
+
+// Tests that a queue reports queued work until a load's request is sent, and
+// again once its data is received
+TEST_P(LoadStoreQueueTest, QueuedWork) {
+  loadUop->setSequenceId(1);
+  auto queue = getQueue();
+  EXPECT_FALSE(queue.hasQueuedWork());
+
+  memory::MemoryReadResult completedRead = {addresses[0], data[0], 1};
+  span<memory::MemoryReadResult> completedReads = {&completedRead, 1};
+
+  EXPECT_CALL(*loadUop, getGeneratedAddresses())
+      .Times(AtLeast(1))
+      .WillRepeatedly(Return(addressesSpan));
+  loadUop->setLSQLatency(1);
+
+  queue.addLoad(loadUopPtr);
+  queue.startLoad(loadUopPtr);
+  EXPECT_TRUE(queue.hasQueuedWork());
+
+  // Once the request is sent, the queue waits on memory
+  EXPECT_CALL(dataMemory, requestRead(addresses[0], _)).Times(1);
+  queue.tick();
+  EXPECT_FALSE(queue.hasQueuedWork());
+
+  EXPECT_CALL(dataMemory, getCompletedReads())
+      .WillRepeatedly(Return(completedReads));
+  EXPECT_TRUE(queue.hasQueuedWork());
 }
 
 // Tests that a queue can perform a load with no addresses
@@ -341,7 +372,7 @@ TEST_P(LoadStoreQueueTest, LoadWithNoAddresses) {
   // Tick the queue to complete the load
   queue.tick();
 
-  EXPECT_EQ(completionSlots[0].getTailSlots()[0].get(), loadUop);
+  EXPECT_EQ(completions.getEvents(1).back().get(), loadUop);
 }
 
 // Tests that a queue can commit a load
@@ -438,7 +469,7 @@ TEST_P(LoadStoreQueueTest, LoadStore) {
 
   // Tick the queue to complete the load portion of the load-store
   queue.tick();
-  EXPECT_EQ(completionSlots[0].getTailSlots()[0].get(), loadStoreUop);
+  EXPECT_EQ(completions.getEvents(1).back().get(), loadStoreUop);
 
   // Check that a write request is sent to the memory interface
   EXPECT_CALL(dataMemory,
@@ -901,6 +932,163 @@ TEST_P(LoadStoreQueueTest, SupplyDataToConfliction) {
   queue.commitStore(storeUopPtr);
 }
 
+// Test that a load forwarded the data of an earlier store only constitutes a
+// memory order violation when that store commits if forwarded loads aren't
+// exempt, as they are when a memory dependence predictor is in use
+TEST_P(LoadStoreQueueTest, ViolationOnForwardedLoad) {
+  for (bool exempt : {false, true}) {
+    auto queue = getQueue(false, UINT16_MAX, UINT16_MAX, UINT16_MAX,
+                          UINT16_MAX, UINT16_MAX, exempt);
+
+    storeUop->setSequenceId(0);
+    storeUop->setInstructionId(0);
+    loadUop->setSequenceId(1);
+    loadUop->setInstructionId(1);
+
+    std::vector<memory::MemoryAccessTarget> storeAddresses = {{1, 1}, {2, 1}};
+    span<const memory::MemoryAccessTarget> storeAddressesSpan = {
+        storeAddresses.data(), storeAddresses.size()};
+    std::vector<RegisterValue> storeData = {static_cast<uint8_t>(0x01),
+                                            static_cast<uint8_t>(0x10)};
+    span<const RegisterValue> storeDataSpan = {storeData.data(),
+                                               storeData.size()};
+    EXPECT_CALL(*storeUop, getGeneratedAddresses())
+        .Times(AtLeast(1))
+        .WillRepeatedly(Return(storeAddressesSpan));
+    EXPECT_CALL(*storeUop, getData())
+        .Times(AtLeast(1))
+        .WillRepeatedly(Return(storeDataSpan));
+
+    // Set load address which exactly matches the first store address
+    std::vector<memory::MemoryAccessTarget> loadAddresses = {{1, 1}};
+    span<const memory::MemoryAccessTarget> loadAddressesSpan = {
+        loadAddresses.data(), loadAddresses.size()};
+    EXPECT_CALL(*loadUop, getGeneratedAddresses())
+        .Times(AtLeast(1))
+        .WillRepeatedly(Return(loadAddressesSpan));
+
+    queue.addStore(storeUopPtr);
+    queue.addLoad(loadUopPtr);
+    queue.supplyStoreData(storeUopPtr);
+
+    // The load is started after the store's addresses are known, and so is
+    // forwarded its data
+    EXPECT_TRUE(queue.startLoad(loadUopPtr));
+    EXPECT_EQ(queue.commitStore(storeUopPtr), !exempt);
+  }
+}
+
+// Test that, with many in-flight stores scattering to the same addresses, a
+// gathering load registers its conflictions only on the youngest store earlier
+// than it in the program order
+TEST_P(LoadStoreQueueTest, ConflictOnYoungestOfManyStores) {
+  auto queue = getQueue();
+  const size_t numStores = 16;
+  const size_t numAccesses = 32;
+
+  // Each store writes its own sequence ID to the same set of addresses
+  std::vector<memory::MemoryAccessTarget> accesses;
+  for (size_t i = 0; i < numAccesses; i++) accesses.push_back({i * 64, 8});
+  span<const memory::MemoryAccessTarget> accessesSpan = {accesses.data(),
+                                                         accesses.size()};
+  std::vector<std::vector<RegisterValue>> storeData(numStores);
+  std::vector<std::shared_ptr<MockInstruction>> stores;
+  for (size_t i = 0; i < numStores; i++) {
+    storeData[i].assign(numAccesses, static_cast<uint64_t>(i));
+    stores.push_back(std::make_shared<MockInstruction>());
+    ON_CALL(*stores[i], isStoreAddress()).WillByDefault(Return(true));
+    ON_CALL(*stores[i], isStoreData()).WillByDefault(Return(true));
+    ON_CALL(*stores[i], getGeneratedAddresses())
+        .WillByDefault(Return(accessesSpan));
+    ON_CALL(*stores[i], getData())
+        .WillByDefault(Return(span<const RegisterValue>(
+            {storeData[i].data(), storeData[i].size()})));
+    // Leave a gap in the sequence IDs for the load
+    stores[i]->setSequenceId(i < numStores / 2 ? i : i + 1);
+    stores[i]->setInstructionId(stores[i]->getSequenceId());
+    queue.addStore(stores[i]);
+    queue.supplyStoreData(stores[i]);
+  }
+
+  // The load is younger than the first half of the stores
+  loadUop->setSequenceId(numStores / 2);
+  loadUop->setInstructionId(numStores / 2);
+  ON_CALL(*loadUop, getGeneratedAddresses())
+      .WillByDefault(Return(accessesSpan));
+  queue.addLoad(loadUopPtr);
+  queue.startLoad(loadUopPtr);
+
+  // Every access conflicts with a store so no reads should be requested
+  EXPECT_CALL(dataMemory, requestRead(_, _)).Times(0);
+  queue.tick();
+
+  // Only the youngest earlier store should supply data to the load
+  const uint64_t expectedStore = numStores / 2 - 1;
+  EXPECT_CALL(*loadUop, supplyData(_, Property(&RegisterValue::get<uint64_t>,
+                                               expectedStore)))
+      .Times(numAccesses);
+  EXPECT_CALL(*loadUop, supplyData(_, Property(&RegisterValue::get<uint64_t>,
+                                               Ne(expectedStore))))
+      .Times(0);
+  for (size_t i = 0; i < numStores; i++) {
+    stores[i]->setCommitReady();
+    queue.commitStore(stores[i]);
+  }
+}
+
+// Test that, with many in-flight loads gathering from overlapping regions, a
+// scattering store reports the oldest overlapping load as the violating load
+TEST_P(LoadStoreQueueTest, ViolationAmongManyLoads) {
+  auto queue = getQueue();
+  const size_t numLoads = 16;
+  const size_t numAccesses = 32;
+
+  // Each load gathers from a disjoint region, except the loads from the second
+  // half which also read a single byte the store writes to
+  std::vector<std::vector<memory::MemoryAccessTarget>> loadAccesses(numLoads);
+  std::vector<std::shared_ptr<MockInstruction>> loads;
+  for (size_t i = 0; i < numLoads; i++) {
+    for (size_t j = 0; j < numAccesses; j++) {
+      loadAccesses[i].push_back({0x10000 * (i + 1) + j * 16, 16});
+    }
+    if (i >= numLoads / 2) loadAccesses[i].push_back({0x100 + 7, 1});
+    loads.push_back(std::make_shared<MockInstruction>());
+    ON_CALL(*loads[i], isLoad()).WillByDefault(Return(true));
+    ON_CALL(*loads[i], getGeneratedAddresses())
+        .WillByDefault(Return(span<const memory::MemoryAccessTarget>(
+            {loadAccesses[i].data(), loadAccesses[i].size()})));
+    loads[i]->setSequenceId(i + 1);
+    loads[i]->setInstructionId(i + 1);
+  }
+
+  // The store scatters across a region overlapping the later loads' reads
+  std::vector<memory::MemoryAccessTarget> storeAccesses;
+  for (size_t j = 0; j < numAccesses; j++) {
+    storeAccesses.push_back({0x100 + j * 8, 8});
+  }
+  std::vector<RegisterValue> storeData(numAccesses, static_cast<uint64_t>(0));
+  ON_CALL(*storeUop, getGeneratedAddresses())
+      .WillByDefault(Return(span<const memory::MemoryAccessTarget>(
+          {storeAccesses.data(), storeAccesses.size()})));
+  ON_CALL(*storeUop, getData())
+      .WillByDefault(Return(
+          span<const RegisterValue>({storeData.data(), storeData.size()})));
+  storeUop->setSequenceId(0);
+  storeUop->setInstructionId(0);
+  queue.addStore(storeUopPtr);
+
+  // Start the loads, youngest first, before the store generates its addresses
+  for (size_t i = numLoads; i > 0; i--) {
+    queue.addLoad(loads[i - 1]);
+    queue.startLoad(loads[i - 1]);
+  }
+  queue.supplyStoreData(storeUopPtr);
+  storeUop->setCommitReady();
+
+  EXPECT_TRUE(queue.commitStore(storeUopPtr));
+  EXPECT_EQ(queue.getViolatingLoad(), loads[numLoads / 2]);
+}
+
 INSTANTIATE_TEST_SUITE_P(LoadStoreQueueTests, LoadStoreQueueTest,
                          ::testing::Values<bool>(false, true));
 
@@ -33,13 +33,13 @@ class M1PortAllocatorTest : public testing::Test {
 
 // Tests correct allocation for single port groups (i.e. INT_DIV_OR_SQRT)
 TEST_F(M1PortAllocatorTest, singlePortAllocation) {
-  std::vector<uint16_t> ports = {4};
+  PortMask ports = toPortMask({4});
   EXPECT_EQ(portAllocator.allocate(ports), 4);
 }
 
 // Tests correct allocation of multiple INT_SIMPLE instructions
 TEST_F(M1PortAllocatorTest, allocationIntSimple) {
-  std::vector<uint16_t> ports = {0, 1, 2, 3, 4, 5};
+  PortMask ports = toPortMask({0, 1, 2, 3, 4, 5});
   EXPECT_EQ(portAllocator.allocate(ports), 0);
   rsFreeEntries[0]--;
   EXPECT_EQ(portAllocator.allocate(ports), 1);
@@ -64,7 +64,7 @@ TEST_F(M1PortAllocatorTest, allocationIntSimple) {
 
 // Tests correct allocation of multiple BRANCH instructions
 TEST_F(M1PortAllocatorTest, allocationBranch) {
-  std::vector<uint16_t> ports = {0, 1};
+  PortMask ports = toPortMask({0, 1});
   EXPECT_EQ(portAllocator.allocate(ports), 0);
   rsFreeEntries[0]--;
   EXPECT_EQ(portAllocator.allocate(ports), 1);
@@ -81,7 +81,7 @@ TEST_F(M1PortAllocatorTest, allocationBranch) {
 
 // Tests correct allocation of multiple INT_MUL instructions
 TEST_F(M1PortAllocatorTest, allocationIntMul) {
-  std::vector<uint16_t> ports = {4, 5};
+  PortMask ports = toPortMask({4, 5});
   EXPECT_EQ(portAllocator.allocate(ports), 4);
   rsFreeEntries[4]--;
   EXPECT_EQ(portAllocator.allocate(ports), 5);
@@ -98,7 +98,7 @@ TEST_F(M1PortAllocatorTest, allocationIntMul) {
 
 // Tests correct allocation of multiple LOAD instructions
 TEST_F(M1PortAllocatorTest, allocationLoad) {
-  std::vector<uint16_t> ports = {7, 8, 9};
+  PortMask ports = toPortMask({7, 8, 9});
   EXPECT_EQ(portAllocator.allocate(ports), 7);
   rsFreeEntries[7]--;
   EXPECT_EQ(portAllocator.allocate(ports), 8);
@@ -117,7 +117,7 @@ TEST_F(M1PortAllocatorTest, allocationLoad) {
 
 // Tests correct allocation of multiple STORE instructions
 TEST_F(M1PortAllocatorTest, allocationStore) {
-  std::vector<uint16_t> ports = {6, 7};
+  PortMask ports = toPortMask({6, 7});
   EXPECT_EQ(portAllocator.allocate(ports), 6);
   rsFreeEntries[6]--;
   EXPECT_EQ(portAllocator.allocate(ports), 7);
@@ -134,7 +134,7 @@ TEST_F(M1PortAllocatorTest, allocationStore) {
 
 // Tests correct allocation of multiple FP / VECTOR instructions
 TEST_F(M1PortAllocatorTest, allocationFpVec) {
-  std::vector<uint16_t> ports = {10, 11, 12, 13};
+  PortMask ports = toPortMask({10, 11, 12, 13});
   EXPECT_EQ(portAllocator.allocate(ports), 10);
   rsFreeEntries[10]--;
   EXPECT_EQ(portAllocator.allocate(ports), 11);
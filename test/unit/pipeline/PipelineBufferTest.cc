@@ -1,4 +1,9 @@
+#include <chrono>
+#include <iostream>
+
+#include "../MockInstruction.hh"
 #include "gtest/gtest.h"
+#include "simeng/arch/Architecture.hh"
 #include "simeng/pipeline/PipelineBuffer.hh"
 
 namespace simeng {
@@ -62,5 +67,61 @@ TEST_P(PipelineBufferTest, Fill) {
 INSTANTIATE_TEST_SUITE_P(PipelineBufferTests, PipelineBufferTest,
                          ::testing::Range<size_t>(1, 9, 1));
 
+// Measure the cost of handing instructions between the fetch, decode, rename
+// and dispatch units of an 8-wide front end (as in the M1 Firestorm config),
+// following the access pattern of those units. Disabled by default; run with
+// `--gtest_also_run_disabled_tests --gtest_filter=*Benchmark*`
+TEST(PipelineBufferBenchmark, DISABLED_FrontEnd) {
+  const uint16_t width = 8;
+  const uint64_t cycles = 10000000;
+  PipelineBuffer<MacroOp> fetchToDecode(width, {});
+  PipelineBuffer<std::shared_ptr<Instruction>> decodeToRename(width, nullptr);
+  PipelineBuffer<std::shared_ptr<Instruction>> renameToDispatch(width,
+                                                                nullptr);
+  auto insn = std::make_shared<MockInstruction>();
+  uint64_t dispatched = 0;
+
+  auto start = std::chrono::steady_clock::now();
+  for (uint64_t cycle = 0; cycle < cycles; cycle++) {
+    // Fetch: predecode a single micro-op into each macro-op slot
+    for (size_t slot = 0; slot < width; slot++) {
+      auto& macroOp = fetchToDecode.getTailSlots()[slot];
+      macroOp.resize(1);
+      macroOp[0] = insn;
+    }
+    // Decode: move each micro-op out of its macro-op
+    for (size_t slot = 0; slot < width; slot++) {
+      auto& macroOp = fetchToDecode.getHeadSlots()[slot];
+      if (macroOp.size() == 0) continue;
+      decodeToRename.getTailSlots()[slot] = std::move(macroOp[0]);
+      macroOp.clear();
+    }
+    // Rename: move each instruction on to dispatch
+    for (size_t slot = 0; slot < width; slot++) {
+      auto& uop = decodeToRename.getHeadSlots()[slot];
+      if (uop == nullptr) continue;
+      renameToDispatch.getTailSlots()[slot] = std::move(uop);
+    }
+    // Dispatch: consume each instruction
+    for (size_t slot = 0; slot < width; slot++) {
+      auto& uop = renameToDispatch.getHeadSlots()[slot];
+      if (uop == nullptr) continue;
+      dispatched++;
+      uop = nullptr;
+    }
+
+    fetchToDecode.tick();
+    decodeToRename.tick();
+    renameToDispatch.tick();
+  }
+  std::chrono::duration<double, std::nano> elapsed =
+      std::chrono::steady_clock::now() - start;
+
+  EXPECT_EQ(dispatched, (cycles - 3) * width);
+  std::cout << "[SimEng:PipelineBufferBenchmark] " << width
+            << "-wide front end: " << elapsed.count() / cycles << " ns/cycle"
+            << std::endl;
+}
+
 }  // namespace pipeline
 }  // namespace simeng
@@ -97,5 +97,69 @@ TEST_F(RegisterAliasTableTest, Rewind) {
   EXPECT_EQ(rat.freeRegistersAvailable(0), initialFreeRegisters);
 }
 
+// Tests that physical registers are freed in any order and reallocated
+// lowest-numbered first
+TEST_F(RegisterAliasTableTest, FreeOrder) {
+  Register reg1 = {0, 1};
+  auto first = rat.allocate(reg);
+  auto second = rat.allocate(reg1);
+  EXPECT_EQ(first.tag, architecturalCount);
+  EXPECT_EQ(second.tag, architecturalCount + 1);
+
+  rat.rewind(second);
+  rat.rewind(first);
+  EXPECT_EQ(rat.allocate(reg1).tag, architecturalCount);
+}
+
+// Tests that restoring a checkpoint reinstates the mappings held when it was
+// taken and frees all registers allocated since, whilst keeping those
+// allocated beforehand
+TEST_F(RegisterAliasTableTest, CheckpointRestore) {
+  auto checkpointRAT =
+      RegisterAliasTable({{8, architecturalCount}}, {physicalCount}, 2);
+  Register reg1 = {0, 1};
+  auto initialFreeRegisters = checkpointRAT.freeRegistersAvailable(0);
+  auto oldMapping1 = checkpointRAT.getMapping(reg1);
+
+  auto kept = checkpointRAT.allocate(reg);
+  EXPECT_TRUE(checkpointRAT.checkpoint(0));
+  checkpointRAT.allocate(reg);
+  checkpointRAT.allocate(reg1);
+  EXPECT_TRUE(checkpointRAT.checkpoint(1));
+  checkpointRAT.allocate(reg1);
+  EXPECT_EQ(checkpointRAT.getCheckpointsInUse(), 2);
+
+  EXPECT_TRUE(checkpointRAT.restoreCheckpoint(0));
+  EXPECT_EQ(checkpointRAT.getCheckpointsInUse(), 1);
+  EXPECT_EQ(checkpointRAT.getMapping(reg), kept);
+  EXPECT_EQ(checkpointRAT.getMapping(reg1), oldMapping1);
+  EXPECT_EQ(checkpointRAT.freeRegistersAvailable(0), initialFreeRegisters - 1);
+
+  // The committed allocation frees the architectural register's old mapping
+  checkpointRAT.commit(kept);
+  EXPECT_EQ(checkpointRAT.freeRegistersAvailable(0), initialFreeRegisters);
+}
+
+// Tests that only a bounded number of checkpoints are held, that they are
+// released upon commit, and that those taken after flushed instructions are
+// discarded without being restored
+TEST_F(RegisterAliasTableTest, CheckpointCapacity) {
+  auto checkpointRAT =
+      RegisterAliasTable({{8, architecturalCount}}, {physicalCount}, 1);
+  EXPECT_TRUE(checkpointRAT.checkpoint(0));
+  EXPECT_FALSE(checkpointRAT.checkpoint(1));
+
+  checkpointRAT.releaseCheckpoints(0);
+  EXPECT_EQ(checkpointRAT.getCheckpointsInUse(), 0);
+
+  EXPECT_TRUE(checkpointRAT.checkpoint(2));
+  EXPECT_FALSE(checkpointRAT.restoreCheckpoint(1));
+  EXPECT_EQ(checkpointRAT.getCheckpointsInUse(), 0);
+
+  // A RAT without checkpoints can never restore one
+  EXPECT_FALSE(rat.checkpoint(0));
+  EXPECT_FALSE(rat.restoreCheckpoint(0));
+}
+
 }  // namespace pipeline
 }  // namespace simeng
@@ -18,11 +18,11 @@ class RenameUnitTest : public testing::Test {
         output(1, nullptr),
         rat(archRegFileStruct, physRegCounts),
         lsq(
-            lsqQueueSize, lsqQueueSize, memory, completionSlots,
+            lsqQueueSize, lsqQueueSize, memory, completions, 0,
             [](auto registers, auto values) {}, [](auto insn) {}),
         rob(
             robSize, rat, lsq, [](auto insn) {}, [](auto branchAddr) {},
-            predictor, 16, 4),
+            predictor, storeSetPredictor, 16, 4),
         renameUnit(input, output, rob, rat, lsq, physRegCounts.size()),
         uop(new MockInstruction),
         uop2(new MockInstruction),
@@ -52,7 +52,8 @@ class RenameUnitTest : public testing::Test {
 
   MockMemoryInterface memory;
   MockBranchPredictor predictor;
-  span<PipelineBuffer<std::shared_ptr<Instruction>>> completionSlots;
+  StoreSetPredictor storeSetPredictor;
+  TimingWheel<std::shared_ptr<Instruction>> completions;
 
   RegisterAliasTable rat;
   LoadStoreQueue lsq;
@@ -25,7 +25,7 @@ class ReorderBufferTest : public testing::Test {
       : memory{},
         rat({{8, 32}}, {64}),
         lsq(
-            maxLSQLoads, maxLSQStores, dataMemory, {nullptr, 0},
+            maxLSQLoads, maxLSQStores, dataMemory, completions, 0,
             [](auto registers, auto values) {}, [](auto uop) {}),
         uop(new MockInstruction),
         uop2(new MockInstruction),
@@ -37,7 +37,7 @@ class ReorderBufferTest : public testing::Test {
             maxROBSize, rat, lsq,
             [this](auto insn) { exceptionHandler.raiseException(insn); },
             [this](auto branchAddress) { loopBoundaryAddr = branchAddress; },
-            predictor, 4, 2) {}
+            predictor, storeSetPredictor, 4, 2) {}
 
  protected:
   const uint8_t maxLSQLoads = 32;
@@ -46,8 +46,10 @@ class ReorderBufferTest : public testing::Test {
 
   char memory[1024];
   RegisterAliasTable rat;
+  TimingWheel<std::shared_ptr<Instruction>> completions;
   LoadStoreQueue lsq;
   MockBranchPredictor predictor;
+  StoreSetPredictor storeSetPredictor;
 
   MockExceptionHandler exceptionHandler;
 
@@ -134,6 +136,19 @@ TEST_F(ReorderBufferTest, CommitHeadNotReady) {
   EXPECT_EQ(reorderBuffer.getInstructionsCommittedCount(), 0);
 }
 
+// Tests that only the readiness of the head instruction is reported
+TEST_F(ReorderBufferTest, HeadCommitReady) {
+  EXPECT_FALSE(reorderBuffer.isHeadCommitReady());
+
+  reorderBuffer.reserve(uopPtr);
+  reorderBuffer.reserve(uopPtr2);
+  uopPtr2->setCommitReady();
+  EXPECT_FALSE(reorderBuffer.isHeadCommitReady());
+
+  uop->setCommitReady();
+  EXPECT_TRUE(reorderBuffer.isHeadCommitReady());
+}
+
 // Tests that the reorder buffer can commit multiple ready instructions
 TEST_F(ReorderBufferTest, CommitMultiple) {
   reorderBuffer.reserve(uopPtr);
@@ -290,6 +305,75 @@ TEST_F(ReorderBufferTest, commitMicroOps) {
   EXPECT_EQ(reorderBuffer.size(), 0);
 }
 
+// Tests that the reorder buffer's slots are correctly reused once it has wrapped
+// around, including by a group of micro-ops spanning the end of the buffer
+TEST_F(ReorderBufferTest, wrapAround) {
+  auto insn = std::make_shared<MockInstruction>();
+  std::shared_ptr<Instruction> insnPtr = insn;
+  insn->setCommitReady();
+  for (int i = 0; i < maxROBSize * 2 - 1; i++) {
+    reorderBuffer.reserve(insnPtr);
+    EXPECT_EQ(reorderBuffer.commit(1), 1);
+  }
+  EXPECT_EQ(reorderBuffer.size(), 0);
+
+  // Reserve a group of micro-ops occupying the last and first slots
+  uop->setIsMicroOp(true);
+  uop->setIsLastMicroOp(false);
+  uop2->setIsMicroOp(true);
+  uop2->setIsLastMicroOp(false);
+  uop3->setIsMicroOp(true);
+  uop3->setIsLastMicroOp(true);
+  reorderBuffer.reserve(uopPtr);
+  reorderBuffer.reserve(uopPtr2);
+  reorderBuffer.reserve(uopPtr3);
+  EXPECT_EQ(reorderBuffer.size(), 3);
+  EXPECT_EQ(reorderBuffer.getFreeSpace(), maxROBSize - 3);
+
+  uop->setWaitingCommit();
+  uop2->setWaitingCommit();
+  uop3->setWaitingCommit();
+  reorderBuffer.commitMicroOps(uop->getInstructionId());
+  EXPECT_TRUE(uopPtr->canCommit());
+  EXPECT_TRUE(uopPtr2->canCommit());
+  EXPECT_TRUE(uopPtr3->canCommit());
+
+  EXPECT_EQ(reorderBuffer.commit(3), 3);
+  EXPECT_EQ(reorderBuffer.getInstructionsCommittedCount(), maxROBSize * 2);
+  EXPECT_EQ(reorderBuffer.size(), 0);
+}
+
+// Tests that instructions reserved after a flush are allocated sequence and
+// instruction IDs greater than those of the flushed instructions, and that a
+// flushed group of micro-ops can no longer be set ready to commit
+TEST_F(ReorderBufferTest, flushIds) {
+  reorderBuffer.reserve(uopPtr);
+  uop2->setIsMicroOp(true);
+  uop2->setIsLastMicroOp(false);
+  reorderBuffer.reserve(uopPtr2);
+  uint64_t flushedSeqId = uop2->getSequenceId();
+  uint64_t flushedInsnId = uop2->getInstructionId();
+
+  reorderBuffer.flush(uop->getInstructionId());
+  EXPECT_TRUE(uop2->isFlushed());
+  EXPECT_EQ(reorderBuffer.size(), 1);
+
+  uop2->setWaitingCommit();
+  uop2->setIsLastMicroOp(true);
+  reorderBuffer.commitMicroOps(flushedInsnId);
+  EXPECT_FALSE(uopPtr2->canCommit());
+
+  reorderBuffer.reserve(uopPtr3);
+  EXPECT_GT(uop3->getSequenceId(), flushedSeqId);
+  EXPECT_GT(uop3->getInstructionId(), flushedInsnId);
+  EXPECT_EQ(reorderBuffer.size(), 2);
+
+  uop->setCommitReady();
+  uop3->setCommitReady();
+  EXPECT_EQ(reorderBuffer.commit(2), 2);
+  EXPECT_EQ(reorderBuffer.size(), 0);
+}
+
 // Test that a detected violating load in the lsq leads to a flush
 TEST_F(ReorderBufferTest, violatingLoad) {
   const uint64_t strAddr = 16;
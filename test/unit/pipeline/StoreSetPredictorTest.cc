@@ -0,0 +1,148 @@
+#include "../ConfigInit.hh"
+#include "../MockInstruction.hh"
+#include "gtest/gtest.h"
+#include "simeng/pipeline/StoreSetPredictor.hh"
+
+namespace simeng {
+namespace pipeline {
+
+class StoreSetPredictorTest : public testing::Test {
+ public:
+  StoreSetPredictorTest()
+      : store(new MockInstruction),
+        storePtr(store),
+        store2(new MockInstruction),
+        store2Ptr(store2),
+        load(new MockInstruction),
+        loadPtr(load) {
+    store->setInstructionAddress(storeAddress);
+    store->setSequenceId(0);
+    store2->setInstructionAddress(store2Address);
+    store2->setSequenceId(1);
+    load->setInstructionAddress(loadAddress);
+    load->setSequenceId(2);
+  }
+
+ protected:
+  ConfigInit configInit = ConfigInit(config::ISA::AArch64, R"YAML({
+    Memory-Dependence-Predictor: {Type: Store-Set, SSIT-Size: 64,
+    LFST-Size: 8, Clear-Interval: 10}
+  })YAML");
+
+  const uint64_t storeAddress = 0x100;
+  const uint64_t store2Address = 0x104;
+  const uint64_t loadAddress = 0x108;
+
+  MockInstruction* store;
+  std::shared_ptr<Instruction> storePtr;
+  MockInstruction* store2;
+  std::shared_ptr<Instruction> store2Ptr;
+  MockInstruction* load;
+  std::shared_ptr<Instruction> loadPtr;
+};
+
+// Tests that no dependence is predicted before any violation is trained on
+TEST_F(StoreSetPredictorTest, Untrained) {
+  StoreSetPredictor predictor;
+  EXPECT_TRUE(predictor.isEnabled());
+
+  predictor.storeDispatched(storePtr);
+  EXPECT_EQ(predictor.getPredictedStore(loadPtr), nullptr);
+}
+
+// Tests that a load is predicted to depend on an in-flight store it previously
+// violated, until that store issues
+TEST_F(StoreSetPredictorTest, Trained) {
+  StoreSetPredictor predictor;
+  predictor.train(storeAddress, loadAddress);
+
+  // No dependence whilst the store isn't in-flight
+  EXPECT_EQ(predictor.getPredictedStore(loadPtr), nullptr);
+
+  predictor.storeDispatched(storePtr);
+  EXPECT_EQ(predictor.getPredictedStore(loadPtr), storePtr);
+
+  predictor.storeIssued(storePtr);
+  EXPECT_EQ(predictor.getPredictedStore(loadPtr), nullptr);
+}
+
+// Tests that no dependence is predicted on a flushed store, or on a store later
+// in the program order than the load
+TEST_F(StoreSetPredictorTest, InvalidStore) {
+  StoreSetPredictor predictor;
+  predictor.train(storeAddress, loadAddress);
+
+  store->setSequenceId(3);
+  predictor.storeDispatched(storePtr);
+  EXPECT_EQ(predictor.getPredictedStore(loadPtr), nullptr);
+
+  store->setSequenceId(0);
+  store->setFlushed();
+  EXPECT_EQ(predictor.getPredictedStore(loadPtr), nullptr);
+}
+
+// Tests that a load violating two different stores waits on the latest
+// dispatched of the two
+TEST_F(StoreSetPredictorTest, MergedStoreSets) {
+  StoreSetPredictor predictor;
+  predictor.train(storeAddress, loadAddress);
+  predictor.train(store2Address, loadAddress);
+
+  predictor.storeDispatched(storePtr);
+  EXPECT_EQ(predictor.getPredictedStore(loadPtr), storePtr);
+  predictor.storeDispatched(store2Ptr);
+  EXPECT_EQ(predictor.getPredictedStore(loadPtr), store2Ptr);
+
+  // The issue of the earlier store doesn't affect the later store's entry
+  predictor.storeIssued(storePtr);
+  EXPECT_EQ(predictor.getPredictedStore(loadPtr), store2Ptr);
+  predictor.storeIssued(store2Ptr);
+  EXPECT_EQ(predictor.getPredictedStore(loadPtr), nullptr);
+}
+
+// Tests that moving a store to a different store set forgets its in-flight
+// instance, such that no load can wait on a store which won't be released
+TEST_F(StoreSetPredictorTest, ReassignedStore) {
+  StoreSetPredictor predictor;
+  // Place the load and the store in different store sets, the load's having
+  // the smaller ID
+  predictor.train(store2Address, loadAddress);
+  predictor.train(storeAddress, 0x200);
+  predictor.storeDispatched(storePtr);
+
+  // Merge the store's set into the load's
+  predictor.train(storeAddress, loadAddress);
+  EXPECT_EQ(predictor.getPredictedStore(loadPtr), nullptr);
+
+  predictor.storeDispatched(storePtr);
+  EXPECT_EQ(predictor.getPredictedStore(loadPtr), storePtr);
+}
+
+// Tests that all learnt store sets are cleared after the clear interval
+TEST_F(StoreSetPredictorTest, ClearInterval) {
+  StoreSetPredictor predictor;
+  predictor.train(storeAddress, loadAddress);
+  predictor.storeDispatched(storePtr);
+
+  for (int i = 0; i < 9; i++) predictor.tick();
+  EXPECT_EQ(predictor.getPredictedStore(loadPtr), storePtr);
+
+  predictor.tick();
+  EXPECT_EQ(predictor.getPredictedStore(loadPtr), nullptr);
+  predictor.storeDispatched(storePtr);
+  EXPECT_EQ(predictor.getPredictedStore(loadPtr), nullptr);
+}
+
+// Tests that a disabled predictor never predicts a dependence
+TEST_F(StoreSetPredictorTest, Disabled) {
+  config::SimInfo::addToConfig("{Memory-Dependence-Predictor: {Type: None}}");
+  StoreSetPredictor predictor;
+  EXPECT_FALSE(predictor.isEnabled());
+
+  predictor.train(storeAddress, loadAddress);
+  predictor.storeDispatched(storePtr);
+  EXPECT_EQ(predictor.getPredictedStore(loadPtr), nullptr);
+}
+
+}  // namespace pipeline
+}  // namespace simeng
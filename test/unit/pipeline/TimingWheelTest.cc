@@ -0,0 +1,75 @@
+#include "gtest/gtest.h"
+#include "simeng/pipeline/TimingWheel.hh"
+
+namespace simeng {
+namespace pipeline {
+
+// Test that events only fall due once the wheel has been ticked by their delay
+TEST(TimingWheelTest, Schedule) {
+  auto wheel = TimingWheel<int>(4);
+  EXPECT_TRUE(wheel.empty());
+
+  wheel.schedule(1, 0);
+  wheel.schedule(2, 1);
+  wheel.schedule(3, 3);
+  wheel.schedule(4, 1);
+  EXPECT_FALSE(wheel.empty());
+
+  EXPECT_EQ(wheel.getDueEvents(), std::vector<int>({1}));
+  EXPECT_EQ(wheel.getEvents(1), std::vector<int>({2, 4}));
+  wheel.clearDueEvents();
+
+  wheel.tick();
+  EXPECT_EQ(wheel.getDueEvents(), std::vector<int>({2, 4}));
+  wheel.clearDueEvents();
+
+  wheel.tick();
+  EXPECT_TRUE(wheel.getDueEvents().empty());
+  wheel.tick();
+  EXPECT_EQ(wheel.getDueEvents(), std::vector<int>({3}));
+  wheel.clearDueEvents();
+  EXPECT_TRUE(wheel.empty());
+}
+
+// Test that events due but not cleared are carried over ahead of those due
+// next cycle
+TEST(TimingWheelTest, CarryOver) {
+  auto wheel = TimingWheel<int>(2);
+  wheel.schedule(1, 0);
+  wheel.schedule(2, 1);
+
+  wheel.tick();
+  EXPECT_EQ(wheel.getDueEvents(), std::vector<int>({1, 2}));
+  wheel.clearDueEvents();
+  EXPECT_TRUE(wheel.empty());
+}
+
+// Test that scheduling beyond the horizon grows the wheel without disturbing
+// already scheduled events, including after the wheel has wrapped around
+TEST(TimingWheelTest, Grow) {
+  auto wheel = TimingWheel<int>(2);
+  for (int i = 0; i < 5; i++) wheel.tick();
+
+  wheel.schedule(1, 1);
+  wheel.schedule(2, 3);
+  wheel.schedule(3, 40);
+
+  for (uint64_t cycle = 0; cycle <= 40; cycle++) {
+    const auto& due = wheel.getDueEvents();
+    if (cycle == 1) {
+      EXPECT_EQ(due, std::vector<int>({1}));
+    } else if (cycle == 3) {
+      EXPECT_EQ(due, std::vector<int>({2}));
+    } else if (cycle == 40) {
+      EXPECT_EQ(due, std::vector<int>({3}));
+    } else {
+      EXPECT_TRUE(due.empty());
+    }
+    wheel.clearDueEvents();
+    wheel.tick();
+  }
+  EXPECT_TRUE(wheel.empty());
+}
+
+}  // namespace pipeline
+}  // namespace simeng
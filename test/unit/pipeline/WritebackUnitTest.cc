@@ -3,7 +3,6 @@
 #include "gtest/gtest.h"
 #include "simeng/Instruction.hh"
 #include "simeng/RegisterFileSet.hh"
-#include "simeng/pipeline/PipelineBuffer.hh"
 #include "simeng/pipeline/WritebackUnit.hh"
 
 using ::testing::_;
@@ -18,14 +17,13 @@ namespace pipeline {
 class PipelineWritebackUnitTest : public testing::Test {
  public:
   PipelineWritebackUnitTest()
-      : input(1, {1, nullptr}),
-        registerFileSet({{8, 2}}),
+      : registerFileSet({{8, 2}}),
         uop(new MockInstruction),
         uopPtr(uop),
         writebackUnit(input, registerFileSet, [](auto insnId) {}) {}
 
  protected:
-  std::vector<PipelineBuffer<std::shared_ptr<Instruction>>> input;
+  TimingWheel<std::shared_ptr<Instruction>> input;
   RegisterFileSet registerFileSet;
 
   MockInstruction* uop;
@@ -34,9 +32,9 @@ class PipelineWritebackUnitTest : public testing::Test {
 };
 
 // Tests that a value is correctly written back, and the uop is cleared from the
-// buffer
+// timing wheel
 TEST_F(PipelineWritebackUnitTest, Tick) {
-  input[0].getHeadSlots()[0] = uopPtr;
+  input.schedule(uopPtr, 0);
   uint64_t result = 1;
   std::vector<RegisterValue> results = {result};
   std::vector<Register> destinations = {{0, 1}};
@@ -50,7 +48,30 @@ TEST_F(PipelineWritebackUnitTest, Tick) {
   writebackUnit.tick();
 
   EXPECT_EQ(registerFileSet.get(destinations[0]).get<uint64_t>(), result);
-  EXPECT_EQ(input[0].getHeadSlots()[0], nullptr);
+  EXPECT_TRUE(input.empty());
+}
+
+// Tests that a uop is only written back in the cycle it was scheduled for
+TEST_F(PipelineWritebackUnitTest, TickScheduled) {
+  input.schedule(uopPtr, 2);
+  std::vector<RegisterValue> results = {static_cast<uint64_t>(1)};
+  std::vector<Register> destinations = {{0, 1}};
+
+  EXPECT_CALL(*uop, getResults())
+      .WillOnce(Return(span<RegisterValue>(results.data(), results.size())));
+  EXPECT_CALL(*uop, getDestinationRegisters())
+      .WillOnce(
+          Return(span<Register>(destinations.data(), destinations.size())));
+
+  writebackUnit.tick();
+  input.tick();
+  writebackUnit.tick();
+  input.tick();
+  EXPECT_EQ(writebackUnit.getInstructionsWrittenCount(), 0);
+
+  writebackUnit.tick();
+  EXPECT_EQ(writebackUnit.getInstructionsWrittenCount(), 1);
+  EXPECT_TRUE(input.empty());
 }
 
 }  // namespace pipeline
@@ -1,3 +1,6 @@
+#include <chrono>
+#include <iostream>
+
 #include "../ConfigInit.hh"
 #include "arch/riscv/InstructionMetadata.hh"
 #include "gmock/gmock.h"
@@ -97,7 +100,7 @@ TEST_F(RiscVInstructionTest, validInsn) {
   std::vector<Register> destRegs = {{RegisterType::GENERAL, 13}};
   std::vector<Register> srcRegs = {{RegisterType::GENERAL, 13},
                                    {RegisterType::GENERAL, 10}};
-  const std::vector<uint16_t> ports = {1, 2, 3};
+  const PortMask ports = toPortMask({1, 2, 3});
   insn.setExecutionInfo({3, 4, ports});
   insn.setInstructionAddress(0x48);
   insn.setInstructionId(11);
@@ -158,7 +161,7 @@ TEST_F(RiscVInstructionTest, invalidInsn_1) {
   // Define instruction's registers
   std::vector<Register> destRegs = {};
   std::vector<Register> srcRegs = {};
-  const std::vector<uint16_t> ports = {};
+  const PortMask ports = 0;
   insn.setExecutionInfo({1, 1, ports});
   insn.setInstructionAddress(0x44);
   insn.setInstructionId(13);
@@ -222,7 +225,7 @@ TEST_F(RiscVInstructionTest, invalidInsn_2) {
   // Define instruction's registers
   std::vector<Register> destRegs = {};
   std::vector<Register> srcRegs = {};
-  const std::vector<uint16_t> ports = {};
+  const PortMask ports = 0;
   insn.setExecutionInfo({1, 1, ports});
   insn.setInstructionAddress(0x43);
   insn.setInstructionId(15);
@@ -608,6 +611,43 @@ TEST_F(RiscVInstructionTest, setters) {
   EXPECT_TRUE(insn.isWaitingCommit());
 }
 
+// Measure the cost of executing decoded instructions, as every core model does
+// once an instruction's operands are available. Each iteration copies the
+// decoded instruction first, as predecode does. Disabled by default; run with
+// `--gtest_also_run_disabled_tests --gtest_filter=*Benchmark*`
+class RiscVInstructionBenchmark : public RiscVInstructionTest {};
+
+TEST_F(RiscVInstructionBenchmark, DISABLED_Execute) {
+  const uint64_t iterations = 10000000;
+  // Insns are `div a3, a3, a0` and `bgeu a5, a4, -86`
+  const Instruction div(arch, *divMetadata.get());
+  const Instruction bgeu(arch, *bgeuMetadata.get());
+  RegisterValue dividend = RegisterValue(100, 8);
+  RegisterValue divisor = RegisterValue(7, 8);
+  uint64_t taken = 0;
+
+  auto start = std::chrono::steady_clock::now();
+  for (uint64_t i = 0; i < iterations; i++) {
+    Instruction divide = div;
+    divide.supplyOperand(0, dividend);
+    divide.supplyOperand(1, divisor);
+    divide.execute();
+
+    Instruction branch = bgeu;
+    branch.supplyOperand(0, dividend);
+    branch.supplyOperand(1, divisor);
+    branch.execute();
+    taken += branch.wasBranchTaken();
+  }
+  std::chrono::duration<double, std::nano> elapsed =
+      std::chrono::steady_clock::now() - start;
+
+  EXPECT_EQ(taken, iterations);
+  std::cout << "[SimEng:RiscVInstructionBenchmark] execute: "
+            << elapsed.count() / (iterations * 2) << " ns/instruction"
+            << std::endl;
+}
+
 }  // namespace riscv
 }  // namespace arch
 }  // namespace simeng
\ No newline at end of file